@@ -0,0 +1,134 @@
+/**
+ * \file helpers/agentd_session.h
+ *
+ * \brief A connected, authenticated session with agentd.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/handshake_pool.h>
+#include <rcpr/psock.h>
+#include <rcpr/status.h>
+#include <vcblockchain/entity_cert.h>
+#include <vctool/file.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief An authenticated agentd session.
+ *
+ * This bundles the values returned by \ref agentd_connection_init so that
+ * tools which juggle several connections can pass a single pointer around. A
+ * session is not synchronized; at most one thread may use it at a time.
+ */
+typedef struct agentd_session agentd_session;
+
+struct agentd_session
+{
+    RCPR_SYM(psock)* sock;
+    vcblockchain_entity_private_cert* cert;
+    vccrypt_buffer_t shared_secret;
+    uint64_t client_iv;
+    uint64_t server_iv;
+};
+
+/**
+ * \brief Connect and authenticate a session with agentd.
+ *
+ * \param session       The session to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the session owns a socket, a private certificate, and a
+ * shared secret. These must be released by calling
+ * \ref agentd_session_dispose when the session is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_init(
+    agentd_session* session, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, const char* hostaddr,
+    unsigned int hostport, const char* clientpriv, const char* serverpub);
+
+/**
+ * \brief Authenticate a session over a socket descriptor the caller opened.
+ *
+ * The session's socket wraps the descriptor, so the blocking request helpers
+ * work on it as usual, while transports that multiplex many sessions can
+ * drive the descriptor directly.
+ *
+ * \param session       The session to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param descriptor    A socket descriptor connected to agentd.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note The session takes ownership of the descriptor, even on failure. On
+ * success, it must be released by calling \ref agentd_session_dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_init_from_descriptor(
+    agentd_session* session, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, int descriptor, const char* clientpriv,
+    const char* serverpub);
+
+/**
+ * \brief Connect and authenticate a session using a handshake pool.
+ *
+ * This is \ref agentd_session_init for callers that reconnect often: the
+ * credential files are read, and the handshake request is encoded, ahead of
+ * time by the pool, so the connection waits only on the network and the
+ * server.
+ *
+ * \param session       The session to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param pool          The handshake pool for the client credential.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ *
+ * \note On success, the session must be released by calling
+ * \ref agentd_session_dispose when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_init_pooled(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    handshake_pool* pool, const char* hostaddr, unsigned int hostport);
+
+/**
+ * \brief Release the resources owned by a session.
+ *
+ * This does not send a close request; callers wanting a graceful close should
+ * call \ref send_and_verify_close_connection first.
+ *
+ * \param session       The session to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_dispose(agentd_session* session);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,49 @@
+/**
+ * \file helpers/agentd_status.h
+ *
+ * \brief Track the last status code reported by agentd on this thread.
+ *
+ * The helpers in conn_helpers.h map a non-success agentd response status to a
+ * helper error code such as ERROR_TXN_SUBMIT_STATUS, which loses the status
+ * that agentd actually reported. Before doing so, they record that status
+ * here, so that load tools can break failures down by agentd status.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Value reported by \ref agentd_status_last when agentd has not
+ * reported a failure status since the last clear.
+ */
+#define AGENTD_STATUS_NONE                                      0
+
+/**
+ * \brief Record a failure status reported by agentd on this thread.
+ *
+ * \param agentd_status The status from the agentd response header.
+ */
+void agentd_status_record(uint32_t agentd_status);
+
+/**
+ * \brief Get the last failure status reported by agentd on this thread.
+ *
+ * \returns the last recorded status, or AGENTD_STATUS_NONE.
+ */
+uint32_t agentd_status_last(void);
+
+/**
+ * \brief Clear the last failure status reported by agentd on this thread.
+ */
+void agentd_status_clear(void);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
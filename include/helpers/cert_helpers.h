@@ -88,6 +88,40 @@ status create_transaction_cert(
     const RCPR_SYM(rcpr_uuid)* signer_id,
     const vccrypt_buffer_t* client_privkey);
 
+/**
+ * \brief Create a transaction certificate suitable for testing, carrying the
+ * given payload in its custom field.
+ *
+ * A short field holds at most 64 KiB, so a larger payload is split across
+ * consecutive custom fields.
+ *
+ * \param cert_buffer       Pointer to an uninitialized certificate buffer that
+ *                          is initialized with the contents of this certificate
+ *                          on success.
+ * \param txn_uuid          Pointer to a uuid field that is populated with the
+ *                          transaction uuid on success.
+ * \param artifact_uuid     Pointer to a uuid field that is populated with the
+ *                          artifact uuid on success.
+ * \param builder_opts      Certificate builder options for this operation.
+ * \param client_id         ID of the client signing this certificate.
+ * \param client_privkey    Private signing key of the client.
+ * \param payload           The payload.
+ * \param payload_size      The size of the payload, which may be zero.
+ *
+ * \note On success, the caller owns the cert_buffer and must dispose it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status create_transaction_cert_with_payload(
+    vccrypt_buffer_t* cert_buffer, RCPR_SYM(rcpr_uuid)* txn_uuid,
+    RCPR_SYM(rcpr_uuid)* artifact_uuid, vccert_builder_options_t* builder_opts,
+    const RCPR_SYM(rcpr_uuid)* signer_id,
+    const vccrypt_buffer_t* client_privkey, const uint8_t* payload,
+    size_t payload_size);
+
 /**
  * \brief Create the next transaction cert for an artifact.
  *
@@ -0,0 +1,159 @@
+/**
+ * \file helpers/chain_archive.h
+ *
+ * \brief A local block archive with per-segment Bloom filters for finding
+ * the block that holds a transaction.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/chain_export.h>
+#include <helpers/uuid_column.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief An index over exported records that answers which block holds a
+ * transaction.
+ *
+ * The records are ordered by block height and split into segments of
+ * segment_blocks consecutive heights. Each segment carries a Bloom filter
+ * over its transaction IDs, so that a lookup only scans the segments whose
+ * filter may hold the ID: the one that does, plus the occasional false
+ * positive. A missing ID usually scans no segment at all.
+ *
+ * The archive refers to the records it was built from, which must outlive
+ * it. Once created, it is read only, so any number of threads may look up
+ * transactions at once.
+ */
+typedef struct chain_archive chain_archive;
+
+/**
+ * \brief Options for building an archive.
+ *
+ * Each filter has at least bits_per_txn bits for each transaction of its
+ * segment, rounded up to a power of two, and sets hash_count bits per
+ * transaction. Every lookup tests every segment, so false positives cost
+ * about their rate times the whole archive in scanned rows; the defaults of
+ * 16 bits and 11 hashes keep the rate near 0.05% per segment. impl selects
+ * the \ref uuid_column_impl used to scan a segment.
+ */
+typedef struct chain_archive_options chain_archive_options;
+
+struct chain_archive_options
+{
+    size_t segment_blocks;
+    size_t bits_per_txn;
+    size_t hash_count;
+    uuid_column_impl impl;
+};
+
+/**
+ * \brief The shape of an archive.
+ */
+typedef struct chain_archive_info chain_archive_info;
+
+struct chain_archive_info
+{
+    size_t row_count;
+    size_t segment_count;
+    size_t filter_bytes;
+};
+
+/**
+ * \brief Counters describing the work done by lookups.
+ *
+ * segments_scanned counts the segments whose filter matched and which were
+ * therefore scanned; false_positives counts those that did not hold the ID
+ * after all. rows_compared counts the transaction IDs compared while
+ * scanning.
+ */
+typedef struct chain_archive_stats chain_archive_stats;
+
+struct chain_archive_stats
+{
+    uint64_t lookups;
+    uint64_t found;
+    uint64_t segments_scanned;
+    uint64_t false_positives;
+    uint64_t rows_compared;
+};
+
+/**
+ * \brief Initialize archive options with their defaults.
+ *
+ * The defaults make segments of 64 blocks, with filters of 16 bits and 11
+ * hashes per transaction, scanned with the fastest supported UUID kernels.
+ *
+ * \param opts          The options to initialize.
+ */
+void chain_archive_options_init(chain_archive_options* opts);
+
+/**
+ * \brief Build an archive over exported records.
+ *
+ * \param archive       Pointer to the archive pointer to receive the archive
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param records       The records to index, in any block order.
+ * \param count         The number of records.
+ * \param opts          The archive options.
+ *
+ * \note On success, the caller owns the archive and must release it by
+ * calling \ref chain_archive_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY if the index could not be
+ *        allocated.
+ */
+status chain_archive_create(
+    chain_archive** archive, RCPR_SYM(allocator)* alloc,
+    const chain_export_record* records, size_t count,
+    const chain_archive_options* opts);
+
+/**
+ * \brief Release an archive.
+ *
+ * \param archive       The archive to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_archive_release(chain_archive* archive);
+
+/**
+ * \brief Find the record of a transaction.
+ *
+ * \param archive       The archive.
+ * \param txn_id        The 16-byte transaction ID to find.
+ * \param stats         Counters to add this lookup to, or NULL.
+ *
+ * \returns the record of the transaction, which holds its block ID and
+ * height, or NULL if the archive does not hold it.
+ */
+const chain_export_record* chain_archive_find(
+    const chain_archive* archive, const uint8_t* txn_id,
+    chain_archive_stats* stats);
+
+/**
+ * \brief Get the shape of an archive.
+ *
+ * \param archive       The archive.
+ * \param info          The info to populate.
+ */
+void chain_archive_get_info(
+    const chain_archive* archive, chain_archive_info* info);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,154 @@
+/**
+ * \file helpers/chain_block.h
+ *
+ * \brief Helpers for fetching, parsing, and verifying blocks in chain scans.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdint.h>
+#include <vccert/parser.h>
+#include <vccrypt/buffer.h>
+#include <vpr/uuid.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A transaction certificate wrapped in a block.
+ *
+ * The certificate points into the block certificate that holds it.
+ */
+typedef struct chain_block_txn chain_block_txn;
+
+struct chain_block_txn
+{
+    const uint8_t* cert;
+    size_t size;
+};
+
+/**
+ * \brief A block fetched from agentd.
+ *
+ * \ref chain_block_fetch populates the ids and the certificate;
+ * \ref chain_block_parse populates the transaction list.
+ */
+typedef struct chain_block chain_block;
+
+struct chain_block
+{
+    uint64_t height;
+    vpr_uuid block_id;
+    vpr_uuid prev_id;
+    vpr_uuid next_id;
+    vccrypt_buffer_t cert;
+    size_t txn_count;
+    chain_block_txn* txns;
+};
+
+/**
+ * \brief The fields of a verified transaction.
+ *
+ * artifact_type and signer_id are zero if the transaction does not carry
+ * them.
+ */
+typedef struct chain_block_txn_info chain_block_txn_info;
+
+struct chain_block_txn_info
+{
+    vpr_uuid txn_id;
+    vpr_uuid prev_txn_id;
+    vpr_uuid artifact_id;
+    vpr_uuid cert_type;
+    vpr_uuid artifact_type;
+    vpr_uuid signer_id;
+};
+
+/**
+ * \brief Fetch the block at the given height.
+ *
+ * \param block         The block to populate. On success, the caller must
+ *                      release it by calling \ref chain_block_dispose.
+ * \param session       The session on which the block is fetched.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param height        The height of the block.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_fetch(
+    chain_block* block, agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, uint64_t height);
+
+/**
+ * \brief Build the list of transactions wrapped in a fetched block.
+ *
+ * \param block         The block to parse.
+ * \param alloc         The allocator to use for this operation.
+ * \param parser_opts   The parser options to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_parse(
+    chain_block* block, RCPR_SYM(allocator)* alloc,
+    vccert_parser_options_t* parser_opts);
+
+/**
+ * \brief Verify a transaction wrapped in a block.
+ *
+ * The transaction certificate must parse, and must carry a transaction id,
+ * previous transaction id, artifact id, and certificate type. The artifact
+ * type and signer id are read if present. Its digest is computed with the
+ * suite hash, which is the per-transaction cost of a full verification.
+ * Signatures are not attested, since that needs the signing entities'
+ * public certificates.
+ *
+ * \param info          The structure to receive the transaction fields.
+ * \param txn           The transaction to verify.
+ * \param parser_opts   The parser options to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_verify_txn(
+    chain_block_txn_info* info, const chain_block_txn* txn,
+    vccert_parser_options_t* parser_opts, vccrypt_suite_options_t* suite);
+
+/**
+ * \brief Read the height of a block from its certificate.
+ *
+ * \param height        Pointer to receive the height.
+ * \param cert          The block certificate.
+ * \param parser_opts   The parser options to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_height(
+    uint64_t* height, const vccrypt_buffer_t* cert,
+    vccert_parser_options_t* parser_opts);
+
+/**
+ * \brief Release a block.
+ *
+ * \param block         The block to release.
+ * \param alloc         The allocator used to parse the block.
+ */
+void chain_block_dispose(chain_block* block, RCPR_SYM(allocator)* alloc);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,180 @@
+/**
+ * \file helpers/chain_export.h
+ *
+ * \brief A flat file of transaction records exported from the chain.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The magic bytes at the start of an export file.
+ */
+#define CHAIN_EXPORT_MAGIC                                      "VCEXPRT1"
+
+/**
+ * \brief The current export file version.
+ */
+#define CHAIN_EXPORT_VERSION                                    2
+
+/**
+ * \brief The header of an export file.
+ *
+ * record_count is written when the file is closed, so a file that was not
+ * closed cleanly has a count that does not match its size, and is rejected
+ * by the reader.
+ */
+typedef struct chain_export_header chain_export_header;
+
+struct chain_export_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t record_count;
+};
+
+/**
+ * \brief One exported transaction.
+ *
+ * Records are fixed size and in host byte order, so that an export file can
+ * be mapped and scanned in place. Records of a block are contiguous and in
+ * block order, but blocks may appear in any order. artifact_type and
+ * signer_id are zero for transactions that do not carry them.
+ *
+ * Version 2 added cert_type, artifact_type and signer_id.
+ */
+typedef struct chain_export_record chain_export_record;
+
+struct chain_export_record
+{
+    uint8_t txn_id[16];
+    uint8_t prev_txn_id[16];
+    uint8_t artifact_id[16];
+    uint8_t block_id[16];
+    uint8_t cert_type[16];
+    uint8_t artifact_type[16];
+    uint8_t signer_id[16];
+    uint64_t block_height;
+    uint32_t txn_index;
+    uint32_t txn_size;
+};
+
+/**
+ * \brief A writer for an export file.
+ */
+typedef struct chain_export_writer chain_export_writer;
+
+/**
+ * \brief A reader for an export file, which maps the file in place.
+ */
+typedef struct chain_export_reader chain_export_reader;
+
+/**
+ * \brief Create an export file, replacing any existing file.
+ *
+ * \param writer        Pointer to the writer pointer to receive the writer
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param path          The path of the file to create.
+ *
+ * \note On success, the caller owns the writer and must release it by calling
+ * \ref chain_export_writer_release, which completes the file.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_writer_create(
+    chain_export_writer** writer, RCPR_SYM(allocator)* alloc,
+    const char* path);
+
+/**
+ * \brief Append records to an export file.
+ *
+ * \param writer        The writer.
+ * \param records       The records to append.
+ * \param count         The number of records.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_writer_append(
+    chain_export_writer* writer, const chain_export_record* records,
+    size_t count);
+
+/**
+ * \brief Write the record count to the header, close the file and release
+ * the writer.
+ *
+ * \param writer        The writer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_writer_release(chain_export_writer* writer);
+
+/**
+ * \brief Map an export file for reading.
+ *
+ * The file must match this version and record size, and must have been
+ * closed cleanly: its header count must account for exactly the records
+ * that follow the header.
+ *
+ * \param reader        Pointer to the reader pointer to receive the reader
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param path          The path of the file to read.
+ *
+ * \note On success, the caller owns the reader and must release it by calling
+ * \ref chain_export_reader_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_EXPORT_OPEN if the file could not be opened or mapped.
+ *      - ERROR_CHAIN_EXPORT_FORMAT if the file is not a complete export of
+ *        this version, including one that was not closed cleanly.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_reader_create(
+    chain_export_reader** reader, RCPR_SYM(allocator)* alloc,
+    const char* path);
+
+/**
+ * \brief Get the records of a mapped export file.
+ *
+ * \param reader        The reader.
+ * \param records       Pointer to receive the records, which stay valid
+ *                      until the reader is released.
+ * \param count         Pointer to receive the number of records.
+ */
+void chain_export_reader_records(
+    chain_export_reader* reader, const chain_export_record** records,
+    size_t* count);
+
+/**
+ * \brief Unmap an export file and release the reader.
+ *
+ * \param reader        The reader to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_reader_release(chain_export_reader* reader);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,222 @@
+/**
+ * \file helpers/chain_nav.h
+ *
+ * \brief Chain navigation with speculative prefetch of the next record.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/read_request.h>
+#include <helpers/session_pool.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A navigation layer that answers predictable reads ahead of time.
+ *
+ * Clients walking the chain issue reads in a fixed rhythm: the next block id,
+ * then that block, then the next block id again; or a transaction, then the
+ * transaction after it. After each read, the layer predicts the read that
+ * usually follows and queues it for a prefetch thread, so that by the time
+ * the client asks, the answer is already on hand. Some predictions need no
+ * wire request at all: a block or transaction carries the id of its
+ * successor, which is the answer to the next id query that usually follows.
+ *
+ * Each prediction rule is scored by how many of its predictions were used
+ * before being discarded. A rule whose accuracy falls below the configured
+ * minimum stops prefetching, apart from an occasional probe so that it can
+ * recover when the access pattern changes. Random access therefore costs
+ * little more than reading from the session pool directly.
+ *
+ * Only records by id are predicted, and ids that mark the end of a chain are
+ * never prefetched. A prefetched record that goes unused for max_age_ns is
+ * discarded, which bounds how stale a prefetched transaction's successor
+ * link can be.
+ *
+ * Any number of threads may call \ref chain_nav_read concurrently, though
+ * prediction works best when each walk stays on one thread.
+ */
+typedef struct chain_nav chain_nav;
+
+/**
+ * \brief The prediction rules, named for the read that triggers them and the
+ * read they predict.
+ */
+typedef enum chain_nav_rule
+{
+    CHAIN_NAV_RULE_NEXT_BLOCK_ID_TO_BLOCK,
+    CHAIN_NAV_RULE_BLOCK_TO_NEXT_BLOCK_ID,
+    CHAIN_NAV_RULE_BLOCK_TO_NEXT_BLOCK,
+    CHAIN_NAV_RULE_NEXT_TXN_ID_TO_TXN,
+    CHAIN_NAV_RULE_TXN_TO_NEXT_TXN_ID,
+    CHAIN_NAV_RULE_TXN_TO_NEXT_TXN,
+    CHAIN_NAV_RULE_COUNT,
+} chain_nav_rule;
+
+/**
+ * \brief Options for creating a navigation layer.
+ *
+ * cache_capacity bounds the predictions held at once, whether queued, in
+ * flight, or ready. A rule is scored once warmup of its predictions have been
+ * settled, and is disabled while fewer than min_accuracy_percent of them are
+ * used; a disabled rule still fires once every probe_interval opportunities.
+ */
+typedef struct chain_nav_options chain_nav_options;
+
+struct chain_nav_options
+{
+    size_t cache_capacity;
+    size_t prefetch_threads;
+    uint64_t max_age_ns;
+    size_t warmup;
+    size_t min_accuracy_percent;
+    size_t probe_interval;
+};
+
+/**
+ * \brief Counters for one prediction rule.
+ */
+typedef struct chain_nav_rule_stats chain_nav_rule_stats;
+
+struct chain_nav_rule_stats
+{
+    uint64_t predictions;
+    uint64_t used;
+    uint64_t wasted;
+    bool enabled;
+};
+
+/**
+ * \brief Counters describing the work done by a navigation layer.
+ *
+ * Every call to \ref chain_nav_read is counted once as a hit, answered from
+ * a ready prediction; a late hit, answered by a prefetch still in flight;
+ * or a miss, read from the session pool. Of the predictions made, derived
+ * ones were answered from a record already read, and prefetches were read
+ * from the pool by a prefetch thread. used and wasted count predictions
+ * that were matched by a request or discarded without one, so the
+ * prefetch accuracy is used / (used + wasted).
+ */
+typedef struct chain_nav_stats chain_nav_stats;
+
+struct chain_nav_stats
+{
+    uint64_t requests;
+    uint64_t hits;
+    uint64_t late_hits;
+    uint64_t misses;
+    uint64_t predictions;
+    uint64_t derived;
+    uint64_t prefetches;
+    uint64_t prefetch_failures;
+    uint64_t used;
+    uint64_t wasted;
+    chain_nav_rule_stats rules[CHAIN_NAV_RULE_COUNT];
+};
+
+/**
+ * \brief Initialize navigation options with their defaults.
+ *
+ * The defaults hold 16 predictions, prefetch on one thread, discard
+ * predictions after a second, and disable a rule once fewer than half of 16
+ * settled predictions were used.
+ *
+ * \param opts          The options to initialize.
+ */
+void chain_nav_options_init(chain_nav_options* opts);
+
+/**
+ * \brief Create a navigation layer over a session pool.
+ *
+ * \param nav           Pointer to the navigation layer pointer to receive the
+ *                      layer on success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param pool          The session pool to read from, which must outlive the
+ *                      layer.
+ * \param opts          The navigation options.
+ *
+ * \note On success, the caller owns the layer and must release it by calling
+ * \ref chain_nav_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_NAV_SETUP if the options are invalid or a prefetch
+ *        thread could not be started.
+ *      - ERROR_CHAIN_NAV_OUT_OF_MEMORY if the layer could not be allocated.
+ */
+status chain_nav_create(
+    chain_nav** nav, RCPR_SYM(allocator)* alloc, session_pool* pool,
+    const chain_nav_options* opts);
+
+/**
+ * \brief Release a navigation layer, discarding any pending predictions.
+ *
+ * No read may be in progress.
+ *
+ * \param nav           The navigation layer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_nav_release(chain_nav* nav);
+
+/**
+ * \brief Execute a read request, answering it from a prediction if one
+ * matches.
+ *
+ * A failed prefetch is never returned; the request is read again instead,
+ * so errors and agentd status are reported as by \ref session_pool_read.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_nav_read(
+    chain_nav* nav, const read_request* req, read_result* result);
+
+/**
+ * \brief Get a snapshot of the layer counters.
+ *
+ * \param nav           The navigation layer.
+ * \param stats         The structure to receive the counters.
+ */
+void chain_nav_get_stats(chain_nav* nav, chain_nav_stats* stats);
+
+/**
+ * \brief Reset the layer counters.
+ *
+ * Rule scores are kept, so disabled rules stay disabled.
+ *
+ * \param nav           The navigation layer.
+ */
+void chain_nav_reset_stats(chain_nav* nav);
+
+/**
+ * \brief Get a short name for a prediction rule.
+ *
+ * \param rule          The rule.
+ *
+ * \returns a static string naming the rule.
+ */
+const char* chain_nav_rule_name(chain_nav_rule rule);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,207 @@
+/**
+ * \file helpers/chain_query.h
+ *
+ * \brief Parallel columnar queries over exported transaction records.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/chain_export.h>
+#include <helpers/uuid_column.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The number of rows a query worker claims at a time.
+ */
+#define CHAIN_QUERY_CHUNK_ROWS                               4096
+
+/**
+ * \brief Exported transaction records, decoded into one column per field.
+ *
+ * The UUID columns are flat arrays of \ref UUID_COLUMN_ENTRY_SIZE byte
+ * entries, as taken by the \ref uuid_column_filter kernels. Row i of every
+ * column describes the same transaction. A table is read only once it is
+ * initialized, so any number of queries may run over it at once.
+ */
+typedef struct chain_query_table chain_query_table;
+
+struct chain_query_table
+{
+    size_t row_count;
+    uint64_t* block_height;
+    uint8_t* txn_id;
+    uint8_t* block_id;
+    uint8_t* artifact_id;
+    uint8_t* artifact_type;
+    uint8_t* cert_type;
+    uint8_t* signer_id;
+    void* data;
+};
+
+/**
+ * \brief The fields a predicate tests, as bits of its fields member.
+ */
+typedef enum chain_query_field
+{
+    CHAIN_QUERY_FIELD_ARTIFACT_ID = 1 << 0,
+    CHAIN_QUERY_FIELD_ARTIFACT_TYPE = 1 << 1,
+    CHAIN_QUERY_FIELD_CERT_TYPE = 1 << 2,
+    CHAIN_QUERY_FIELD_SIGNER_ID = 1 << 3,
+    CHAIN_QUERY_FIELD_HEIGHT = 1 << 4,
+} chain_query_field;
+
+/**
+ * \brief The rows a query selects.
+ *
+ * A row matches when every field named in fields matches: the UUID fields
+ * by equality, and the block height when it lies in height_min to
+ * height_max inclusive. A predicate with no fields matches every row.
+ */
+typedef struct chain_query_predicate chain_query_predicate;
+
+struct chain_query_predicate
+{
+    unsigned int fields;
+    uint8_t artifact_id[16];
+    uint8_t artifact_type[16];
+    uint8_t cert_type[16];
+    uint8_t signer_id[16];
+    uint64_t height_min;
+    uint64_t height_max;
+};
+
+/**
+ * \brief Called for each matching row of a query.
+ *
+ * \param context       The context from the query options.
+ * \param table         The table being queried.
+ * \param row           The index of the matching row.
+ */
+typedef void (*chain_query_visit_fn)(
+    void* context, const chain_query_table* table, size_t row);
+
+/**
+ * \brief Options for running a query.
+ *
+ * threads is the number of threads scanning the table, including the
+ * caller's. impl selects the \ref uuid_column_impl used for the UUID fields.
+ * If visit is set, it is called for each matching row, concurrently from
+ * every scanning thread and in no particular order.
+ */
+typedef struct chain_query_options chain_query_options;
+
+struct chain_query_options
+{
+    size_t threads;
+    uuid_column_impl impl;
+    chain_query_visit_fn visit;
+    void* context;
+};
+
+/**
+ * \brief The outcome of a query.
+ */
+typedef struct chain_query_result chain_query_result;
+
+struct chain_query_result
+{
+    uint64_t rows_scanned;
+    uint64_t rows_matched;
+    uint64_t elapsed_ns;
+};
+
+/**
+ * \brief Decode exported records into a columnar table.
+ *
+ * \param table         The table to initialize. On success, the caller must
+ *                      release it by calling \ref chain_query_table_dispose.
+ * \param alloc         The allocator to use for this operation.
+ * \param records       The records to decode.
+ * \param count         The number of records.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_QUERY_OUT_OF_MEMORY if the columns could not be
+ *        allocated.
+ */
+status chain_query_table_init(
+    chain_query_table* table, RCPR_SYM(allocator)* alloc,
+    const chain_export_record* records, size_t count);
+
+/**
+ * \brief Release the columns of a table.
+ *
+ * \param table         The table to release.
+ * \param alloc         The allocator used to initialize the table.
+ */
+void chain_query_table_dispose(
+    chain_query_table* table, RCPR_SYM(allocator)* alloc);
+
+/**
+ * \brief Initialize a predicate that matches every row.
+ *
+ * \param pred          The predicate to initialize.
+ */
+void chain_query_predicate_init(chain_query_predicate* pred);
+
+/**
+ * \brief Test a single exported record against a predicate.
+ *
+ * This is the row-at-a-time form of the test that \ref chain_query_run
+ * applies to whole columns.
+ *
+ * \param pred          The predicate.
+ * \param record        The record to test.
+ *
+ * \returns true if the record matches.
+ */
+bool chain_query_predicate_match(
+    const chain_query_predicate* pred, const chain_export_record* record);
+
+/**
+ * \brief Initialize query options with their defaults.
+ *
+ * The defaults scan on four threads with the fastest supported UUID kernels
+ * and visit no rows.
+ *
+ * \param opts          The options to initialize.
+ */
+void chain_query_options_init(chain_query_options* opts);
+
+/**
+ * \brief Run a query over a table.
+ *
+ * The table is split into chunks of \ref CHAIN_QUERY_CHUNK_ROWS rows, which
+ * the scanning threads claim in turn. Each chunk is filtered one column at a
+ * time into a row mask, so each predicate field touches only its own column.
+ *
+ * \param table         The table to query.
+ * \param alloc         The allocator to use for this operation.
+ * \param pred          The predicate selecting rows.
+ * \param opts          The query options.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_QUERY_OUT_OF_MEMORY if the scan could not be set up.
+ *      - ERROR_CHAIN_QUERY_THREAD_CREATE if a scanning thread could not be
+ *        started.
+ */
+status chain_query_run(
+    const chain_query_table* table, RCPR_SYM(allocator)* alloc,
+    const chain_query_predicate* pred, const chain_query_options* opts,
+    chain_query_result* result);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,73 @@
+/**
+ * \file helpers/chain_seed.h
+ *
+ * \brief Helpers for seeding a test chain with transactions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <rcpr/status.h>
+#include <vccert/builder.h>
+#include <vpr/uuid.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Submit a number of test transactions on the given session.
+ *
+ * Each transaction creates a new artifact and is signed by the session's
+ * private certificate.
+ *
+ * \param session       The session on which the transactions are submitted.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param builder_opts  Certificate builder options for this operation.
+ * \param count         The number of transactions to submit.
+ * \param txn_ids       Array of count uuids to receive the transaction ids, or
+ *                      NULL.
+ * \param artifact_ids  Array of count uuids to receive the artifact ids, or
+ *                      NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_seed_transactions(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts,
+    size_t count, vpr_uuid* txn_ids, vpr_uuid* artifact_ids);
+
+/**
+ * \brief Wait until the given transaction has been canonized into a block.
+ *
+ * The transaction's block id is polled every poll_interval_ms milliseconds.
+ *
+ * \param session           The session used to poll agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param txn_id            The transaction to wait for.
+ * \param poll_interval_ms  The polling interval, in milliseconds.
+ * \param timeout_ms        The maximum time to wait, in milliseconds.
+ * \param block_id          The uuid to receive the block id on success, or
+ *                          NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_SEED_CANONIZATION_TIMEOUT if the transaction was not
+ *        canonized in time.
+ *      - a non-zero error code on failure.
+ */
+status chain_wait_for_transaction(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const vpr_uuid* txn_id,
+    unsigned int poll_interval_ms, unsigned int timeout_ms,
+    vpr_uuid* block_id);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
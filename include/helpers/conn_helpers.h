@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <helpers/zerocopy_sender.h>
 #include <rcpr/psock.h>
 #include <rcpr/status.h>
 #include <vcblockchain/entity_cert.h>
@@ -64,6 +65,95 @@ status agentd_connection_init(
     vccrypt_suite_options_t* suite, const char* hostaddr, unsigned int hostport,
     const char* clientpriv, const char* serverpub);
 
+/**
+ * \brief Perform the agentd handshake over an already connected socket.
+ *
+ * This method initializes and returns a shared secret, client_iv, server_iv,
+ * and entity private certificate on success, exactly as
+ * \ref agentd_connection_init does, but leaves the socket to the caller. This
+ * lets callers that own the socket descriptor, such as transports that drive
+ * many sockets from one event loop, authenticate it with the blocking path.
+ * The socket is not released on failure.
+ *
+ * \param sock          The socket connection to agentd.
+ * \param alloc         The allocator to use for this operation.
+ * \param cert          Pointer to the entity private certificate pointer that
+ *                      will receive the client private entity certificate on
+ *                      success.
+ * \param shared_secret Pointer to a vccrypt buffer that will be initialized on
+ *                      success with the shared secret for this session.
+ * \param client_iv     Pointer to the uint64_t value that will be updated with
+ *                      the client_iv on success.
+ * \param server_iv     Pointer to the uint64_t value that will be updated with
+ *                      the server_iv on success.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_connection_handshake(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vcblockchain_entity_private_cert** cert, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv, file* file,
+    vccrypt_suite_options_t* suite, const char* clientpriv,
+    const char* serverpub);
+
+/**
+ * \brief Complete an agentd handshake once its request has been sent.
+ *
+ * This receives and verifies the handshake response, derives the shared
+ * secret, and sends and verifies the handshake acknowledgement. It is the
+ * part of the handshake that depends on the server; everything before it
+ * depends only on the client's credentials.
+ *
+ * \param sock              The socket connection to agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param server_id         The expected server artifact id.
+ * \param server_pubkey     The expected server public encryption key.
+ * \param client_privkey    The client private encryption key.
+ * \param key_nonce         The key nonce sent in the handshake request.
+ * \param challenge_nonce   The challenge nonce sent in the handshake request.
+ * \param shared_secret     Pointer to a vccrypt buffer that will be
+ *                          initialized on success with the shared secret for
+ *                          this session.
+ * \param client_iv         Pointer to the uint64_t value that will be updated
+ *                          with the client_iv on success.
+ * \param server_iv         Pointer to the uint64_t value that will be updated
+ *                          with the server_iv on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_connection_handshake_finish(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const RCPR_SYM(rcpr_uuid)* server_id,
+    const vccrypt_buffer_t* server_pubkey,
+    const vccrypt_buffer_t* client_privkey, const vccrypt_buffer_t* key_nonce,
+    const vccrypt_buffer_t* challenge_nonce, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv);
+
+/**
+ * \brief Open a TCP connection to agentd and return its raw descriptor.
+ *
+ * \param descriptor    Pointer to receive the connected descriptor on
+ *                      success, which the caller must close.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_AGENTD_SOCKET_CONNECT if the connection failed.
+ */
+status agentd_socket_connect(
+    int* descriptor, const char* hostaddr, unsigned int hostport);
+
 /**
  * \brief Submit and verify the response from submitting a transaction.
  *
@@ -393,6 +483,70 @@ status send_and_verify_ping_request(
     vccrypt_buffer_t* shared_secret, uint32_t offset,
     const vpr_uuid* ping_sentinel_id, size_t payload_size);
 
+/**
+ * \brief Send an extended api ping protocol request through a zero-copy
+ * sender and verify the response.
+ *
+ * The request is encrypted into a frame allocated with alloc, which is handed
+ * to the sender; the sender's release callback must reclaim it with alloc.
+ * The response is read from sock, which must wrap the sender's socket.
+ *
+ * \param sender            The zero-copy sender for the connection.
+ * \param sock              The socket connection with agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param client_iv         The client-side initialization vector counter.
+ * \param server_iv         The server-side initialization vector counter.
+ * \param shared_secret     The computed shared secret for this session.
+ * \param offset            The offset to use for this request.
+ * \param ping_sentinel_id  The UUID of the ping sentinel.
+ * \param payload_size      The size of the payload to send.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status send_and_verify_ping_request_zerocopy(
+    zerocopy_sender* sender, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* alloc, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, uint64_t* server_iv, vccrypt_buffer_t* shared_secret,
+    uint32_t offset, const vpr_uuid* ping_sentinel_id, size_t payload_size);
+
+/**
+ * \brief Receive and verify the response to an extended api ping request.
+ *
+ * \param sock              The socket connection with agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param server_iv         The server-side initialization vector counter.
+ * \param shared_secret     The computed shared secret for this session.
+ * \param offset            The offset used for the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status recv_and_verify_ping_response(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    vccrypt_buffer_t* shared_secret, uint32_t offset);
+
+/**
+ * \brief Verify a decrypted response to an extended api ping request.
+ *
+ * \param suite             The crypto suite to use for this operation.
+ * \param response          The decrypted response, which remains owned by
+ *                          the caller.
+ * \param offset            The offset used for the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status verify_ping_response(
+    vccrypt_suite_options_t* suite, vccrypt_buffer_t* response,
+    uint32_t offset);
+
 /**
  * \brief Get and verify the connection status.
  *
@@ -0,0 +1,64 @@
+/**
+ * \file helpers/env_helpers.h
+ *
+ * \brief Helpers for reading tool settings from the environment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Read a size value from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The value to use if the variable is unset or invalid.
+ *
+ * \returns the size from the environment, or the default value.
+ */
+size_t env_get_size(const char* name, size_t default_value);
+
+/**
+ * \brief Read a floating point value from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The value to use if the variable is unset or invalid.
+ *
+ * \returns the value from the environment, or the default value.
+ */
+double env_get_double(const char* name, double default_value);
+
+/**
+ * \brief Read a string value from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The value to use if the variable is unset or empty.
+ *
+ * \returns the string from the environment, or the default value.
+ */
+const char* env_get_string(const char* name, const char* default_value);
+
+/**
+ * \brief Read a UUID value from the environment.
+ *
+ * The value is written in the usual 8-4-4-4-12 hex form.
+ *
+ * \param name          The name of the environment variable.
+ * \param value         The 16 bytes to receive the UUID; left unchanged if
+ *                      the variable is unset or invalid.
+ *
+ * \returns true if a UUID was read from the environment.
+ */
+bool env_get_uuid(const char* name, uint8_t* value);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,34 @@
+/**
+ * \file helpers/error_class.h
+ *
+ * \brief Classification of helper status codes.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/status.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Determine whether a helper status code is a transport error.
+ *
+ * A transport error means that a request could not be written or a response
+ * could not be read. After such an error, the client and server IVs of the
+ * session can no longer be trusted to be in sync, so the session must be
+ * discarded. All other helper errors leave the session usable.
+ *
+ * \param code          The helper status code to classify.
+ *
+ * \returns true if this is a transport error and false otherwise.
+ */
+bool status_is_transport_error(status code);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
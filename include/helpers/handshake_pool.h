@@ -0,0 +1,162 @@
+/**
+ * \file helpers/handshake_pool.h
+ *
+ * \brief A pool of precomputed client handshake material.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/allocator.h>
+#include <rcpr/psock.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vcblockchain/entity_cert.h>
+#include <vctool/file.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A pool of precomputed client handshake material for one credential.
+ *
+ * Before a handshake reaches the network, \ref agentd_connection_handshake
+ * loads the client and server certificates from disk, draws a key nonce and
+ * a challenge nonce from the PRNG, and encodes the handshake request. None
+ * of that depends on the server. The pool does this ahead of time on a
+ * refill thread, keeping up to capacity entries ready, each holding a
+ * freshly loaded client certificate, its two nonces, and the encoded
+ * request. The server certificate is loaded once, when the pool is created.
+ *
+ * A pooled handshake takes an entry, writes its request, and then only waits
+ * on the server and derives the shared secret. Each entry is used for
+ * exactly one handshake, since nonces must never be reused. If the pool is
+ * empty, the entry is computed inline, as the unpooled handshake would.
+ *
+ * The pool is synchronized, so threads may share it.
+ */
+typedef struct handshake_pool handshake_pool;
+
+/**
+ * \brief Options for creating a handshake pool.
+ */
+typedef struct handshake_pool_options handshake_pool_options;
+
+struct handshake_pool_options
+{
+    size_t capacity;
+};
+
+/**
+ * \brief Counters describing the use of a handshake pool.
+ *
+ * hits counts handshakes served from a ready entry, and misses those that
+ * computed their entry inline. produce_ns is the time the refill thread
+ * spent computing entries.
+ */
+typedef struct handshake_pool_stats handshake_pool_stats;
+
+struct handshake_pool_stats
+{
+    uint64_t produced;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t produce_ns;
+    size_t available;
+};
+
+/**
+ * \brief Initialize handshake pool options with their defaults.
+ *
+ * The default keeps four entries ready.
+ *
+ * \param opts          The options to initialize.
+ */
+void handshake_pool_options_init(handshake_pool_options* opts);
+
+/**
+ * \brief Create a handshake pool for a client credential.
+ *
+ * The server certificate and one entry are loaded before this returns, so
+ * bad credentials are reported here rather than on the first handshake. The
+ * refill thread then fills the rest of the pool.
+ *
+ * \param pool          Pointer to the pool pointer to receive the pool on
+ *                      success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param file          The OS file abstraction to use for this operation,
+ *                      which must outlive the pool.
+ * \param suite         The crypto suite to use for this operation, which
+ *                      must outlive the pool.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ * \param opts          The pool options.
+ *
+ * \note On success, the caller owns the pool and must release it by calling
+ * \ref handshake_pool_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_create(
+    handshake_pool** pool, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, const char* clientpriv,
+    const char* serverpub, const handshake_pool_options* opts);
+
+/**
+ * \brief Perform the agentd handshake with precomputed material.
+ *
+ * This returns the same values as \ref agentd_connection_handshake, and
+ * likewise leaves the socket to the caller.
+ *
+ * \param pool          The handshake pool.
+ * \param sock          The socket connection to agentd.
+ * \param alloc         The allocator to use for this operation.
+ * \param cert          Pointer to the entity private certificate pointer that
+ *                      will receive the client private entity certificate on
+ *                      success.
+ * \param shared_secret Pointer to a vccrypt buffer that will be initialized on
+ *                      success with the shared secret for this session.
+ * \param client_iv     Pointer to the uint64_t value that will be updated with
+ *                      the client_iv on success.
+ * \param server_iv     Pointer to the uint64_t value that will be updated with
+ *                      the server_iv on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_handshake(
+    handshake_pool* pool, RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vcblockchain_entity_private_cert** cert, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv);
+
+/**
+ * \brief Get a snapshot of the pool counters.
+ *
+ * \param pool          The handshake pool.
+ * \param stats         The structure to receive the counters.
+ */
+void handshake_pool_get_stats(
+    handshake_pool* pool, handshake_pool_stats* stats);
+
+/**
+ * \brief Release a handshake pool, discarding any unused entries.
+ *
+ * \param pool          The handshake pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_release(handshake_pool* pool);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,212 @@
+/**
+ * \file helpers/large_buffer_pool.h
+ *
+ * \brief A pool of large, pre-faulted buffers backed by huge pages.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vpr/allocator.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A pool of large buffers.
+ *
+ * Multi-megabyte buffers from malloc are mapped fresh on every allocation
+ * and unmapped on every release, so each request pays a page fault for every
+ * page it touches, and the kernel zeroes each page as it is faulted in. The
+ * pool maps its slots once, backs them with huge pages where it can, and
+ * touches every page up front. After that, acquiring and returning a slot
+ * never faults. The pool is synchronized, so threads may share it.
+ */
+typedef struct large_buffer_pool large_buffer_pool;
+
+/**
+ * \brief The memory backing a pool.
+ *
+ * AUTO tries explicit huge pages, then transparent huge pages, then base
+ * pages. Explicit huge pages require pages reserved through
+ * /proc/sys/vm/nr_hugepages; transparent huge pages require that
+ * /sys/kernel/mm/transparent_hugepage/enabled is not "never".
+ */
+typedef enum large_buffer_pool_backing
+{
+    LARGE_BUFFER_POOL_BACKING_AUTO,
+    LARGE_BUFFER_POOL_BACKING_HUGETLB,
+    LARGE_BUFFER_POOL_BACKING_THP,
+    LARGE_BUFFER_POOL_BACKING_BASE_PAGES,
+} large_buffer_pool_backing;
+
+/**
+ * \brief Options for creating a pool.
+ *
+ * slot_size is rounded up to a whole number of huge pages. Through the
+ * allocator interface, requests smaller than min_size, larger than a slot,
+ * or made while every slot is in use are passed to the fallback allocator.
+ */
+typedef struct large_buffer_pool_options large_buffer_pool_options;
+
+struct large_buffer_pool_options
+{
+    size_t slot_size;
+    size_t slot_count;
+    size_t min_size;
+    large_buffer_pool_backing backing;
+    bool prefault;
+};
+
+/**
+ * \brief Counters describing the use of a pool.
+ *
+ * fallbacks counts allocator requests of at least min_size that the pool
+ * could not serve. prefault_ns is the time spent mapping and touching the
+ * slots when the pool was created.
+ */
+typedef struct large_buffer_pool_stats large_buffer_pool_stats;
+
+struct large_buffer_pool_stats
+{
+    uint64_t acquired;
+    uint64_t fallbacks;
+    size_t in_use;
+    size_t peak_in_use;
+    uint64_t prefault_ns;
+};
+
+/**
+ * \brief Allocator options that serve large allocations from a pool.
+ *
+ * The options member comes first, so a pointer to this structure can be
+ * passed anywhere an allocator_options_t* is expected, such as to
+ * vccrypt_suite_options_init.
+ */
+typedef struct large_buffer_pool_allocator large_buffer_pool_allocator;
+
+struct large_buffer_pool_allocator
+{
+    allocator_options_t options;
+    large_buffer_pool* pool;
+    allocator_options_t* fallback;
+};
+
+/**
+ * \brief Initialize pool options with their defaults.
+ *
+ * The defaults are eight 8 MiB slots, pooling allocations of 256 KiB and
+ * up, with automatic backing, pre-faulted.
+ *
+ * \param opts          The options to initialize.
+ */
+void large_buffer_pool_options_init(large_buffer_pool_options* opts);
+
+/**
+ * \brief Create a pool, mapping and optionally pre-faulting its slots.
+ *
+ * \param pool          Pointer to the pool pointer to receive the pool on
+ *                      success.
+ * \param alloc         The allocator to use for this operation.
+ * \param opts          The pool options.
+ *
+ * \note On success, the caller owns the pool and must release it by calling
+ * \ref large_buffer_pool_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LARGE_BUFFER_POOL_MAP if the requested backing could not be
+ *        mapped.
+ *      - a non-zero error code on failure.
+ */
+status large_buffer_pool_create(
+    large_buffer_pool** pool, RCPR_SYM(allocator)* alloc,
+    const large_buffer_pool_options* opts);
+
+/**
+ * \brief Release a pool, unmapping its slots.
+ *
+ * Every slot must have been returned.
+ *
+ * \param pool          The pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status large_buffer_pool_release(large_buffer_pool* pool);
+
+/**
+ * \brief Take a slot from the pool.
+ *
+ * \param pool          The pool.
+ * \param size          The number of bytes needed.
+ *
+ * \returns the slot, or NULL if size is larger than a slot or every slot is
+ * in use.
+ */
+void* large_buffer_pool_acquire(large_buffer_pool* pool, size_t size);
+
+/**
+ * \brief Return a slot to the pool.
+ *
+ * \param pool          The pool.
+ * \param ptr           The memory to return.
+ *
+ * \returns true if ptr is a slot of this pool and was returned, and false if
+ * it belongs to some other allocator.
+ */
+bool large_buffer_pool_return(large_buffer_pool* pool, void* ptr);
+
+/**
+ * \brief Get the backing the pool ended up with.
+ *
+ * \param pool          The pool.
+ *
+ * \returns the backing, which is never LARGE_BUFFER_POOL_BACKING_AUTO.
+ */
+large_buffer_pool_backing large_buffer_pool_backing_get(
+    const large_buffer_pool* pool);
+
+/**
+ * \brief Get a printable name for a backing.
+ *
+ * \param backing       The backing.
+ *
+ * \returns the name.
+ */
+const char* large_buffer_pool_backing_name(large_buffer_pool_backing backing);
+
+/**
+ * \brief Get a snapshot of the pool counters.
+ *
+ * \param pool          The pool.
+ * \param stats         The structure to receive the counters.
+ */
+void large_buffer_pool_get_stats(
+    large_buffer_pool* pool, large_buffer_pool_stats* stats);
+
+/**
+ * \brief Initialize allocator options that serve large allocations from a
+ * pool and everything else from a fallback allocator.
+ *
+ * \param alloc_opts    The allocator options to initialize. These must be
+ *                      disposed before the pool is released.
+ * \param pool          The pool.
+ * \param fallback      The allocator options for everything else, which
+ *                      must outlive these options.
+ */
+void large_buffer_pool_allocator_init(
+    large_buffer_pool_allocator* alloc_opts, large_buffer_pool* pool,
+    allocator_options_t* fallback);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,114 @@
+/**
+ * \file helpers/latency_histogram.h
+ *
+ * \brief Log-linear latency histogram for load and benchmark tools.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Number of sub-buckets per power of two, expressed in bits.
+ *
+ * Four bits gives sixteen sub-buckets per octave, which bounds the relative
+ * error of any reported percentile to 1/16th of its value.
+ */
+#define LATENCY_HISTOGRAM_SUB_BUCKET_BITS                       4
+#define LATENCY_HISTOGRAM_SUB_BUCKETS \
+    (1U << LATENCY_HISTOGRAM_SUB_BUCKET_BITS)
+#define LATENCY_HISTOGRAM_BUCKETS \
+    (64U * LATENCY_HISTOGRAM_SUB_BUCKETS)
+
+/**
+ * \brief A latency histogram with nanosecond samples.
+ *
+ * This histogram is not synchronized. Tools that record from multiple threads
+ * should keep one histogram per thread and merge them when reporting.
+ */
+typedef struct latency_histogram latency_histogram;
+
+struct latency_histogram
+{
+    uint64_t counts[LATENCY_HISTOGRAM_BUCKETS];
+    uint64_t total;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+};
+
+/**
+ * \brief Initialize or reset a latency histogram.
+ *
+ * \param hist          The histogram to initialize.
+ */
+void latency_histogram_init(latency_histogram* hist);
+
+/**
+ * \brief Record a latency sample.
+ *
+ * \param hist          The histogram to update.
+ * \param value_ns      The sample, in nanoseconds.
+ */
+void latency_histogram_record(latency_histogram* hist, uint64_t value_ns);
+
+/**
+ * \brief Merge the samples from one histogram into another.
+ *
+ * \param dest          The histogram receiving the samples.
+ * \param src           The histogram providing the samples.
+ */
+void latency_histogram_merge(
+    latency_histogram* dest, const latency_histogram* src);
+
+/**
+ * \brief Get the value at the given percentile.
+ *
+ * \param hist          The histogram to query.
+ * \param percentile    The percentile to query, from 0.0 to 100.0.
+ *
+ * \returns the upper bound of the bucket holding the requested percentile, in
+ * nanoseconds, or 0 if the histogram is empty.
+ */
+uint64_t latency_histogram_percentile(
+    const latency_histogram* hist, double percentile);
+
+/**
+ * \brief Get the mean of all samples in this histogram.
+ *
+ * \param hist          The histogram to query.
+ *
+ * \returns the mean in nanoseconds, or 0 if the histogram is empty.
+ */
+uint64_t latency_histogram_mean(const latency_histogram* hist);
+
+/**
+ * \brief Print a one line summary of this histogram.
+ *
+ * The summary includes the sample count, mean, p50, p90, p99, p99.9, and max,
+ * all reported in microseconds.
+ *
+ * \param hist          The histogram to print.
+ * \param out           The stream to which the summary is written.
+ * \param label         A label to prefix the summary.
+ */
+void latency_histogram_print(
+    const latency_histogram* hist, FILE* out, const char* label);
+
+/**
+ * \brief Read the monotonic clock.
+ *
+ * \returns the current monotonic time in nanoseconds.
+ */
+uint64_t latency_clock_now_ns(void);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
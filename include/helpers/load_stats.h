@@ -0,0 +1,109 @@
+/**
+ * \file helpers/load_stats.h
+ *
+ * \brief Success and failure accounting for load tools.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/latency_histogram.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The number of distinct failure kinds tracked by \ref load_stats.
+ *
+ * Failures beyond this many distinct kinds are still counted and timed, but
+ * are reported as untracked rather than by code.
+ */
+#define LOAD_STATS_MAX_FAILURE_KINDS                            64
+
+/**
+ * \brief A kind of failure: a helper error code paired with the status that
+ * agentd reported, or AGENTD_STATUS_NONE if agentd reported none.
+ */
+typedef struct load_failure_kind load_failure_kind;
+
+struct load_failure_kind
+{
+    status code;
+    uint32_t agentd_status;
+    uint64_t count;
+};
+
+/**
+ * \brief Results of a load run.
+ *
+ * Latency samples are tagged as success or failure by recording them in
+ * separate histograms, so that fast failures under overload do not flatter
+ * the success latency. Failures are counted by kind.
+ *
+ * Like \ref latency_histogram, this structure is not synchronized. Tools that
+ * record from multiple threads should keep one per thread and merge them when
+ * reporting.
+ */
+typedef struct load_stats load_stats;
+
+struct load_stats
+{
+    latency_histogram success_latency;
+    latency_histogram failure_latency;
+    size_t kind_count;
+    load_failure_kind kinds[LOAD_STATS_MAX_FAILURE_KINDS];
+    uint64_t untracked_failures;
+};
+
+/**
+ * \brief Initialize or reset load stats.
+ *
+ * \param stats         The stats to initialize.
+ */
+void load_stats_init(load_stats* stats);
+
+/**
+ * \brief Record the outcome of a request.
+ *
+ * On failure, the agentd status is taken from \ref agentd_status_last, so the
+ * caller should clear it before issuing a request that does not go through a
+ * session pool.
+ *
+ * \param stats         The stats to update.
+ * \param retval        The status returned by the request.
+ * \param latency_ns    The latency of the request, in nanoseconds.
+ */
+void load_stats_record(load_stats* stats, status retval, uint64_t latency_ns);
+
+/**
+ * \brief Merge one set of load stats into another.
+ *
+ * \param dest          The stats receiving the results.
+ * \param src           The stats providing the results.
+ */
+void load_stats_merge(load_stats* dest, const load_stats* src);
+
+/**
+ * \brief Print a summary of these load stats.
+ *
+ * The summary includes the success and failure latency distributions, then
+ * the failure count broken down by helper error code and by agentd status,
+ * each with its share of all requests and its rate per second.
+ *
+ * \param stats         The stats to print.
+ * \param out           The stream to which the summary is written.
+ * \param label         A label to prefix the summary.
+ * \param elapsed_s     The duration of the run, in seconds.
+ */
+void load_stats_print(
+    const load_stats* stats, FILE* out, const char* label, double elapsed_s);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
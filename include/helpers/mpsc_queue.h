@@ -0,0 +1,75 @@
+/**
+ * \file helpers/mpsc_queue.h
+ *
+ * \brief Intrusive lock-free multi-producer single-consumer queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <stdatomic.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A link embedded in each queued item.
+ */
+typedef struct mpsc_queue_node mpsc_queue_node;
+
+struct mpsc_queue_node
+{
+    _Atomic(mpsc_queue_node*) next;
+};
+
+/**
+ * \brief An intrusive multi-producer single-consumer queue.
+ *
+ * Producers push with a single atomic exchange and never wait on each other
+ * or on the consumer. Only one thread may pop. The queue never allocates;
+ * each item embeds a \ref mpsc_queue_node and must stay valid until popped.
+ */
+typedef struct mpsc_queue mpsc_queue;
+
+struct mpsc_queue
+{
+    _Atomic(mpsc_queue_node*) head;
+    mpsc_queue_node* tail;
+    mpsc_queue_node stub;
+};
+
+/**
+ * \brief Initialize an empty queue.
+ *
+ * \param queue         The queue to initialize.
+ */
+void mpsc_queue_init(mpsc_queue* queue);
+
+/**
+ * \brief Push a node onto the queue.
+ *
+ * This may be called from any number of threads at once.
+ *
+ * \param queue         The queue.
+ * \param node          The node to push.
+ */
+void mpsc_queue_push(mpsc_queue* queue, mpsc_queue_node* node);
+
+/**
+ * \brief Pop the oldest node from the queue.
+ *
+ * This must only be called from the consumer thread. A push that has started
+ * but not yet linked its node is not visible, so NULL may be returned while a
+ * producer is mid-push; callers that know an item is coming should retry.
+ *
+ * \param queue         The queue.
+ *
+ * \returns the oldest node, or NULL if no linked node is available.
+ */
+mpsc_queue_node* mpsc_queue_pop(mpsc_queue* queue);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
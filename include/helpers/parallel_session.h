@@ -0,0 +1,187 @@
+/**
+ * \file helpers/parallel_session.h
+ *
+ * \brief Encrypt and decrypt the frames of one session on a worker pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <helpers/session_frame.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A session whose frames are encrypted and decrypted in parallel.
+ *
+ * The key stream of each frame is derived from the shared secret and that
+ * frame's IV, so frames don't depend on one another and a session carrying
+ * multi-megabyte frames need not be bound to one core's crypto throughput.
+ *
+ * Requests are encrypted by a pool of workers and written by a writer
+ * thread in the order they were sent. A reader thread reads responses off
+ * the socket one after the other, decrypting only the few header bytes that
+ * give each frame's size, and hands whole frames to the workers to decrypt
+ * and decode. Responses are returned in the order they arrived.
+ *
+ * Every request is expected to get exactly one response; the reader only
+ * reads while responses are outstanding. While the parallel session exists,
+ * it owns the IVs of its session and nothing else may use the session's
+ * socket. Once it is released, the session's IVs reflect every frame sent
+ * and received, and the session may be used as before.
+ *
+ * The parallel session may be used by one caller thread at a time.
+ */
+typedef struct parallel_session parallel_session;
+
+/**
+ * \brief Options for creating a parallel session.
+ *
+ * window bounds the frames in flight in each direction: requests sent but
+ * not yet written, and responses read but not yet returned. max_frame_size
+ * rejects frame headers announcing more than that many bytes.
+ */
+typedef struct parallel_session_options parallel_session_options;
+
+struct parallel_session_options
+{
+    size_t workers;
+    size_t window;
+    size_t max_frame_size;
+};
+
+/**
+ * \brief Counters describing the use of a parallel session.
+ *
+ * crypto_ns is the time the workers spent encrypting and decrypting, summed
+ * over workers, and elapsed_ns the time since the session was created.
+ */
+typedef struct parallel_session_stats parallel_session_stats;
+
+struct parallel_session_stats
+{
+    size_t workers;
+    uint64_t frames_sent;
+    uint64_t frames_received;
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    uint64_t crypto_ns;
+    uint64_t elapsed_ns;
+};
+
+/**
+ * \brief Initialize parallel session options with their defaults.
+ *
+ * The defaults use one worker per online CPU, up to 8, keep twice as many
+ * frames in flight as there are workers, and accept frames of up to
+ * 256 MiB.
+ *
+ * \param opts          The options to initialize.
+ */
+void parallel_session_options_init(parallel_session_options* opts);
+
+/**
+ * \brief Create a parallel session over an established session.
+ *
+ * \param ps            Pointer to the parallel session pointer to receive
+ *                      the parallel session on success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param suite         The crypto suite to use for this operation.
+ * \param session       The session, which must outlive the parallel session.
+ * \param descriptor    The session's socket descriptor, which remains owned
+ *                      by the session.
+ * \param opts          The parallel session options.
+ *
+ * \note On success, the caller owns the parallel session and must release it
+ * by calling \ref parallel_session_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_create(
+    parallel_session** ps, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, agentd_session* session, int descriptor,
+    const parallel_session_options* opts);
+
+/**
+ * \brief Queue a request, blocking while the send window is full.
+ *
+ * The request is encrypted later by a worker, so context must remain valid
+ * until \ref parallel_session_flush or \ref parallel_session_release
+ * returns.
+ *
+ * \param ps            The parallel session.
+ * \param encode        The function writing the request.
+ * \param context       The request arguments passed to encode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code if the session has failed.
+ */
+status parallel_session_send(
+    parallel_session* ps, session_frame_encode_fn encode, void* context);
+
+/**
+ * \brief Wait until every queued request has been written.
+ *
+ * \param ps            The parallel session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code if the session has failed.
+ */
+status parallel_session_flush(parallel_session* ps);
+
+/**
+ * \brief Get the next response, blocking until it is decrypted.
+ *
+ * \param ps            The parallel session.
+ * \param response      The buffer to initialize with the decrypted response
+ *                      on success, which the caller must dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_PARALLEL_SESSION_CLOSED if no response is outstanding or the
+ *        peer closed the connection.
+ *      - a non-zero error code if the session has failed.
+ */
+status parallel_session_recv(
+    parallel_session* ps, vccrypt_buffer_t* response);
+
+/**
+ * \brief Get a snapshot of the parallel session counters.
+ *
+ * \param ps            The parallel session.
+ * \param stats         The structure to receive the counters.
+ */
+void parallel_session_get_stats(
+    parallel_session* ps, parallel_session_stats* stats);
+
+/**
+ * \brief Release a parallel session.
+ *
+ * Queued requests are written first. Responses that were read but not
+ * returned are discarded, and the reader stops waiting for any that are
+ * still outstanding.
+ *
+ * \param ps            The parallel session to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_release(parallel_session* ps);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -48,6 +48,31 @@ status ping_protocol_sendreq_ping_response(
     vccrypt_buffer_t* shared_secret, uint64_t offset, uint32_t status_code,
     const vccrypt_buffer_t* payload);
 
+/**
+ * \brief Read a single extended API client request and answer it as a ping
+ * sentinel.
+ *
+ * Ping requests are answered with a success status and a payload of the given
+ * size. Requests for any other verb are answered with
+ * ERROR_READ_EXTENDED_API_INVALID_VERB.
+ *
+ * \param sock          The socket connection with agentd.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param client_iv     The client-side initialization vector counter.
+ * \param server_iv     The server-side initialization vector counter.
+ * \param shared_secret The computed shared secret for this session.
+ * \param payload_size  The size of the response payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status ping_protocol_sentinel_serve_request(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, uint64_t* client_iv, uint64_t* server_iv,
+    vccrypt_buffer_t* shared_secret, size_t payload_size);
+
 #if defined(__cplusplus)
 }
 #endif /*defined(__cplusplus)*/
@@ -0,0 +1,166 @@
+/**
+ * \file helpers/pipeline.h
+ *
+ * \brief A staged processing pipeline joined by bounded queues.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A staged processing pipeline.
+ *
+ * Each stage has its own threads and a bounded input queue. Items pushed into
+ * the pipeline flow through the stages in order. A full queue blocks the
+ * stage feeding it, so a slow stage holds back the stages before it rather
+ * than letting work pile up without bound. Every stage records how long its
+ * threads were busy, how long they waited for input, and how long they
+ * waited to hand off output, so the bottleneck is the stage whose threads
+ * are busiest while the others stall.
+ */
+typedef struct pipeline pipeline;
+
+/**
+ * \brief The input queue capacity of a stage that doesn't specify one.
+ */
+#define PIPELINE_DEFAULT_QUEUE_CAPACITY                         64
+
+/**
+ * \brief The description of one stage.
+ *
+ * thread_init and thread_dispose are optional, and set up and tear down the
+ * state owned by each thread of the stage, such as a session.
+ *
+ * process is called for each item. To forward the item, or a replacement for
+ * it, to the next stage, it sets *out. The last stage must consume every
+ * item and leave *out NULL. On failure, process releases the item itself.
+ *
+ * A queue_capacity of zero selects \ref PIPELINE_DEFAULT_QUEUE_CAPACITY.
+ *
+ * discard releases an item that can't be processed because its thread could
+ * not be set up.
+ */
+typedef struct pipeline_stage_ops pipeline_stage_ops;
+
+struct pipeline_stage_ops
+{
+    const char* name;
+    size_t threads;
+    size_t queue_capacity;
+    void* context;
+    status (*thread_init)(void* context, size_t thread, void** state);
+    void (*thread_dispose)(void* context, void* state);
+    status (*process)(void* context, void* state, void* item, void** out);
+    void (*discard)(void* context, void* item);
+};
+
+/**
+ * \brief Counters describing the work done by one stage.
+ *
+ * Times are summed over the stage's threads. queue_mean is the time-weighted
+ * mean depth of the stage's input queue.
+ */
+typedef struct pipeline_stage_stats pipeline_stage_stats;
+
+struct pipeline_stage_stats
+{
+    const char* name;
+    size_t threads;
+    size_t queue_capacity;
+    uint64_t items;
+    uint64_t failures;
+    uint64_t busy_ns;
+    uint64_t input_stall_ns;
+    uint64_t output_stall_ns;
+    double queue_mean;
+    size_t queue_max;
+    uint64_t elapsed_ns;
+};
+
+/**
+ * \brief Create a pipeline and start its threads.
+ *
+ * \param pipe          Pointer to the pipeline pointer to receive the
+ *                      pipeline on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param stages        The stages, in order.
+ * \param stage_count   The number of stages.
+ *
+ * \note On success, the caller owns the pipeline and must release it by
+ * calling \ref pipeline_release when it is no longer needed. The stage names
+ * and contexts must outlive the pipeline.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pipeline_create(
+    pipeline** pipe, RCPR_SYM(allocator)* alloc,
+    const pipeline_stage_ops* stages, size_t stage_count);
+
+/**
+ * \brief Push an item into the first stage, blocking while its queue is
+ * full.
+ *
+ * \param pipe          The pipeline.
+ * \param item          The item to push.
+ */
+void pipeline_push(pipeline* pipe, void* item);
+
+/**
+ * \brief Close the pipeline input, then wait for every item to pass through
+ * every stage and for every stage thread to exit.
+ *
+ * \param pipe          The pipeline.
+ */
+void pipeline_finish(pipeline* pipe);
+
+/**
+ * \brief Get the counters of each stage.
+ *
+ * This must be called after \ref pipeline_finish.
+ *
+ * \param pipe          The pipeline.
+ * \param stats         Array of one entry per stage to receive the counters.
+ */
+void pipeline_get_stats(pipeline* pipe, pipeline_stage_stats* stats);
+
+/**
+ * \brief Print a table of stage counters and name the bottleneck.
+ *
+ * The bottleneck is the stage whose threads were busy for the largest share
+ * of the run.
+ *
+ * \param stats         The stage counters.
+ * \param stage_count   The number of stages.
+ * \param out           The stream to print to.
+ */
+void pipeline_print_stats(
+    const pipeline_stage_stats* stats, size_t stage_count, FILE* out);
+
+/**
+ * \brief Release a pipeline.
+ *
+ * If \ref pipeline_finish has not been called, it is called first.
+ *
+ * \param pipe          The pipeline to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pipeline_release(pipeline* pipe);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
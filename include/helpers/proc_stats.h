@@ -0,0 +1,74 @@
+/**
+ * \file helpers/proc_stats.h
+ *
+ * \brief Resource usage snapshots of local processes, read from /proc.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The maximum number of processes captured in a snapshot.
+ */
+#define PROC_SNAPSHOT_MAX_PROCESSES                             128
+
+/**
+ * \brief Resource usage of a single process.
+ *
+ * cmdline holds the command line with arguments separated by spaces,
+ * truncated to fit.
+ */
+typedef struct proc_info proc_info;
+
+struct proc_info
+{
+    pid_t pid;
+    pid_t ppid;
+    uint64_t rss_bytes;
+    size_t fd_count;
+    char cmdline[128];
+};
+
+/**
+ * \brief Resource usage of every process with a given name.
+ */
+typedef struct proc_snapshot proc_snapshot;
+
+struct proc_snapshot
+{
+    size_t count;
+    proc_info procs[PROC_SNAPSHOT_MAX_PROCESSES];
+    uint64_t total_rss_bytes;
+    size_t total_fds;
+};
+
+/**
+ * \brief Take a snapshot of every process with the given name.
+ *
+ * A process matches if the final path component of its argv[0] equals name.
+ * Processes that exit while the snapshot is taken are skipped. Reading fd
+ * counts requires permission to list /proc/PID/fd; processes for which this
+ * is denied are reported with an fd count of zero.
+ *
+ * \param snapshot      The snapshot to populate.
+ * \param name          The process name to match, e.g. "agentd".
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status proc_snapshot_take(proc_snapshot* snapshot, const char* name);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
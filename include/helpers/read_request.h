@@ -0,0 +1,138 @@
+/**
+ * \file helpers/read_request.h
+ *
+ * \brief Idempotent agentd read requests as data.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <vpr/uuid.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The read operations that can be described by a \ref read_request.
+ *
+ * Each of these maps to a get_and_verify helper in conn_helpers.h. All of them
+ * are idempotent, so a request may safely be issued more than once.
+ */
+typedef enum read_request_type
+{
+    READ_REQUEST_BLOCK_GET,
+    READ_REQUEST_TXN_GET,
+    READ_REQUEST_LATEST_BLOCK_ID_GET,
+    READ_REQUEST_NEXT_BLOCK_ID_GET,
+    READ_REQUEST_PREV_BLOCK_ID_GET,
+    READ_REQUEST_BLOCK_ID_BY_HEIGHT_GET,
+    READ_REQUEST_NEXT_TXN_ID_GET,
+    READ_REQUEST_PREV_TXN_ID_GET,
+    READ_REQUEST_TXN_BLOCK_ID_GET,
+    READ_REQUEST_ARTIFACT_FIRST_TXN_ID_GET,
+    READ_REQUEST_ARTIFACT_LAST_TXN_ID_GET,
+} read_request_type;
+
+/**
+ * \brief A read request.
+ *
+ * The id field holds the block, transaction, or artifact id being queried. The
+ * height field is only used by READ_REQUEST_BLOCK_ID_BY_HEIGHT_GET.
+ */
+typedef struct read_request read_request;
+
+struct read_request
+{
+    read_request_type type;
+    vpr_uuid id;
+    uint64_t height;
+};
+
+/**
+ * \brief The decoded result of a read request.
+ *
+ * Block and transaction gets populate cert, prev_id, and next_id; transaction
+ * gets also populate artifact_id and block_id. All single id lookups populate
+ * id. When has_cert is set, the caller owns cert and must release it by
+ * calling \ref read_result_dispose.
+ */
+typedef struct read_result read_result;
+
+struct read_result
+{
+    bool has_cert;
+    vccrypt_buffer_t cert;
+    vpr_uuid id;
+    vpr_uuid prev_id;
+    vpr_uuid next_id;
+    vpr_uuid artifact_id;
+    vpr_uuid block_id;
+};
+
+/**
+ * \brief Execute a read request on the given session.
+ *
+ * \param session           The session on which this request is executed.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param req               The request to execute.
+ * \param result            The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status read_request_execute(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const read_request* req,
+    read_result* result);
+
+/**
+ * \brief Determine whether two requests ask for the same thing.
+ *
+ * Only the fields used by the request type are compared.
+ *
+ * \param lhs               The first request.
+ * \param rhs               The second request.
+ *
+ * \returns true if the requests are identical.
+ */
+bool read_request_equal(const read_request* lhs, const read_request* rhs);
+
+/**
+ * \brief Move a read result from one location to another.
+ *
+ * \param dest              The uninitialized result receiving the value.
+ * \param src               The result whose value is moved.
+ */
+void read_result_move(read_result* dest, read_result* src);
+
+/**
+ * \brief Copy a read result, duplicating its certificate buffer.
+ *
+ * \param dest              The uninitialized result receiving the copy. On
+ *                          success, the caller owns it and must release it
+ *                          by calling \ref read_result_dispose.
+ * \param src               The result to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_READ_RESULT_OUT_OF_MEMORY if the buffer could not be copied.
+ */
+status read_result_copy(read_result* dest, const read_result* src);
+
+/**
+ * \brief Release any buffer owned by a read result.
+ *
+ * \param result            The result to dispose.
+ */
+void read_result_dispose(read_result* result);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,84 @@
+/**
+ * \file helpers/session_frame.h
+ *
+ * \brief Encode and decode agentd frames in memory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <rcpr/psock.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Write one request to a socket.
+ *
+ * This has the shape of the vcblockchain_protocol_sendreq functions, minus
+ * the request arguments, which come in through context.
+ */
+typedef status (*session_frame_encode_fn)(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, vccrypt_buffer_t* shared_secret, void* context);
+
+/**
+ * \brief Encrypt a request for a session into memory instead of its socket.
+ *
+ * Transports that write the socket descriptor themselves use this to produce
+ * the exact bytes the blocking path would have written. The session's client
+ * IV advances as if the request had been sent, and is left untouched on
+ * failure.
+ *
+ * \param session       The session the request belongs to.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param encode        The function writing the request.
+ * \param context       The request arguments passed to encode.
+ * \param frame         Pointer to receive the encrypted frame on success,
+ *                      which the caller must reclaim with alloc.
+ * \param frame_size    Pointer to receive the size of the frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_frame_encode(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, session_frame_encode_fn encode,
+    void* context, void** frame, size_t* frame_size);
+
+/**
+ * \brief Decrypt a response for a session from the bytes received so far.
+ *
+ * The data must start at a frame boundary. If it doesn't yet hold a whole
+ * frame, the session's server IV is left untouched and the caller should
+ * try again once more bytes arrive.
+ *
+ * \param session       The session the response belongs to.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param data          The bytes received.
+ * \param size          The number of bytes received.
+ * \param response      The buffer to initialize with the decrypted response
+ *                      on success, which the caller must dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_SESSION_FRAME_INCOMPLETE if the data doesn't decode yet.
+ *      - a non-zero error code on failure.
+ */
+status session_frame_decode(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const void* data, size_t size,
+    vccrypt_buffer_t* response);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,181 @@
+/**
+ * \file helpers/session_pool.h
+ *
+ * \brief A pool of agentd sessions, each driven by its own worker thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/read_request.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <vctool/file.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A pool of authenticated agentd sessions.
+ *
+ * Each session is owned by a worker thread that executes queued read requests
+ * in order using the blocking helpers. Any number of application threads may
+ * call \ref session_pool_read concurrently.
+ */
+typedef struct session_pool session_pool;
+
+/**
+ * \brief Policies for choosing the session that receives a request.
+ *
+ * Round robin sends requests to each session in turn, regardless of how much
+ * work is already queued on it. Least loaded samples two distinct sessions at
+ * random and picks the one with fewer outstanding requests (the "power of two
+ * choices"), which steers new requests away from sessions stuck behind slow
+ * reads without the herding caused by always picking the global minimum.
+ */
+typedef enum session_pool_selection_policy
+{
+    SESSION_POOL_SELECT_ROUND_ROBIN,
+    SESSION_POOL_SELECT_LEAST_LOADED,
+} session_pool_selection_policy;
+
+/**
+ * \brief Hedging policy for pooled reads.
+ *
+ * When enabled, a read that has not completed within the hedge delay is sent
+ * again on a second session, and the first successful answer wins. The delay
+ * is the given percentile of the wire latency observed by this pool, floored
+ * at min_delay_ns. Wire latency runs from when a session sends a read to its
+ * answer, so time spent queued behind other reads is not counted. Until
+ * warmup_samples latencies have been observed, the delay is min_delay_ns.
+ */
+typedef struct session_pool_hedge_policy session_pool_hedge_policy;
+
+struct session_pool_hedge_policy
+{
+    bool enabled;
+    double percentile;
+    uint64_t min_delay_ns;
+    uint64_t warmup_samples;
+};
+
+/**
+ * \brief Counters describing the work done by a session pool.
+ *
+ * requests counts calls to \ref session_pool_read. wire_requests counts the
+ * requests actually sent to agentd, so wire_requests - requests is the load
+ * added by hedging. hedge_wins counts hedged reads answered first by the
+ * hedge rather than the original request.
+ */
+typedef struct session_pool_stats session_pool_stats;
+
+struct session_pool_stats
+{
+    uint64_t requests;
+    uint64_t wire_requests;
+    uint64_t hedges;
+    uint64_t hedge_wins;
+    uint64_t failures;
+};
+
+/**
+ * \brief Create a session pool.
+ *
+ * \param pool          Pointer to the session pool pointer to receive the pool
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param session_count The number of sessions to open.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the caller owns the pool and must release it by calling
+ * \ref session_pool_release when it is no longer needed. The allocator and
+ * crypto suite must outlive the pool. Hedging starts out disabled, and
+ * requests are distributed round robin.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_create(
+    session_pool** pool, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, size_t session_count,
+    const char* hostaddr, unsigned int hostport, const char* clientpriv,
+    const char* serverpub);
+
+/**
+ * \brief Close every session in the pool and release it.
+ *
+ * Queued requests are drained before each session is closed.
+ *
+ * \param pool          The pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_release(session_pool* pool);
+
+/**
+ * \brief Set the hedging policy for this pool.
+ *
+ * \param pool          The pool to update.
+ * \param policy        The new hedging policy.
+ */
+void session_pool_set_hedge_policy(
+    session_pool* pool, const session_pool_hedge_policy* policy);
+
+/**
+ * \brief Set the session selection policy for this pool.
+ *
+ * \param pool          The pool to update.
+ * \param policy        The new selection policy.
+ */
+void session_pool_set_selection_policy(
+    session_pool* pool, session_pool_selection_policy policy);
+
+/**
+ * \brief Execute a read request on the pool, blocking until it completes.
+ *
+ * \param pool          The pool on which the request is executed.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \note On failure, the status reported by agentd, if any, is available to the
+ * calling thread through \ref agentd_status_last.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_read(
+    session_pool* pool, const read_request* req, read_result* result);
+
+/**
+ * \brief Get a snapshot of the pool counters.
+ *
+ * \param pool          The pool to query.
+ * \param stats         The structure to receive the counters.
+ */
+void session_pool_get_stats(session_pool* pool, session_pool_stats* stats);
+
+/**
+ * \brief Reset the pool counters and observed latencies.
+ *
+ * \param pool          The pool to reset.
+ */
+void session_pool_reset_stats(session_pool* pool);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
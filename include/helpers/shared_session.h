@@ -0,0 +1,140 @@
+/**
+ * \file helpers/shared_session.h
+ *
+ * \brief An agentd session shared by many threads through a lock-free queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/mpsc_queue.h>
+#include <helpers/read_request.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <vctool/file.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief An authenticated agentd session shared by many threads.
+ *
+ * Application threads push requests onto a lock-free multi-producer queue and
+ * never block each other. A single I/O thread owns the session; it pops each
+ * request, encrypts and sends it, reads the response, and hands the result to
+ * the request's completion.
+ */
+typedef struct shared_session shared_session;
+
+typedef struct shared_session_request shared_session_request;
+
+/**
+ * \brief Completion callback for a shared session request.
+ *
+ * The callback runs on the I/O thread and should return quickly. After it
+ * returns, the session no longer touches the request.
+ *
+ * \param request       The completed request.
+ * \param context       The context given with the request.
+ */
+typedef void (*shared_session_completion_fn)(
+    shared_session_request* request, void* context);
+
+/**
+ * \brief A read request submitted to a shared session.
+ *
+ * The caller owns the request and must keep it valid until its completion
+ * runs. On completion, retval holds the result of the request and
+ * agentd_status holds the failure status reported by agentd, if any. On
+ * success, the completion owns result and must release it by calling
+ * \ref read_result_dispose.
+ */
+struct shared_session_request
+{
+    mpsc_queue_node node;
+    read_request req;
+    read_result result;
+    status retval;
+    uint32_t agentd_status;
+    shared_session_completion_fn complete;
+    void* context;
+};
+
+/**
+ * \brief Create a shared session.
+ *
+ * \param session       Pointer to the shared session pointer to receive the
+ *                      session on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the caller owns the session and must release it by
+ * calling \ref shared_session_release when it is no longer needed. The
+ * allocator and crypto suite must outlive the session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status shared_session_create(
+    shared_session** session, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, const char* hostaddr,
+    unsigned int hostport, const char* clientpriv, const char* serverpub);
+
+/**
+ * \brief Close a shared session and release it.
+ *
+ * Requests already submitted are completed before the session is closed. No
+ * request may be submitted once release has started.
+ *
+ * \param session       The session to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status shared_session_release(shared_session* session);
+
+/**
+ * \brief Submit a request to a shared session without waiting for it.
+ *
+ * The caller fills in req, complete, and context before submitting. This
+ * never blocks and may be called from any number of threads at once.
+ *
+ * \param session       The session on which the request is executed.
+ * \param request       The request to submit.
+ */
+void shared_session_submit(
+    shared_session* session, shared_session_request* request);
+
+/**
+ * \brief Execute a read request on a shared session, blocking until it
+ * completes.
+ *
+ * \param session       The session on which the request is executed.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \note On failure, the status reported by agentd, if any, is available to the
+ * calling thread through \ref agentd_status_last.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status shared_session_read(
+    shared_session* session, const read_request* req, read_result* result);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
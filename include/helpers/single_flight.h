@@ -0,0 +1,159 @@
+/**
+ * \file helpers/single_flight.h
+ *
+ * \brief Join concurrent identical read requests onto one wire request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/read_request.h>
+#include <helpers/session_pool.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A single-flight layer in front of a read backend.
+ *
+ * When several threads ask for the same block or transaction at once, as
+ * happens around the chain tip, the first one through sends the request and
+ * the rest wait for its answer instead of sending their own. Each waiter
+ * gets its own copy of the decoded result. Nothing is cached: once a request
+ * completes, the next identical one goes to the wire again.
+ *
+ * A joined read may see agentd's state as of the moment the first request
+ * was sent, up to one round trip before the joining thread asked. This is
+ * immaterial for reads by id, but callers that need the tip as of their own
+ * call, such as after a submit, should read from the backend directly.
+ *
+ * Any number of threads may call \ref single_flight_read concurrently.
+ */
+typedef struct single_flight single_flight;
+
+/**
+ * \brief The read backend behind a single-flight layer.
+ *
+ * \param context       The backend context.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+typedef status (*single_flight_read_fn)(
+    void* context, const read_request* req, read_result* result);
+
+/**
+ * \brief Counters describing the work done by a single-flight layer.
+ *
+ * requests counts calls to \ref single_flight_read, and wire_requests those
+ * passed to the backend; joined is the difference, the load saved.
+ * peak_waiters is the most callers that shared one wire request.
+ */
+typedef struct single_flight_stats single_flight_stats;
+
+struct single_flight_stats
+{
+    uint64_t requests;
+    uint64_t wire_requests;
+    uint64_t joined;
+    uint64_t failures;
+    size_t peak_waiters;
+};
+
+/**
+ * \brief Create a single-flight layer.
+ *
+ * \param sf            Pointer to the single-flight pointer to receive the
+ *                      layer on success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param read          The read backend.
+ * \param context       The backend context, which must outlive the layer.
+ *
+ * \note On success, the caller owns the layer and must release it by calling
+ * \ref single_flight_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_create(
+    single_flight** sf, RCPR_SYM(allocator)* alloc, single_flight_read_fn read,
+    void* context);
+
+/**
+ * \brief Release a single-flight layer.
+ *
+ * No read may be in progress.
+ *
+ * \param sf            The layer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_release(single_flight* sf);
+
+/**
+ * \brief Execute a read request, joining an identical one in flight.
+ *
+ * \param sf            The single-flight layer.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \note On failure, the status reported by agentd, if any, is available to the
+ * calling thread through \ref agentd_status_last, whether or not the caller
+ * sent the request itself.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_SINGLE_FLIGHT_OUT_OF_MEMORY if the request could not be
+ *        tracked.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_read(
+    single_flight* sf, const read_request* req, read_result* result);
+
+/**
+ * \brief Get a snapshot of the layer counters.
+ *
+ * \param sf            The single-flight layer.
+ * \param stats         The structure to receive the counters.
+ */
+void single_flight_get_stats(single_flight* sf, single_flight_stats* stats);
+
+/**
+ * \brief Reset the layer counters.
+ *
+ * \param sf            The single-flight layer.
+ */
+void single_flight_reset_stats(single_flight* sf);
+
+/**
+ * \brief A \ref single_flight_read_fn backed by a session pool.
+ *
+ * \param context       The \ref session_pool.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_session_pool_read(
+    void* context, const read_request* req, read_result* result);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
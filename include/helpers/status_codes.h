@@ -157,6 +157,60 @@
 #define ERROR_PING_RESPONSE_STATUS_CODE                 147
 #define ERROR_PING_RESPONSE_OFFSET                      148
 #define ERROR_PING_RESPONSE_DECODE                      149
+#define ERROR_READ_REQUEST_INVALID_TYPE                 150
+#define ERROR_SESSION_POOL_OUT_OF_MEMORY                151
+#define ERROR_SESSION_POOL_THREAD_CREATE                152
+#define ERROR_SESSION_POOL_SESSION_FAILED               153
+#define ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY               154
+#define ERROR_CHAIN_SEED_CANONIZATION_TIMEOUT           155
+#define ERROR_PROBE_METRICS_WRITE                       156
+#define ERROR_PROC_STATS_OPEN                           157
+#define ERROR_SHARED_SESSION_OUT_OF_MEMORY              158
+#define ERROR_SHARED_SESSION_THREAD_CREATE              159
+#define ERROR_SHARED_SESSION_FAILED                     160
+#define ERROR_CHAIN_BLOCK_OUT_OF_MEMORY                 161
+#define ERROR_CHAIN_BLOCK_PARSE                         162
+#define ERROR_CHAIN_BLOCK_MALFORMED_TXN                 163
+#define ERROR_CHAIN_BLOCK_HASH                          164
+#define ERROR_TASK_SCHEDULER_OUT_OF_MEMORY              165
+#define ERROR_TASK_SCHEDULER_THREAD_CREATE              166
+#define ERROR_PIPELINE_OUT_OF_MEMORY                    167
+#define ERROR_PIPELINE_THREAD_CREATE                    168
+#define ERROR_CHAIN_EXPORT_OPEN                         169
+#define ERROR_CHAIN_EXPORT_WRITE                        170
+#define ERROR_SUBMIT_WINDOW_OUT_OF_MEMORY               171
+#define ERROR_LARGE_BUFFER_POOL_OUT_OF_MEMORY           172
+#define ERROR_LARGE_BUFFER_POOL_MAP                     173
+#define ERROR_SESSION_FRAME_INCOMPLETE                  174
+#define ERROR_URING_TRANSPORT_SETUP                     175
+#define ERROR_URING_TRANSPORT_OUT_OF_MEMORY             176
+#define ERROR_URING_TRANSPORT_BUSY                      177
+#define ERROR_URING_TRANSPORT_CLOSED                    178
+#define ERROR_URING_TRANSPORT_IO                        179
+#define ERROR_ZEROCOPY_SENDER_OUT_OF_MEMORY             180
+#define ERROR_ZEROCOPY_SENDER_IO                        181
+#define ERROR_PARALLEL_SESSION_SETUP                    182
+#define ERROR_PARALLEL_SESSION_OUT_OF_MEMORY            183
+#define ERROR_PARALLEL_SESSION_IO                       184
+#define ERROR_PARALLEL_SESSION_CLOSED                   185
+#define ERROR_PARALLEL_SESSION_BAD_FRAME                186
+#define ERROR_HANDSHAKE_POOL_SETUP                      187
+#define ERROR_HANDSHAKE_POOL_OUT_OF_MEMORY              188
+#define ERROR_READ_RESULT_OUT_OF_MEMORY                 189
+#define ERROR_SINGLE_FLIGHT_OUT_OF_MEMORY               190
+#define ERROR_CHAIN_NAV_SETUP                           191
+#define ERROR_CHAIN_NAV_OUT_OF_MEMORY                   192
+#define ERROR_CHAIN_EXPORT_FORMAT                       193
+#define ERROR_CHAIN_QUERY_OUT_OF_MEMORY                 194
+#define ERROR_CHAIN_QUERY_THREAD_CREATE                 195
+
+/* status codes specific to the chain query tool. */
+#define ERROR_CHAIN_QUERY_CONFIGURATION                 196
+#define ERROR_CHAIN_QUERY_MISMATCH                      197
+
+/* status codes specific to the archive lookup benchmark. */
+#define ERROR_ARCHIVE_LOOKUP_BENCH_CONFIGURATION        198
+#define ERROR_ARCHIVE_LOOKUP_BENCH_MISMATCH             199
 
 /* status codes specific to submit_multiple_txns test. */
 #define ERROR_TXN1_PREV_ID_MISMATCH                     200
@@ -175,6 +229,7 @@
 #define ERROR_TXN1_BLOCK_ID_MISMATCH                    213
 #define ERROR_TXN2_BLOCK_ID_MISMATCH                    214
 #define ERROR_TXN3_BLOCK_ID_MISMATCH                    215
+#define ERROR_SUBMIT_MULTIPLE_TXNS_CONFIGURATION        216
 
 /* status codes specific to the ping protocol sentinel. */
 #define ERROR_READ_EXTENDED_API_RESPONSE                200
@@ -184,3 +239,77 @@
 #define ERROR_READ_EXTENDED_API_OUT_OF_MEMORY           204
 #define ERROR_READ_EXTENDED_API_INVALID_VERB            205
 #define ERROR_WRITE_EXTENDED_API_RESPONSE               206
+
+/* status codes specific to the sentinel storm benchmark. */
+#define ERROR_STORM_BENCH_CONFIGURATION                 216
+#define ERROR_STORM_BENCH_NOT_ROUTABLE                  217
+
+/* status codes specific to the read/write interference benchmark. */
+#define ERROR_INTERFERENCE_BENCH_CONFIGURATION          218
+
+/* status codes specific to the long session stress tool. */
+#define ERROR_LONG_SESSION_CONFIGURATION                219
+#define ERROR_LONG_SESSION_OFFSET                       220
+
+/* status codes specific to the shared session benchmark. */
+#define ERROR_SHARED_SESSION_BENCH_CONFIGURATION        221
+
+/* status codes specific to the chain scan benchmark. */
+#define ERROR_SCAN_BENCH_CONFIGURATION                  222
+#define ERROR_SCAN_BENCH_FAILED                         223
+
+/* status codes specific to the chain pipeline. */
+#define ERROR_CHAIN_PIPELINE_CONFIGURATION              224
+#define ERROR_CHAIN_PIPELINE_FAILED                     225
+
+/* status codes specific to the UUID match benchmark. */
+#define ERROR_UUID_MATCH_BENCH_CONFIGURATION            226
+#define ERROR_UUID_MATCH_BENCH_MISMATCH                 227
+#define ERROR_UUID_MATCH_BENCH_OUT_OF_MEMORY            228
+
+/* status codes specific to the pipelined submit benchmark. */
+#define ERROR_PIPELINED_SUBMIT_BENCH_CONFIGURATION      229
+#define ERROR_PIPELINED_SUBMIT_BENCH_REJECTED           230
+#define ERROR_PIPELINED_SUBMIT_BENCH_OUT_OF_MEMORY      231
+
+/* status codes specific to the transaction size sweep. */
+#define ERROR_TXN_SIZE_SWEEP_CONFIGURATION              232
+#define ERROR_TXN_SIZE_SWEEP_OUT_OF_MEMORY              233
+#define ERROR_TXN_SIZE_SWEEP_REJECTED                   234
+
+/* status codes specific to the agentd chaos test. */
+#define ERROR_AGENTD_CHAOS_CONFIGURATION                235
+#define ERROR_AGENTD_CHAOS_NO_SUPERVISOR                236
+#define ERROR_AGENTD_CHAOS_KILL                         237
+#define ERROR_AGENTD_CHAOS_UNRECOVERED                  238
+#define ERROR_AGENTD_CHAOS_THREAD_CREATE                239
+#define ERROR_AGENTD_CHAOS_OUT_OF_MEMORY                240
+
+/* status codes specific to the large buffer benchmark. */
+#define ERROR_LARGE_BUFFER_BENCH_CONFIGURATION          241
+#define ERROR_LARGE_BUFFER_BENCH_OUT_OF_MEMORY          242
+
+/* status codes specific to the session transport benchmark. */
+#define ERROR_SESSION_TRANSPORT_BENCH_CONFIGURATION     243
+#define ERROR_SESSION_TRANSPORT_BENCH_OUT_OF_MEMORY     244
+#define ERROR_SESSION_TRANSPORT_BENCH_IO                245
+#define ERROR_SESSION_TRANSPORT_BENCH_RESPONSE          246
+
+/* status codes specific to the zero-copy send benchmark. */
+#define ERROR_ZEROCOPY_SEND_BENCH_CONFIGURATION         247
+#define ERROR_ZEROCOPY_SEND_BENCH_OUT_OF_MEMORY         248
+#define ERROR_ZEROCOPY_SEND_BENCH_SOCKET                249
+
+/* status codes specific to the parallel session benchmark. */
+#define ERROR_PARALLEL_SESSION_BENCH_CONFIGURATION      250
+#define ERROR_PARALLEL_SESSION_BENCH_OUT_OF_MEMORY      251
+#define ERROR_PARALLEL_SESSION_BENCH_RESPONSE           252
+
+/* status codes specific to the reconnect benchmark. */
+#define ERROR_RECONNECT_BENCH_CONFIGURATION             253
+
+/* status codes specific to the single-flight benchmark. */
+#define ERROR_SINGLE_FLIGHT_BENCH_CONFIGURATION         254
+
+/* status codes specific to the chain navigation benchmark. */
+#define ERROR_CHAIN_NAV_BENCH_CONFIGURATION             255
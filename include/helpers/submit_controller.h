@@ -0,0 +1,116 @@
+/**
+ * \file helpers/submit_controller.h
+ *
+ * \brief An AIMD controller for the submission window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/submit_window.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Options for a submit controller.
+ *
+ * The latency target is latency_target_ns if it is non-zero. Otherwise it is
+ * latency_tolerance times the lowest acknowledgement latency seen so far,
+ * which approximates the round trip time of an idle agentd.
+ */
+typedef struct submit_controller_options submit_controller_options;
+
+struct submit_controller_options
+{
+    size_t min_window;
+    size_t max_window;
+    size_t initial_window;
+    double additive_increase;
+    double multiplicative_decrease;
+    double latency_tolerance;
+    uint64_t latency_target_ns;
+};
+
+/**
+ * \brief An additive increase, multiplicative decrease window controller.
+ *
+ * Each accepted acknowledgement grows the window by additive_increase
+ * divided by the window, so the window grows by additive_increase per
+ * window of acknowledgements. A rejected submission, or a smoothed
+ * acknowledgement latency above the target, shrinks the window by
+ * multiplicative_decrease. It shrinks at most once per window of
+ * acknowledgements, so that one overload does not cause several cuts.
+ *
+ * Latency grows once the window holds more submissions than agentd can
+ * absorb, so the window settles where throughput peaks but latency has not
+ * yet grown.
+ */
+typedef struct submit_controller submit_controller;
+
+struct submit_controller
+{
+    submit_controller_options opts;
+    double window;
+    uint64_t min_latency_ns;
+    double smoothed_latency_ns;
+    uint64_t acks_since_decrease;
+    uint64_t latency_decreases;
+    uint64_t reject_decreases;
+};
+
+/**
+ * \brief Initialize submit controller options with their defaults.
+ *
+ * The window ranges from 1 to 256 and starts at 1. It grows by 1 per window
+ * of acknowledgements, halves on overload, and the latency target is twice
+ * the lowest latency seen.
+ *
+ * \param opts          The options to initialize.
+ */
+void submit_controller_options_init(submit_controller_options* opts);
+
+/**
+ * \brief Initialize a submit controller.
+ *
+ * \param ctrl          The controller to initialize.
+ * \param opts          The options to use.
+ */
+void submit_controller_init(
+    submit_controller* ctrl, const submit_controller_options* opts);
+
+/**
+ * \brief Update the window from an acknowledgement.
+ *
+ * \param ctrl          The controller.
+ * \param ack           The acknowledgement.
+ */
+void submit_controller_on_ack(
+    submit_controller* ctrl, const submit_window_ack* ack);
+
+/**
+ * \brief Return the current window.
+ *
+ * \param ctrl          The controller.
+ *
+ * \returns the number of submissions that may be in flight.
+ */
+size_t submit_controller_window(const submit_controller* ctrl);
+
+/**
+ * \brief Return the current latency target.
+ *
+ * \param ctrl          The controller.
+ *
+ * \returns the latency target in nanoseconds, or 0 before the first
+ * accepted acknowledgement when the target is derived.
+ */
+uint64_t submit_controller_target_ns(const submit_controller* ctrl);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,187 @@
+/**
+ * \file helpers/submit_window.h
+ *
+ * \brief Pipelined transaction submission over one session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <helpers/latency_histogram.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdint.h>
+#include <vccrypt/buffer.h>
+#include <vccrypt/suite.h>
+#include <vpr/uuid.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A window of transaction submissions in flight on one session.
+ *
+ * Each submission is sent with its own request offset and is not waited
+ * for. Acknowledgements are matched to their submissions by offset, so they
+ * may arrive in any order. Once the window is full, submitting waits for the
+ * next acknowledgement. Submission throughput is then bound by agentd rather
+ * than by the round trip time.
+ *
+ * While a window is in use, it owns the session: no other request may be
+ * sent on it until the window is drained.
+ */
+typedef struct submit_window submit_window;
+
+/**
+ * \brief The acknowledgement of one submission.
+ *
+ * status is STATUS_SUCCESS if agentd accepted the transaction, or
+ * ERROR_TXN_SUBMIT_STATUS if it rejected it, in which case agentd_status
+ * holds its reason. latency_ns is the time from sending the submission to
+ * receiving its acknowledgement.
+ */
+typedef struct submit_window_ack submit_window_ack;
+
+struct submit_window_ack
+{
+    const vpr_uuid* txn_id;
+    uint32_t offset;
+    status status;
+    uint32_t agentd_status;
+    uint64_t latency_ns;
+    void* context;
+};
+
+/**
+ * \brief Called for each acknowledgement.
+ *
+ * \param context       The context given when the window was created.
+ * \param ack           The acknowledgement.
+ */
+typedef void (*submit_window_ack_fn)(
+    void* context, const submit_window_ack* ack);
+
+/**
+ * \brief Counters describing a window.
+ *
+ * latency holds the acknowledgement latency of accepted submissions.
+ */
+typedef struct submit_window_stats submit_window_stats;
+
+struct submit_window_stats
+{
+    uint64_t submitted;
+    uint64_t accepted;
+    uint64_t rejected;
+    uint64_t full_waits;
+    latency_histogram latency;
+};
+
+/**
+ * \brief Create a submission window.
+ *
+ * \param win           Pointer to the window pointer to receive the window on
+ *                      success.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param session       The session to submit on.
+ * \param window        The maximum number of submissions in flight. The
+ *                      limit may later be lowered and raised back up to
+ *                      this with \ref submit_window_set_limit.
+ * \param on_ack        Optional function called for each acknowledgement.
+ * \param context       The context passed to on_ack.
+ *
+ * \note On success, the caller owns the window and must release it by calling
+ * \ref submit_window_release when it is no longer needed. The session must
+ * outlive the window.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status submit_window_create(
+    submit_window** win, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, agentd_session* session, size_t window,
+    submit_window_ack_fn on_ack, void* context);
+
+/**
+ * \brief Submit a transaction, first waiting for an acknowledgement if the
+ * window is full.
+ *
+ * \param win           The window.
+ * \param txn_id        The transaction id.
+ * \param artifact_id   The artifact id.
+ * \param cert          The transaction certificate. It is sent before this
+ *                      function returns and may then be released.
+ * \param context       A value passed back in the acknowledgement.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on a transport or protocol failure, after
+ *        which the session can't be used.
+ */
+status submit_window_submit(
+    submit_window* win, const vpr_uuid* txn_id, const vpr_uuid* artifact_id,
+    const vccrypt_buffer_t* cert, void* context);
+
+/**
+ * \brief Wait for the acknowledgement of every submission in flight.
+ *
+ * \param win           The window.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on a transport or protocol failure.
+ */
+status submit_window_drain(submit_window* win);
+
+/**
+ * \brief Return the number of submissions in flight.
+ *
+ * \param win           The window.
+ *
+ * \returns the number of submissions in flight.
+ */
+size_t submit_window_in_flight(const submit_window* win);
+
+/**
+ * \brief Change the number of submissions that may be in flight.
+ *
+ * A lower limit takes effect as acknowledgements arrive; submissions already
+ * in flight are not recalled. This may be called from the acknowledgement
+ * function.
+ *
+ * \param win           The window.
+ * \param limit         The new limit, which is clamped to between 1 and the
+ *                      window given at creation.
+ */
+void submit_window_set_limit(submit_window* win, size_t limit);
+
+/**
+ * \brief Get the counters of a window, and reset them.
+ *
+ * \param win           The window.
+ * \param stats         Pointer to receive the counters.
+ */
+void submit_window_take_stats(submit_window* win, submit_window_stats* stats);
+
+/**
+ * \brief Release a window.
+ *
+ * Submissions still in flight are abandoned; call \ref submit_window_drain
+ * first to keep the session usable.
+ *
+ * \param win           The window to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status submit_window_release(submit_window* win);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,153 @@
+/**
+ * \file helpers/task_scheduler.h
+ *
+ * \brief A work-stealing task scheduler whose workers each own a session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <vctool/file.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A work-stealing task scheduler.
+ *
+ * Each worker thread owns an authenticated agentd session and a deque of
+ * tasks. A worker runs its own newest task first, which keeps the data of a
+ * task and its children hot. A worker with an empty deque steals the oldest
+ * task of another worker, which tends to be the largest remaining piece of
+ * work. Tasks of very uneven cost therefore spread out across workers
+ * without any up-front partitioning.
+ */
+typedef struct task_scheduler task_scheduler;
+
+/**
+ * \brief A task function.
+ *
+ * \param sched         The scheduler running the task. The task may spawn
+ *                      further tasks on it.
+ * \param session       The session owned by the worker running the task.
+ * \param arg           The argument given when the task was spawned.
+ */
+typedef void (*task_scheduler_fn)(
+    task_scheduler* sched, agentd_session* session, void* arg);
+
+/**
+ * \brief Counters describing the work done by one worker.
+ *
+ * busy_ns is the time spent running tasks. steals counts tasks taken from
+ * other workers, and is included in tasks.
+ */
+typedef struct task_scheduler_worker_stats task_scheduler_worker_stats;
+
+struct task_scheduler_worker_stats
+{
+    uint64_t tasks;
+    uint64_t steals;
+    uint64_t busy_ns;
+};
+
+/**
+ * \brief Create a task scheduler.
+ *
+ * \param sched         Pointer to the scheduler pointer to receive the
+ *                      scheduler on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param worker_count  The number of workers, each with its own session.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the caller owns the scheduler and must release it by
+ * calling \ref task_scheduler_release when it is no longer needed. The
+ * allocator and crypto suite must outlive the scheduler. Stealing starts out
+ * enabled.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status task_scheduler_create(
+    task_scheduler** sched, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, size_t worker_count,
+    const char* hostaddr, unsigned int hostport, const char* clientpriv,
+    const char* serverpub);
+
+/**
+ * \brief Run every remaining task, then stop the workers and release the
+ * scheduler.
+ *
+ * \param sched         The scheduler to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status task_scheduler_release(task_scheduler* sched);
+
+/**
+ * \brief Spawn a task.
+ *
+ * A task spawned from a running task is pushed onto its worker's own deque.
+ * A task spawned from any other thread is given to the workers in turn.
+ *
+ * \param sched         The scheduler.
+ * \param fn            The task function.
+ * \param arg           The argument passed to the task function.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status task_scheduler_spawn(
+    task_scheduler* sched, task_scheduler_fn fn, void* arg);
+
+/**
+ * \brief Wait until every spawned task, and every task they spawned, has
+ * run.
+ *
+ * This must not be called from a task.
+ *
+ * \param sched         The scheduler.
+ */
+void task_scheduler_wait(task_scheduler* sched);
+
+/**
+ * \brief Enable or disable stealing.
+ *
+ * With stealing disabled, each worker only runs the tasks given to it, which
+ * is a static partition of the work. This is useful as a baseline.
+ *
+ * \param sched         The scheduler.
+ * \param enabled       true to enable stealing.
+ */
+void task_scheduler_set_stealing(task_scheduler* sched, bool enabled);
+
+/**
+ * \brief Get the counters of each worker, and reset them.
+ *
+ * This should be called while the scheduler is idle.
+ *
+ * \param sched         The scheduler.
+ * \param stats         Array of one entry per worker to receive the counters.
+ */
+void task_scheduler_take_stats(
+    task_scheduler* sched, task_scheduler_worker_stats* stats);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
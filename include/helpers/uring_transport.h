@@ -0,0 +1,183 @@
+/**
+ * \file helpers/uring_transport.h
+ *
+ * \brief An io_uring transport that batches requests across many sessions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <helpers/session_frame.h>
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A transport driving many sessions through one io_uring instance.
+ *
+ * The blocking path spends at least one write and one read system call per
+ * request, and usually several, because psock reads a frame header before its
+ * body. This transport instead queues the write of each request, and a
+ * receive for its response, on a shared submission queue, then submits
+ * everything queued across every session with a single io_uring_enter call
+ * that also waits for completions. Frames are encrypted and decrypted in
+ * memory with \ref session_frame_encode and \ref session_frame_decode, so
+ * sessions stay interchangeable with the blocking path between requests.
+ *
+ * Each session may have one request outstanding at a time. The transport is
+ * not synchronized; one thread drives it.
+ */
+typedef struct uring_transport uring_transport;
+
+/**
+ * \brief The outcome of one request.
+ *
+ * If retval is STATUS_SUCCESS, response holds the decrypted response, which
+ * the caller must dispose. Otherwise, the session has failed and should be
+ * removed from use.
+ */
+typedef struct uring_transport_completion uring_transport_completion;
+
+struct uring_transport_completion
+{
+    size_t session;
+    status retval;
+    vccrypt_buffer_t response;
+};
+
+/**
+ * \brief Counters describing the use of a transport.
+ *
+ * enters counts io_uring_enter calls, which are the only system calls the
+ * transport makes once sessions are added. submitted counts the
+ * operations those calls submitted, and completed counts the completions
+ * reaped.
+ */
+typedef struct uring_transport_stats uring_transport_stats;
+
+struct uring_transport_stats
+{
+    uint64_t enters;
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t responses;
+};
+
+/**
+ * \brief Create a transport.
+ *
+ * \param transport     Pointer to the transport pointer to receive the
+ *                      transport on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param max_sessions  The largest number of sessions that will be added.
+ *
+ * \note On success, the caller owns the transport and must release it by
+ * calling \ref uring_transport_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_SETUP if the kernel doesn't support io_uring
+ *        or it is disabled.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_create(
+    uring_transport** transport, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, size_t max_sessions);
+
+/**
+ * \brief Add a session to a transport.
+ *
+ * The session and its descriptor remain owned by the caller and must outlive
+ * the transport. While a request is outstanding on it, the session must not
+ * be used through any other path.
+ *
+ * \param transport     The transport.
+ * \param session       The session, whose socket wraps descriptor.
+ * \param descriptor    The socket descriptor of the session, as passed to
+ *                      \ref agentd_session_init_from_descriptor.
+ * \param index         Pointer to receive the index identifying the session
+ *                      in this transport.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_add_session(
+    uring_transport* transport, agentd_session* session, int descriptor,
+    size_t* index);
+
+/**
+ * \brief Queue a request on a session.
+ *
+ * The request is encrypted now, but is not written until the next call to
+ * \ref uring_transport_wait, which submits every queued request at once.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ * \param encode        The function writing the request.
+ * \param context       The request arguments passed to encode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_BUSY if the session already has a request
+ *        outstanding.
+ *      - ERROR_URING_TRANSPORT_CLOSED if the session has failed.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_send(
+    uring_transport* transport, size_t index, session_frame_encode_fn encode,
+    void* context);
+
+/**
+ * \brief Submit every queued operation and wait for requests to complete.
+ *
+ * This blocks until at least one request completes, then returns as many
+ * completions as are ready, up to max.
+ *
+ * \param transport     The transport.
+ * \param completions   Array to receive the completions.
+ * \param max           The size of the array.
+ * \param count         Pointer to receive the number of completions, which is
+ *                      zero only if no request was outstanding.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_wait(
+    uring_transport* transport, uring_transport_completion* completions,
+    size_t max, size_t* count);
+
+/**
+ * \brief Get a snapshot of the transport counters.
+ *
+ * \param transport     The transport.
+ * \param stats         The structure to receive the counters.
+ */
+void uring_transport_get_stats(
+    const uring_transport* transport, uring_transport_stats* stats);
+
+/**
+ * \brief Release a transport.
+ *
+ * Outstanding requests are cancelled first.
+ *
+ * \param transport     The transport to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_release(uring_transport* transport);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
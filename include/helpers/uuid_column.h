@@ -0,0 +1,151 @@
+/**
+ * \file helpers/uuid_column.h
+ *
+ * \brief Vectorized matching of UUIDs against flat UUID columns.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The size of one entry of a UUID column.
+ */
+#define UUID_COLUMN_ENTRY_SIZE                                  16
+
+/**
+ * \brief The implementation of the column kernels.
+ *
+ * A UUID column is a flat array of 16-byte UUIDs, such as the transaction
+ * IDs or artifact IDs of a decoded block. The kernels compare a UUID against
+ * many entries at once. They are not constant time, so they must only be
+ * used on public data such as transaction and artifact IDs.
+ */
+typedef enum uuid_column_impl uuid_column_impl;
+
+enum uuid_column_impl
+{
+    UUID_COLUMN_IMPL_SCALAR,
+    UUID_COLUMN_IMPL_SSE2,
+    UUID_COLUMN_IMPL_AVX2,
+    UUID_COLUMN_IMPL_COUNT
+};
+
+/**
+ * \brief Return true if the given implementation can run on this CPU.
+ *
+ * \param impl          The implementation.
+ *
+ * \returns true if the implementation is supported.
+ */
+bool uuid_column_impl_supported(uuid_column_impl impl);
+
+/**
+ * \brief Return the fastest implementation that can run on this CPU.
+ *
+ * \returns the implementation.
+ */
+uuid_column_impl uuid_column_impl_best(void);
+
+/**
+ * \brief Return the name of an implementation.
+ *
+ * \param impl          The implementation.
+ *
+ * \returns the name.
+ */
+const char* uuid_column_impl_name(uuid_column_impl impl);
+
+/**
+ * \brief Find the first entry of a column equal to a UUID.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to find.
+ *
+ * \returns the index of the entry, or count if there is none.
+ */
+size_t uuid_column_find(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* id);
+
+/**
+ * \brief Count the entries of a column equal to a UUID.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to count.
+ *
+ * \returns the number of equal entries.
+ */
+size_t uuid_column_count(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* id);
+
+/**
+ * \brief Clear the mask of every entry of a column not equal to a UUID.
+ *
+ * Filtering the same mask by several columns keeps the rows that match on
+ * all of them, as a columnar scan with several equality predicates does.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to keep.
+ * \param mask          One byte per entry, 1 to keep it and 0 to drop it.
+ *                      Entries equal to the UUID are left as they are.
+ */
+void uuid_column_filter(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* id, uint8_t* mask);
+
+/**
+ * \brief Find each of many candidate UUIDs in a column.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param ids           The candidates, as a column.
+ * \param id_count      The number of candidates.
+ * \param indexes       Array of one entry per candidate to receive the index
+ *                      of its first match, or count if there is none.
+ *
+ * \returns the number of candidates found.
+ */
+size_t uuid_column_find_many(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* ids, size_t id_count, size_t* indexes);
+
+/**
+ * \brief Count the matches of each of many candidate UUIDs in a column.
+ *
+ * Given a column of artifact IDs, this counts the transactions of each
+ * candidate artifact.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param ids           The candidates, as a column.
+ * \param id_count      The number of candidates.
+ * \param counts        Array of one entry per candidate to receive its
+ *                      number of matches.
+ *
+ * \returns the total number of matches.
+ */
+size_t uuid_column_count_many(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* ids, size_t id_count, size_t* counts);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,180 @@
+/**
+ * \file helpers/zerocopy_sender.h
+ *
+ * \brief Send large frames with MSG_ZEROCOPY.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <rcpr/allocator.h>
+#include <rcpr/status.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A sender writing frames to a socket without copying them.
+ *
+ * A normal send copies the whole frame into socket buffers before returning,
+ * which for a multi-megabyte encrypted frame is a measurable share of the
+ * CPU spent on it. With MSG_ZEROCOPY, the kernel pins the frame's pages and
+ * transmits from them directly, so the frame must stay untouched until the
+ * kernel reports on the socket's error queue that it is done with it. The
+ * sender takes ownership of each frame, tracks those notifications, and
+ * hands the frame back through a release callback only once every byte of it
+ * has been transmitted.
+ *
+ * Frames smaller than min_size gain nothing from page pinning and
+ * notifications, so they are sent normally and released at once, as are all
+ * frames if the socket doesn't support SO_ZEROCOPY. The kernel may also
+ * decide to copy a zero-copy send after all, for instance when the peer is on
+ * the loopback interface; such frames are counted as copied.
+ *
+ * The sender is not synchronized. Its socket may be read concurrently by the
+ * usual path, since notifications arrive on the error queue only.
+ */
+typedef struct zerocopy_sender zerocopy_sender;
+
+/**
+ * \brief Called when the kernel no longer needs a frame.
+ *
+ * \param context       The release context from the options.
+ * \param frame         The frame passed to \ref zerocopy_sender_send.
+ */
+typedef void (*zerocopy_sender_release_fn)(void* context, void* frame);
+
+/**
+ * \brief Options for creating a sender.
+ *
+ * max_pending bounds the frames awaiting their completion notification;
+ * sending another blocks until one is released.
+ */
+typedef struct zerocopy_sender_options zerocopy_sender_options;
+
+struct zerocopy_sender_options
+{
+    size_t min_size;
+    size_t max_pending;
+    zerocopy_sender_release_fn release;
+    void* context;
+};
+
+/**
+ * \brief Counters describing the use of a sender.
+ *
+ * zerocopy_frames counts frames sent with MSG_ZEROCOPY, of which
+ * copied_frames were copied by the kernel anyway. fallback_sends counts
+ * sends retried without MSG_ZEROCOPY because the kernel was out of memory
+ * for pinning.
+ */
+typedef struct zerocopy_sender_stats zerocopy_sender_stats;
+
+struct zerocopy_sender_stats
+{
+    bool enabled;
+    uint64_t frames;
+    uint64_t bytes;
+    uint64_t zerocopy_frames;
+    uint64_t copied_frames;
+    uint64_t fallback_sends;
+    uint64_t notifications;
+    size_t peak_pending;
+};
+
+/**
+ * \brief Initialize sender options with their defaults.
+ *
+ * The defaults send frames of 1 MiB and up without copying, with up to 8
+ * frames pending, and no release callback.
+ *
+ * \param opts          The options to initialize.
+ */
+void zerocopy_sender_options_init(zerocopy_sender_options* opts);
+
+/**
+ * \brief Create a sender for a connected stream socket.
+ *
+ * \param sender        Pointer to the sender pointer to receive the sender on
+ *                      success.
+ * \param alloc         The allocator to use for this operation.
+ * \param descriptor    The socket, which remains owned by the caller and
+ *                      must outlive the sender. The kernel numbers zero-copy
+ *                      sends per socket, so no other sender may ever have
+ *                      used this socket.
+ * \param opts          The sender options.
+ *
+ * \note On success, the caller owns the sender and must release it by calling
+ * \ref zerocopy_sender_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status zerocopy_sender_create(
+    zerocopy_sender** sender, RCPR_SYM(allocator)* alloc, int descriptor,
+    const zerocopy_sender_options* opts);
+
+/**
+ * \brief Send a frame, taking ownership of it.
+ *
+ * This returns once every byte of the frame is queued on the socket. The
+ * frame is passed to the release callback, possibly before this returns,
+ * once the kernel no longer reads from it. On failure, it is released
+ * before this returns.
+ *
+ * \param sender        The sender.
+ * \param frame         The frame.
+ * \param size          The size of the frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SENDER_IO if the socket failed.
+ */
+status zerocopy_sender_send(
+    zerocopy_sender* sender, void* frame, size_t size);
+
+/**
+ * \brief Release every frame the kernel has finished with, optionally
+ * waiting until that is every pending frame.
+ *
+ * \param sender        The sender.
+ * \param wait          If true, block until no frame is pending.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SENDER_IO if the socket failed.
+ */
+status zerocopy_sender_reap(zerocopy_sender* sender, bool wait);
+
+/**
+ * \brief Get a snapshot of the sender counters.
+ *
+ * \param sender        The sender.
+ * \param stats         The structure to receive the counters.
+ */
+void zerocopy_sender_get_stats(
+    const zerocopy_sender* sender, zerocopy_sender_stats* stats);
+
+/**
+ * \brief Release a sender, first waiting for every pending frame.
+ *
+ * If the socket has failed, frames still pending are passed to the release
+ * callback without waiting for the kernel to report them.
+ *
+ * \param sender        The sender to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status zerocopy_sender_release(zerocopy_sender* sender);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,875 @@
+/**
+ * \file agentd_chaos/main.c
+ *
+ * \brief Main entry point for the agentd chaos test.
+ *
+ * This test measures how agentd recovers when one of its service processes
+ * dies under load. Worker threads each keep a session open and issue a
+ * steady stream of latest block id reads, with a transaction submission
+ * every CHAOS_SUBMIT_EVERY requests. A worker whose session breaks opens a
+ * new one, retrying every CHAOS_RECONNECT_MS until agentd accepts it.
+ *
+ * After measuring baseline throughput, the test kills CHAOS_KILLS service
+ * processes, one at a time, with SIGKILL. Victims are children of the
+ * supervisor, optionally restricted to those whose command line contains one
+ * of the comma separated names in CHAOS_VICTIMS; the supervisor itself is
+ * never killed. For each kill it reports:
+ *
+ *  - the time until the supervisor has replaced the victim, as seen in the
+ *    process table;
+ *  - the time until clients are served again, which is the end of the first
+ *    sample interval after the disruption with successes and no failures;
+ *  - the number of requests that failed, and the number of sessions that
+ *    had to be reopened;
+ *  - the time until throughput over CHAOS_RECOVERY_WINDOW_MS is back to
+ *    CHAOS_RECOVERY_PERCENT of the baseline, measured to the start of that
+ *    window.
+ *
+ * A kill that agentd doesn't recover from within CHAOS_RECOVERY_TIMEOUT_MS
+ * fails the test.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_session.h>
+#include <helpers/agentd_status.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/proc_stats.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+#define CHAOS_MAX_WINDOW_SAMPLES 1024
+
+/**
+ * \brief Test settings.
+ */
+typedef struct chaos_settings chaos_settings;
+
+struct chaos_settings
+{
+    size_t worker_count;
+    size_t kills;
+    const char* victims;
+    uint64_t sample_ns;
+    uint64_t baseline_ns;
+    uint64_t window_ns;
+    size_t window_samples;
+    size_t recovery_percent;
+    uint64_t recovery_timeout_ns;
+    uint64_t settle_ns;
+};
+
+/**
+ * \brief Shared test state.
+ *
+ * The request counters are updated by the workers and sampled by the main
+ * thread.
+ */
+typedef struct chaos_context chaos_context;
+
+struct chaos_context
+{
+    rcpr_allocator* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    vccert_builder_options_t* builder_opts;
+    size_t submit_every;
+    uint64_t reconnect_ns;
+    atomic_bool stop;
+    atomic_uint_fast64_t successes;
+    atomic_uint_fast64_t failures;
+    atomic_uint_fast64_t reconnects;
+    atomic_uint_fast64_t connect_failures;
+};
+
+/**
+ * \brief Per-worker test state.
+ */
+typedef struct chaos_worker chaos_worker;
+
+struct chaos_worker
+{
+    pthread_t thread;
+    chaos_context* ctx;
+    load_stats stats;
+};
+
+/**
+ * \brief A sample of the shared request counters.
+ */
+typedef struct chaos_counters chaos_counters;
+
+struct chaos_counters
+{
+    uint64_t successes;
+    uint64_t failures;
+    uint64_t reconnects;
+};
+
+/**
+ * \brief The outcome of a single kill.
+ *
+ * Times are measured from the kill, and are only valid if the matching flag
+ * is set.
+ */
+typedef struct chaos_result chaos_result;
+
+struct chaos_result
+{
+    bool disrupted;
+    bool process_restored;
+    bool service_restored;
+    bool baseline_restored;
+    uint64_t process_ns;
+    uint64_t service_ns;
+    uint64_t baseline_ns;
+    uint64_t failures;
+    uint64_t reconnects;
+};
+
+/* forward decls. */
+static status measure_baseline(
+    chaos_context* ctx, const chaos_settings* settings, double* rate);
+static status kill_one(
+    chaos_context* ctx, const chaos_settings* settings, size_t kill,
+    double baseline_rate, chaos_result* result);
+static size_t find_supervisor(const proc_snapshot* snapshot);
+static size_t count_children(const proc_snapshot* snapshot, pid_t parent);
+static bool pick_victim(
+    const chaos_settings* settings, const proc_snapshot* snapshot,
+    pid_t supervisor, size_t kill, proc_info* victim);
+static bool matches_victims(const char* victims, const char* cmdline);
+static void read_counters(chaos_context* ctx, chaos_counters* counters);
+static void print_ms(uint64_t ns, bool reached);
+static void* chaos_worker_main(void* context);
+static status chaos_request(
+    chaos_context* ctx, agentd_session* session, size_t request);
+
+/**
+ * \brief Main entry point for the agentd chaos test.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    chaos_context ctx;
+    chaos_settings settings;
+    chaos_worker* workers = NULL;
+    chaos_result result;
+    load_stats merged;
+    size_t started = 0, unrecovered = 0;
+    double baseline_rate;
+    uint64_t start;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.submit_every = env_get_size("CHAOS_SUBMIT_EVERY", 10);
+    ctx.reconnect_ns = env_get_size("CHAOS_RECONNECT_MS", 50) * 1000000;
+
+    memset(&settings, 0, sizeof(settings));
+    settings.worker_count = env_get_size("CHAOS_WORKERS", 4);
+    settings.kills = env_get_size("CHAOS_KILLS", 3);
+    settings.victims = env_get_string("CHAOS_VICTIMS", "");
+    settings.sample_ns = env_get_size("CHAOS_SAMPLE_MS", 50) * 1000000;
+    settings.baseline_ns = env_get_size("CHAOS_BASELINE_MS", 5000) * 1000000;
+    settings.window_ns =
+        env_get_size("CHAOS_RECOVERY_WINDOW_MS", 1000) * 1000000;
+    settings.recovery_percent = env_get_size("CHAOS_RECOVERY_PERCENT", 90);
+    settings.recovery_timeout_ns =
+        env_get_size("CHAOS_RECOVERY_TIMEOUT_MS", 30000) * 1000000;
+    settings.settle_ns = env_get_size("CHAOS_SETTLE_MS", 2000) * 1000000;
+    if (0 != settings.sample_ns)
+    {
+        settings.window_samples = settings.window_ns / settings.sample_ns;
+    }
+
+    if (0 == settings.worker_count || 0 == settings.sample_ns
+     || 0 == settings.window_samples
+     || settings.window_samples > CHAOS_MAX_WINDOW_SAMPLES
+     || settings.baseline_ns < settings.sample_ns
+     || 0 == settings.recovery_percent || settings.recovery_percent > 100
+     || 0 == ctx.reconnect_ns)
+    {
+        fprintf(stderr, "Bad agentd chaos configuration.\n");
+        return ERROR_AGENTD_CHAOS_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    ctx.alloc = alloc;
+    ctx.file = &file;
+    ctx.suite = &suite;
+    ctx.builder_opts = &builder_opts;
+
+    workers = calloc(settings.worker_count, sizeof(chaos_worker));
+    if (NULL == workers)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        retval = ERROR_AGENTD_CHAOS_OUT_OF_MEMORY;
+        goto cleanup_file;
+    }
+
+    /* start the load. */
+    start = latency_clock_now_ns();
+    for (started = 0; started < settings.worker_count; ++started)
+    {
+        workers[started].ctx = &ctx;
+        load_stats_init(&workers[started].stats);
+        if (0 !=
+                pthread_create(
+                    &workers[started].thread, NULL, &chaos_worker_main,
+                    &workers[started]))
+        {
+            fprintf(stderr, "Error starting chaos worker %zu.\n", started);
+            retval = ERROR_AGENTD_CHAOS_THREAD_CREATE;
+            goto stop_workers;
+        }
+    }
+
+    retval = measure_baseline(&ctx, &settings, &baseline_rate);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto stop_workers;
+    }
+
+    printf(
+        "%zu workers, baseline %.0f requests/s, recovered at %zu%% over "
+        "%" PRIu64 " ms\n", settings.worker_count, baseline_rate,
+        settings.recovery_percent, settings.window_ns / 1000000);
+    printf(
+        "%4s %8s %-40s %10s %10s %10s %8s %10s\n", "kill", "pid", "victim",
+        "process", "service", "baseline", "failed", "reconnects");
+
+    for (size_t i = 0; i < settings.kills; ++i)
+    {
+        retval = kill_one(&ctx, &settings, i, baseline_rate, &result);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto stop_workers;
+        }
+
+        if (!result.process_restored || !result.service_restored
+         || !result.baseline_restored)
+        {
+            ++unrecovered;
+        }
+
+        /* let the load settle before the next kill. */
+        usleep(settings.settle_ns / 1000);
+    }
+
+    if (0 != unrecovered)
+    {
+        fprintf(
+            stderr, "%zu of %zu kills were not recovered from.\n",
+            unrecovered, settings.kills);
+        retval = ERROR_AGENTD_CHAOS_UNRECOVERED;
+    }
+
+stop_workers:
+    atomic_store(&ctx.stop, true);
+    load_stats_init(&merged);
+    for (size_t i = 0; i < started; ++i)
+    {
+        pthread_join(workers[i].thread, NULL);
+        load_stats_merge(&merged, &workers[i].stats);
+    }
+
+    load_stats_print(
+        &merged, stdout, "chaos", (latency_clock_now_ns() - start) / 1e9);
+    printf(
+        "session reconnects: %" PRIu64 ", failed connection attempts: "
+        "%" PRIu64 "\n", (uint64_t)atomic_load(&ctx.reconnects),
+        (uint64_t)atomic_load(&ctx.connect_failures));
+
+    free(workers);
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Measure the request rate of the undisturbed load.
+ *
+ * The first sample interval is discarded, to give the workers time to
+ * connect.
+ *
+ * \param ctx           The test context.
+ * \param settings      The test settings.
+ * \param rate          Pointer to receive the successful requests per
+ *                      second.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_AGENTD_CHAOS_UNRECOVERED if no request succeeded.
+ */
+static status measure_baseline(
+    chaos_context* ctx, const chaos_settings* settings, double* rate)
+{
+    chaos_counters before, after;
+    uint64_t start;
+
+    usleep(settings->sample_ns / 1000);
+
+    read_counters(ctx, &before);
+    start = latency_clock_now_ns();
+    usleep(settings->baseline_ns / 1000);
+    read_counters(ctx, &after);
+
+    *rate =
+        (after.successes - before.successes)
+            / ((latency_clock_now_ns() - start) / 1e9);
+    if (0 == after.successes - before.successes)
+    {
+        fprintf(stderr, "No request succeeded before the first kill.\n");
+        return ERROR_AGENTD_CHAOS_UNRECOVERED;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Kill one service process and watch the recovery.
+ *
+ * \param ctx           The test context.
+ * \param settings      The test settings.
+ * \param kill_index    The index of this kill.
+ * \param baseline_rate The undisturbed successful requests per second.
+ * \param result        The result to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, even if agentd didn't recover.
+ *      - a non-zero error code if no victim could be killed.
+ */
+static status kill_one(
+    chaos_context* ctx, const chaos_settings* settings, size_t kill_index,
+    double baseline_rate, chaos_result* result)
+{
+    status retval;
+    proc_snapshot snapshot;
+    proc_info victim;
+    pid_t supervisor;
+    size_t children, index, window_fill = 0, window_pos = 0;
+    uint64_t window[CHAOS_MAX_WINDOW_SAMPLES];
+    uint64_t window_sum = 0, start, now, successes, failures;
+    chaos_counters before, prev, sample;
+    double window_target =
+        baseline_rate * settings->window_samples * settings->sample_ns / 1e9
+            * settings->recovery_percent / 100.0;
+
+    memset(result, 0, sizeof(*result));
+
+    retval = proc_snapshot_take(&snapshot, "agentd");
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    index = find_supervisor(&snapshot);
+    if (index == snapshot.count)
+    {
+        fprintf(stderr, "The agentd supervisor is not running.\n");
+        return ERROR_AGENTD_CHAOS_NO_SUPERVISOR;
+    }
+
+    supervisor = snapshot.procs[index].pid;
+    children = count_children(&snapshot, supervisor);
+    if (!pick_victim(settings, &snapshot, supervisor, kill_index, &victim))
+    {
+        fprintf(stderr, "No agentd service matches CHAOS_VICTIMS.\n");
+        return ERROR_AGENTD_CHAOS_NO_SUPERVISOR;
+    }
+
+    read_counters(ctx, &before);
+    prev = before;
+    start = latency_clock_now_ns();
+    if (0 != kill(victim.pid, SIGKILL))
+    {
+        fprintf(
+            stderr, "Error killing agentd service %d (%s).\n",
+            (int)victim.pid, strerror(errno));
+        return ERROR_AGENTD_CHAOS_KILL;
+    }
+
+    do
+    {
+        usleep(settings->sample_ns / 1000);
+        now = latency_clock_now_ns();
+        read_counters(ctx, &sample);
+        successes = sample.successes - prev.successes;
+        failures = sample.failures - prev.failures;
+        prev = sample;
+
+        /* the victim is replaced once the supervisor is back to strength. */
+        if (!result->process_restored
+         && STATUS_SUCCESS == proc_snapshot_take(&snapshot, "agentd"))
+        {
+            bool victim_gone = true;
+
+            for (size_t i = 0; i < snapshot.count; ++i)
+            {
+                if (snapshot.procs[i].pid == victim.pid)
+                {
+                    victim_gone = false;
+                }
+            }
+
+            if (victim_gone
+             && count_children(&snapshot, supervisor) >= children)
+            {
+                result->process_restored = true;
+                result->process_ns = now - start;
+            }
+        }
+
+        /* clients notice the kill as failures, or as a stall. */
+        if (!result->disrupted && (0 != failures || 0 == successes))
+        {
+            result->disrupted = true;
+        }
+
+        if (result->disrupted && !result->service_restored)
+        {
+            if (0 != successes && 0 == failures)
+            {
+                result->service_restored = true;
+                result->service_ns = now - start;
+            }
+
+            continue;
+        }
+
+        /* throughput is compared over a window after service is back. */
+        if (window_fill == settings->window_samples)
+        {
+            window_sum -= window[window_pos];
+        }
+        else
+        {
+            ++window_fill;
+        }
+
+        window[window_pos] = successes;
+        window_sum += successes;
+        window_pos = (window_pos + 1) % settings->window_samples;
+
+        if (!result->baseline_restored
+         && window_fill == settings->window_samples
+         && window_sum >= window_target)
+        {
+            result->baseline_restored = true;
+            result->baseline_ns =
+                now - start - settings->window_samples * settings->sample_ns;
+        }
+    } while ((!result->process_restored || !result->baseline_restored)
+          && now - start < settings->recovery_timeout_ns);
+
+    /* a kill that never disturbed the clients needed no recovery. */
+    if (!result->disrupted)
+    {
+        result->service_restored = true;
+    }
+
+    result->failures = prev.failures - before.failures;
+    result->reconnects = prev.reconnects - before.reconnects;
+
+    printf("%4zu %8d %-40.40s", kill_index, (int)victim.pid, victim.cmdline);
+    print_ms(result->process_ns, result->process_restored);
+    print_ms(result->service_ns, result->service_restored);
+    print_ms(result->baseline_ns, result->baseline_restored);
+    printf(
+        " %8" PRIu64 " %10" PRIu64 "\n", result->failures,
+        result->reconnects);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Find the agentd supervisor in a snapshot.
+ *
+ * \param snapshot      The snapshot to search.
+ *
+ * \returns the index of the supervisor, or snapshot->count if there is none.
+ */
+static size_t find_supervisor(const proc_snapshot* snapshot)
+{
+    for (size_t i = 0; i < snapshot->count; ++i)
+    {
+        if (NULL != strstr(snapshot->procs[i].cmdline, "supervisor"))
+        {
+            return i;
+        }
+    }
+
+    return snapshot->count;
+}
+
+/**
+ * \brief Count the processes in a snapshot with a given parent.
+ *
+ * \param snapshot      The snapshot to search.
+ * \param parent        The parent pid.
+ *
+ * \returns the number of children.
+ */
+static size_t count_children(const proc_snapshot* snapshot, pid_t parent)
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < snapshot->count; ++i)
+    {
+        if (snapshot->procs[i].ppid == parent)
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Pick the service process to kill.
+ *
+ * The eligible processes are the children of the supervisor that match
+ * CHAOS_VICTIMS. Successive kills cycle through them.
+ *
+ * \param settings      The test settings.
+ * \param snapshot      The current agentd processes.
+ * \param supervisor    The supervisor pid.
+ * \param kill_index    The index of this kill.
+ * \param victim        Pointer to receive the victim.
+ *
+ * \returns true if a victim was found, and false otherwise.
+ */
+static bool pick_victim(
+    const chaos_settings* settings, const proc_snapshot* snapshot,
+    pid_t supervisor, size_t kill_index, proc_info* victim)
+{
+    size_t eligible = 0, pick;
+
+    for (size_t i = 0; i < snapshot->count; ++i)
+    {
+        if (snapshot->procs[i].ppid == supervisor
+         && matches_victims(settings->victims, snapshot->procs[i].cmdline))
+        {
+            ++eligible;
+        }
+    }
+
+    if (0 == eligible)
+    {
+        return false;
+    }
+
+    pick = kill_index % eligible;
+    for (size_t i = 0; i < snapshot->count; ++i)
+    {
+        if (snapshot->procs[i].ppid == supervisor
+         && matches_victims(settings->victims, snapshot->procs[i].cmdline)
+         && 0 == pick--)
+        {
+            *victim = snapshot->procs[i];
+            break;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Check a command line against the comma separated victim names.
+ *
+ * \param victims       The victim names; an empty list matches everything.
+ * \param cmdline       The command line to check.
+ *
+ * \returns true if the command line contains one of the names.
+ */
+static bool matches_victims(const char* victims, const char* cmdline)
+{
+    char name[64];
+    const char* end;
+    size_t len;
+
+    if ('\0' == *victims)
+    {
+        return true;
+    }
+
+    while ('\0' != *victims)
+    {
+        end = strchr(victims, ',');
+        len = (NULL == end) ? strlen(victims) : (size_t)(end - victims);
+        if (len > 0 && len < sizeof(name))
+        {
+            memcpy(name, victims, len);
+            name[len] = 0;
+            if (NULL != strstr(cmdline, name))
+            {
+                return true;
+            }
+        }
+
+        victims += len;
+        if (',' == *victims)
+        {
+            ++victims;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Sample the shared request counters.
+ *
+ * \param ctx           The test context.
+ * \param counters      The sample to populate.
+ */
+static void read_counters(chaos_context* ctx, chaos_counters* counters)
+{
+    counters->successes = atomic_load(&ctx->successes);
+    counters->failures = atomic_load(&ctx->failures);
+    counters->reconnects = atomic_load(&ctx->reconnects);
+}
+
+/**
+ * \brief Print a recovery time column.
+ *
+ * \param ns            The time, in nanoseconds.
+ * \param reached       false if recovery timed out.
+ */
+static void print_ms(uint64_t ns, bool reached)
+{
+    if (reached)
+    {
+        printf(" %10.1f", ns / 1e6);
+    }
+    else
+    {
+        printf(" %10s", "timeout");
+    }
+}
+
+/**
+ * \brief Entry point for a worker thread.
+ *
+ * \param context       The \ref chaos_worker for this thread.
+ *
+ * \returns NULL.
+ */
+static void* chaos_worker_main(void* context)
+{
+    chaos_worker* worker = (chaos_worker*)context;
+    chaos_context* ctx = worker->ctx;
+    agentd_session session;
+    bool connected = false, ever_connected = false;
+    size_t request = 0;
+    status retval;
+    uint64_t start;
+
+    while (!atomic_load(&ctx->stop))
+    {
+        if (!connected)
+        {
+            retval =
+                agentd_session_init(
+                    &session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1",
+                    4931, "test.priv", "agentd.pub");
+            if (STATUS_SUCCESS != retval)
+            {
+                atomic_fetch_add(&ctx->connect_failures, 1);
+                usleep(ctx->reconnect_ns / 1000);
+                continue;
+            }
+
+            if (ever_connected)
+            {
+                atomic_fetch_add(&ctx->reconnects, 1);
+            }
+
+            connected = ever_connected = true;
+        }
+
+        agentd_status_clear();
+        start = latency_clock_now_ns();
+        retval = chaos_request(ctx, &session, ++request);
+        load_stats_record(
+            &worker->stats, retval, latency_clock_now_ns() - start);
+
+        if (STATUS_SUCCESS == retval)
+        {
+            atomic_fetch_add(&ctx->successes, 1);
+        }
+        else
+        {
+            atomic_fetch_add(&ctx->failures, 1);
+
+            /* a broken session can't be reused. */
+            if (status_is_transport_error(retval))
+            {
+                agentd_session_dispose(&session);
+                connected = false;
+            }
+        }
+    }
+
+    if (connected)
+    {
+        send_and_verify_close_connection(
+            session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+        agentd_session_dispose(&session);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Issue one request of the load.
+ *
+ * \param ctx           The test context.
+ * \param session       The session to use.
+ * \param request       The number of this request on this worker.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status chaos_request(
+    chaos_context* ctx, agentd_session* session, size_t request)
+{
+    status retval;
+    vccrypt_buffer_t cert;
+    vpr_uuid txn_id, artifact_id, block_id;
+    const rcpr_uuid* client_id;
+    const vccrypt_buffer_t* client_sign_priv;
+
+    if (0 == ctx->submit_every || 0 != request % ctx->submit_every)
+    {
+        return
+            get_and_verify_last_block_id(
+                session->sock, ctx->alloc, ctx->suite, &session->client_iv,
+                &session->server_iv, &session->shared_secret, &block_id);
+    }
+
+    retval = vcblockchain_entity_get_artifact_id(&client_id, session->cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vcblockchain_entity_private_cert_get_private_signing_key(
+            &client_sign_priv, session->cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        create_transaction_cert(
+            &cert, (rcpr_uuid*)&txn_id, (rcpr_uuid*)&artifact_id,
+            ctx->builder_opts, client_id, client_sign_priv);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_TRANSACTION_CERT_CREATE;
+    }
+
+    retval =
+        submit_and_verify_txn(
+            session->sock, ctx->alloc, ctx->suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &txn_id,
+            &artifact_id, &cert);
+
+    dispose((disposable_t*)&cert);
+
+    return retval;
+}
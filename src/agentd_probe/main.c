@@ -0,0 +1,554 @@
+/**
+ * \file agentd_probe/main.c
+ *
+ * \brief Main entry point for the agentd synthetic monitoring probe.
+ *
+ * The probe keeps a warm, authenticated session with agentd and, at a fixed
+ * interval, issues a status request and a latest block id request on it. This
+ * exercises the full authenticated request path rather than TCP liveness.
+ *
+ * At the end of each reporting window, the probe prints a summary and, if
+ * PROBE_METRICS_FILE is set, atomically rewrites that file with the metrics in
+ * the Prometheus text exposition format, suitable for a textfile collector.
+ * The exported metrics are probe latency quantiles for the window, cumulative
+ * probe, failure, and reconnect counts, and the rate at which the chain tip
+ * advanced during the window.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_session.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Probe configuration, read from the environment.
+ */
+typedef struct probe_config probe_config;
+
+struct probe_config
+{
+    const char* hostaddr;
+    unsigned int hostport;
+    const char* clientpriv;
+    const char* serverpub;
+    const char* metrics_file;
+    uint64_t interval_ns;
+    uint64_t report_interval_ns;
+    uint64_t duration_ns;
+};
+
+/**
+ * \brief Probe state and metrics.
+ *
+ * The counters are cumulative over the life of the probe. The histograms and
+ * tip_advances_window cover the current reporting window only.
+ */
+typedef struct probe_state probe_state;
+
+struct probe_state
+{
+    agentd_session session;
+    bool connected;
+    bool has_tip;
+    vpr_uuid tip;
+    uint64_t probes;
+    uint64_t failures;
+    uint64_t connects;
+    uint64_t connect_failures;
+    uint64_t reconnects;
+    uint64_t tip_advances;
+    uint64_t tip_advances_window;
+    uint64_t window_start_ns;
+    latency_histogram connect_latency;
+    latency_histogram status_latency;
+    latency_histogram block_id_latency;
+};
+
+/* set by the signal handler to request shutdown. */
+static volatile sig_atomic_t probe_shutdown = 0;
+
+/* forward decls. */
+static void probe_config_read(probe_config* config);
+static void probe_handle_signal(int sig);
+static void probe_tick(
+    probe_state* state, const probe_config* config, RCPR_SYM(allocator)* alloc,
+    file* file, vccrypt_suite_options_t* suite);
+static void probe_disconnect(probe_state* state);
+static void probe_report(probe_state* state, const probe_config* config);
+static status probe_write_metrics(
+    const probe_state* state, const probe_config* config, double window_s);
+static void probe_write_quantiles(
+    FILE* out, const char* name, const latency_histogram* hist);
+static void probe_sleep_until(uint64_t deadline_ns);
+
+/**
+ * \brief Main entry point for the agentd synthetic monitoring probe.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    probe_config config;
+    probe_state state;
+    struct sigaction sa;
+    uint64_t start_ns, next_tick_ns, next_report_ns;
+
+    probe_config_read(&config);
+
+    memset(&state, 0, sizeof(state));
+    latency_histogram_init(&state.connect_latency);
+    latency_histogram_init(&state.status_latency);
+    latency_histogram_init(&state.block_id_latency);
+
+    /* stop cleanly on SIGINT or SIGTERM. */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = &probe_handle_signal;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* probe on a fixed schedule until told to stop. */
+    start_ns = latency_clock_now_ns();
+    state.window_start_ns = start_ns;
+    next_tick_ns = start_ns;
+    next_report_ns = start_ns + config.report_interval_ns;
+    while (!probe_shutdown)
+    {
+        probe_tick(&state, &config, alloc, &file, &suite);
+
+        if (latency_clock_now_ns() >= next_report_ns)
+        {
+            probe_report(&state, &config);
+            next_report_ns += config.report_interval_ns;
+        }
+
+        if (0 != config.duration_ns
+         && latency_clock_now_ns() - start_ns >= config.duration_ns)
+        {
+            break;
+        }
+
+        /* skip ticks that were missed rather than bursting to catch up. */
+        next_tick_ns += config.interval_ns;
+        if (next_tick_ns < latency_clock_now_ns())
+        {
+            next_tick_ns = latency_clock_now_ns();
+        }
+
+        probe_sleep_until(next_tick_ns);
+    }
+
+    /* report the final partial window. */
+    probe_report(&state, &config);
+
+    /* close the session gracefully if it is still up. */
+    if (state.connected)
+    {
+        release_retval =
+            send_and_verify_close_connection(
+                state.session.sock, alloc, &suite, &state.session.client_iv,
+                &state.session.server_iv, &state.session.shared_secret);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            fprintf(stderr, "Error closing probe session.\n");
+        }
+
+        probe_disconnect(&state);
+    }
+
+    /* the probe succeeds if it ran; failures are reported as metrics. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_file;
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Read the probe configuration from the environment.
+ *
+ * \param config        The configuration to populate.
+ */
+static void probe_config_read(probe_config* config)
+{
+    config->hostaddr = env_get_string("PROBE_HOST", "127.0.0.1");
+    config->hostport = (unsigned int)env_get_size("PROBE_PORT", 4931);
+    config->clientpriv = env_get_string("PROBE_CLIENT_PRIV", "test.priv");
+    config->serverpub = env_get_string("PROBE_SERVER_PUB", "agentd.pub");
+    config->metrics_file = env_get_string("PROBE_METRICS_FILE", NULL);
+    config->interval_ns =
+        env_get_size("PROBE_INTERVAL_MS", 1000) * UINT64_C(1000000);
+    config->report_interval_ns =
+        env_get_size("PROBE_REPORT_INTERVAL_S", 10) * UINT64_C(1000000000);
+    config->duration_ns =
+        env_get_size("PROBE_DURATION_S", 0) * UINT64_C(1000000000);
+
+    if (0 == config->interval_ns)
+    {
+        config->interval_ns = UINT64_C(1000000000);
+    }
+
+    if (0 == config->report_interval_ns)
+    {
+        config->report_interval_ns = UINT64_C(10000000000);
+    }
+}
+
+/**
+ * \brief Request shutdown on a termination signal.
+ *
+ * \param sig           The signal received.
+ */
+static void probe_handle_signal(int sig)
+{
+    (void)sig;
+
+    probe_shutdown = 1;
+}
+
+/**
+ * \brief Run a single probe, connecting first if the session is down.
+ *
+ * A transport error discards the session so that the next tick reconnects.
+ * Any other error is counted as a failure and the session is kept.
+ *
+ * \param state         The probe state.
+ * \param config        The probe configuration.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ */
+static void probe_tick(
+    probe_state* state, const probe_config* config, RCPR_SYM(allocator)* alloc,
+    file* file, vccrypt_suite_options_t* suite)
+{
+    status retval;
+    vpr_uuid tip;
+    uint64_t start;
+
+    ++state->probes;
+
+    /* bring the session up if needed. */
+    if (!state->connected)
+    {
+        start = latency_clock_now_ns();
+        retval =
+            agentd_session_init(
+                &state->session, alloc, file, suite, config->hostaddr,
+                config->hostport, config->clientpriv, config->serverpub);
+        if (STATUS_SUCCESS != retval)
+        {
+            ++state->connect_failures;
+            ++state->failures;
+            return;
+        }
+
+        latency_histogram_record(
+            &state->connect_latency, latency_clock_now_ns() - start);
+        if (state->connects > 0)
+        {
+            ++state->reconnects;
+        }
+
+        ++state->connects;
+        state->connected = true;
+    }
+
+    /* probe the status API. */
+    start = latency_clock_now_ns();
+    retval =
+        get_and_verify_status(
+            state->session.sock, alloc, suite, &state->session.client_iv,
+            &state->session.server_iv, &state->session.shared_secret);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    latency_histogram_record(
+        &state->status_latency, latency_clock_now_ns() - start);
+
+    /* probe the latest block id. */
+    start = latency_clock_now_ns();
+    retval =
+        get_and_verify_last_block_id(
+            state->session.sock, alloc, suite, &state->session.client_iv,
+            &state->session.server_iv, &state->session.shared_secret, &tip);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    latency_histogram_record(
+        &state->block_id_latency, latency_clock_now_ns() - start);
+
+    /* track tip advancement. */
+    if (state->has_tip && memcmp(&state->tip, &tip, sizeof(tip)))
+    {
+        ++state->tip_advances;
+        ++state->tip_advances_window;
+    }
+
+    memcpy(&state->tip, &tip, sizeof(tip));
+    state->has_tip = true;
+
+    return;
+
+fail:
+    ++state->failures;
+    fprintf(stderr, "Probe failed with status %x.\n", retval);
+
+    if (status_is_transport_error(retval))
+    {
+        probe_disconnect(state);
+    }
+}
+
+/**
+ * \brief Discard the probe session without a protocol level close.
+ *
+ * \param state         The probe state.
+ */
+static void probe_disconnect(probe_state* state)
+{
+    if (STATUS_SUCCESS != agentd_session_dispose(&state->session))
+    {
+        fprintf(stderr, "Error disposing probe session.\n");
+    }
+
+    state->connected = false;
+}
+
+/**
+ * \brief Report and export the metrics for the current window, then start a
+ * new window.
+ *
+ * \param state         The probe state.
+ * \param config        The probe configuration.
+ */
+static void probe_report(probe_state* state, const probe_config* config)
+{
+    uint64_t now = latency_clock_now_ns();
+    double window_s = (now - state->window_start_ns) / 1e9;
+    double tip_rate =
+        window_s > 0.0 ? state->tip_advances_window * 60.0 / window_s : 0.0;
+
+    latency_histogram_print(&state->status_latency, stdout, "status");
+    latency_histogram_print(
+        &state->block_id_latency, stdout, "latest block id");
+    printf(
+        "probes=%" PRIu64 " failures=%" PRIu64 " reconnects=%" PRIu64
+        " connect_failures=%" PRIu64 " tip_advances_per_min=%.2f\n",
+        state->probes, state->failures, state->reconnects,
+        state->connect_failures, tip_rate);
+    fflush(stdout);
+
+    if (NULL != config->metrics_file)
+    {
+        if (STATUS_SUCCESS != probe_write_metrics(state, config, window_s))
+        {
+            fprintf(
+                stderr, "Error writing metrics to %s.\n",
+                config->metrics_file);
+        }
+    }
+
+    /* start a new window. */
+    latency_histogram_init(&state->connect_latency);
+    latency_histogram_init(&state->status_latency);
+    latency_histogram_init(&state->block_id_latency);
+    state->tip_advances_window = 0;
+    state->window_start_ns = now;
+}
+
+/**
+ * \brief Write the metrics file.
+ *
+ * The metrics are written to a temporary file that is then renamed over the
+ * metrics file, so that a collector never sees a partial file.
+ *
+ * \param state         The probe state.
+ * \param config        The probe configuration.
+ * \param window_s      The length of the current window, in seconds.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status probe_write_metrics(
+    const probe_state* state, const probe_config* config, double window_s)
+{
+    char tmpname[4096];
+    FILE* out;
+
+    snprintf(tmpname, sizeof(tmpname), "%s.tmp", config->metrics_file);
+
+    out = fopen(tmpname, "w");
+    if (NULL == out)
+    {
+        return ERROR_PROBE_METRICS_WRITE;
+    }
+
+    fprintf(out, "# TYPE agentd_probe_up gauge\n");
+    fprintf(out, "agentd_probe_up %d\n", state->connected ? 1 : 0);
+
+    fprintf(out, "# TYPE agentd_probe_total counter\n");
+    fprintf(out, "agentd_probe_total %" PRIu64 "\n", state->probes);
+    fprintf(out, "# TYPE agentd_probe_failures_total counter\n");
+    fprintf(out, "agentd_probe_failures_total %" PRIu64 "\n", state->failures);
+    fprintf(out, "# TYPE agentd_probe_connects_total counter\n");
+    fprintf(out, "agentd_probe_connects_total %" PRIu64 "\n", state->connects);
+    fprintf(out, "# TYPE agentd_probe_connect_failures_total counter\n");
+    fprintf(
+        out, "agentd_probe_connect_failures_total %" PRIu64 "\n",
+        state->connect_failures);
+    fprintf(out, "# TYPE agentd_probe_reconnects_total counter\n");
+    fprintf(
+        out, "agentd_probe_reconnects_total %" PRIu64 "\n", state->reconnects);
+    fprintf(out, "# TYPE agentd_probe_tip_advances_total counter\n");
+    fprintf(
+        out, "agentd_probe_tip_advances_total %" PRIu64 "\n",
+        state->tip_advances);
+    fprintf(out, "# TYPE agentd_probe_tip_advances_per_minute gauge\n");
+    fprintf(
+        out, "agentd_probe_tip_advances_per_minute %.4f\n",
+        window_s > 0.0 ? state->tip_advances_window * 60.0 / window_s : 0.0);
+
+    probe_write_quantiles(
+        out, "agentd_probe_connect_latency_seconds", &state->connect_latency);
+    probe_write_quantiles(
+        out, "agentd_probe_status_latency_seconds", &state->status_latency);
+    probe_write_quantiles(
+        out, "agentd_probe_latest_block_id_latency_seconds",
+        &state->block_id_latency);
+
+    if (0 != fclose(out))
+    {
+        return ERROR_PROBE_METRICS_WRITE;
+    }
+
+    if (0 != rename(tmpname, config->metrics_file))
+    {
+        return ERROR_PROBE_METRICS_WRITE;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write a latency histogram as a Prometheus summary.
+ *
+ * \param out           The stream to which the summary is written.
+ * \param name          The metric name.
+ * \param hist          The histogram for the current window.
+ */
+static void probe_write_quantiles(
+    FILE* out, const char* name, const latency_histogram* hist)
+{
+    static const double quantiles[] = { 50.0, 90.0, 99.0, 99.9 };
+
+    fprintf(out, "# TYPE %s summary\n", name);
+    for (size_t i = 0; i < sizeof(quantiles) / sizeof(quantiles[0]); ++i)
+    {
+        fprintf(
+            out, "%s{quantile=\"%g\"} %.9f\n", name, quantiles[i] / 100.0,
+            latency_histogram_percentile(hist, quantiles[i]) / 1e9);
+    }
+
+    fprintf(out, "%s_sum %.9f\n", name, hist->sum / 1e9);
+    fprintf(out, "%s_count %" PRIu64 "\n", name, hist->total);
+}
+
+/**
+ * \brief Sleep until the given monotonic deadline or until a signal arrives.
+ *
+ * \param deadline_ns   The deadline, in monotonic nanoseconds.
+ */
+static void probe_sleep_until(uint64_t deadline_ns)
+{
+    struct timespec ts;
+
+    ts.tv_sec = deadline_ns / UINT64_C(1000000000);
+    ts.tv_nsec = deadline_ns % UINT64_C(1000000000);
+
+    while (!probe_shutdown
+        && EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL))
+    {
+    }
+}
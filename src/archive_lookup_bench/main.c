@@ -0,0 +1,536 @@
+/**
+ * \file archive_lookup_bench/main.c
+ *
+ * \brief Main entry point for the archive lookup benchmark.
+ *
+ * This benchmark answers "which block holds this transaction" three ways:
+ *
+ *  - archive: a local archive built from an export file written by
+ *    chain_pipeline, whose segments of ARCHIVE_SEGMENT_BLOCKS blocks each
+ *    carry a Bloom filter over their transaction IDs. Only the segments whose
+ *    filter matches are scanned.
+ *  - full scan: the transaction ID column of the whole export is scanned
+ *    with the fastest UUID kernels.
+ *  - agentd: get_and_verify_txn_block_id, one round trip per lookup.
+ *
+ * Half of the ARCHIVE_LOOKUPS candidates are taken from the export and half
+ * are random, so that both hits and misses are measured; a miss is the
+ * worst case for a full scan and the best case for the archive. The archive
+ * must agree with the full scan on every candidate, and with agentd on the
+ * first ARCHIVE_AGENTD_LOOKUPS present ones. Setting ARCHIVE_AGENTD_LOOKUPS
+ * to 0 runs the benchmark offline.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/chain_archive.h>
+#include <helpers/chain_export.h>
+#include <helpers/chain_query.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The data being searched and the candidates to look up.
+ *
+ * expected holds the full scan's answer for each candidate: the row of the
+ * transaction in the table, or the row count if it is absent.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    chain_query_table table;
+    chain_archive* archive;
+    chain_archive_options archive_opts;
+    size_t candidate_count;
+    uint8_t* candidates;
+    size_t* expected;
+};
+
+/* forward decls. */
+static status make_candidates(bench_context* ctx);
+static uint64_t run_full_scan(bench_context* ctx);
+static status run_archive(bench_context* ctx, uint64_t baseline_ns);
+static status run_agentd(
+    bench_context* ctx, vccrypt_suite_options_t* suite, size_t lookups);
+static void print_result(
+    const char* name, size_t lookups, uint64_t elapsed_ns,
+    uint64_t baseline_ns);
+
+/**
+ * \brief Main entry point for the archive lookup benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    chain_export_reader* reader;
+    const chain_export_record* records;
+    chain_archive_info info;
+    bench_context ctx;
+    size_t record_count, agentd_lookups;
+    const char* path;
+    uint64_t start, baseline_ns;
+
+    memset(&ctx, 0, sizeof(ctx));
+    chain_archive_options_init(&ctx.archive_opts);
+    path = env_get_string("ARCHIVE_EXPORT_FILE", "chain.export");
+    ctx.archive_opts.segment_blocks =
+        env_get_size(
+            "ARCHIVE_SEGMENT_BLOCKS", ctx.archive_opts.segment_blocks);
+    ctx.archive_opts.bits_per_txn =
+        env_get_size("ARCHIVE_BITS_PER_TXN", ctx.archive_opts.bits_per_txn);
+    ctx.archive_opts.hash_count =
+        env_get_size("ARCHIVE_HASHES", ctx.archive_opts.hash_count);
+    ctx.candidate_count = env_get_size("ARCHIVE_LOOKUPS", 10000);
+    agentd_lookups = env_get_size("ARCHIVE_AGENTD_LOOKUPS", 200);
+    if (0 == ctx.archive_opts.segment_blocks
+     || 0 == ctx.archive_opts.bits_per_txn
+     || 0 == ctx.archive_opts.hash_count || 0 == ctx.candidate_count)
+    {
+        fprintf(stderr, "Bad archive lookup benchmark configuration.\n");
+        return ERROR_ARCHIVE_LOOKUP_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&ctx.alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* map the export file. */
+    retval = chain_export_reader_create(&reader, ctx.alloc, path);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_crypto_suite;
+    }
+
+    chain_export_reader_records(reader, &records, &record_count);
+    if (0 == record_count)
+    {
+        fprintf(stderr, "%s holds no records.\n", path);
+        retval = ERROR_ARCHIVE_LOOKUP_BENCH_CONFIGURATION;
+        goto cleanup_reader;
+    }
+
+    /* the full scan searches the decoded transaction ID column. */
+    retval =
+        chain_query_table_init(&ctx.table, ctx.alloc, records, record_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reader;
+    }
+
+    start = latency_clock_now_ns();
+    retval =
+        chain_archive_create(
+            &ctx.archive, ctx.alloc, records, record_count,
+            &ctx.archive_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_table;
+    }
+
+    chain_archive_get_info(ctx.archive, &info);
+    printf(
+        "archived %zu transactions in %zu segments of %zu blocks in %.2f ms; "
+        "%zu filter bytes\n",
+        info.row_count, info.segment_count, ctx.archive_opts.segment_blocks,
+        (latency_clock_now_ns() - start) / 1e6, info.filter_bytes);
+
+    retval = make_candidates(&ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_candidates;
+    }
+
+    printf(
+        "looking up %zu transactions with %s kernels:\n",
+        ctx.candidate_count, uuid_column_impl_name(ctx.archive_opts.impl));
+
+    baseline_ns = run_full_scan(&ctx);
+
+    retval = run_archive(&ctx, baseline_ns);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_candidates;
+    }
+
+    if (agentd_lookups > 0)
+    {
+        retval = run_agentd(&ctx, &suite, agentd_lookups);
+    }
+
+cleanup_candidates:
+    if (NULL != ctx.candidates)
+    {
+        (void)rcpr_allocator_reclaim(ctx.alloc, ctx.candidates);
+    }
+
+    if (NULL != ctx.expected)
+    {
+        (void)rcpr_allocator_reclaim(ctx.alloc, ctx.expected);
+    }
+
+    release_retval = chain_archive_release(ctx.archive);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_table:
+    chain_query_table_dispose(&ctx.table, ctx.alloc);
+
+cleanup_reader:
+    release_retval = chain_export_reader_release(reader);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval =
+        resource_release(rcpr_allocator_resource_handle(ctx.alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Build the candidates: even ones are taken from the export, odd ones
+ * are random and almost certainly absent.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status make_candidates(bench_context* ctx)
+{
+    status retval;
+    uint8_t* candidate;
+    const size_t rows = ctx->table.row_count;
+
+    retval =
+        rcpr_allocator_allocate(
+            ctx->alloc, (void**)&ctx->candidates,
+            ctx->candidate_count * UUID_COLUMN_ENTRY_SIZE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            ctx->alloc, (void**)&ctx->expected,
+            ctx->candidate_count * sizeof(size_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < ctx->candidate_count; ++i)
+    {
+        candidate = ctx->candidates + i * UUID_COLUMN_ENTRY_SIZE;
+
+        if (0 == i % 2)
+        {
+            memcpy(
+                candidate,
+                ctx->table.txn_id
+                    + ((size_t)rand() % rows) * UUID_COLUMN_ENTRY_SIZE,
+                UUID_COLUMN_ENTRY_SIZE);
+        }
+        else
+        {
+            for (size_t b = 0; b < UUID_COLUMN_ENTRY_SIZE; ++b)
+            {
+                candidate[b] = (uint8_t)rand();
+            }
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Time looking up every candidate by scanning the whole transaction
+ * ID column, recording the answers the other methods must match.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns the time taken.
+ */
+static uint64_t run_full_scan(bench_context* ctx)
+{
+    uint64_t start, elapsed_ns;
+
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < ctx->candidate_count; ++i)
+    {
+        ctx->expected[i] =
+            uuid_column_find(
+                ctx->archive_opts.impl, ctx->table.txn_id,
+                ctx->table.row_count,
+                ctx->candidates + i * UUID_COLUMN_ENTRY_SIZE);
+    }
+
+    elapsed_ns = latency_clock_now_ns() - start;
+    print_result("full scan", ctx->candidate_count, elapsed_ns, elapsed_ns);
+
+    return elapsed_ns;
+}
+
+/**
+ * \brief Time looking up every candidate in the archive, and check that it
+ * agrees with the full scan.
+ *
+ * \param ctx           The benchmark context.
+ * \param baseline_ns   The time taken by the full scan.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ARCHIVE_LOOKUP_BENCH_MISMATCH if the archive disagrees.
+ */
+static status run_archive(bench_context* ctx, uint64_t baseline_ns)
+{
+    chain_archive_stats stats;
+    chain_archive_info info;
+    const chain_export_record* record;
+    const size_t rows = ctx->table.row_count;
+    uint64_t start, elapsed_ns, tested;
+    size_t mismatches = 0;
+
+    memset(&stats, 0, sizeof(stats));
+
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < ctx->candidate_count; ++i)
+    {
+        record =
+            chain_archive_find(
+                ctx->archive, ctx->candidates + i * UUID_COLUMN_ENTRY_SIZE,
+                &stats);
+
+        /* a found record must hold the block the full scan found. */
+        if ((NULL == record) != (ctx->expected[i] == rows)
+         || (NULL != record
+          && memcmp(
+                record->block_id,
+                ctx->table.block_id
+                    + ctx->expected[i] * UUID_COLUMN_ENTRY_SIZE,
+                UUID_COLUMN_ENTRY_SIZE)))
+        {
+            ++mismatches;
+        }
+    }
+
+    elapsed_ns = latency_clock_now_ns() - start;
+    print_result("archive", ctx->candidate_count, elapsed_ns, baseline_ns);
+
+    /* a lookup stops at the segment holding its transaction, so the
+     * segments tested without holding it are roughly the rest. */
+    chain_archive_get_info(ctx->archive, &info);
+    tested = stats.lookups * info.segment_count - stats.found;
+    printf(
+        "    %" PRIu64 " found, %.2f segments and %.1f rows scanned per "
+        "lookup (%.2f%% of a full scan)\n",
+        stats.found, (double)stats.segments_scanned / stats.lookups,
+        (double)stats.rows_compared / stats.lookups,
+        100.0 * stats.rows_compared / ((double)stats.lookups * rows));
+    printf(
+        "    %" PRIu64 " false positive segments, at most %.3f%% of those "
+        "tested\n",
+        stats.false_positives,
+        tested > 0 ? 100.0 * stats.false_positives / tested : 0.0);
+
+    if (mismatches > 0)
+    {
+        fprintf(
+            stderr, "archive disagrees with the full scan on %zu lookups.\n",
+            mismatches);
+        return ERROR_ARCHIVE_LOOKUP_BENCH_MISMATCH;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Time looking up present candidates with agentd, and check that it
+ * agrees with the archive.
+ *
+ * \param ctx           The benchmark context.
+ * \param suite         The crypto suite to use for this operation.
+ * \param lookups       The number of candidates to look up.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ARCHIVE_LOOKUP_BENCH_MISMATCH if agentd disagrees.
+ *      - a non-zero error code on failure.
+ */
+static status run_agentd(
+    bench_context* ctx, vccrypt_suite_options_t* suite, size_t lookups)
+{
+    status retval, release_retval;
+    file file;
+    agentd_session session;
+    latency_histogram hist;
+    const chain_export_record* record;
+    vpr_uuid txn_id, block_id;
+    uint64_t start, lookup_start;
+    size_t done = 0;
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        return ERROR_FILE_ABSTRACTION_INIT;
+    }
+
+    /* connect to agentd. */
+    retval =
+        agentd_session_init(
+            &session, ctx->alloc, &file, suite, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    latency_histogram_init(&hist);
+
+    /* only present candidates are asked for; agentd reports misses as
+     * errors. */
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < ctx->candidate_count && done < lookups; i += 2)
+    {
+        memcpy(
+            txn_id.data, ctx->candidates + i * UUID_COLUMN_ENTRY_SIZE,
+            sizeof(txn_id.data));
+
+        lookup_start = latency_clock_now_ns();
+        retval =
+            get_and_verify_txn_block_id(
+                session.sock, ctx->alloc, suite, &session.client_iv,
+                &session.server_iv, &session.shared_secret, &txn_id,
+                &block_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_session;
+        }
+
+        latency_histogram_record(
+            &hist, latency_clock_now_ns() - lookup_start);
+        ++done;
+
+        record = chain_archive_find(ctx->archive, txn_id.data, NULL);
+        if (NULL == record
+         || memcmp(record->block_id, block_id.data, sizeof(block_id.data)))
+        {
+            fprintf(stderr, "archive disagrees with agentd.\n");
+            retval = ERROR_ARCHIVE_LOOKUP_BENCH_MISMATCH;
+            goto cleanup_session;
+        }
+    }
+
+    print_result("agentd", done, latency_clock_now_ns() - start, 0);
+    latency_histogram_print(&hist, stdout, "agentd lookup");
+
+cleanup_session:
+    release_retval =
+        send_and_verify_close_connection(
+            session.sock, ctx->alloc, suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+    return retval;
+}
+
+/**
+ * \brief Print the cost of one lookup method.
+ *
+ * \param name          The name of the method.
+ * \param lookups       The number of lookups made.
+ * \param elapsed_ns    The time taken for every lookup.
+ * \param baseline_ns   The time taken by the full scan for its lookups, or 0
+ *                      if the lookups differ and no speedup is shown.
+ */
+static void print_result(
+    const char* name, size_t lookups, uint64_t elapsed_ns,
+    uint64_t baseline_ns)
+{
+    printf(
+        "  %-10s %12.1f ns/lookup %12.0f lookups/s", name,
+        (double)elapsed_ns / lookups,
+        elapsed_ns > 0 ? lookups * 1e9 / elapsed_ns : 0);
+
+    if (baseline_ns > 0)
+    {
+        printf(
+            " %8.2fx", elapsed_ns > 0 ? (double)baseline_ns / elapsed_ns : 0);
+    }
+
+    printf("\n");
+}
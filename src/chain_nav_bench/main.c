@@ -0,0 +1,606 @@
+/**
+ * \file chain_nav_bench/main.c
+ *
+ * \brief Main entry point for the chain navigation benchmark.
+ *
+ * This benchmark seeds NAV_BENCH_SEED_BLOCKS blocks of one transaction each,
+ * then walks them the way a client following the chain does: ask for the
+ * next block id, get that block, spend NAV_BENCH_WORK_US microseconds on it,
+ * and repeat until the tip. The walk runs twice, first reading from a session
+ * pool directly and then through a chain navigation layer that prefetches
+ * the next record. It then reads NAV_BENCH_RANDOM_READS blocks in a
+ * scattered order, again directly and through the navigation layer, to show
+ * the prediction rules switching themselves off when they stop paying.
+ *
+ * For each phase, it reports the latency of each read, the wire requests
+ * sent to agentd, and for the navigation layer, the share of requests
+ * answered by a prediction and the prefetch accuracy.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/chain_nav.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/session_pool.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define BENCH_MAX_BLOCKS 4096
+
+static vpr_uuid ff_uuid = { .data = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
+
+/**
+ * \brief Shared benchmark state.
+ *
+ * When nav is set, reads go through it; otherwise they go to the pool. The
+ * direct walk records the ids of the blocks it visits for the random phase.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    session_pool* pool;
+    chain_nav* nav;
+    size_t work_us;
+    size_t random_reads;
+    vpr_uuid start_id;
+    size_t block_count;
+    vpr_uuid block_ids[BENCH_MAX_BLOCKS];
+};
+
+/* forward decls. */
+static status seed_blocks(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts,
+    size_t blocks);
+static status run_phase(
+    bench_context* ctx, bool walk, const char* label,
+    session_pool_stats* stats);
+static status run_walk(bench_context* ctx, latency_histogram* hist);
+static status run_random(bench_context* ctx, latency_histogram* hist);
+static status bench_read(
+    bench_context* ctx, const read_request* req, read_result* result,
+    latency_histogram* hist);
+static void print_nav_stats(bench_context* ctx, const char* label);
+
+/**
+ * \brief Main entry point for the chain navigation benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    agentd_session setup;
+    bench_context* ctx;
+    chain_nav* nav;
+    chain_nav_options nav_opts;
+    session_pool_stats walk_direct, walk_nav, random_direct, random_nav;
+    size_t session_count = env_get_size("NAV_BENCH_SESSIONS", 2);
+    size_t seed_blocks_count = env_get_size("NAV_BENCH_SEED_BLOCKS", 16);
+
+    chain_nav_options_init(&nav_opts);
+    nav_opts.cache_capacity =
+        env_get_size("NAV_BENCH_CACHE", nav_opts.cache_capacity);
+    nav_opts.prefetch_threads =
+        env_get_size("NAV_BENCH_PREFETCH_THREADS", nav_opts.prefetch_threads);
+    if (0 == session_count || 0 == nav_opts.cache_capacity
+     || 0 == nav_opts.prefetch_threads)
+    {
+        fprintf(stderr, "Bad chain navigation benchmark configuration.\n");
+        return ERROR_CHAIN_NAV_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* the context holds the block ids, so it goes on the heap. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&ctx, sizeof(*ctx));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->work_us = env_get_size("NAV_BENCH_WORK_US", 200);
+    ctx->random_reads = env_get_size("NAV_BENCH_RANDOM_READS", 400);
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_ctx;
+    }
+
+    /* the walk starts at the tip as it was before seeding. */
+    retval =
+        get_and_verify_last_block_id(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret, &ctx->start_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    printf("Seeding %zu blocks.\n", seed_blocks_count);
+    retval =
+        seed_blocks(&setup, alloc, &suite, &builder_opts, seed_blocks_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* create the session pool. */
+    retval =
+        session_pool_create(
+            &ctx->pool, alloc, &file, &suite, session_count, "127.0.0.1",
+            4931, "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* walk directly, recording the block ids. */
+    retval = run_phase(ctx, true, "direct walk", &walk_direct);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    if (0 == ctx->block_count)
+    {
+        fprintf(stderr, "No blocks to walk.\n");
+        retval = ERROR_CHAIN_NAV_BENCH_CONFIGURATION;
+        goto cleanup_pool;
+    }
+
+    /* walk through the navigation layer. */
+    retval = chain_nav_create(&ctx->nav, alloc, ctx->pool, &nav_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    retval = run_phase(ctx, true, "chain_nav walk", &walk_nav);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_nav;
+    }
+
+    print_nav_stats(ctx, "chain_nav walk");
+
+    /* read scattered blocks, directly and through the navigation layer. */
+    nav = ctx->nav;
+    ctx->nav = NULL;
+    retval = run_phase(ctx, false, "direct random", &random_direct);
+    ctx->nav = nav;
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_nav;
+    }
+
+    retval = run_phase(ctx, false, "chain_nav random", &random_nav);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_nav;
+    }
+
+    print_nav_stats(ctx, "chain_nav random");
+
+    /* summarize. */
+    printf(
+        "walk: %" PRIu64 " wire requests direct, %" PRIu64
+        " with chain_nav.\n",
+        walk_direct.wire_requests, walk_nav.wire_requests);
+    printf(
+        "random: %" PRIu64 " wire requests direct, %" PRIu64
+        " with chain_nav (%.1f%% extra).\n",
+        random_direct.wire_requests, random_nav.wire_requests,
+        random_direct.wire_requests > 0
+            ? 100.0
+                * ((double)random_nav.wire_requests
+                    - (double)random_direct.wire_requests)
+                / (double)random_direct.wire_requests
+            : 0.0);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_nav;
+
+cleanup_nav:
+    release_retval = chain_nav_release(ctx->nav);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_pool:
+    release_retval = session_pool_release(ctx->pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_ctx:
+    release_retval = rcpr_allocator_reclaim(alloc, ctx);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Seed the chain with blocks of one transaction each.
+ *
+ * \param session       The session on which the transactions are submitted.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param builder_opts  Certificate builder options for this operation.
+ * \param blocks        The number of blocks to seed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status seed_blocks(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts,
+    size_t blocks)
+{
+    status retval;
+    vpr_uuid txn_id;
+
+    /* waiting for each transaction keeps it in a block of its own. */
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        retval =
+            chain_seed_transactions(
+                session, alloc, suite, builder_opts, 1, &txn_id, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            chain_wait_for_transaction(
+                session, alloc, suite, &txn_id, 100, 30000, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Run one phase of the benchmark.
+ *
+ * \param ctx           The benchmark context.
+ * \param walk          true to walk the chain, false to read scattered
+ *                      blocks.
+ * \param label         The label for this phase.
+ * \param stats         Structure to receive the pool counters for this phase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_phase(
+    bench_context* ctx, bool walk, const char* label,
+    session_pool_stats* stats)
+{
+    status retval;
+    latency_histogram hist;
+    uint64_t start;
+
+    session_pool_reset_stats(ctx->pool);
+    if (NULL != ctx->nav)
+    {
+        chain_nav_reset_stats(ctx->nav);
+    }
+
+    latency_histogram_init(&hist);
+    start = latency_clock_now_ns();
+
+    retval = walk ? run_walk(ctx, &hist) : run_random(ctx, &hist);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    session_pool_get_stats(ctx->pool, stats);
+    latency_histogram_print(&hist, stdout, label);
+    printf(
+        "%-24s %.1f ms, requests=%" PRIu64 " wire=%" PRIu64 "\n",
+        label, (latency_clock_now_ns() - start) / 1e6, stats->requests,
+        stats->wire_requests);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Walk the chain from the block after the start block to the tip.
+ *
+ * \param ctx           The benchmark context.
+ * \param hist          The histogram to receive the read latencies.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_walk(bench_context* ctx, latency_histogram* hist)
+{
+    status retval;
+    read_request req;
+    read_result result;
+    vpr_uuid id;
+    size_t count = 0;
+    bool record = (NULL == ctx->nav);
+
+    memcpy(&id, &ctx->start_id, sizeof(id));
+    memset(&req, 0, sizeof(req));
+
+    for (;;)
+    {
+        /* get the next block id. */
+        req.type = READ_REQUEST_NEXT_BLOCK_ID_GET;
+        memcpy(&req.id, &id, sizeof(req.id));
+        retval = bench_read(ctx, &req, &result, hist);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (0 == memcmp(&result.id, &ff_uuid, sizeof(result.id)))
+        {
+            break;
+        }
+
+        memcpy(&id, &result.id, sizeof(id));
+        if (record && count < BENCH_MAX_BLOCKS)
+        {
+            memcpy(&ctx->block_ids[count], &id, sizeof(id));
+            ctx->block_count = count + 1;
+        }
+
+        ++count;
+
+        /* get the block. */
+        req.type = READ_REQUEST_BLOCK_GET;
+        memcpy(&req.id, &id, sizeof(req.id));
+        retval = bench_read(ctx, &req, &result, hist);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        read_result_dispose(&result);
+
+        /* the client works on the block before moving on. */
+        usleep(ctx->work_us);
+    }
+
+    printf("walked %zu blocks\n", count);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the walked blocks in a scattered order.
+ *
+ * \param ctx           The benchmark context.
+ * \param hist          The histogram to receive the read latencies.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_random(bench_context* ctx, latency_histogram* hist)
+{
+    status retval;
+    read_request req;
+    read_result result;
+    uint64_t draw;
+
+    memset(&req, 0, sizeof(req));
+    req.type = READ_REQUEST_BLOCK_GET;
+
+    for (size_t i = 0; i < ctx->random_reads; ++i)
+    {
+        draw = (i + 1) * UINT64_C(2654435761);
+        memcpy(
+            &req.id, &ctx->block_ids[(draw >> 7) % ctx->block_count],
+            sizeof(req.id));
+
+        retval = bench_read(ctx, &req, &result, hist);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        read_result_dispose(&result);
+        usleep(ctx->work_us);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Execute a read through the navigation layer, if any, or the pool.
+ *
+ * \param ctx           The benchmark context.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success.
+ * \param hist          The histogram to receive the read latency.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status bench_read(
+    bench_context* ctx, const read_request* req, read_result* result,
+    latency_histogram* hist)
+{
+    status retval;
+    uint64_t start = latency_clock_now_ns();
+
+    retval =
+        (NULL != ctx->nav)
+            ? chain_nav_read(ctx->nav, req, result)
+            : session_pool_read(ctx->pool, req, result);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error reading from the chain (%x).\n", retval);
+        return retval;
+    }
+
+    latency_histogram_record(hist, latency_clock_now_ns() - start);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Print the navigation counters for a phase.
+ *
+ * \param ctx           The benchmark context.
+ * \param label         The label for this phase.
+ */
+static void print_nav_stats(bench_context* ctx, const char* label)
+{
+    chain_nav_stats stats;
+    uint64_t settled;
+
+    chain_nav_get_stats(ctx->nav, &stats);
+    settled = stats.used + stats.wasted;
+
+    printf(
+        "%-24s hits=%" PRIu64 " late=%" PRIu64 " misses=%" PRIu64
+        " (%.1f%% answered by prediction)\n",
+        label, stats.hits, stats.late_hits, stats.misses,
+        stats.requests > 0
+            ? 100.0 * (stats.hits + stats.late_hits) / stats.requests
+            : 0.0);
+    printf(
+        "%-24s predictions=%" PRIu64 " derived=%" PRIu64
+        " prefetches=%" PRIu64 " accuracy=%.1f%%\n",
+        label, stats.predictions, stats.derived, stats.prefetches,
+        settled > 0 ? 100.0 * stats.used / settled : 0.0);
+
+    for (int i = 0; i < CHAIN_NAV_RULE_COUNT; ++i)
+    {
+        if (0 == stats.rules[i].predictions)
+        {
+            continue;
+        }
+
+        printf(
+            "    %-24s predicted=%" PRIu64 " used=%" PRIu64
+            " wasted=%" PRIu64 " %s\n",
+            chain_nav_rule_name((chain_nav_rule)i), stats.rules[i].predictions,
+            stats.rules[i].used, stats.rules[i].wasted,
+            stats.rules[i].enabled ? "enabled" : "disabled");
+    }
+}
@@ -0,0 +1,741 @@
+/**
+ * \file chain_pipeline/main.c
+ *
+ * \brief Main entry point for the staged chain pipeline.
+ *
+ * This tool walks the whole chain as a pipeline of four stages, each with its
+ * own threads, joined by bounded queues:
+ *
+ *  - fetch: each thread owns a session and fetches blocks by height.
+ *  - parse: the block certificate is parsed and its transactions located.
+ *  - verify: every transaction is checked and hashed.
+ *  - export: one record per transaction is appended to an export file.
+ *
+ * When the chain has been walked, each stage reports its throughput, how busy
+ * its threads were, how long they stalled waiting for input or for room in
+ * the next queue, and the mean and peak depth of its input queue. The stage
+ * that is busiest while the others stall is the bottleneck; giving it more
+ * threads is the next thing to try.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/chain_block.h>
+#include <helpers/chain_export.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/pipeline.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define PIPE_MAX_THREADS 64
+
+enum
+{
+    STAGE_FETCH,
+    STAGE_PARSE,
+    STAGE_VERIFY,
+    STAGE_EXPORT,
+    STAGE_COUNT
+};
+
+/**
+ * \brief Shared pipeline state.
+ */
+typedef struct pipe_context pipe_context;
+
+struct pipe_context
+{
+    rcpr_allocator* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    vccert_parser_options_t* parser_opts;
+    chain_export_writer* writer;
+    atomic_uint_fast64_t txns;
+    atomic_uint_fast64_t bytes;
+};
+
+/**
+ * \brief A block on its way through the pipeline.
+ */
+typedef struct block_item block_item;
+
+struct block_item
+{
+    uint64_t height;
+    chain_block block;
+    chain_block_txn_info* infos;
+};
+
+/* forward decls. */
+static status seed_chain(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts);
+static status get_chain_height(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_parser_options_t* parser_opts,
+    uint64_t* height);
+static status run_pipeline(pipe_context* ctx, uint64_t height);
+static status fetch_thread_init(void* context, size_t thread, void** state);
+static void fetch_thread_dispose(void* context, void* state);
+static status fetch_process(
+    void* context, void* state, void* item, void** out);
+static status parse_process(
+    void* context, void* state, void* item, void** out);
+static status verify_process(
+    void* context, void* state, void* item, void** out);
+static status export_process(
+    void* context, void* state, void* item, void** out);
+static void block_item_release(void* context, void* item);
+
+/**
+ * \brief Main entry point for the staged chain pipeline.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t parser_opts;
+    file file;
+    agentd_session setup;
+    pipe_context ctx;
+    uint64_t height;
+    const char* export_file =
+        env_get_string("PIPE_EXPORT_FILE", "chain.export");
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* initialize parser options. */
+    retval =
+        vccert_parser_options_simple_init(&parser_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate parser.\n");
+        retval = ERROR_CERTIFICATE_PARSER_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_parser_opts;
+    }
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    retval = seed_chain(&setup, alloc, &suite, &builder_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    retval = get_chain_height(&setup, alloc, &suite, &parser_opts, &height);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.alloc = alloc;
+    ctx.file = &file;
+    ctx.suite = &suite;
+    ctx.parser_opts = &parser_opts;
+
+    retval = chain_export_writer_create(&ctx.writer, alloc, export_file);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    retval = run_pipeline(&ctx, height);
+
+    release_retval = chain_export_writer_release(ctx.writer);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        printf(
+            "exported %" PRIu64 " transactions to %s\n",
+            (uint64_t)atomic_load(&ctx.txns), export_file);
+    }
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_parser_opts:
+    dispose((disposable_t*)&parser_opts);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Optionally seed the chain before walking it.
+ *
+ * PIPE_SEED_BLOCKS blocks of PIPE_SEED_TXNS transactions each are added.
+ *
+ * \param session       The setup session.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param builder_opts  The certificate builder options to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status seed_chain(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts)
+{
+    status retval;
+    vpr_uuid* txn_ids;
+    size_t blocks = env_get_size("PIPE_SEED_BLOCKS", 0);
+    size_t txns = env_get_size("PIPE_SEED_TXNS", 10);
+
+    if (0 == blocks || 0 == txns)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&txn_ids, txns * sizeof(vpr_uuid));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* waiting for each batch keeps it in a block of its own. */
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        retval =
+            chain_seed_transactions(
+                session, alloc, suite, builder_opts, txns, txn_ids, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_txn_ids;
+        }
+
+        retval =
+            chain_wait_for_transaction(
+                session, alloc, suite, &txn_ids[txns - 1], 10, 30000, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_txn_ids;
+        }
+    }
+
+    retval = STATUS_SUCCESS;
+
+cleanup_txn_ids:
+    (void)rcpr_allocator_reclaim(alloc, txn_ids);
+
+    return retval;
+}
+
+/**
+ * \brief Get the height of the latest block.
+ *
+ * \param session       The setup session.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param parser_opts   The parser options to use for this operation.
+ * \param height        Pointer to receive the height.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status get_chain_height(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_parser_options_t* parser_opts,
+    uint64_t* height)
+{
+    status retval;
+    vpr_uuid latest_id, prev_id, next_id;
+    vccrypt_buffer_t cert;
+
+    retval =
+        get_and_verify_last_block_id(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &latest_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        get_and_verify_block(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &latest_id, &cert,
+            &prev_id, &next_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = chain_block_height(height, &cert, parser_opts);
+
+    dispose((disposable_t*)&cert);
+
+    return retval;
+}
+
+/**
+ * \brief Push every block through the pipeline and print the stage counters.
+ *
+ * \param ctx           The pipeline context.
+ * \param height        The height of the latest block.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_pipeline(pipe_context* ctx, uint64_t height)
+{
+    status retval, release_retval;
+    pipeline* pipe;
+    pipeline_stage_ops stages[STAGE_COUNT];
+    pipeline_stage_stats stats[STAGE_COUNT];
+    block_item* item;
+    size_t capacity = env_get_size("PIPE_QUEUE_CAPACITY", 64);
+    double elapsed_s;
+
+    memset(stages, 0, sizeof(stages));
+    stages[STAGE_FETCH].name = "fetch";
+    stages[STAGE_FETCH].threads = env_get_size("PIPE_FETCH_THREADS", 4);
+    stages[STAGE_FETCH].thread_init = &fetch_thread_init;
+    stages[STAGE_FETCH].thread_dispose = &fetch_thread_dispose;
+    stages[STAGE_FETCH].process = &fetch_process;
+    stages[STAGE_PARSE].name = "parse";
+    stages[STAGE_PARSE].threads = env_get_size("PIPE_PARSE_THREADS", 2);
+    stages[STAGE_PARSE].process = &parse_process;
+    stages[STAGE_VERIFY].name = "verify";
+    stages[STAGE_VERIFY].threads = env_get_size("PIPE_VERIFY_THREADS", 4);
+    stages[STAGE_VERIFY].process = &verify_process;
+
+    /* a single export thread keeps each block's records contiguous. */
+    stages[STAGE_EXPORT].name = "export";
+    stages[STAGE_EXPORT].threads = 1;
+    stages[STAGE_EXPORT].process = &export_process;
+
+    for (size_t i = 0; i < STAGE_COUNT; ++i)
+    {
+        if (0 == stages[i].threads || stages[i].threads > PIPE_MAX_THREADS)
+        {
+            fprintf(stderr, "Bad chain pipeline configuration.\n");
+            return ERROR_CHAIN_PIPELINE_CONFIGURATION;
+        }
+
+        stages[i].queue_capacity = capacity;
+        stages[i].context = ctx;
+        stages[i].discard = &block_item_release;
+    }
+
+    printf(
+        "walking %" PRIu64 " blocks with %zu fetch, %zu parse, %zu verify "
+        "and %zu export threads, queue capacity %zu\n",
+        height, stages[STAGE_FETCH].threads, stages[STAGE_PARSE].threads,
+        stages[STAGE_VERIFY].threads, stages[STAGE_EXPORT].threads,
+        capacity);
+
+    retval = pipeline_create(&pipe, ctx->alloc, stages, STAGE_COUNT);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (uint64_t h = 1; h <= height; ++h)
+    {
+        retval =
+            rcpr_allocator_allocate(ctx->alloc, (void**)&item, sizeof(*item));
+        if (STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+
+        memset(item, 0, sizeof(*item));
+        item->height = h;
+        pipeline_push(pipe, item);
+    }
+
+    pipeline_finish(pipe);
+    pipeline_get_stats(pipe, stats);
+
+    elapsed_s = stats[STAGE_EXPORT].elapsed_ns / 1e9;
+    printf(
+        "%" PRIu64 " blocks, %" PRIu64 " transactions, %" PRIu64
+        " bytes in %.3f s (%.0f transactions/s)\n",
+        stats[STAGE_EXPORT].items, (uint64_t)atomic_load(&ctx->txns),
+        (uint64_t)atomic_load(&ctx->bytes), elapsed_s,
+        elapsed_s > 0 ? atomic_load(&ctx->txns) / elapsed_s : 0.0);
+    pipeline_print_stats(stats, STAGE_COUNT, stdout);
+
+    for (size_t i = 0; i < STAGE_COUNT; ++i)
+    {
+        if (STATUS_SUCCESS == retval && 0 != stats[i].failures)
+        {
+            retval = ERROR_CHAIN_PIPELINE_FAILED;
+        }
+    }
+
+    release_retval = pipeline_release(pipe);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Connect the session owned by a fetch thread.
+ *
+ * \param context       The pipeline context.
+ * \param thread        The index of the thread within the stage.
+ * \param state         Pointer to receive the session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status fetch_thread_init(void* context, size_t thread, void** state)
+{
+    (void)thread;
+    pipe_context* ctx = (pipe_context*)context;
+    agentd_session* session;
+    status retval;
+
+    retval =
+        rcpr_allocator_allocate(
+            ctx->alloc, (void**)&session, sizeof(*session));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        agentd_session_init(
+            session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        (void)rcpr_allocator_reclaim(ctx->alloc, session);
+        return retval;
+    }
+
+    *state = session;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Close the session owned by a fetch thread.
+ *
+ * \param context       The pipeline context.
+ * \param state         The session.
+ */
+static void fetch_thread_dispose(void* context, void* state)
+{
+    pipe_context* ctx = (pipe_context*)context;
+    agentd_session* session = (agentd_session*)state;
+
+    (void)send_and_verify_close_connection(
+        session->sock, ctx->alloc, ctx->suite, &session->client_iv,
+        &session->server_iv, &session->shared_secret);
+    (void)agentd_session_dispose(session);
+    (void)rcpr_allocator_reclaim(ctx->alloc, session);
+}
+
+/**
+ * \brief Fetch stage: fetch a block by height.
+ *
+ * \param context       The pipeline context.
+ * \param state         The session of this thread.
+ * \param item          The \ref block_item.
+ * \param out           Pointer to receive the item for the next stage.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status fetch_process(
+    void* context, void* state, void* item, void** out)
+{
+    pipe_context* ctx = (pipe_context*)context;
+    block_item* block = (block_item*)item;
+    status retval;
+
+    retval =
+        chain_block_fetch(
+            &block->block, (agentd_session*)state, ctx->alloc, ctx->suite,
+            block->height);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Error fetching block %" PRIu64 ".\n", block->height);
+        block_item_release(ctx, block);
+        return retval;
+    }
+
+    *out = block;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Parse stage: parse a block and locate its transactions.
+ *
+ * \param context       The pipeline context.
+ * \param state         Unused.
+ * \param item          The \ref block_item.
+ * \param out           Pointer to receive the item for the next stage.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_process(
+    void* context, void* state, void* item, void** out)
+{
+    (void)state;
+    pipe_context* ctx = (pipe_context*)context;
+    block_item* block = (block_item*)item;
+    status retval;
+
+    retval = chain_block_parse(&block->block, ctx->alloc, ctx->parser_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Error parsing block %" PRIu64 ".\n", block->height);
+        block_item_release(ctx, block);
+        return retval;
+    }
+
+    *out = block;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Verify stage: check and hash every transaction of a block.
+ *
+ * \param context       The pipeline context.
+ * \param state         Unused.
+ * \param item          The \ref block_item.
+ * \param out           Pointer to receive the item for the next stage.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status verify_process(
+    void* context, void* state, void* item, void** out)
+{
+    (void)state;
+    pipe_context* ctx = (pipe_context*)context;
+    block_item* block = (block_item*)item;
+    status retval;
+
+    if (block->block.txn_count > 0)
+    {
+        retval =
+            rcpr_allocator_allocate(
+                ctx->alloc, (void**)&block->infos,
+                block->block.txn_count * sizeof(chain_block_txn_info));
+        if (STATUS_SUCCESS != retval)
+        {
+            block_item_release(ctx, block);
+            return retval;
+        }
+    }
+
+    for (size_t i = 0; i < block->block.txn_count; ++i)
+    {
+        retval =
+            chain_block_verify_txn(
+                &block->infos[i], &block->block.txns[i], ctx->parser_opts,
+                ctx->suite);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(
+                stderr, "Error verifying transaction %zu of block %" PRIu64
+                ".\n", i, block->height);
+            block_item_release(ctx, block);
+            return retval;
+        }
+    }
+
+    *out = block;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Export stage: append a record for every transaction of a block.
+ *
+ * \param context       The pipeline context.
+ * \param state         Unused.
+ * \param item          The \ref block_item, which is released.
+ * \param out           Unused; this is the last stage.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status export_process(
+    void* context, void* state, void* item, void** out)
+{
+    (void)state;
+    (void)out;
+    pipe_context* ctx = (pipe_context*)context;
+    block_item* block = (block_item*)item;
+    chain_export_record record;
+    status retval = STATUS_SUCCESS;
+
+    for (size_t i = 0; i < block->block.txn_count; ++i)
+    {
+        memset(&record, 0, sizeof(record));
+        memcpy(record.txn_id, block->infos[i].txn_id.data, 16);
+        memcpy(record.prev_txn_id, block->infos[i].prev_txn_id.data, 16);
+        memcpy(record.artifact_id, block->infos[i].artifact_id.data, 16);
+        memcpy(record.block_id, block->block.block_id.data, 16);
+        memcpy(record.cert_type, block->infos[i].cert_type.data, 16);
+        memcpy(record.artifact_type, block->infos[i].artifact_type.data, 16);
+        memcpy(record.signer_id, block->infos[i].signer_id.data, 16);
+        record.block_height = block->height;
+        record.txn_index = (uint32_t)i;
+        record.txn_size = (uint32_t)block->block.txns[i].size;
+
+        retval = chain_export_writer_append(ctx->writer, &record, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error writing export record.\n");
+            break;
+        }
+
+        atomic_fetch_add(&ctx->txns, 1);
+    }
+
+    atomic_fetch_add(&ctx->bytes, block->block.cert.size);
+    block_item_release(ctx, block);
+
+    return retval;
+}
+
+/**
+ * \brief Release a block item.
+ *
+ * \param context       The pipeline context.
+ * \param item          The \ref block_item to release.
+ */
+static void block_item_release(void* context, void* item)
+{
+    pipe_context* ctx = (pipe_context*)context;
+    block_item* block = (block_item*)item;
+
+    if (NULL != block->infos)
+    {
+        (void)rcpr_allocator_reclaim(ctx->alloc, block->infos);
+    }
+
+    chain_block_dispose(&block->block, ctx->alloc);
+    (void)rcpr_allocator_reclaim(ctx->alloc, block);
+}
@@ -0,0 +1,424 @@
+/**
+ * \file chain_query/main.c
+ *
+ * \brief Main entry point for the offline chain query tool.
+ *
+ * This tool answers questions about the chain from an export file written by
+ * chain_pipeline, without a connection to agentd. The records are mapped in
+ * place and decoded into one column per field, then queried by artifact ID,
+ * artifact type, certificate type, signer and block height range.
+ *
+ * The predicate is read from QUERY_ARTIFACT_ID, QUERY_ARTIFACT_TYPE,
+ * QUERY_CERT_TYPE, QUERY_SIGNER_ID, QUERY_HEIGHT_MIN and QUERY_HEIGHT_MAX.
+ * When none of these is set, a handful of representative queries are built
+ * from values sampled from the export instead.
+ *
+ * Each query is timed as a row-at-a-time scan over the mapped records, the
+ * way a client would filter records one by one, and as a columnar scan on
+ * one thread and then on more, up to QUERY_THREADS. Every scan must find the
+ * same rows. The decoded columns stay in memory for the whole run, so that
+ * many queries share the cost of decoding.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/chain_export.h>
+#include <helpers/chain_query.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+#define QUERY_MAX_QUERIES 4
+
+/**
+ * \brief A named query.
+ */
+typedef struct query_case query_case;
+
+struct query_case
+{
+    const char* name;
+    chain_query_predicate pred;
+};
+
+/**
+ * \brief The data being queried and how to time it.
+ */
+typedef struct query_context query_context;
+
+struct query_context
+{
+    rcpr_allocator* alloc;
+    const chain_export_record* records;
+    chain_query_table table;
+    size_t threads;
+    size_t repeat;
+    atomic_size_t visited;
+};
+
+/* forward decls. */
+static bool read_predicate(chain_query_predicate* pred);
+static size_t sample_queries(
+    const query_context* ctx, query_case* queries);
+static status run_query(query_context* ctx, const query_case* query);
+static void count_visit(
+    void* context, const chain_query_table* table, size_t row);
+static void print_result(
+    const query_context* ctx, const char* name, uint64_t matched,
+    uint64_t elapsed_ns, uint64_t baseline_ns);
+
+/**
+ * \brief Main entry point for the offline chain query tool.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    chain_export_reader* reader;
+    query_context ctx;
+    query_case queries[QUERY_MAX_QUERIES];
+    size_t query_count, record_count;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* path;
+    uint64_t start;
+
+    memset(&ctx, 0, sizeof(ctx));
+    path = env_get_string("QUERY_EXPORT_FILE", "chain.export");
+    ctx.threads = env_get_size("QUERY_THREADS", cpus > 0 ? (size_t)cpus : 1);
+    ctx.repeat = env_get_size("QUERY_REPEAT", 100);
+    if (0 == ctx.threads || 0 == ctx.repeat)
+    {
+        fprintf(stderr, "Bad chain query configuration.\n");
+        return ERROR_CHAIN_QUERY_CONFIGURATION;
+    }
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&ctx.alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* map the export file. */
+    retval = chain_export_reader_create(&reader, ctx.alloc, path);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    chain_export_reader_records(reader, &ctx.records, &record_count);
+    if (0 == record_count)
+    {
+        fprintf(stderr, "%s holds no records.\n", path);
+        retval = ERROR_CHAIN_QUERY_CONFIGURATION;
+        goto cleanup_reader;
+    }
+
+    /* decode the records into columns. */
+    start = latency_clock_now_ns();
+    retval =
+        chain_query_table_init(
+            &ctx.table, ctx.alloc, ctx.records, record_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_reader;
+    }
+
+    printf(
+        "decoded %zu records from %s in %.2f ms; using %s kernels\n",
+        record_count, path, (latency_clock_now_ns() - start) / 1e6,
+        uuid_column_impl_name(uuid_column_impl_best()));
+
+    /* a predicate from the environment replaces the sampled queries. */
+    if (read_predicate(&queries[0].pred))
+    {
+        queries[0].name = "environment";
+        query_count = 1;
+    }
+    else
+    {
+        query_count = sample_queries(&ctx, queries);
+    }
+
+    for (size_t i = 0; i < query_count; ++i)
+    {
+        retval = run_query(&ctx, &queries[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_table;
+        }
+    }
+
+cleanup_table:
+    chain_query_table_dispose(&ctx.table, ctx.alloc);
+
+cleanup_reader:
+    release_retval = chain_export_reader_release(reader);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    release_retval =
+        resource_release(rcpr_allocator_resource_handle(ctx.alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Read a predicate from the environment.
+ *
+ * \param pred          The predicate to fill.
+ *
+ * \returns true if any predicate field was set.
+ */
+static bool read_predicate(chain_query_predicate* pred)
+{
+    chain_query_predicate_init(pred);
+
+    if (env_get_uuid("QUERY_ARTIFACT_ID", pred->artifact_id))
+    {
+        pred->fields |= CHAIN_QUERY_FIELD_ARTIFACT_ID;
+    }
+
+    if (env_get_uuid("QUERY_ARTIFACT_TYPE", pred->artifact_type))
+    {
+        pred->fields |= CHAIN_QUERY_FIELD_ARTIFACT_TYPE;
+    }
+
+    if (env_get_uuid("QUERY_CERT_TYPE", pred->cert_type))
+    {
+        pred->fields |= CHAIN_QUERY_FIELD_CERT_TYPE;
+    }
+
+    if (env_get_uuid("QUERY_SIGNER_ID", pred->signer_id))
+    {
+        pred->fields |= CHAIN_QUERY_FIELD_SIGNER_ID;
+    }
+
+    pred->height_min = env_get_size("QUERY_HEIGHT_MIN", 0);
+    pred->height_max = env_get_size("QUERY_HEIGHT_MAX", SIZE_MAX);
+    if (0 != pred->height_min || SIZE_MAX != pred->height_max)
+    {
+        pred->fields |= CHAIN_QUERY_FIELD_HEIGHT;
+    }
+
+    return 0 != pred->fields;
+}
+
+/**
+ * \brief Build representative queries from values found in the export.
+ *
+ * The queries select a height range, one artifact, one certificate type
+ * within a height range, and one artifact type from one signer.
+ *
+ * \param ctx           The data being queried.
+ * \param queries       Array of \ref QUERY_MAX_QUERIES queries to fill.
+ *
+ * \returns the number of queries built.
+ */
+static size_t sample_queries(
+    const query_context* ctx, query_case* queries)
+{
+    const size_t rows = ctx->table.row_count;
+    const chain_export_record* middle = &ctx->records[rows / 2];
+    const chain_export_record* last = &ctx->records[rows - 1];
+    uint64_t low = UINT64_MAX, high = 0;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        low = ctx->table.block_height[i] < low
+            ? ctx->table.block_height[i] : low;
+        high = ctx->table.block_height[i] > high
+            ? ctx->table.block_height[i] : high;
+    }
+
+    for (size_t i = 0; i < QUERY_MAX_QUERIES; ++i)
+    {
+        chain_query_predicate_init(&queries[i].pred);
+    }
+
+    /* the middle half of the chain. */
+    queries[0].name = "height range";
+    queries[0].pred.fields = CHAIN_QUERY_FIELD_HEIGHT;
+    queries[0].pred.height_min = low + (high - low) / 4;
+    queries[0].pred.height_max = high - (high - low) / 4;
+
+    queries[1].name = "artifact id";
+    queries[1].pred.fields = CHAIN_QUERY_FIELD_ARTIFACT_ID;
+    memcpy(queries[1].pred.artifact_id, middle->artifact_id, 16);
+
+    queries[2].name = "cert type + height";
+    queries[2].pred.fields =
+        CHAIN_QUERY_FIELD_CERT_TYPE | CHAIN_QUERY_FIELD_HEIGHT;
+    memcpy(queries[2].pred.cert_type, last->cert_type, 16);
+    queries[2].pred.height_min = queries[0].pred.height_min;
+    queries[2].pred.height_max = queries[0].pred.height_max;
+
+    queries[3].name = "artifact type + signer";
+    queries[3].pred.fields =
+        CHAIN_QUERY_FIELD_ARTIFACT_TYPE | CHAIN_QUERY_FIELD_SIGNER_ID;
+    memcpy(queries[3].pred.artifact_type, last->artifact_type, 16);
+    memcpy(queries[3].pred.signer_id, last->signer_id, 16);
+
+    return QUERY_MAX_QUERIES;
+}
+
+/**
+ * \brief Time one query as a row-at-a-time scan and as columnar scans on a
+ * growing number of threads.
+ *
+ * \param ctx           The data being queried.
+ * \param query         The query.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_QUERY_MISMATCH if the scans disagree.
+ *      - a non-zero error code on failure.
+ */
+static status run_query(query_context* ctx, const query_case* query)
+{
+    status retval;
+    chain_query_options opts;
+    chain_query_result result;
+    const size_t rows = ctx->table.row_count;
+    uint64_t start, baseline_ns, expected = 0, elapsed_ns;
+    char name[32];
+
+    printf("query: %s\n", query->name);
+
+    /* the row-at-a-time scan. */
+    start = latency_clock_now_ns();
+    for (size_t r = 0; r < ctx->repeat; ++r)
+    {
+        expected = 0;
+        for (size_t i = 0; i < rows; ++i)
+        {
+            expected +=
+                chain_query_predicate_match(&query->pred, &ctx->records[i]);
+        }
+    }
+
+    baseline_ns = latency_clock_now_ns() - start;
+    print_result(ctx, "row at a time", expected, baseline_ns, baseline_ns);
+
+    chain_query_options_init(&opts);
+    for (size_t threads = 1;; threads *= 2)
+    {
+        opts.threads = threads < ctx->threads ? threads : ctx->threads;
+
+        elapsed_ns = 0;
+        for (size_t r = 0; r < ctx->repeat; ++r)
+        {
+            retval =
+                chain_query_run(
+                    &ctx->table, ctx->alloc, &query->pred, &opts, &result);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            elapsed_ns += result.elapsed_ns;
+        }
+
+        snprintf(name, sizeof(name), "columnar x%zu", opts.threads);
+        print_result(
+            ctx, name, result.rows_matched, elapsed_ns, baseline_ns);
+
+        if (result.rows_matched != expected)
+        {
+            fprintf(
+                stderr, "%s found %" PRIu64 " rows, expected %" PRIu64 ".\n",
+                name, result.rows_matched, expected);
+            return ERROR_CHAIN_QUERY_MISMATCH;
+        }
+
+        if (opts.threads == ctx->threads)
+        {
+            break;
+        }
+    }
+
+    /* every match must be visited exactly once. */
+    atomic_store(&ctx->visited, 0);
+    opts.visit = &count_visit;
+    opts.context = ctx;
+    retval =
+        chain_query_run(
+            &ctx->table, ctx->alloc, &query->pred, &opts, &result);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (atomic_load(&ctx->visited) != expected)
+    {
+        fprintf(
+            stderr, "visited %zu rows, expected %" PRIu64 ".\n",
+            atomic_load(&ctx->visited), expected);
+        return ERROR_CHAIN_QUERY_MISMATCH;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Count a visited row.
+ *
+ * \param context       The query context.
+ * \param table         The table being queried.
+ * \param row           The index of the matching row.
+ */
+static void count_visit(
+    void* context, const chain_query_table* table, size_t row)
+{
+    query_context* ctx = (query_context*)context;
+
+    (void)table;
+    (void)row;
+
+    atomic_fetch_add_explicit(&ctx->visited, 1, memory_order_relaxed);
+}
+
+/**
+ * \brief Print the cost of one scan over every repetition.
+ *
+ * \param ctx           The data being queried.
+ * \param name          The name of the scan.
+ * \param matched       The number of rows it matched.
+ * \param elapsed_ns    The time taken for every repetition.
+ * \param baseline_ns   The time taken by the row-at-a-time scan.
+ */
+static void print_result(
+    const query_context* ctx, const char* name, uint64_t matched,
+    uint64_t elapsed_ns, uint64_t baseline_ns)
+{
+    double rows = (double)ctx->table.row_count * ctx->repeat;
+
+    printf(
+        "  %-14s %8" PRIu64 " matches %14.0f rows/s %6.2fx\n", name, matched,
+        elapsed_ns > 0 ? rows * 1e9 / elapsed_ns : 0,
+        elapsed_ns > 0 ? (double)baseline_ns / elapsed_ns : 0.0);
+}
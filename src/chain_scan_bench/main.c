@@ -0,0 +1,634 @@
+/**
+ * \file chain_scan_bench/main.c
+ *
+ * \brief Main entry point for the chain scan benchmark.
+ *
+ * This benchmark scans the whole chain with the work-stealing task scheduler.
+ * Each block is fetched and parsed by one task, which then splits the
+ * verification of its transactions into chunks and spawns a task per chunk.
+ * A block that is a hundred times larger than the rest therefore becomes a
+ * hundred times more tasks, which idle workers steal.
+ *
+ * The scan runs twice: first with stealing disabled, which is a static
+ * round robin partition of the blocks, and then with stealing enabled. For
+ * each run, the busy time of every worker is reported, along with the ratio
+ * of the busiest worker to the mean, which is 1.0 for a perfectly balanced
+ * scan.
+ *
+ * Optionally, the chain is first seeded with blocks of uneven size.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/chain_block.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <helpers/task_scheduler.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define BENCH_MAX_WORKERS 64
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    vccert_parser_options_t* parser_opts;
+    task_scheduler* sched;
+    size_t verify_chunk;
+    atomic_uint_fast64_t blocks;
+    atomic_uint_fast64_t txns;
+    atomic_uint_fast64_t bytes;
+    atomic_uint_fast64_t failures;
+};
+
+/**
+ * \brief A fetched block, shared by the tasks verifying its transactions.
+ */
+typedef struct block_job block_job;
+
+struct block_job
+{
+    bench_context* ctx;
+    uint64_t height;
+    chain_block block;
+    atomic_size_t remaining;
+};
+
+/**
+ * \brief A chunk of the transactions of a block.
+ */
+typedef struct verify_job verify_job;
+
+struct verify_job
+{
+    block_job* job;
+    size_t first;
+    size_t count;
+};
+
+/* forward decls. */
+static status seed_uneven_chain(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts);
+static status get_chain_height(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_parser_options_t* parser_opts,
+    uint64_t* height);
+static status run_scan(
+    bench_context* ctx, uint64_t height, size_t worker_count, bool steal);
+static void fetch_task(
+    task_scheduler* sched, agentd_session* session, void* arg);
+static void verify_task(
+    task_scheduler* sched, agentd_session* session, void* arg);
+static void block_job_release(block_job* job);
+
+/**
+ * \brief Main entry point for the chain scan benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t parser_opts;
+    file file;
+    agentd_session setup;
+    bench_context ctx;
+    uint64_t height;
+    size_t worker_count = env_get_size("SCAN_WORKERS", 8);
+
+    if (0 == worker_count || worker_count > BENCH_MAX_WORKERS)
+    {
+        fprintf(stderr, "Bad chain scan benchmark configuration.\n");
+        return ERROR_SCAN_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* initialize parser options. */
+    retval =
+        vccert_parser_options_simple_init(&parser_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate parser.\n");
+        retval = ERROR_CERTIFICATE_PARSER_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_parser_opts;
+    }
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    retval = seed_uneven_chain(&setup, alloc, &suite, &builder_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    retval = get_chain_height(&setup, alloc, &suite, &parser_opts, &height);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.alloc = alloc;
+    ctx.suite = &suite;
+    ctx.parser_opts = &parser_opts;
+    ctx.verify_chunk = env_get_size("SCAN_VERIFY_CHUNK", 16);
+    if (0 == ctx.verify_chunk)
+    {
+        ctx.verify_chunk = 1;
+    }
+
+    /* one worker session per scheduler thread. */
+    retval =
+        task_scheduler_create(
+            &ctx.sched, alloc, &file, &suite, worker_count, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    printf(
+        "scanning %" PRIu64 " blocks with %zu workers, %zu transactions "
+        "per verify task\n", height, worker_count, ctx.verify_chunk);
+
+    retval = run_scan(&ctx, height, worker_count, false);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = run_scan(&ctx, height, worker_count, true);
+    }
+
+    release_retval = task_scheduler_release(ctx.sched);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_parser_opts:
+    dispose((disposable_t*)&parser_opts);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Seed the chain with blocks of very uneven size.
+ *
+ * SCAN_SEED_BLOCKS blocks are added. Every SCAN_BIG_EVERY-th block holds
+ * SCAN_BIG_TXNS transactions; the others hold one.
+ *
+ * \param session       The setup session.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param builder_opts  The certificate builder options to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status seed_uneven_chain(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts)
+{
+    status retval;
+    vpr_uuid* txn_ids;
+    size_t blocks = env_get_size("SCAN_SEED_BLOCKS", 0);
+    size_t big_every = env_get_size("SCAN_BIG_EVERY", 10);
+    size_t big_txns = env_get_size("SCAN_BIG_TXNS", 100);
+    size_t count;
+
+    if (0 == blocks)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&txn_ids, big_txns * sizeof(vpr_uuid));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* waiting for each batch keeps it in a block of its own. */
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        count = (0 != big_every && 0 == b % big_every) ? big_txns : 1;
+
+        retval =
+            chain_seed_transactions(
+                session, alloc, suite, builder_opts, count, txn_ids, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_txn_ids;
+        }
+
+        retval =
+            chain_wait_for_transaction(
+                session, alloc, suite, &txn_ids[count - 1], 10, 30000, NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_txn_ids;
+        }
+    }
+
+    retval = STATUS_SUCCESS;
+
+cleanup_txn_ids:
+    (void)rcpr_allocator_reclaim(alloc, txn_ids);
+
+    return retval;
+}
+
+/**
+ * \brief Get the height of the latest block.
+ *
+ * \param session       The setup session.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param parser_opts   The parser options to use for this operation.
+ * \param height        Pointer to receive the height.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status get_chain_height(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_parser_options_t* parser_opts,
+    uint64_t* height)
+{
+    status retval;
+    vpr_uuid latest_id, prev_id, next_id;
+    vccrypt_buffer_t cert;
+
+    retval =
+        get_and_verify_last_block_id(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &latest_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        get_and_verify_block(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &latest_id, &cert,
+            &prev_id, &next_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = chain_block_height(height, &cert, parser_opts);
+
+    dispose((disposable_t*)&cert);
+
+    return retval;
+}
+
+/**
+ * \brief Scan every block once and print how evenly the work was spread.
+ *
+ * \param ctx           The benchmark context.
+ * \param height        The height of the latest block.
+ * \param worker_count  The number of scheduler workers.
+ * \param steal         true to let idle workers steal.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_scan(
+    bench_context* ctx, uint64_t height, size_t worker_count, bool steal)
+{
+    status retval = STATUS_SUCCESS;
+    task_scheduler_worker_stats stats[BENCH_MAX_WORKERS];
+    block_job* job;
+    const char* label = steal ? "work stealing" : "static partition";
+    uint64_t start, elapsed_ns, max_busy = 0, total_busy = 0;
+    double elapsed_s, mean_busy;
+
+    atomic_store(&ctx->blocks, 0);
+    atomic_store(&ctx->txns, 0);
+    atomic_store(&ctx->bytes, 0);
+    atomic_store(&ctx->failures, 0);
+    task_scheduler_set_stealing(ctx->sched, steal);
+    task_scheduler_take_stats(ctx->sched, stats);
+
+    /* one fetch task per block, dealt out round robin. */
+    start = latency_clock_now_ns();
+    for (uint64_t h = 1; h <= height; ++h)
+    {
+        retval =
+            rcpr_allocator_allocate(ctx->alloc, (void**)&job, sizeof(*job));
+        if (STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+
+        memset(job, 0, sizeof(*job));
+        job->ctx = ctx;
+        job->height = h;
+
+        retval = task_scheduler_spawn(ctx->sched, &fetch_task, job);
+        if (STATUS_SUCCESS != retval)
+        {
+            (void)rcpr_allocator_reclaim(ctx->alloc, job);
+            break;
+        }
+    }
+
+    task_scheduler_wait(ctx->sched);
+    elapsed_ns = latency_clock_now_ns() - start;
+    elapsed_s = elapsed_ns / 1e9;
+    task_scheduler_take_stats(ctx->sched, stats);
+
+    printf(
+        "%s: %" PRIu64 " blocks, %" PRIu64 " transactions, %" PRIu64
+        " bytes in %.3f s (%.0f blocks/s, %.0f transactions/s), %" PRIu64
+        " failures\n",
+        label, (uint64_t)atomic_load(&ctx->blocks),
+        (uint64_t)atomic_load(&ctx->txns), (uint64_t)atomic_load(&ctx->bytes),
+        elapsed_s, atomic_load(&ctx->blocks) / elapsed_s,
+        atomic_load(&ctx->txns) / elapsed_s,
+        (uint64_t)atomic_load(&ctx->failures));
+
+    for (size_t i = 0; i < worker_count; ++i)
+    {
+        printf(
+            "  worker %zu: %" PRIu64 " tasks, %" PRIu64 " stolen, busy "
+            "%.1f ms (%.0f%%)\n",
+            i, stats[i].tasks, stats[i].steals, stats[i].busy_ns / 1e6,
+            100.0 * stats[i].busy_ns / elapsed_ns);
+
+        total_busy += stats[i].busy_ns;
+        if (stats[i].busy_ns > max_busy)
+        {
+            max_busy = stats[i].busy_ns;
+        }
+    }
+
+    mean_busy = (double)total_busy / worker_count;
+    printf(
+        "  imbalance (max busy / mean busy): %.2f\n",
+        mean_busy > 0 ? max_busy / mean_busy : 1.0);
+
+    if (STATUS_SUCCESS == retval && 0 != atomic_load(&ctx->failures))
+    {
+        retval = ERROR_SCAN_BENCH_FAILED;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Fetch and parse one block, then spawn its verify tasks.
+ *
+ * \param sched         The scheduler running this task.
+ * \param session       The session of the worker running this task.
+ * \param arg           The \ref block_job for the block.
+ */
+static void fetch_task(
+    task_scheduler* sched, agentd_session* session, void* arg)
+{
+    block_job* job = (block_job*)arg;
+    bench_context* ctx = job->ctx;
+    verify_job* chunk;
+    size_t chunks;
+    status retval;
+
+    /* fetch stage. */
+    retval =
+        chain_block_fetch(
+            &job->block, session, ctx->alloc, ctx->suite, job->height);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    /* parse stage. */
+    retval = chain_block_parse(&job->block, ctx->alloc, ctx->parser_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    atomic_fetch_add(&ctx->blocks, 1);
+    atomic_fetch_add(&ctx->bytes, job->block.cert.size);
+
+    chunks =
+        (job->block.txn_count + ctx->verify_chunk - 1) / ctx->verify_chunk;
+    if (0 == chunks)
+    {
+        block_job_release(job);
+        return;
+    }
+
+    /* verify stage, split so that idle workers can share large blocks. */
+    atomic_init(&job->remaining, chunks);
+    for (size_t i = 0; i < chunks; ++i)
+    {
+        chunk = NULL;
+        retval =
+            rcpr_allocator_allocate(
+                ctx->alloc, (void**)&chunk, sizeof(*chunk));
+        if (STATUS_SUCCESS == retval)
+        {
+            chunk->job = job;
+            chunk->first = i * ctx->verify_chunk;
+            chunk->count = job->block.txn_count - chunk->first;
+            if (chunk->count > ctx->verify_chunk)
+            {
+                chunk->count = ctx->verify_chunk;
+            }
+
+            retval = task_scheduler_spawn(sched, &verify_task, chunk);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            /* count the chunk as failed; the block is still released. */
+            atomic_fetch_add(&ctx->failures, 1);
+            if (NULL != chunk)
+            {
+                (void)rcpr_allocator_reclaim(ctx->alloc, chunk);
+            }
+
+            if (1 == atomic_fetch_sub(&job->remaining, 1))
+            {
+                block_job_release(job);
+            }
+        }
+    }
+
+    return;
+
+fail:
+    atomic_fetch_add(&ctx->failures, 1);
+    block_job_release(job);
+}
+
+/**
+ * \brief Verify a chunk of the transactions of a block.
+ *
+ * \param sched         The scheduler running this task.
+ * \param session       The session of the worker running this task.
+ * \param arg           The \ref verify_job.
+ */
+static void verify_task(
+    task_scheduler* sched, agentd_session* session, void* arg)
+{
+    (void)sched;
+    (void)session;
+    verify_job* chunk = (verify_job*)arg;
+    block_job* job = chunk->job;
+    bench_context* ctx = job->ctx;
+    chain_block_txn_info info;
+
+    for (size_t i = chunk->first; i < chunk->first + chunk->count; ++i)
+    {
+        if (STATUS_SUCCESS ==
+                chain_block_verify_txn(
+                    &info, &job->block.txns[i], ctx->parser_opts, ctx->suite))
+        {
+            atomic_fetch_add(&ctx->txns, 1);
+        }
+        else
+        {
+            atomic_fetch_add(&ctx->failures, 1);
+        }
+    }
+
+    (void)rcpr_allocator_reclaim(ctx->alloc, chunk);
+
+    /* the last chunk releases the block. */
+    if (1 == atomic_fetch_sub(&job->remaining, 1))
+    {
+        block_job_release(job);
+    }
+}
+
+/**
+ * \brief Release a block job.
+ *
+ * \param job           The job to release.
+ */
+static void block_job_release(block_job* job)
+{
+    rcpr_allocator* alloc = job->ctx->alloc;
+
+    chain_block_dispose(&job->block, alloc);
+    (void)rcpr_allocator_reclaim(alloc, job);
+}
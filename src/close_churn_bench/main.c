@@ -0,0 +1,474 @@
+/**
+ * \file close_churn_bench/main.c
+ *
+ * \brief Main entry point for the close churn benchmark.
+ *
+ * This benchmark opens and discards a large number of short-lived sessions at
+ * a high rate, first closing each one gracefully with a protocol level close,
+ * then dropping each one abruptly with a request still in flight. While each
+ * phase runs, it samples the resident memory and open file descriptors of the
+ * local agentd processes. Once the phase ends, it measures how long agentd
+ * takes to return to its pre-phase fd count and resident memory.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/agentd_status.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/proc_stats.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vcblockchain/protocol.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief The ways in which a churned session ends.
+ */
+typedef enum churn_mode
+{
+    CHURN_MODE_GRACEFUL,
+    CHURN_MODE_ABRUPT,
+} churn_mode;
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    churn_mode mode;
+    size_t sessions;
+    atomic_size_t next_session;
+    atomic_size_t threads_done;
+};
+
+/**
+ * \brief Per-thread benchmark state.
+ */
+typedef struct bench_thread bench_thread;
+
+struct bench_thread
+{
+    pthread_t thread;
+    bench_context* ctx;
+    load_stats stats;
+};
+
+/**
+ * \brief Benchmark settings.
+ */
+typedef struct bench_settings bench_settings;
+
+struct bench_settings
+{
+    size_t thread_count;
+    uint64_t sample_ns;
+    uint64_t settle_timeout_ns;
+    uint64_t rss_slack_bytes;
+};
+
+/* forward decls. */
+static status run_phase(
+    bench_context* ctx, bench_thread* threads,
+    const bench_settings* settings, churn_mode mode, const char* label);
+static void* churn_thread_main(void* context);
+static status churn_one(bench_context* ctx);
+
+/**
+ * \brief Main entry point for the close churn benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    bench_context ctx;
+    bench_settings settings;
+    bench_thread* threads = NULL;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.sessions = env_get_size("CHURN_SESSIONS", 1000);
+    settings.thread_count = env_get_size("CHURN_THREADS", 16);
+    settings.sample_ns =
+        env_get_size("CHURN_SAMPLE_MS", 10) * UINT64_C(1000000);
+    settings.settle_timeout_ns =
+        env_get_size("CHURN_SETTLE_TIMEOUT_MS", 30000) * UINT64_C(1000000);
+    settings.rss_slack_bytes =
+        env_get_size("CHURN_RSS_SLACK_KB", 1024) * UINT64_C(1024);
+    if (0 == settings.thread_count)
+    {
+        settings.thread_count = 1;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    ctx.alloc = alloc;
+    ctx.file = &file;
+    ctx.suite = &suite;
+
+    /* allocate the churn threads. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&threads,
+            settings.thread_count * sizeof(bench_thread));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    /* run the graceful close phase. */
+    retval =
+        run_phase(&ctx, threads, &settings, CHURN_MODE_GRACEFUL, "graceful");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_threads;
+    }
+
+    /* run the abrupt drop phase. */
+    retval = run_phase(&ctx, threads, &settings, CHURN_MODE_ABRUPT, "abrupt");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_threads;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_threads;
+
+cleanup_threads:
+    release_retval = rcpr_allocator_reclaim(alloc, threads);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Run one phase of the benchmark.
+ *
+ * \param ctx           The benchmark context.
+ * \param threads       The thread array to use for this phase.
+ * \param settings      The benchmark settings.
+ * \param mode          The way in which each session ends in this phase.
+ * \param label         The label for this phase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_phase(
+    bench_context* ctx, bench_thread* threads,
+    const bench_settings* settings, churn_mode mode, const char* label)
+{
+    status retval;
+    proc_snapshot baseline, sample;
+    load_stats merged;
+    uint64_t start, end, now;
+    uint64_t fd_release_ns = 0, rss_release_ns = 0;
+    bool fds_released = false, rss_released = false;
+    uint64_t peak_rss;
+    size_t peak_fds;
+
+    /* measure agentd at rest. */
+    retval = proc_snapshot_take(&baseline, "agentd");
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (0 == baseline.count)
+    {
+        fprintf(stderr, "No agentd processes found.\n");
+    }
+
+    peak_rss = baseline.total_rss_bytes;
+    peak_fds = baseline.total_fds;
+
+    ctx->mode = mode;
+    atomic_store(&ctx->next_session, 0);
+    atomic_store(&ctx->threads_done, 0);
+    load_stats_init(&merged);
+
+    /* start the churn threads. */
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < settings->thread_count; ++i)
+    {
+        threads[i].ctx = ctx;
+        load_stats_init(&threads[i].stats);
+        pthread_create(
+            &threads[i].thread, NULL, &churn_thread_main, &threads[i]);
+    }
+
+    /* sample agentd while the churn runs. */
+    while (atomic_load(&ctx->threads_done) < settings->thread_count)
+    {
+        if (STATUS_SUCCESS == proc_snapshot_take(&sample, "agentd"))
+        {
+            if (sample.total_rss_bytes > peak_rss)
+            {
+                peak_rss = sample.total_rss_bytes;
+            }
+
+            if (sample.total_fds > peak_fds)
+            {
+                peak_fds = sample.total_fds;
+            }
+        }
+
+        usleep(settings->sample_ns / 1000);
+    }
+
+    for (size_t i = 0; i < settings->thread_count; ++i)
+    {
+        pthread_join(threads[i].thread, NULL);
+        load_stats_merge(&merged, &threads[i].stats);
+    }
+
+    end = latency_clock_now_ns();
+
+    /* wait for agentd to release what the churn consumed. */
+    do
+    {
+        now = latency_clock_now_ns();
+        retval = proc_snapshot_take(&sample, "agentd");
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (!fds_released && sample.total_fds <= baseline.total_fds)
+        {
+            fds_released = true;
+            fd_release_ns = now - end;
+        }
+
+        if (!rss_released
+         && sample.total_rss_bytes
+                <= baseline.total_rss_bytes + settings->rss_slack_bytes)
+        {
+            rss_released = true;
+            rss_release_ns = now - end;
+        }
+
+        if (fds_released && rss_released)
+        {
+            break;
+        }
+
+        usleep(settings->sample_ns / 1000);
+    } while (now - end < settings->settle_timeout_ns);
+
+    /* report. */
+    load_stats_print(&merged, stdout, label, (end - start) / 1e9);
+    printf(
+        "%s: %zu sessions in %.2fs (%.1f/s)\n", label, ctx->sessions,
+        (end - start) / 1e9, ctx->sessions / ((end - start) / 1e9));
+    printf(
+        "%s: baseline fds=%zu rss=%" PRIu64 "KB, peak fds=%zu (+%zu)"
+        " rss=%" PRIu64 "KB (+%" PRIu64 "KB)\n",
+        label, baseline.total_fds, baseline.total_rss_bytes / 1024, peak_fds,
+        peak_fds - baseline.total_fds, peak_rss / 1024,
+        (peak_rss - baseline.total_rss_bytes) / 1024);
+
+    if (fds_released)
+    {
+        printf(
+            "%s: fds released %.1fms after churn\n", label,
+            fd_release_ns / 1e6);
+    }
+    else
+    {
+        printf(
+            "%s: fds NOT released after %.1fms (%zu still open)\n", label,
+            settings->settle_timeout_ns / 1e6,
+            sample.total_fds - baseline.total_fds);
+    }
+
+    if (rss_released)
+    {
+        printf(
+            "%s: rss settled %.1fms after churn\n", label,
+            rss_release_ns / 1e6);
+    }
+    else
+    {
+        printf(
+            "%s: rss NOT settled after %.1fms (%" PRIu64 "KB retained)\n",
+            label, settings->settle_timeout_ns / 1e6,
+            (sample.total_rss_bytes - baseline.total_rss_bytes) / 1024);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Churn thread entry point.
+ *
+ * \param context       The \ref bench_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* churn_thread_main(void* context)
+{
+    bench_thread* th = (bench_thread*)context;
+    bench_context* ctx = th->ctx;
+    uint64_t start;
+    status retval;
+
+    while (atomic_fetch_add(&ctx->next_session, 1) < ctx->sessions)
+    {
+        agentd_status_clear();
+        start = latency_clock_now_ns();
+        retval = churn_one(ctx);
+        load_stats_record(&th->stats, retval, latency_clock_now_ns() - start);
+    }
+
+    atomic_fetch_add(&ctx->threads_done, 1);
+
+    return NULL;
+}
+
+/**
+ * \brief Open a session, issue a request, and end the session.
+ *
+ * In graceful mode, the request is answered and the session is closed with a
+ * close request. In abrupt mode, the socket is closed as soon as the request
+ * is written, so agentd has a response in flight and unread data may remain
+ * in the client's receive buffer, which makes the kernel reset the connection.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status churn_one(bench_context* ctx)
+{
+    status retval, release_retval;
+    agentd_session session;
+    const uint32_t status_offset = 0x3133;
+
+    retval =
+        agentd_session_init(
+            &session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (CHURN_MODE_GRACEFUL == ctx->mode)
+    {
+        retval =
+            get_and_verify_status(
+                session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+                &session.server_iv, &session.shared_secret);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_session;
+        }
+
+        retval =
+            send_and_verify_close_connection(
+                session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+                &session.server_iv, &session.shared_secret);
+    }
+    else
+    {
+        retval =
+            vcblockchain_protocol_sendreq_status_get(
+                session.sock, ctx->suite, &session.client_iv,
+                &session.shared_secret, status_offset);
+        if (STATUS_SUCCESS != retval)
+        {
+            retval = ERROR_SEND_STATUS_REQ;
+        }
+    }
+
+cleanup_session:
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
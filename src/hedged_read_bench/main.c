@@ -0,0 +1,454 @@
+/**
+ * \file hedged_read_bench/main.c
+ *
+ * \brief Main entry point for the hedged read benchmark.
+ *
+ * This benchmark runs the same read-heavy workload against a session pool
+ * twice: once with hedging disabled, and once with hedging enabled. It reports
+ * the latency distribution of each run, along with the number of additional
+ * wire requests that hedging caused.
+ *
+ * By default, the first failed read aborts the run. If LOAD_KEEP_GOING is set
+ * to 1, failed reads are counted by helper error code and agentd status, and
+ * the run continues.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/session_pool.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+#define BENCH_MAX_TXNS 256
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    session_pool* pool;
+    size_t iterations;
+    bool keep_going;
+    size_t txn_count;
+    vpr_uuid txn_ids[BENCH_MAX_TXNS];
+    vpr_uuid latest_block_id;
+};
+
+/**
+ * \brief Per-thread benchmark state.
+ */
+typedef struct bench_thread bench_thread;
+
+struct bench_thread
+{
+    pthread_t thread;
+    bench_context* ctx;
+    size_t index;
+    status retval;
+    load_stats stats;
+};
+
+/* forward decls. */
+static status run_phase(
+    bench_context* ctx, bench_thread* threads, size_t thread_count,
+    const char* label, load_stats* merged, session_pool_stats* stats);
+static void* bench_thread_main(void* context);
+static void make_request(
+    const bench_context* ctx, size_t index, size_t i, read_request* req);
+
+/**
+ * \brief Main entry point for the hedged read benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    agentd_session setup;
+    bench_context ctx;
+    bench_thread* threads = NULL;
+    load_stats baseline, hedged;
+    session_pool_stats baseline_stats, hedged_stats;
+    session_pool_hedge_policy policy;
+    size_t session_count = env_get_size("HEDGE_BENCH_SESSIONS", 4);
+    size_t thread_count = env_get_size("HEDGE_BENCH_THREADS", 8);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.iterations = env_get_size("HEDGE_BENCH_ITERATIONS", 2000);
+    ctx.keep_going = 0 != env_get_size("LOAD_KEEP_GOING", 0);
+    ctx.txn_count = env_get_size("HEDGE_BENCH_TXNS", 16);
+    if (0 == ctx.txn_count || ctx.txn_count > BENCH_MAX_TXNS)
+    {
+        ctx.txn_count = 16;
+    }
+
+    policy.enabled = true;
+    policy.percentile = env_get_double("HEDGE_BENCH_PERCENTILE", 95.0);
+    policy.min_delay_ns =
+        env_get_size("HEDGE_BENCH_MIN_DELAY_US", 100) * UINT64_C(1000);
+    policy.warmup_samples = env_get_size("HEDGE_BENCH_WARMUP", 200);
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    /* seed the chain with transactions to read. */
+    printf("Submitting %zu transactions.\n", ctx.txn_count);
+    retval =
+        chain_seed_transactions(
+            &setup, alloc, &suite, &builder_opts, ctx.txn_count, ctx.txn_ids,
+            NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* wait for the last transaction to be canonized. */
+    retval =
+        chain_wait_for_transaction(
+            &setup, alloc, &suite, &ctx.txn_ids[ctx.txn_count - 1], 100,
+            30000, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* get the latest block id. */
+    retval =
+        get_and_verify_last_block_id(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret, &ctx.latest_block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* create the session pool. */
+    retval =
+        session_pool_create(
+            &ctx.pool, alloc, &file, &suite, session_count, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* allocate the benchmark threads. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&threads, thread_count * sizeof(bench_thread));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* run the baseline phase. */
+    retval =
+        run_phase(
+            &ctx, threads, thread_count, "baseline", &baseline,
+            &baseline_stats);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_threads;
+    }
+
+    /* run the hedged phase. */
+    session_pool_set_hedge_policy(ctx.pool, &policy);
+    retval =
+        run_phase(
+            &ctx, threads, thread_count, "hedged", &hedged, &hedged_stats);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_threads;
+    }
+
+    /* summarize. */
+    printf(
+        "p99.9 baseline=%.1fus hedged=%.1fus (%.1f%% change)\n",
+        latency_histogram_percentile(&baseline.success_latency, 99.9) / 1000.0,
+        latency_histogram_percentile(&hedged.success_latency, 99.9) / 1000.0,
+        100.0 *
+            ((double)latency_histogram_percentile(
+                    &hedged.success_latency, 99.9)
+                - (double)latency_histogram_percentile(
+                    &baseline.success_latency, 99.9))
+            / (double)latency_histogram_percentile(
+                &baseline.success_latency, 99.9));
+    printf(
+        "added load: %" PRIu64 " extra wire requests for %" PRIu64
+        " reads (%.2f%%), %" PRIu64 " hedges won.\n",
+        hedged_stats.wire_requests - hedged_stats.requests,
+        hedged_stats.requests,
+        100.0 * (double)(hedged_stats.wire_requests - hedged_stats.requests)
+            / (double)hedged_stats.requests,
+        hedged_stats.hedge_wins);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_threads;
+
+cleanup_threads:
+    release_retval = rcpr_allocator_reclaim(alloc, threads);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_pool:
+    release_retval = session_pool_release(ctx.pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Run one phase of the benchmark.
+ *
+ * \param ctx           The benchmark context.
+ * \param threads       The thread array to use for this phase.
+ * \param thread_count  The number of threads to run.
+ * \param label         The label for this phase.
+ * \param merged        Load stats to receive the merged results.
+ * \param stats         Structure to receive the pool counters for this phase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_phase(
+    bench_context* ctx, bench_thread* threads, size_t thread_count,
+    const char* label, load_stats* merged, session_pool_stats* stats)
+{
+    status retval = STATUS_SUCCESS;
+    uint64_t start;
+
+    session_pool_reset_stats(ctx->pool);
+    load_stats_init(merged);
+    start = latency_clock_now_ns();
+
+    /* start the threads. */
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads[i].ctx = ctx;
+        threads[i].index = i;
+        threads[i].retval = STATUS_SUCCESS;
+        load_stats_init(&threads[i].stats);
+        pthread_create(&threads[i].thread, NULL, &bench_thread_main,
+            &threads[i]);
+    }
+
+    /* join the threads and merge their results. */
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        pthread_join(threads[i].thread, NULL);
+        load_stats_merge(merged, &threads[i].stats);
+        if (STATUS_SUCCESS != threads[i].retval)
+        {
+            retval = threads[i].retval;
+        }
+    }
+
+    session_pool_get_stats(ctx->pool, stats);
+    load_stats_print(
+        merged, stdout, label, (latency_clock_now_ns() - start) / 1e9);
+    printf(
+        "%-24s requests=%" PRIu64 " wire=%" PRIu64 " hedges=%" PRIu64
+        " hedge_wins=%" PRIu64 "\n",
+        label, stats->requests, stats->wire_requests, stats->hedges,
+        stats->hedge_wins);
+
+    return retval;
+}
+
+/**
+ * \brief Benchmark thread entry point.
+ *
+ * \param context       The \ref bench_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* bench_thread_main(void* context)
+{
+    bench_thread* th = (bench_thread*)context;
+    read_request req;
+    read_result result;
+    uint64_t start;
+    status retval;
+
+    for (size_t i = 0; i < th->ctx->iterations; ++i)
+    {
+        make_request(th->ctx, th->index, i, &req);
+
+        start = latency_clock_now_ns();
+        retval = session_pool_read(th->ctx->pool, &req, &result);
+        load_stats_record(&th->stats, retval, latency_clock_now_ns() - start);
+        if (STATUS_SUCCESS != retval)
+        {
+            if (th->ctx->keep_going)
+            {
+                continue;
+            }
+
+            th->retval = retval;
+            break;
+        }
+
+        read_result_dispose(&result);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Build the next request in the read mix.
+ *
+ * The mix cycles through block gets, transaction gets, latest block id
+ * lookups, and block id by height lookups.
+ *
+ * \param ctx           The benchmark context.
+ * \param index         The index of the calling thread.
+ * \param i             The iteration number.
+ * \param req           The request to populate.
+ */
+static void make_request(
+    const bench_context* ctx, size_t index, size_t i, read_request* req)
+{
+    memset(req, 0, sizeof(*req));
+
+    switch ((index + i) % 4)
+    {
+        case 0:
+            req->type = READ_REQUEST_BLOCK_GET;
+            memcpy(&req->id, &ctx->latest_block_id, sizeof(req->id));
+            break;
+
+        case 1:
+            req->type = READ_REQUEST_TXN_GET;
+            memcpy(
+                &req->id, &ctx->txn_ids[(index + i) % ctx->txn_count],
+                sizeof(req->id));
+            break;
+
+        case 2:
+            req->type = READ_REQUEST_LATEST_BLOCK_ID_GET;
+            break;
+
+        default:
+            req->type = READ_REQUEST_BLOCK_ID_BY_HEIGHT_GET;
+            req->height = 1;
+            break;
+    }
+}
@@ -0,0 +1,224 @@
+/**
+ * \file helpers/agentd_connection_handshake.c
+ *
+ * \brief Authenticate a connection to an agentd instance.
+ *
+ * \copyright 2021-2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <fcntl.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <rcpr/resource.h>
+#include <rcpr/uuid.h>
+#include <stdio.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/error_codes.h>
+
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Perform the agentd handshake over an already connected socket.
+ *
+ * This method initializes and returns a shared secret, client_iv, server_iv,
+ * and entity private certificate on success, exactly as
+ * \ref agentd_connection_init does, but leaves the socket to the caller. This
+ * lets callers that own the socket descriptor, such as transports that drive
+ * many sockets from one event loop, authenticate it with the blocking path.
+ * The socket is not released on failure.
+ *
+ * \param sock          The socket connection to agentd.
+ * \param alloc         The allocator to use for this operation.
+ * \param cert          Pointer to the entity private certificate pointer that
+ *                      will receive the client private entity certificate on
+ *                      success.
+ * \param shared_secret Pointer to a vccrypt buffer that will be initialized on
+ *                      success with the shared secret for this session.
+ * \param client_iv     Pointer to the uint64_t value that will be updated with
+ *                      the client_iv on success.
+ * \param server_iv     Pointer to the uint64_t value that will be updated with
+ *                      the server_iv on success.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_connection_handshake(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vcblockchain_entity_private_cert** cert, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv, file* file,
+    vccrypt_suite_options_t* suite, const char* clientpriv,
+    const char* serverpub)
+{
+    bool success = false;
+    status retval, release_retval;
+    vcblockchain_entity_public_cert* server_cert;
+    const vccrypt_buffer_t* client_pubkey;
+    const vccrypt_buffer_t* client_privkey;
+    const vccrypt_buffer_t* server_pubkey;
+    const rcpr_uuid* client_id;
+    const rcpr_uuid* server_id;
+    vccrypt_buffer_t key_nonce;
+    vccrypt_buffer_t challenge_nonce;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != cert);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(prop_file_valid(file));
+    MODEL_ASSERT(prop_vccrypt_crypto_suite_valid(suite));
+    MODEL_ASSERT(NULL != clientpriv);
+    MODEL_ASSERT(NULL != serverpub);
+
+    /* read the private key. */
+    retval =
+        entity_private_certificate_create_from_file(
+            cert, file, suite, clientpriv);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /*read the public key. */
+    retval =
+        entity_public_certificate_create_from_file(
+            &server_cert, file, suite, serverpub);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_cert;
+    }
+
+    /* get client artifact id. */
+    retval =
+        vcblockchain_entity_get_artifact_id(&client_id, *cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_cert;
+    }
+
+    /* get client public encryption key. */
+    retval =
+        vcblockchain_entity_get_public_encryption_key(
+            &client_pubkey, *cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_cert;
+    }
+
+    /* get client private encryption key. */
+    retval =
+        vcblockchain_entity_private_cert_get_private_encryption_key(
+            &client_privkey, *cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_cert;
+    }
+
+    /* get server artifact id. */
+    retval =
+        vcblockchain_entity_get_artifact_id(&server_id, server_cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_cert;
+    }
+
+    /* get server public encryption key. */
+    retval =
+        vcblockchain_entity_get_public_encryption_key(
+            &server_pubkey, server_cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_cert;
+    }
+
+    /* send handshake request. */
+    retval =
+        vcblockchain_protocol_sendreq_handshake_request(
+            sock, suite, (const vpr_uuid*)client_id, &key_nonce,
+            &challenge_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error sending handshake request to agentd.\n");
+        retval = ERROR_SEND_HANDSHAKE_REQ;
+        goto cleanup_server_cert;
+    }
+
+    /* receive the response and acknowledge it. */
+    retval =
+        agentd_connection_handshake_finish(
+            sock, alloc, suite, server_id, server_pubkey, client_privkey,
+            &key_nonce, &challenge_nonce, shared_secret, client_iv,
+            server_iv);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_handshake_req;
+    }
+
+    /* success. */
+    success = true;
+    goto cleanup_handshake_req;
+
+cleanup_handshake_req:
+    dispose((disposable_t*)&key_nonce);
+    dispose((disposable_t*)&challenge_nonce);
+
+cleanup_server_cert:
+    release_retval =
+        resource_release(
+            vcblockchain_entity_public_cert_resource_handle(server_cert));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_cert:
+    if (!success)
+    {
+        release_retval =
+            resource_release(
+                vcblockchain_entity_private_cert_resource_handle(*cert));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        cert = NULL;
+    }
+
+done:
+    /* if something went wrong during cleanup, attempt to clean up return
+     * values. */
+    if (success && STATUS_SUCCESS != retval)
+    {
+        if (shared_secret != NULL)
+        {
+            dispose((disposable_t*)shared_secret);
+            shared_secret = NULL;
+        }
+
+        if (cert != NULL)
+        {
+            release_retval =
+                resource_release(
+                    vcblockchain_entity_private_cert_resource_handle(*cert));
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+
+            cert = NULL;
+        }
+    }
+
+    return retval;
+}
@@ -0,0 +1,177 @@
+/**
+ * \file helpers/agentd_connection_handshake_finish.c
+ *
+ * \brief Complete an agentd handshake once its request has been sent.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/error_codes.h>
+#include <vccrypt/compare.h>
+
+/**
+ * \brief Complete an agentd handshake once its request has been sent.
+ *
+ * This receives and verifies the handshake response, derives the shared
+ * secret, and sends and verifies the handshake acknowledgement. It is the
+ * part of the handshake that depends on the server; everything before it
+ * depends only on the client's credentials.
+ *
+ * \param sock              The socket connection to agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param server_id         The expected server artifact id.
+ * \param server_pubkey     The expected server public encryption key.
+ * \param client_privkey    The client private encryption key.
+ * \param key_nonce         The key nonce sent in the handshake request.
+ * \param challenge_nonce   The challenge nonce sent in the handshake request.
+ * \param shared_secret     Pointer to a vccrypt buffer that will be
+ *                          initialized on success with the shared secret for
+ *                          this session.
+ * \param client_iv         Pointer to the uint64_t value that will be updated
+ *                          with the client_iv on success.
+ * \param server_iv         Pointer to the uint64_t value that will be updated
+ *                          with the server_iv on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_connection_handshake_finish(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const RCPR_SYM(rcpr_uuid)* server_id,
+    const vccrypt_buffer_t* server_pubkey,
+    const vccrypt_buffer_t* client_privkey, const vccrypt_buffer_t* key_nonce,
+    const vccrypt_buffer_t* challenge_nonce, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv)
+{
+    bool success = false;
+    status retval;
+    uint32_t status, offset, request_id;
+    RCPR_SYM(rcpr_uuid) server_id_from_server;
+    vccrypt_buffer_t server_pubkey_from_server;
+    vccrypt_buffer_t server_challenge_nonce;
+    vccrypt_buffer_t response;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != server_id);
+    MODEL_ASSERT(NULL != server_pubkey);
+    MODEL_ASSERT(NULL != client_privkey);
+    MODEL_ASSERT(NULL != key_nonce);
+    MODEL_ASSERT(NULL != challenge_nonce);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != server_iv);
+
+    /* receive handshake response. */
+    retval =
+        vcblockchain_protocol_recvresp_handshake_request(
+            sock, alloc, suite, (vpr_uuid*)&server_id_from_server,
+            &server_pubkey_from_server, client_privkey, key_nonce,
+            challenge_nonce, &server_challenge_nonce, shared_secret, &offset,
+            &status);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr,
+            "Error receiving handshake response from agentd (%x).\n", retval);
+        retval = ERROR_RECV_HANDSHAKE_RESP;
+        goto done;
+    }
+
+    /* verify that the server ids match. */
+    if (crypto_memcmp(server_id, &server_id_from_server, 16))
+    {
+        fprintf(stderr, "Server UUIDs do not match!\n");
+        retval = ERROR_SERVER_ID_MISMATCH;
+        goto cleanup_handshake_resp;
+    }
+
+    /* verify that the server pubkey matches. */
+    if (server_pubkey_from_server.size != server_pubkey->size
+     || crypto_memcmp(
+            server_pubkey->data, server_pubkey_from_server.data,
+            server_pubkey->size))
+    {
+        fprintf(stderr, "Server public keys do not match!\n");
+        retval = ERROR_SERVER_KEY_MISMATCH;
+        goto cleanup_handshake_resp;
+    }
+
+    /* send handshake acknowledge request. */
+    retval =
+        vcblockchain_protocol_sendreq_handshake_ack(
+            sock, suite, client_iv, server_iv, shared_secret,
+            &server_challenge_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error sending handshake ack to agentd.\n");
+        retval = ERROR_SEND_HANDSHAKE_ACK;
+        goto cleanup_handshake_resp;
+    }
+
+    /* read a response. */
+    retval =
+        vcblockchain_protocol_recvresp(
+            sock, alloc, suite, server_iv, shared_secret, &response);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error getting handshake ack response.\n");
+        retval = ERROR_RECV_HANDSHAKE_ACK;
+        goto cleanup_handshake_resp;
+    }
+
+    /* decode the response header. */
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &offset, &status, &response);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error decoding response header.\n");
+        retval = ERROR_DECODE_HANDSHAKE_ACK;
+        goto cleanup_resp;
+    }
+
+    /* verify that the request id matches. */
+    if (PROTOCOL_REQ_ID_HANDSHAKE_ACKNOWLEDGE != request_id)
+    {
+        fprintf(stderr, "Unexpected request id (%x).\n", request_id);
+        retval = ERROR_HANDSHAKE_ACK_REQUEST_ID;
+        goto cleanup_resp;
+    }
+
+    /* verify that the status was successful. */
+    if (STATUS_SUCCESS != status)
+    {
+        agentd_status_record(status);
+        fprintf(
+            stderr, "Handshake was not acknowledged by server (%x).\n", status);
+        retval = ERROR_HANDSHAKE_ACK_STATUS;
+        goto cleanup_resp;
+    }
+
+    /* success. */
+    success = true;
+    goto cleanup_resp;
+
+cleanup_resp:
+    dispose((disposable_t*)&response);
+
+cleanup_handshake_resp:
+    dispose((disposable_t*)&server_pubkey_from_server);
+    dispose((disposable_t*)&server_challenge_nonce);
+    if (!success)
+    {
+        dispose((disposable_t*)shared_secret);
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,61 @@
+/**
+ * \file helpers/agentd_session/agentd_session_dispose.c
+ *
+ * \brief Release the resources owned by an agentd session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_session.h>
+#include <rcpr/resource.h>
+#include <string.h>
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Release the resources owned by a session.
+ *
+ * This does not send a close request; callers wanting a graceful close should
+ * call \ref send_and_verify_close_connection first.
+ *
+ * \param session       The session to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_dispose(agentd_session* session)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+
+    if (NULL != session->cert)
+    {
+        release_retval =
+            resource_release(
+                vcblockchain_entity_private_cert_resource_handle(
+                    session->cert));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        dispose((disposable_t*)&session->shared_secret);
+    }
+
+    if (NULL != session->sock)
+    {
+        release_retval = resource_release(psock_resource_handle(session->sock));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    memset(session, 0, sizeof(*session));
+
+    return retval;
+}
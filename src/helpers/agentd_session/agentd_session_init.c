@@ -0,0 +1,49 @@
+/**
+ * \file helpers/agentd_session/agentd_session_init.c
+ *
+ * \brief Connect and authenticate an agentd session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/conn_helpers.h>
+#include <string.h>
+
+/**
+ * \brief Connect and authenticate a session with agentd.
+ *
+ * \param session       The session to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the session owns a socket, a private certificate, and a
+ * shared secret. These must be released by calling
+ * \ref agentd_session_dispose when the session is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_init(
+    agentd_session* session, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, const char* hostaddr,
+    unsigned int hostport, const char* clientpriv, const char* serverpub)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+
+    memset(session, 0, sizeof(*session));
+
+    return
+        agentd_connection_init(
+            &session->sock, alloc, &session->cert, &session->shared_secret,
+            &session->client_iv, &session->server_iv, file, suite, hostaddr,
+            hostport, clientpriv, serverpub);
+}
@@ -0,0 +1,79 @@
+/**
+ * \file helpers/agentd_session/agentd_session_init_from_descriptor.c
+ *
+ * \brief Authenticate an agentd session over a caller-opened descriptor.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/conn_helpers.h>
+#include <rcpr/resource.h>
+#include <string.h>
+#include <unistd.h>
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Authenticate a session over a socket descriptor the caller opened.
+ *
+ * The session's socket wraps the descriptor, so the blocking request helpers
+ * work on it as usual, while transports that multiplex many sessions can
+ * drive the descriptor directly.
+ *
+ * \param session       The session to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param descriptor    A socket descriptor connected to agentd.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note The session takes ownership of the descriptor, even on failure. On
+ * success, it must be released by calling \ref agentd_session_dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_init_from_descriptor(
+    agentd_session* session, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, int descriptor, const char* clientpriv,
+    const char* serverpub)
+{
+    status retval, release_retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(descriptor >= 0);
+
+    memset(session, 0, sizeof(*session));
+
+    /* the psock owns the descriptor from here on. */
+    retval = psock_create_from_descriptor(&session->sock, alloc, descriptor);
+    if (STATUS_SUCCESS != retval)
+    {
+        close(descriptor);
+        return retval;
+    }
+
+    retval =
+        agentd_connection_handshake(
+            session->sock, alloc, &session->cert, &session->shared_secret,
+            &session->client_iv, &session->server_iv, file, suite, clientpriv,
+            serverpub);
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval =
+            resource_release(psock_resource_handle(session->sock));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        session->sock = NULL;
+    }
+
+    return retval;
+}
@@ -0,0 +1,82 @@
+/**
+ * \file helpers/agentd_session/agentd_session_init_pooled.c
+ *
+ * \brief Connect and authenticate an agentd session with precomputed
+ * handshake material.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/status_codes.h>
+#include <rcpr/resource.h>
+#include <stdio.h>
+#include <string.h>
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Connect and authenticate a session using a handshake pool.
+ *
+ * This is \ref agentd_session_init for callers that reconnect often: the
+ * credential files are read, and the handshake request is encoded, ahead of
+ * time by the pool, so the connection waits only on the network and the
+ * server.
+ *
+ * \param session       The session to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param pool          The handshake pool for the client credential.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ *
+ * \note On success, the session must be released by calling
+ * \ref agentd_session_dispose when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status agentd_session_init_pooled(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    handshake_pool* pool, const char* hostaddr, unsigned int hostport)
+{
+    status retval, release_retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != hostaddr);
+    MODEL_ASSERT(hostport < 65536);
+
+    memset(session, 0, sizeof(*session));
+
+    /* open socket connection to agentd. */
+    retval =
+        psock_create_from_hostname_and_port(
+            &session->sock, alloc, hostaddr, hostport);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error connecting to agentd.\n");
+        session->sock = NULL;
+        return ERROR_AGENTD_SOCKET_CONNECT;
+    }
+
+    retval =
+        handshake_pool_handshake(
+            pool, session->sock, alloc, &session->cert,
+            &session->shared_secret, &session->client_iv,
+            &session->server_iv);
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval =
+            resource_release(psock_resource_handle(session->sock));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+        session->sock = NULL;
+    }
+
+    return retval;
+}
@@ -0,0 +1,71 @@
+/**
+ * \file helpers/agentd_socket_connect.c
+ *
+ * \brief Open a raw TCP connection to agentd.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/**
+ * \brief Open a TCP connection to agentd and return its raw descriptor.
+ *
+ * \param descriptor    Pointer to receive the connected descriptor on
+ *                      success, which the caller must close.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_AGENTD_SOCKET_CONNECT if the connection failed.
+ */
+status agentd_socket_connect(
+    int* descriptor, const char* hostaddr, unsigned int hostport)
+{
+    struct sockaddr_in addr;
+    int fd, nodelay = 1;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != descriptor);
+    MODEL_ASSERT(NULL != hostaddr);
+    MODEL_ASSERT(hostport < 65536);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)hostport);
+    if (1 != inet_pton(AF_INET, hostaddr, &addr.sin_addr))
+    {
+        fprintf(stderr, "Bad agentd address %s.\n", hostaddr);
+        return ERROR_AGENTD_SOCKET_CONNECT;
+    }
+
+    fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        fprintf(stderr, "Error creating socket.\n");
+        return ERROR_AGENTD_SOCKET_CONNECT;
+    }
+
+    if (0 != connect(fd, (struct sockaddr*)&addr, sizeof(addr)))
+    {
+        fprintf(stderr, "Error connecting to agentd.\n");
+        close(fd);
+        return ERROR_AGENTD_SOCKET_CONNECT;
+    }
+
+    /* requests are single small frames; don't hold them for coalescing. */
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+    *descriptor = fd;
+
+    return STATUS_SUCCESS;
+}
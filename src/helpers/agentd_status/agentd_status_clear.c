@@ -0,0 +1,17 @@
+/**
+ * \file helpers/agentd_status/agentd_status_clear.c
+ *
+ * \brief Clear the last failure status reported by agentd.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "agentd_status_internal.h"
+
+/**
+ * \brief Clear the last failure status reported by agentd on this thread.
+ */
+void agentd_status_clear(void)
+{
+    agentd_status_last_value = AGENTD_STATUS_NONE;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file helpers/agentd_status/agentd_status_internal.h
+ *
+ * \brief Internal state for agentd status tracking.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_status.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The last failure status reported by agentd on this thread.
+ */
+extern _Thread_local uint32_t agentd_status_last_value;
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,19 @@
+/**
+ * \file helpers/agentd_status/agentd_status_last.c
+ *
+ * \brief Get the last failure status reported by agentd.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "agentd_status_internal.h"
+
+/**
+ * \brief Get the last failure status reported by agentd on this thread.
+ *
+ * \returns the last recorded status, or AGENTD_STATUS_NONE.
+ */
+uint32_t agentd_status_last(void)
+{
+    return agentd_status_last_value;
+}
@@ -0,0 +1,21 @@
+/**
+ * \file helpers/agentd_status/agentd_status_record.c
+ *
+ * \brief Record a failure status reported by agentd.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "agentd_status_internal.h"
+
+_Thread_local uint32_t agentd_status_last_value = AGENTD_STATUS_NONE;
+
+/**
+ * \brief Record a failure status reported by agentd on this thread.
+ *
+ * \param agentd_status The status from the agentd response header.
+ */
+void agentd_status_record(uint32_t agentd_status)
+{
+    agentd_status_last_value = agentd_status;
+}
@@ -0,0 +1,348 @@
+/**
+ * \file helpers/chain_archive/chain_archive_create.c
+ *
+ * \brief Build an archive over exported records.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stdlib.h>
+
+#include "chain_archive_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief The position of a record in block height order.
+ */
+typedef struct chain_archive_key chain_archive_key;
+
+struct chain_archive_key
+{
+    uint64_t block_height;
+    uint32_t txn_index;
+    size_t row;
+};
+
+/* forward decls. */
+static status chain_archive_sort(chain_archive* archive);
+static status chain_archive_segment_rows(chain_archive* archive);
+static status chain_archive_build_filters(chain_archive* archive);
+static int chain_archive_key_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Build an archive over exported records.
+ *
+ * \param archive       Pointer to the archive pointer to receive the archive
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param records       The records to index, in any block order.
+ * \param count         The number of records.
+ * \param opts          The archive options.
+ *
+ * \note On success, the caller owns the archive and must release it by
+ * calling \ref chain_archive_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY if the index could not be
+ *        allocated.
+ */
+status chain_archive_create(
+    chain_archive** archive, RCPR_SYM(allocator)* alloc,
+    const chain_export_record* records, size_t count,
+    const chain_archive_options* opts)
+{
+    status retval, release_retval;
+    chain_archive* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != archive);
+    MODEL_ASSERT(NULL != records || 0 == count);
+    MODEL_ASSERT(NULL != opts);
+    MODEL_ASSERT(opts->segment_blocks > 0);
+    MODEL_ASSERT(opts->bits_per_txn > 0);
+    MODEL_ASSERT(opts->hash_count > 0);
+    MODEL_ASSERT(uuid_column_impl_supported(opts->impl));
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    memcpy(&tmp->opts, opts, sizeof(tmp->opts));
+    tmp->records = records;
+    tmp->row_count = count;
+
+    retval = chain_archive_sort(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_archive;
+    }
+
+    retval = chain_archive_segment_rows(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_archive;
+    }
+
+    retval = chain_archive_build_filters(tmp);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_archive;
+    }
+
+    /* success. */
+    *archive = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_archive:
+    /* chain_archive_release handles partially built archives. */
+    release_retval = chain_archive_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Put the rows in block height order and copy out their transaction
+ * IDs.
+ *
+ * \param archive       The archive being built.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY on failure.
+ */
+static status chain_archive_sort(chain_archive* archive)
+{
+    status retval;
+    chain_archive_key* keys;
+    const size_t count = archive->row_count;
+
+    /* an empty archive still gets a byte of each. */
+    retval =
+        rcpr_allocator_allocate(
+            archive->alloc, (void**)&archive->rows,
+            count * sizeof(size_t) + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            archive->alloc, (void**)&archive->txn_ids,
+            count * UUID_COLUMN_ENTRY_SIZE + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            archive->alloc, (void**)&keys, count * sizeof(*keys) + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        keys[i].block_height = archive->records[i].block_height;
+        keys[i].txn_index = archive->records[i].txn_index;
+        keys[i].row = i;
+    }
+
+    qsort(keys, count, sizeof(*keys), &chain_archive_key_compare);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        archive->rows[i] = keys[i].row;
+        memcpy(
+            archive->txn_ids + i * UUID_COLUMN_ENTRY_SIZE,
+            archive->records[keys[i].row].txn_id, UUID_COLUMN_ENTRY_SIZE);
+    }
+
+    (void)rcpr_allocator_reclaim(archive->alloc, keys);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Split the sorted rows into segments of segment_blocks heights,
+ * counted from the lowest height in the archive.
+ *
+ * Heights with no records leave a segment short, and a run of them may leave
+ * no segment at all.
+ *
+ * \param archive       The archive being built.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY on failure.
+ */
+static status chain_archive_segment_rows(chain_archive* archive)
+{
+    status retval;
+    const size_t count = archive->row_count;
+    const uint64_t blocks = archive->opts.segment_blocks;
+    uint64_t base, id, current = UINT64_MAX;
+    chain_archive_segment* segment = NULL;
+
+    if (0 == count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    base = archive->records[archive->rows[0]].block_height;
+
+    /* count the segments first. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        id = (archive->records[archive->rows[i]].block_height - base) / blocks;
+        if (id != current)
+        {
+            ++archive->segment_count;
+            current = id;
+        }
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            archive->alloc, (void**)&archive->segments,
+            archive->segment_count * sizeof(chain_archive_segment));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY;
+    }
+
+    memset(
+        archive->segments, 0,
+        archive->segment_count * sizeof(chain_archive_segment));
+
+    current = UINT64_MAX;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const chain_export_record* record =
+            &archive->records[archive->rows[i]];
+        const uint64_t height = record->block_height;
+
+        id = (height - base) / blocks;
+        if (id != current)
+        {
+            segment = (NULL == segment) ? archive->segments : segment + 1;
+            segment->height_min = height;
+            segment->first_row = i;
+            current = id;
+        }
+
+        segment->height_max = height;
+        ++segment->row_count;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Size each segment's filter and add its transaction IDs to it.
+ *
+ * \param archive       The archive being built.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY on failure.
+ */
+static status chain_archive_build_filters(chain_archive* archive)
+{
+    status retval;
+    uint64_t* words;
+    uint64_t h1, h2, bit;
+
+    /* filters are a power of two in size, so that a hash maps to a bit with
+     * a mask. */
+    for (size_t s = 0; s < archive->segment_count; ++s)
+    {
+        chain_archive_segment* segment = &archive->segments[s];
+        const uint64_t wanted =
+            (uint64_t)segment->row_count * archive->opts.bits_per_txn;
+
+        segment->filter_bits = 64;
+        while (segment->filter_bits < wanted)
+        {
+            segment->filter_bits *= 2;
+        }
+
+        archive->filter_words += segment->filter_bits / 64;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            archive->alloc, (void**)&archive->filters,
+            archive->filter_words * sizeof(uint64_t) + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_ARCHIVE_OUT_OF_MEMORY;
+    }
+
+    memset(archive->filters, 0, archive->filter_words * sizeof(uint64_t));
+
+    words = archive->filters;
+    for (size_t s = 0; s < archive->segment_count; ++s)
+    {
+        chain_archive_segment* segment = &archive->segments[s];
+
+        segment->filter = words;
+        words += segment->filter_bits / 64;
+
+        for (size_t r = 0; r < segment->row_count; ++r)
+        {
+            chain_archive_hash(
+                archive->txn_ids
+                    + (segment->first_row + r) * UUID_COLUMN_ENTRY_SIZE,
+                &h1, &h2);
+
+            for (size_t i = 0; i < archive->opts.hash_count; ++i)
+            {
+                bit = chain_archive_bit(segment, h1, h2, i);
+                segment->filter[bit / 64] |= 1ULL << (bit % 64);
+            }
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Order keys by block height, then by position in the block.
+ *
+ * \param lhs           The left key.
+ * \param rhs           The right key.
+ *
+ * \returns less than, equal to or greater than zero as lhs sorts before,
+ * with or after rhs.
+ */
+static int chain_archive_key_compare(const void* lhs, const void* rhs)
+{
+    const chain_archive_key* left = (const chain_archive_key*)lhs;
+    const chain_archive_key* right = (const chain_archive_key*)rhs;
+
+    if (left->block_height != right->block_height)
+    {
+        return left->block_height < right->block_height ? -1 : 1;
+    }
+
+    if (left->txn_index != right->txn_index)
+    {
+        return left->txn_index < right->txn_index ? -1 : 1;
+    }
+
+    return 0;
+}
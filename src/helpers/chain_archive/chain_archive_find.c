@@ -0,0 +1,113 @@
+/**
+ * \file helpers/chain_archive/chain_archive_find.c
+ *
+ * \brief Find the record of a transaction.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <stdbool.h>
+
+#include "chain_archive_internal.h"
+
+/* forward decls. */
+static bool chain_archive_filter_test(
+    const chain_archive_segment* segment, size_t hash_count, uint64_t h1,
+    uint64_t h2);
+
+/**
+ * \brief Find the record of a transaction.
+ *
+ * \param archive       The archive.
+ * \param txn_id        The 16-byte transaction ID to find.
+ * \param stats         Counters to add this lookup to, or NULL.
+ *
+ * \returns the record of the transaction, which holds its block ID and
+ * height, or NULL if the archive does not hold it.
+ */
+const chain_export_record* chain_archive_find(
+    const chain_archive* archive, const uint8_t* txn_id,
+    chain_archive_stats* stats)
+{
+    const chain_export_record* record = NULL;
+    chain_archive_stats local;
+    uint64_t h1, h2;
+    size_t index;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != archive);
+    MODEL_ASSERT(NULL != txn_id);
+
+    memset(&local, 0, sizeof(local));
+    ++local.lookups;
+
+    chain_archive_hash(txn_id, &h1, &h2);
+
+    for (size_t i = 0; i < archive->segment_count; ++i)
+    {
+        const chain_archive_segment* segment = &archive->segments[i];
+
+        if (!chain_archive_filter_test(
+                segment, archive->opts.hash_count, h1, h2))
+        {
+            continue;
+        }
+
+        ++local.segments_scanned;
+        local.rows_compared += segment->row_count;
+
+        index =
+            uuid_column_find(
+                archive->opts.impl,
+                archive->txn_ids + segment->first_row * UUID_COLUMN_ENTRY_SIZE,
+                segment->row_count, txn_id);
+        if (index < segment->row_count)
+        {
+            ++local.found;
+            record =
+                &archive->records[archive->rows[segment->first_row + index]];
+            break;
+        }
+
+        ++local.false_positives;
+    }
+
+    if (NULL != stats)
+    {
+        stats->lookups += local.lookups;
+        stats->found += local.found;
+        stats->segments_scanned += local.segments_scanned;
+        stats->false_positives += local.false_positives;
+        stats->rows_compared += local.rows_compared;
+    }
+
+    return record;
+}
+
+/**
+ * \brief Test whether a segment's filter may hold an ID.
+ *
+ * \param segment       The segment.
+ * \param hash_count    The number of bits set per ID.
+ * \param h1            The first hash of the ID.
+ * \param h2            The second hash of the ID.
+ *
+ * \returns false if the segment certainly does not hold the ID.
+ */
+static bool chain_archive_filter_test(
+    const chain_archive_segment* segment, size_t hash_count, uint64_t h1,
+    uint64_t h2)
+{
+    uint64_t bit;
+
+    for (size_t i = 0; i < hash_count; ++i)
+    {
+        bit = chain_archive_bit(segment, h1, h2, i);
+        if (!(segment->filter[bit / 64] & (1ULL << (bit % 64))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
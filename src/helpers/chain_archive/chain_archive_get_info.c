@@ -0,0 +1,28 @@
+/**
+ * \file helpers/chain_archive/chain_archive_get_info.c
+ *
+ * \brief Get the shape of an archive.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_archive_internal.h"
+
+/**
+ * \brief Get the shape of an archive.
+ *
+ * \param archive       The archive.
+ * \param info          The info to populate.
+ */
+void chain_archive_get_info(
+    const chain_archive* archive, chain_archive_info* info)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != archive);
+    MODEL_ASSERT(NULL != info);
+
+    memset(info, 0, sizeof(*info));
+    info->row_count = archive->row_count;
+    info->segment_count = archive->segment_count;
+    info->filter_bytes = archive->filter_words * sizeof(uint64_t);
+}
@@ -0,0 +1,125 @@
+/**
+ * \file helpers/chain_archive/chain_archive_internal.h
+ *
+ * \brief Internal declarations for the block archive.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/chain_archive.h>
+#include <string.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The default archive settings; see \ref chain_archive_options.
+ */
+#define CHAIN_ARCHIVE_DEFAULT_SEGMENT_BLOCKS                   64
+#define CHAIN_ARCHIVE_DEFAULT_BITS_PER_TXN                     16
+#define CHAIN_ARCHIVE_DEFAULT_HASH_COUNT                       11
+
+/**
+ * \brief One segment of the archive.
+ *
+ * The segment holds rows first_row to first_row + row_count - 1 of the
+ * archive. Its filter is filter_bits bits long, which is a power of two of
+ * at least 64.
+ */
+typedef struct chain_archive_segment chain_archive_segment;
+
+struct chain_archive_segment
+{
+    uint64_t height_min;
+    uint64_t height_max;
+    size_t first_row;
+    size_t row_count;
+    uint64_t* filter;
+    uint64_t filter_bits;
+};
+
+/**
+ * \brief The archive.
+ *
+ * Rows are in block height order. txn_ids is the column of their
+ * transaction IDs, and rows maps each row to its index in records. All
+ * segment filters share the filters allocation.
+ */
+struct chain_archive
+{
+    RCPR_SYM(allocator)* alloc;
+    chain_archive_options opts;
+    const chain_export_record* records;
+    size_t row_count;
+    size_t* rows;
+    uint8_t* txn_ids;
+    chain_archive_segment* segments;
+    size_t segment_count;
+    uint64_t* filters;
+    size_t filter_words;
+};
+
+/**
+ * \brief Finish a 64-bit hash, so that every input bit affects every output
+ * bit.
+ *
+ * \param value         The value to mix.
+ *
+ * \returns the mixed value.
+ */
+static inline uint64_t chain_archive_mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
+
+/**
+ * \brief Hash a transaction ID into the two hashes from which all of its
+ * filter bits are derived.
+ *
+ * \param txn_id        The 16-byte transaction ID.
+ * \param h1            Set to the first hash.
+ * \param h2            Set to the second hash, which is odd.
+ */
+static inline void chain_archive_hash(
+    const uint8_t* txn_id, uint64_t* h1, uint64_t* h2)
+{
+    uint64_t low, high;
+
+    memcpy(&low, txn_id, sizeof(low));
+    memcpy(&high, txn_id + sizeof(low), sizeof(high));
+
+    *h1 = chain_archive_mix(low ^ chain_archive_mix(high));
+    *h2 = chain_archive_mix(high + 0x9e3779b97f4a7c15ULL) | 1U;
+}
+
+/**
+ * \brief Get the position of one of an ID's bits in a segment's filter.
+ *
+ * Bit i is (h1 + i * h2) mod the filter size. h2 is odd and the filter size
+ * a power of two, so the bits of one ID are all distinct.
+ *
+ * \param segment       The segment.
+ * \param h1            The first hash of the ID.
+ * \param h2            The second hash of the ID.
+ * \param i             The index of the bit.
+ *
+ * \returns the position of the bit in the filter.
+ */
+static inline uint64_t chain_archive_bit(
+    const chain_archive_segment* segment, uint64_t h1, uint64_t h2, size_t i)
+{
+    return (h1 + i * h2) & (segment->filter_bits - 1);
+}
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,26 @@
+/**
+ * \file helpers/chain_archive/chain_archive_options_init.c
+ *
+ * \brief Initialize archive options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_archive_internal.h"
+
+/**
+ * \brief Initialize archive options with their defaults.
+ *
+ * The defaults make segments of 64 blocks, with filters of 16 bits and 11
+ * hashes per transaction, scanned with the fastest supported UUID kernels.
+ *
+ * \param opts          The options to initialize.
+ */
+void chain_archive_options_init(chain_archive_options* opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->segment_blocks = CHAIN_ARCHIVE_DEFAULT_SEGMENT_BLOCKS;
+    opts->bits_per_txn = CHAIN_ARCHIVE_DEFAULT_BITS_PER_TXN;
+    opts->hash_count = CHAIN_ARCHIVE_DEFAULT_HASH_COUNT;
+    opts->impl = uuid_column_impl_best();
+}
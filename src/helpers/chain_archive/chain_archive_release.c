@@ -0,0 +1,53 @@
+/**
+ * \file helpers/chain_archive/chain_archive_release.c
+ *
+ * \brief Release an archive.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_archive_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release an archive.
+ *
+ * \param archive       The archive to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_archive_release(chain_archive* archive)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = archive->alloc;
+    void* parts[] = {
+        archive->rows, archive->txn_ids, archive->segments,
+        archive->filters };
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != archive);
+
+    /* a partially built archive is missing some of its parts. */
+    for (size_t i = 0; i < sizeof(parts) / sizeof(parts[0]); ++i)
+    {
+        if (NULL != parts[i])
+        {
+            release_retval = rcpr_allocator_reclaim(alloc, parts[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, archive);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
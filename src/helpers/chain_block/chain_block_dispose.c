@@ -0,0 +1,36 @@
+/**
+ * \file helpers/chain_block/chain_block_dispose.c
+ *
+ * \brief Release a block.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/chain_block.h>
+#include <string.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a block.
+ *
+ * \param block         The block to release.
+ * \param alloc         The allocator used to parse the block.
+ */
+void chain_block_dispose(chain_block* block, RCPR_SYM(allocator)* alloc)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != block);
+
+    if (NULL != block->txns)
+    {
+        (void)rcpr_allocator_reclaim(alloc, block->txns);
+    }
+
+    if (NULL != block->cert.data)
+    {
+        dispose((disposable_t*)&block->cert);
+    }
+
+    memset(block, 0, sizeof(*block));
+}
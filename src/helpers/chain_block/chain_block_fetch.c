@@ -0,0 +1,57 @@
+/**
+ * \file helpers/chain_block/chain_block_fetch.c
+ *
+ * \brief Fetch the block at the given height.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/chain_block.h>
+#include <helpers/conn_helpers.h>
+#include <string.h>
+
+/**
+ * \brief Fetch the block at the given height.
+ *
+ * \param block         The block to populate. On success, the caller must
+ *                      release it by calling \ref chain_block_dispose.
+ * \param session       The session on which the block is fetched.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param height        The height of the block.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_fetch(
+    chain_block* block, agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, uint64_t height)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != block);
+    MODEL_ASSERT(NULL != session);
+
+    memset(block, 0, sizeof(*block));
+    block->height = height;
+
+    /* look up the block id. */
+    retval =
+        get_and_verify_block_id_by_height(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, height,
+            &block->block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* get the block. */
+    return
+        get_and_verify_block(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &block->block_id,
+            &block->cert, &block->prev_id, &block->next_id);
+}
@@ -0,0 +1,65 @@
+/**
+ * \file helpers/chain_block/chain_block_height.c
+ *
+ * \brief Read the height of a block from its certificate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/chain_block.h>
+#include <helpers/status_codes.h>
+#include <vccert/fields.h>
+
+/**
+ * \brief Read the height of a block from its certificate.
+ *
+ * \param height        Pointer to receive the height.
+ * \param cert          The block certificate.
+ * \param parser_opts   The parser options to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_height(
+    uint64_t* height, const vccrypt_buffer_t* cert,
+    vccert_parser_options_t* parser_opts)
+{
+    status retval;
+    vccert_parser_context_t parser;
+    const uint8_t* value;
+    size_t size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != height);
+    MODEL_ASSERT(NULL != cert);
+
+    retval = vccert_parser_init(parser_opts, &parser, cert->data, cert->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_BLOCK_PARSE;
+    }
+
+    retval =
+        vccert_parser_find_short(
+            &parser, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, &value, &size);
+    if (STATUS_SUCCESS != retval || sizeof(uint64_t) != size)
+    {
+        retval = ERROR_CHAIN_BLOCK_PARSE;
+        goto cleanup_parser;
+    }
+
+    /* the height is stored in network byte order. */
+    *height = 0;
+    for (size_t i = 0; i < sizeof(uint64_t); ++i)
+    {
+        *height = (*height << 8) | value[i];
+    }
+
+    retval = STATUS_SUCCESS;
+
+cleanup_parser:
+    dispose((disposable_t*)&parser);
+
+    return retval;
+}
@@ -0,0 +1,122 @@
+/**
+ * \file helpers/chain_block/chain_block_parse.c
+ *
+ * \brief Build the list of transactions wrapped in a fetched block.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/chain_block.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <vccert/fields.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static size_t chain_block_count_txns(
+    vccert_parser_options_t* parser_opts, const vccrypt_buffer_t* cert,
+    chain_block_txn* txns);
+
+/**
+ * \brief Build the list of transactions wrapped in a fetched block.
+ *
+ * \param block         The block to parse.
+ * \param alloc         The allocator to use for this operation.
+ * \param parser_opts   The parser options to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_parse(
+    chain_block* block, RCPR_SYM(allocator)* alloc,
+    vccert_parser_options_t* parser_opts)
+{
+    status retval;
+    size_t count;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != block);
+    MODEL_ASSERT(NULL == block->txns);
+
+    /* the first pass counts the transactions. */
+    count = chain_block_count_txns(parser_opts, &block->cert, NULL);
+    if (SIZE_MAX == count)
+    {
+        fprintf(
+            stderr, "Error parsing block at height %" PRIu64 ".\n",
+            block->height);
+        return ERROR_CHAIN_BLOCK_PARSE;
+    }
+
+    block->txn_count = count;
+    if (0 == count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&block->txns, count * sizeof(chain_block_txn));
+    if (STATUS_SUCCESS != retval)
+    {
+        block->txn_count = 0;
+        return ERROR_CHAIN_BLOCK_OUT_OF_MEMORY;
+    }
+
+    /* the second pass records them. */
+    (void)chain_block_count_txns(parser_opts, &block->cert, block->txns);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Walk the transactions wrapped in a block certificate.
+ *
+ * \param parser_opts   The parser options to use for this operation.
+ * \param cert          The block certificate.
+ * \param txns          Array to receive the transactions, or NULL to only
+ *                      count them.
+ *
+ * \returns the number of transactions, or SIZE_MAX if the block could not be
+ * parsed.
+ */
+static size_t chain_block_count_txns(
+    vccert_parser_options_t* parser_opts, const vccrypt_buffer_t* cert,
+    chain_block_txn* txns)
+{
+    status retval;
+    vccert_parser_context_t parser;
+    const uint8_t* txn_bytes;
+    size_t txn_size;
+    size_t count = 0;
+
+    retval = vccert_parser_init(parser_opts, &parser, cert->data, cert->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return SIZE_MAX;
+    }
+
+    retval =
+        vccert_parser_find_short(
+            &parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+            &txn_bytes, &txn_size);
+    while (STATUS_SUCCESS == retval)
+    {
+        if (NULL != txns)
+        {
+            txns[count].cert = txn_bytes;
+            txns[count].size = txn_size;
+        }
+
+        ++count;
+
+        retval = vccert_parser_find_next(&parser, &txn_bytes, &txn_size);
+    }
+
+    dispose((disposable_t*)&parser);
+
+    return count;
+}
@@ -0,0 +1,160 @@
+/**
+ * \file helpers/chain_block/chain_block_verify_txn.c
+ *
+ * \brief Verify a transaction wrapped in a block.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/chain_block.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+
+/* forward decls. */
+static status chain_block_find_uuid(
+    vccert_parser_context_t* parser, uint16_t field, vpr_uuid* id);
+
+/**
+ * \brief Verify a transaction wrapped in a block.
+ *
+ * The transaction certificate must parse, and must carry a transaction id,
+ * previous transaction id, artifact id, and certificate type. The artifact
+ * type and signer id are read if present. Its digest is computed with the
+ * suite hash, which is the per-transaction cost of a full verification.
+ * Signatures are not attested, since that needs the signing entities'
+ * public certificates.
+ *
+ * \param info          The structure to receive the transaction fields.
+ * \param txn           The transaction to verify.
+ * \param parser_opts   The parser options to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_block_verify_txn(
+    chain_block_txn_info* info, const chain_block_txn* txn,
+    vccert_parser_options_t* parser_opts, vccrypt_suite_options_t* suite)
+{
+    status retval;
+    vccert_parser_context_t parser;
+    vccrypt_hash_context_t hash;
+    vccrypt_buffer_t digest;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != info);
+    MODEL_ASSERT(NULL != txn);
+
+    retval = vccert_parser_init(parser_opts, &parser, txn->cert, txn->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_CHAIN_BLOCK_MALFORMED_TXN;
+        goto done;
+    }
+
+    /* every transaction carries these fields. */
+    if (STATUS_SUCCESS !=
+            chain_block_find_uuid(
+                &parser, VCCERT_FIELD_TYPE_CERTIFICATE_ID, &info->txn_id)
+     || STATUS_SUCCESS !=
+            chain_block_find_uuid(
+                &parser, VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID,
+                &info->prev_txn_id)
+     || STATUS_SUCCESS !=
+            chain_block_find_uuid(
+                &parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, &info->artifact_id)
+     || STATUS_SUCCESS !=
+            chain_block_find_uuid(
+                &parser, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, &info->cert_type))
+    {
+        retval = ERROR_CHAIN_BLOCK_MALFORMED_TXN;
+        goto cleanup_parser;
+    }
+
+    /* these are optional, and left zero when missing. */
+    if (STATUS_SUCCESS !=
+            chain_block_find_uuid(
+                &parser, VCCERT_FIELD_TYPE_ARTIFACT_TYPE,
+                &info->artifact_type))
+    {
+        memset(&info->artifact_type, 0, sizeof(info->artifact_type));
+    }
+
+    if (STATUS_SUCCESS !=
+            chain_block_find_uuid(
+                &parser, VCCERT_FIELD_TYPE_SIGNER_ID, &info->signer_id))
+    {
+        memset(&info->signer_id, 0, sizeof(info->signer_id));
+    }
+
+    /* digest the transaction. */
+    retval = vccrypt_suite_buffer_init_for_hash(suite, &digest);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_CHAIN_BLOCK_HASH;
+        goto cleanup_parser;
+    }
+
+    retval = vccrypt_suite_hash_init(suite, &hash);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_CHAIN_BLOCK_HASH;
+        goto cleanup_digest;
+    }
+
+    if (STATUS_SUCCESS != vccrypt_hash_digest(&hash, txn->cert, txn->size)
+     || STATUS_SUCCESS != vccrypt_hash_finalize(&hash, &digest))
+    {
+        retval = ERROR_CHAIN_BLOCK_HASH;
+        goto cleanup_hash;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_hash;
+
+cleanup_hash:
+    dispose((disposable_t*)&hash);
+
+cleanup_digest:
+    dispose((disposable_t*)&digest);
+
+cleanup_parser:
+    dispose((disposable_t*)&parser);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Read a UUID field from a certificate.
+ *
+ * \param parser        The parser for the certificate.
+ * \param field         The field to read.
+ * \param id            The UUID to receive the field.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_BLOCK_MALFORMED_TXN if the field is missing or is not
+ *        a UUID.
+ */
+static status chain_block_find_uuid(
+    vccert_parser_context_t* parser, uint16_t field, vpr_uuid* id)
+{
+    const uint8_t* value;
+    size_t size;
+
+    if (STATUS_SUCCESS !=
+            vccert_parser_find_short(parser, field, &value, &size)
+     || sizeof(*id) != size)
+    {
+        return ERROR_CHAIN_BLOCK_MALFORMED_TXN;
+    }
+
+    memcpy(id, value, sizeof(*id));
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,36 @@
+/**
+ * \file helpers/chain_export/chain_export_internal.h
+ *
+ * \brief Internal declarations for export files.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/chain_export.h>
+#include <stdio.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+struct chain_export_writer
+{
+    RCPR_SYM(allocator)* alloc;
+    FILE* out;
+    uint64_t record_count;
+};
+
+struct chain_export_reader
+{
+    RCPR_SYM(allocator)* alloc;
+    void* map;
+    size_t map_size;
+    const chain_export_record* records;
+    size_t record_count;
+};
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
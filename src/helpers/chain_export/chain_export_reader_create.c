@@ -0,0 +1,134 @@
+/**
+ * \file helpers/chain_export/chain_export_reader_create.c
+ *
+ * \brief Map an export file for reading.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "chain_export_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Map an export file for reading.
+ *
+ * The file must have been closed cleanly and must match this version and
+ * record size.
+ *
+ * \param reader        Pointer to the reader pointer to receive the reader
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param path          The path of the file to read.
+ *
+ * \note On success, the caller owns the reader and must release it by calling
+ * \ref chain_export_reader_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_EXPORT_OPEN if the file could not be opened or mapped.
+ *      - ERROR_CHAIN_EXPORT_FORMAT if the file is not a complete export of
+ *        this version.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_reader_create(
+    chain_export_reader** reader, RCPR_SYM(allocator)* alloc,
+    const char* path)
+{
+    status retval;
+    chain_export_reader* tmp;
+    const chain_export_header* header;
+    size_t body_size;
+    struct stat st;
+    int fd;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != reader);
+    MODEL_ASSERT(NULL != path);
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0 || 0 != fstat(fd, &st))
+    {
+        fprintf(stderr, "Error opening %s: %s.\n", path, strerror(errno));
+        retval = ERROR_CHAIN_EXPORT_OPEN;
+        goto cleanup_fd;
+    }
+
+    if ((size_t)st.st_size < sizeof(chain_export_header))
+    {
+        fprintf(stderr, "%s is not an export file.\n", path);
+        retval = ERROR_CHAIN_EXPORT_FORMAT;
+        goto cleanup_fd;
+    }
+
+    /* the mapping outlives the descriptor. */
+    tmp->map_size = (size_t)st.st_size;
+    tmp->map = mmap(NULL, tmp->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == tmp->map)
+    {
+        fprintf(stderr, "Error mapping %s: %s.\n", path, strerror(errno));
+        retval = ERROR_CHAIN_EXPORT_OPEN;
+        goto cleanup_fd;
+    }
+
+    close(fd);
+    fd = -1;
+
+    /* a file that was not closed cleanly has records but a zero count, so
+     * the count must account for every byte after the header. */
+    header = (const chain_export_header*)tmp->map;
+    body_size = tmp->map_size - sizeof(*header);
+    if (0 != memcmp(header->magic, CHAIN_EXPORT_MAGIC, sizeof(header->magic))
+     || CHAIN_EXPORT_VERSION != header->version
+     || sizeof(chain_export_record) != header->record_size
+     || 0 != body_size % sizeof(chain_export_record)
+     || header->record_count != body_size / sizeof(chain_export_record))
+    {
+        fprintf(
+            stderr, "%s is not a complete version %d export file.\n", path,
+            CHAIN_EXPORT_VERSION);
+        retval = ERROR_CHAIN_EXPORT_FORMAT;
+        goto cleanup_map;
+    }
+
+    /* the records follow the header, which keeps them 8-byte aligned. */
+    tmp->records = (const chain_export_record*)(header + 1);
+    tmp->record_count = (size_t)header->record_count;
+
+    /* the records are scanned in order. */
+    (void)madvise(tmp->map, tmp->map_size, MADV_SEQUENTIAL);
+
+    /* success. */
+    *reader = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_map:
+    munmap(tmp->map, tmp->map_size);
+
+cleanup_fd:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    (void)rcpr_allocator_reclaim(alloc, tmp);
+
+    return retval;
+}
@@ -0,0 +1,30 @@
+/**
+ * \file helpers/chain_export/chain_export_reader_records.c
+ *
+ * \brief Get the records of a mapped export file.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_export_internal.h"
+
+/**
+ * \brief Get the records of a mapped export file.
+ *
+ * \param reader        The reader.
+ * \param records       Pointer to receive the records, which stay valid
+ *                      until the reader is released.
+ * \param count         Pointer to receive the number of records.
+ */
+void chain_export_reader_records(
+    chain_export_reader* reader, const chain_export_record** records,
+    size_t* count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != reader);
+    MODEL_ASSERT(NULL != records);
+    MODEL_ASSERT(NULL != count);
+
+    *records = reader->records;
+    *count = reader->record_count;
+}
@@ -0,0 +1,32 @@
+/**
+ * \file helpers/chain_export/chain_export_reader_release.c
+ *
+ * \brief Unmap an export file and release the reader.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <sys/mman.h>
+
+#include "chain_export_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Unmap an export file and release the reader.
+ *
+ * \param reader        The reader to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_reader_release(chain_export_reader* reader)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != reader);
+
+    munmap(reader->map, reader->map_size);
+
+    return rcpr_allocator_reclaim(reader->alloc, reader);
+}
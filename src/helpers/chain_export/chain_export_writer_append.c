@@ -0,0 +1,40 @@
+/**
+ * \file helpers/chain_export/chain_export_writer_append.c
+ *
+ * \brief Append records to an export file.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "chain_export_internal.h"
+
+/**
+ * \brief Append records to an export file.
+ *
+ * \param writer        The writer.
+ * \param records       The records to append.
+ * \param count         The number of records.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_writer_append(
+    chain_export_writer* writer, const chain_export_record* records,
+    size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != writer);
+    MODEL_ASSERT(NULL != records || 0 == count);
+
+    if (count != fwrite(records, sizeof(*records), count, writer->out))
+    {
+        return ERROR_CHAIN_EXPORT_WRITE;
+    }
+
+    writer->record_count += count;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,85 @@
+/**
+ * \file helpers/chain_export/chain_export_writer_create.c
+ *
+ * \brief Create an export file.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "chain_export_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create an export file, replacing any existing file.
+ *
+ * \param writer        Pointer to the writer pointer to receive the writer
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param path          The path of the file to create.
+ *
+ * \note On success, the caller owns the writer and must release it by calling
+ * \ref chain_export_writer_release, which completes the file.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_writer_create(
+    chain_export_writer** writer, RCPR_SYM(allocator)* alloc,
+    const char* path)
+{
+    status retval;
+    chain_export_writer* tmp;
+    chain_export_header header;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != writer);
+    MODEL_ASSERT(NULL != path);
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+
+    tmp->out = fopen(path, "wb");
+    if (NULL == tmp->out)
+    {
+        fprintf(stderr, "Error creating %s: %s.\n", path, strerror(errno));
+        retval = ERROR_CHAIN_EXPORT_OPEN;
+        goto cleanup_writer;
+    }
+
+    /* the record count is filled in on release. */
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHAIN_EXPORT_MAGIC, sizeof(header.magic));
+    header.version = CHAIN_EXPORT_VERSION;
+    header.record_size = sizeof(chain_export_record);
+
+    if (1 != fwrite(&header, sizeof(header), 1, tmp->out))
+    {
+        fprintf(stderr, "Error writing %s.\n", path);
+        retval = ERROR_CHAIN_EXPORT_WRITE;
+        goto cleanup_file;
+    }
+
+    /* success. */
+    *writer = tmp;
+    return STATUS_SUCCESS;
+
+cleanup_file:
+    fclose(tmp->out);
+
+cleanup_writer:
+    (void)rcpr_allocator_reclaim(alloc, tmp);
+
+    return retval;
+}
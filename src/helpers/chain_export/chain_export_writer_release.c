@@ -0,0 +1,55 @@
+/**
+ * \file helpers/chain_export/chain_export_writer_release.c
+ *
+ * \brief Complete an export file and release its writer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stddef.h>
+
+#include "chain_export_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Write the record count to the header, close the file and release
+ * the writer.
+ *
+ * \param writer        The writer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_export_writer_release(chain_export_writer* writer)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != writer);
+
+    if (0 != fseek(
+                writer->out, offsetof(chain_export_header, record_count),
+                SEEK_SET)
+     || 1 != fwrite(
+                &writer->record_count, sizeof(writer->record_count), 1,
+                writer->out))
+    {
+        retval = ERROR_CHAIN_EXPORT_WRITE;
+    }
+
+    if (0 != fclose(writer->out))
+    {
+        retval = ERROR_CHAIN_EXPORT_WRITE;
+    }
+
+    release_retval = rcpr_allocator_reclaim(writer->alloc, writer);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
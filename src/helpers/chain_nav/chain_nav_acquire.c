@@ -0,0 +1,54 @@
+/**
+ * \file helpers/chain_nav/chain_nav_acquire.c
+ *
+ * \brief Find a free entry for a new prediction.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Find a free entry for a new prediction.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param evict         If true and no entry is free, the oldest unclaimed
+ *                      ready entry is discarded to make room.
+ *
+ * \returns a free entry, or NULL if there is none.
+ */
+chain_nav_entry* chain_nav_acquire(chain_nav* nav, bool evict)
+{
+    chain_nav_entry* oldest = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+
+    for (size_t i = 0; i < nav->opts.cache_capacity; ++i)
+    {
+        chain_nav_entry* entry = &nav->entries[i];
+
+        if (CHAIN_NAV_ENTRY_FREE == entry->state)
+        {
+            return entry;
+        }
+
+        if (CHAIN_NAV_ENTRY_READY == entry->state && !entry->claimed
+         && (NULL == oldest || entry->seq < oldest->seq))
+        {
+            oldest = entry;
+        }
+    }
+
+    /* queued and in flight entries are left alone; their reads are paid. */
+    if (!evict || NULL == oldest)
+    {
+        return NULL;
+    }
+
+    chain_nav_settle(nav, oldest, false);
+
+    return oldest;
+}
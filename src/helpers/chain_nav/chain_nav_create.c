@@ -0,0 +1,125 @@
+/**
+ * \file helpers/chain_nav/chain_nav_create.c
+ *
+ * \brief Create a chain navigation layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "chain_nav_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a navigation layer over a session pool.
+ *
+ * \param nav           Pointer to the navigation layer pointer to receive the
+ *                      layer on success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param pool          The session pool to read from, which must outlive the
+ *                      layer.
+ * \param opts          The navigation options.
+ *
+ * \note On success, the caller owns the layer and must release it by calling
+ * \ref chain_nav_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_NAV_SETUP if the options are invalid or a prefetch
+ *        thread could not be started.
+ *      - ERROR_CHAIN_NAV_OUT_OF_MEMORY if the layer could not be allocated.
+ */
+status chain_nav_create(
+    chain_nav** nav, RCPR_SYM(allocator)* alloc, session_pool* pool,
+    const chain_nav_options* opts)
+{
+    status retval, release_retval;
+    chain_nav* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != opts);
+
+    if (0 == opts->cache_capacity || 0 == opts->prefetch_threads
+     || 0 == opts->probe_interval || opts->min_accuracy_percent > 100)
+    {
+        fprintf(stderr, "Bad chain navigation options.\n");
+        retval = ERROR_CHAIN_NAV_SETUP;
+        goto done;
+    }
+
+    /* allocate the layer. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_CHAIN_NAV_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->pool = pool;
+    memcpy(&tmp->opts, opts, sizeof(tmp->opts));
+    pthread_mutex_init(&tmp->lock, NULL);
+    pthread_cond_init(&tmp->work, NULL);
+    pthread_cond_init(&tmp->ready, NULL);
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->entries,
+            opts->cache_capacity * sizeof(chain_nav_entry));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_CHAIN_NAV_OUT_OF_MEMORY;
+        goto cleanup_nav;
+    }
+
+    memset(tmp->entries, 0, opts->cache_capacity * sizeof(chain_nav_entry));
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->threads,
+            opts->prefetch_threads * sizeof(pthread_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_CHAIN_NAV_OUT_OF_MEMORY;
+        goto cleanup_nav;
+    }
+
+    /* start the prefetch threads. */
+    for (size_t i = 0; i < opts->prefetch_threads; ++i)
+    {
+        if (0 !=
+                pthread_create(
+                    &tmp->threads[i], NULL, &chain_nav_prefetch_main, tmp))
+        {
+            fprintf(stderr, "Error starting chain navigation thread.\n");
+            retval = ERROR_CHAIN_NAV_SETUP;
+            goto cleanup_nav;
+        }
+
+        ++tmp->threads_started;
+    }
+
+    /* success. */
+    *nav = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_nav:
+    /* chain_nav_release handles partially constructed layers. */
+    release_retval = chain_nav_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,39 @@
+/**
+ * \file helpers/chain_nav/chain_nav_find.c
+ *
+ * \brief Find the prediction for a read request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Find the prediction for a request.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request.
+ *
+ * \returns the entry carrying an identical request, or NULL.
+ */
+chain_nav_entry* chain_nav_find(chain_nav* nav, const read_request* req)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(NULL != req);
+
+    for (size_t i = 0; i < nav->opts.cache_capacity; ++i)
+    {
+        chain_nav_entry* entry = &nav->entries[i];
+
+        if (CHAIN_NAV_ENTRY_FREE != entry->state
+         && read_request_equal(&entry->req, req))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
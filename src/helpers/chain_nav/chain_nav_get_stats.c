@@ -0,0 +1,31 @@
+/**
+ * \file helpers/chain_nav/chain_nav_get_stats.c
+ *
+ * \brief Get a snapshot of the navigation counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Get a snapshot of the layer counters.
+ *
+ * \param nav           The navigation layer.
+ * \param stats         The structure to receive the counters.
+ */
+void chain_nav_get_stats(chain_nav* nav, chain_nav_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(NULL != stats);
+
+    pthread_mutex_lock(&nav->lock);
+    *stats = nav->stats;
+    for (int i = 0; i < CHAIN_NAV_RULE_COUNT; ++i)
+    {
+        stats->rules[i].enabled =
+            chain_nav_rule_enabled(nav, (chain_nav_rule)i);
+    }
+    pthread_mutex_unlock(&nav->lock);
+}
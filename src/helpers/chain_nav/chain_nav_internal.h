@@ -0,0 +1,196 @@
+/**
+ * \file helpers/chain_nav/chain_nav_internal.h
+ *
+ * \brief Internal declarations for the chain navigation layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/chain_nav.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The default number of predictions held at once.
+ */
+#define CHAIN_NAV_DEFAULT_CACHE_CAPACITY                       16
+
+/**
+ * \brief The default prediction settings; see \ref chain_nav_options.
+ */
+#define CHAIN_NAV_DEFAULT_PREFETCH_THREADS                      1
+#define CHAIN_NAV_DEFAULT_MAX_AGE_NS                   1000000000
+#define CHAIN_NAV_DEFAULT_WARMUP                               16
+#define CHAIN_NAV_DEFAULT_MIN_ACCURACY_PERCENT                 50
+#define CHAIN_NAV_DEFAULT_PROBE_INTERVAL                       16
+
+/**
+ * \brief Once this many of a rule's predictions are settled, its score is
+ * halved, so that it follows changes in the access pattern.
+ */
+#define CHAIN_NAV_SCORE_WINDOW                                 64
+
+/**
+ * \brief The state of a cache entry.
+ *
+ * A prediction is QUEUED until a prefetch thread takes it, INFLIGHT while
+ * that thread reads it, and READY once its result is in. Derived
+ * predictions are READY as soon as they are made.
+ */
+typedef enum chain_nav_entry_state
+{
+    CHAIN_NAV_ENTRY_FREE,
+    CHAIN_NAV_ENTRY_QUEUED,
+    CHAIN_NAV_ENTRY_INFLIGHT,
+    CHAIN_NAV_ENTRY_READY,
+} chain_nav_entry_state;
+
+/**
+ * \brief One prediction.
+ *
+ * A reader that finds its request in flight claims the entry and waits for
+ * it; a claimed entry is only freed by the reader that claimed it. seq
+ * orders entries by when they were made, oldest first. probe is set for
+ * predictions made by a disabled rule.
+ */
+typedef struct chain_nav_entry chain_nav_entry;
+
+struct chain_nav_entry
+{
+    chain_nav_entry_state state;
+    read_request req;
+    read_result result;
+    status retval;
+    chain_nav_rule rule;
+    uint64_t seq;
+    uint64_t ready_ns;
+    bool probe;
+    bool claimed;
+};
+
+/**
+ * \brief The recent record of one prediction rule.
+ *
+ * skipped counts the opportunities passed up while the rule is disabled,
+ * which paces its probes.
+ */
+typedef struct chain_nav_score chain_nav_score;
+
+struct chain_nav_score
+{
+    uint64_t used;
+    uint64_t wasted;
+    uint64_t skipped;
+};
+
+/**
+ * \brief The navigation layer.
+ *
+ * Prefetch threads wait on work for queued entries, and readers wait on
+ * ready for claimed entries to complete. Everything but the fields set at
+ * creation is guarded by lock.
+ */
+struct chain_nav
+{
+    RCPR_SYM(allocator)* alloc;
+    session_pool* pool;
+    chain_nav_options opts;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t ready;
+    chain_nav_entry* entries;
+    uint64_t seq;
+    bool stopping;
+    pthread_t* threads;
+    size_t threads_started;
+    chain_nav_score scores[CHAIN_NAV_RULE_COUNT];
+    chain_nav_stats stats;
+};
+
+/**
+ * \brief Entry point for a prefetch thread.
+ *
+ * \param context       The navigation layer.
+ *
+ * \returns NULL.
+ */
+void* chain_nav_prefetch_main(void* context);
+
+/**
+ * \brief Find the prediction for a request.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request.
+ *
+ * \returns the entry carrying an identical request, or NULL.
+ */
+chain_nav_entry* chain_nav_find(chain_nav* nav, const read_request* req);
+
+/**
+ * \brief Find a free entry for a new prediction.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param evict         If true and no entry is free, the oldest unclaimed
+ *                      ready entry is discarded to make room.
+ *
+ * \returns a free entry, or NULL if there is none.
+ */
+chain_nav_entry* chain_nav_acquire(chain_nav* nav, bool evict);
+
+/**
+ * \brief Settle a prediction and free its entry.
+ *
+ * The outcome is added to the counters and to the score of the rule that
+ * made the prediction, where a probe by a disabled rule weighs as much as
+ * the predictions it passed up. Any result still held by the entry is
+ * disposed.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param entry         The entry to free.
+ * \param used          true if a request matched the prediction.
+ */
+void chain_nav_settle(chain_nav* nav, chain_nav_entry* entry, bool used);
+
+/**
+ * \brief Make the predictions that follow a successful read.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request that was read.
+ * \param result        Its result.
+ * \param chained       true if the read was itself a prefetch, in which case
+ *                      predictions only take free entries.
+ */
+void chain_nav_predict(
+    chain_nav* nav, const read_request* req, const read_result* result,
+    bool chained);
+
+/**
+ * \brief Determine whether a rule is currently enabled.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param rule          The rule.
+ *
+ * \returns true if the rule's recent predictions meet the minimum accuracy
+ * or are too few to judge.
+ */
+bool chain_nav_rule_enabled(chain_nav* nav, chain_nav_rule rule);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,31 @@
+/**
+ * \file helpers/chain_nav/chain_nav_options_init.c
+ *
+ * \brief Initialize navigation options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Initialize navigation options with their defaults.
+ *
+ * The defaults hold 16 predictions, prefetch on one thread, discard
+ * predictions after a second, and disable a rule once fewer than half of 16
+ * settled predictions were used.
+ *
+ * \param opts          The options to initialize.
+ */
+void chain_nav_options_init(chain_nav_options* opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->cache_capacity = CHAIN_NAV_DEFAULT_CACHE_CAPACITY;
+    opts->prefetch_threads = CHAIN_NAV_DEFAULT_PREFETCH_THREADS;
+    opts->max_age_ns = CHAIN_NAV_DEFAULT_MAX_AGE_NS;
+    opts->warmup = CHAIN_NAV_DEFAULT_WARMUP;
+    opts->min_accuracy_percent = CHAIN_NAV_DEFAULT_MIN_ACCURACY_PERCENT;
+    opts->probe_interval = CHAIN_NAV_DEFAULT_PROBE_INTERVAL;
+}
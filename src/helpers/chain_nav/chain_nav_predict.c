@@ -0,0 +1,221 @@
+/**
+ * \file helpers/chain_nav/chain_nav_predict.c
+ *
+ * \brief Make the predictions that follow a read.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <string.h>
+
+#include "chain_nav_internal.h"
+
+/* forward decls. */
+static bool chain_nav_target(
+    chain_nav_rule rule, const read_request* req, const read_result* result,
+    read_request* target, const vpr_uuid** answer);
+static bool chain_nav_is_end_marker(const vpr_uuid* id);
+static void chain_nav_make(
+    chain_nav* nav, chain_nav_rule rule, const read_request* target,
+    const vpr_uuid* answer, bool probe, bool chained);
+
+/**
+ * \brief Make the predictions that follow a successful read.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request that was read.
+ * \param result        Its result.
+ * \param chained       true if the read was itself a prefetch, in which case
+ *                      predictions only take free entries.
+ */
+void chain_nav_predict(
+    chain_nav* nav, const read_request* req, const read_result* result,
+    bool chained)
+{
+    read_request target;
+    const vpr_uuid* answer;
+    bool probe;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != result);
+
+    for (int i = 0; i < CHAIN_NAV_RULE_COUNT; ++i)
+    {
+        chain_nav_rule rule = (chain_nav_rule)i;
+
+        if (!chain_nav_target(rule, req, result, &target, &answer))
+        {
+            continue;
+        }
+
+        /* a disabled rule still probes now and then, to notice a change,
+         * but never reads ahead. */
+        probe = !chain_nav_rule_enabled(nav, rule);
+        if (probe
+         && (chained
+          || 0 != nav->scores[rule].skipped++ % nav->opts.probe_interval))
+        {
+            continue;
+        }
+
+        if (NULL == chain_nav_find(nav, &target))
+        {
+            chain_nav_make(nav, rule, &target, answer, probe, chained);
+        }
+    }
+}
+
+/**
+ * \brief Work out the request a rule predicts after a read.
+ *
+ * \param rule          The rule.
+ * \param req           The request that was read.
+ * \param result        Its result.
+ * \param target        The predicted request, on success.
+ * \param answer        Set to the id answering the predicted request when
+ *                      the rule derives it from the result, or NULL when it
+ *                      must be prefetched.
+ *
+ * \returns true if the rule applies to this read.
+ */
+static bool chain_nav_target(
+    chain_nav_rule rule, const read_request* req, const read_result* result,
+    read_request* target, const vpr_uuid** answer)
+{
+    read_request_type trigger, type;
+    const vpr_uuid* id;
+
+    *answer = NULL;
+
+    switch (rule)
+    {
+        case CHAIN_NAV_RULE_NEXT_BLOCK_ID_TO_BLOCK:
+            trigger = READ_REQUEST_NEXT_BLOCK_ID_GET;
+            type = READ_REQUEST_BLOCK_GET;
+            id = &result->id;
+            break;
+
+        case CHAIN_NAV_RULE_BLOCK_TO_NEXT_BLOCK_ID:
+            trigger = READ_REQUEST_BLOCK_GET;
+            type = READ_REQUEST_NEXT_BLOCK_ID_GET;
+            id = &req->id;
+            *answer = &result->next_id;
+            break;
+
+        case CHAIN_NAV_RULE_BLOCK_TO_NEXT_BLOCK:
+            trigger = READ_REQUEST_BLOCK_GET;
+            type = READ_REQUEST_BLOCK_GET;
+            id = &result->next_id;
+            break;
+
+        case CHAIN_NAV_RULE_NEXT_TXN_ID_TO_TXN:
+            trigger = READ_REQUEST_NEXT_TXN_ID_GET;
+            type = READ_REQUEST_TXN_GET;
+            id = &result->id;
+            break;
+
+        case CHAIN_NAV_RULE_TXN_TO_NEXT_TXN_ID:
+            trigger = READ_REQUEST_TXN_GET;
+            type = READ_REQUEST_NEXT_TXN_ID_GET;
+            id = &req->id;
+            *answer = &result->next_id;
+            break;
+
+        case CHAIN_NAV_RULE_TXN_TO_NEXT_TXN:
+            trigger = READ_REQUEST_TXN_GET;
+            type = READ_REQUEST_TXN_GET;
+            id = &result->next_id;
+            break;
+
+        default:
+            return false;
+    }
+
+    if (req->type != trigger)
+    {
+        return false;
+    }
+
+    /* the record at the end of a chain has no successor to predict. */
+    if (chain_nav_is_end_marker(NULL != *answer ? *answer : id))
+    {
+        return false;
+    }
+
+    memset(target, 0, sizeof(*target));
+    target->type = type;
+    memcpy(&target->id, id, sizeof(target->id));
+
+    return true;
+}
+
+/**
+ * \brief Determine whether an id is the all-zero or all-0xff marker used for
+ * a missing predecessor or successor.
+ *
+ * \param id            The id to check.
+ *
+ * \returns true if the id is an end marker.
+ */
+static bool chain_nav_is_end_marker(const vpr_uuid* id)
+{
+    bool zero = true, ff = true;
+
+    for (size_t i = 0; i < sizeof(id->data); ++i)
+    {
+        zero = zero && 0x00 == id->data[i];
+        ff = ff && 0xff == id->data[i];
+    }
+
+    return zero || ff;
+}
+
+/**
+ * \brief Record a prediction, answering it at once if it is derived or
+ * queueing it for a prefetch thread otherwise.
+ *
+ * \param nav           The navigation layer.
+ * \param rule          The rule making the prediction.
+ * \param target        The predicted request.
+ * \param answer        The derived answer, or NULL.
+ * \param probe         true if the rule is disabled and this is a probe.
+ * \param chained       true if predictions may only take free entries.
+ */
+static void chain_nav_make(
+    chain_nav* nav, chain_nav_rule rule, const read_request* target,
+    const vpr_uuid* answer, bool probe, bool chained)
+{
+    chain_nav_entry* entry = chain_nav_acquire(nav, !chained);
+    if (NULL == entry)
+    {
+        return;
+    }
+
+    memcpy(&entry->req, target, sizeof(entry->req));
+    entry->rule = rule;
+    entry->seq = ++nav->seq;
+    entry->probe = probe;
+    entry->claimed = false;
+    entry->retval = STATUS_SUCCESS;
+    ++nav->stats.predictions;
+    ++nav->stats.rules[rule].predictions;
+
+    if (NULL != answer)
+    {
+        memset(&entry->result, 0, sizeof(entry->result));
+        memcpy(&entry->result.id, answer, sizeof(entry->result.id));
+        entry->ready_ns = latency_clock_now_ns();
+        entry->state = CHAIN_NAV_ENTRY_READY;
+        ++nav->stats.derived;
+    }
+    else
+    {
+        entry->state = CHAIN_NAV_ENTRY_QUEUED;
+        pthread_cond_signal(&nav->work);
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * \file helpers/chain_nav/chain_nav_prefetch_main.c
+ *
+ * \brief Entry point for a prefetch thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "chain_nav_internal.h"
+
+/* forward decls. */
+static chain_nav_entry* chain_nav_next_queued(chain_nav* nav);
+
+/**
+ * \brief Entry point for a prefetch thread.
+ *
+ * The thread reads queued predictions oldest first. A completed prefetch
+ * makes predictions of its own, so a sequential walk is read ahead as far
+ * as there are free entries. A failed prefetch is discarded unless a reader
+ * is waiting on it, in which case that reader sees the failure and reads
+ * the request again itself.
+ *
+ * \param context       The navigation layer.
+ *
+ * \returns NULL.
+ */
+void* chain_nav_prefetch_main(void* context)
+{
+    chain_nav* nav = (chain_nav*)context;
+    chain_nav_entry* entry;
+    status retval;
+
+    pthread_mutex_lock(&nav->lock);
+    for (;;)
+    {
+        while (!nav->stopping && NULL == (entry = chain_nav_next_queued(nav)))
+        {
+            pthread_cond_wait(&nav->work, &nav->lock);
+        }
+
+        if (nav->stopping)
+        {
+            break;
+        }
+
+        /* an in flight entry belongs to this thread until it is ready. */
+        entry->state = CHAIN_NAV_ENTRY_INFLIGHT;
+        ++nav->stats.prefetches;
+        pthread_mutex_unlock(&nav->lock);
+
+        retval = session_pool_read(nav->pool, &entry->req, &entry->result);
+
+        pthread_mutex_lock(&nav->lock);
+        entry->retval = retval;
+        if (STATUS_SUCCESS != retval)
+        {
+            ++nav->stats.prefetch_failures;
+            if (!entry->claimed)
+            {
+                entry->state = CHAIN_NAV_ENTRY_READY;
+                chain_nav_settle(nav, entry, false);
+                continue;
+            }
+        }
+
+        entry->state = CHAIN_NAV_ENTRY_READY;
+        entry->ready_ns = latency_clock_now_ns();
+        if (entry->claimed)
+        {
+            pthread_cond_broadcast(&nav->ready);
+        }
+
+        if (STATUS_SUCCESS == retval)
+        {
+            chain_nav_predict(nav, &entry->req, &entry->result, true);
+        }
+    }
+
+    pthread_mutex_unlock(&nav->lock);
+
+    return NULL;
+}
+
+/**
+ * \brief Find the oldest queued entry.
+ *
+ * \param nav           The navigation layer.
+ *
+ * \returns the oldest queued entry, or NULL if none is queued.
+ */
+static chain_nav_entry* chain_nav_next_queued(chain_nav* nav)
+{
+    chain_nav_entry* oldest = NULL;
+
+    for (size_t i = 0; i < nav->opts.cache_capacity; ++i)
+    {
+        chain_nav_entry* entry = &nav->entries[i];
+
+        if (CHAIN_NAV_ENTRY_QUEUED == entry->state
+         && (NULL == oldest || entry->seq < oldest->seq))
+        {
+            oldest = entry;
+        }
+    }
+
+    return oldest;
+}
@@ -0,0 +1,151 @@
+/**
+ * \file helpers/chain_nav/chain_nav_read.c
+ *
+ * \brief Execute a read request through the navigation layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "chain_nav_internal.h"
+
+/* forward decls. */
+static bool chain_nav_take(
+    chain_nav* nav, chain_nav_entry* entry, read_result* result);
+static status chain_nav_miss(
+    chain_nav* nav, const read_request* req, read_result* result);
+
+/**
+ * \brief Execute a read request, answering it from a prediction if one
+ * matches.
+ *
+ * A failed prefetch is never returned; the request is read again instead,
+ * so errors and agentd status are reported as by \ref session_pool_read.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_nav_read(
+    chain_nav* nav, const read_request* req, read_result* result)
+{
+    chain_nav_entry* entry;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != result);
+
+    pthread_mutex_lock(&nav->lock);
+    ++nav->stats.requests;
+
+    entry = chain_nav_find(nav, req);
+    if (NULL == entry || entry->claimed)
+    {
+        return chain_nav_miss(nav, req, result);
+    }
+
+    switch (entry->state)
+    {
+        case CHAIN_NAV_ENTRY_READY:
+            if (chain_nav_take(nav, entry, result))
+            {
+                ++nav->stats.hits;
+                chain_nav_predict(nav, req, result, false);
+                pthread_mutex_unlock(&nav->lock);
+                return STATUS_SUCCESS;
+            }
+            break;
+
+        case CHAIN_NAV_ENTRY_INFLIGHT:
+            entry->claimed = true;
+            while (CHAIN_NAV_ENTRY_INFLIGHT == entry->state)
+            {
+                pthread_cond_wait(&nav->ready, &nav->lock);
+            }
+
+            if (chain_nav_take(nav, entry, result))
+            {
+                ++nav->stats.late_hits;
+                chain_nav_predict(nav, req, result, false);
+                pthread_mutex_unlock(&nav->lock);
+                return STATUS_SUCCESS;
+            }
+            break;
+
+        default:
+            /* the prediction was right, but reading it here is quicker. */
+            chain_nav_settle(nav, entry, true);
+            break;
+    }
+
+    return chain_nav_miss(nav, req, result);
+}
+
+/**
+ * \brief Take the result of a ready prediction.
+ *
+ * A failed or expired prediction is discarded instead.
+ *
+ * \param nav           The navigation layer.
+ * \param entry         The ready entry.
+ * \param result        The result to populate on success.
+ *
+ * \returns true if the result was taken.
+ */
+static bool chain_nav_take(
+    chain_nav* nav, chain_nav_entry* entry, read_result* result)
+{
+    if (STATUS_SUCCESS != entry->retval
+     || latency_clock_now_ns() - entry->ready_ns > nav->opts.max_age_ns)
+    {
+        chain_nav_settle(nav, entry, false);
+        return false;
+    }
+
+    read_result_move(result, &entry->result);
+    chain_nav_settle(nav, entry, true);
+
+    return true;
+}
+
+/**
+ * \brief Read a request from the session pool and predict what follows it.
+ *
+ * The lock is held on entry and released on return.
+ *
+ * \param nav           The navigation layer.
+ * \param req           The request to read.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status chain_nav_miss(
+    chain_nav* nav, const read_request* req, read_result* result)
+{
+    status retval;
+
+    ++nav->stats.misses;
+    pthread_mutex_unlock(&nav->lock);
+
+    retval = session_pool_read(nav->pool, req, result);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    pthread_mutex_lock(&nav->lock);
+    chain_nav_predict(nav, req, result, false);
+    pthread_mutex_unlock(&nav->lock);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/**
+ * \file helpers/chain_nav/chain_nav_release.c
+ *
+ * \brief Release a chain navigation layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a navigation layer, discarding any pending predictions.
+ *
+ * No read may be in progress.
+ *
+ * \param nav           The navigation layer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_nav_release(chain_nav* nav)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = nav->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+
+    /* in flight prefetches complete before their threads stop. */
+    pthread_mutex_lock(&nav->lock);
+    nav->stopping = true;
+    pthread_cond_broadcast(&nav->work);
+    pthread_mutex_unlock(&nav->lock);
+
+    for (size_t i = 0; i < nav->threads_started; ++i)
+    {
+        pthread_join(nav->threads[i], NULL);
+    }
+
+    if (NULL != nav->entries)
+    {
+        for (size_t i = 0; i < nav->opts.cache_capacity; ++i)
+        {
+            if (CHAIN_NAV_ENTRY_FREE != nav->entries[i].state)
+            {
+                chain_nav_settle(nav, &nav->entries[i], false);
+            }
+        }
+
+        release_retval = rcpr_allocator_reclaim(alloc, nav->entries);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != nav->threads)
+    {
+        release_retval = rcpr_allocator_reclaim(alloc, nav->threads);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    pthread_cond_destroy(&nav->ready);
+    pthread_cond_destroy(&nav->work);
+    pthread_mutex_destroy(&nav->lock);
+
+    release_retval = rcpr_allocator_reclaim(alloc, nav);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file helpers/chain_nav/chain_nav_reset_stats.c
+ *
+ * \brief Reset the navigation counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Reset the layer counters.
+ *
+ * Rule scores are kept, so disabled rules stay disabled.
+ *
+ * \param nav           The navigation layer.
+ */
+void chain_nav_reset_stats(chain_nav* nav)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+
+    pthread_mutex_lock(&nav->lock);
+    memset(&nav->stats, 0, sizeof(nav->stats));
+    pthread_mutex_unlock(&nav->lock);
+}
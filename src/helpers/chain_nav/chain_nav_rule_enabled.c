@@ -0,0 +1,39 @@
+/**
+ * \file helpers/chain_nav/chain_nav_rule_enabled.c
+ *
+ * \brief Determine whether a prediction rule is enabled.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Determine whether a rule is currently enabled.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param rule          The rule.
+ *
+ * \returns true if the rule's recent predictions meet the minimum accuracy
+ * or are too few to judge.
+ */
+bool chain_nav_rule_enabled(chain_nav* nav, chain_nav_rule rule)
+{
+    const chain_nav_score* score;
+    uint64_t settled;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(rule < CHAIN_NAV_RULE_COUNT);
+
+    score = &nav->scores[rule];
+    settled = score->used + score->wasted;
+    if (settled < nav->opts.warmup)
+    {
+        return true;
+    }
+
+    return score->used * 100 >= settled * nav->opts.min_accuracy_percent;
+}
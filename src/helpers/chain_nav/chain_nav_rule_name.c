@@ -0,0 +1,43 @@
+/**
+ * \file helpers/chain_nav/chain_nav_rule_name.c
+ *
+ * \brief Get a short name for a prediction rule.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Get a short name for a prediction rule.
+ *
+ * \param rule          The rule.
+ *
+ * \returns a static string naming the rule.
+ */
+const char* chain_nav_rule_name(chain_nav_rule rule)
+{
+    switch (rule)
+    {
+        case CHAIN_NAV_RULE_NEXT_BLOCK_ID_TO_BLOCK:
+            return "next block id -> block";
+
+        case CHAIN_NAV_RULE_BLOCK_TO_NEXT_BLOCK_ID:
+            return "block -> next block id";
+
+        case CHAIN_NAV_RULE_BLOCK_TO_NEXT_BLOCK:
+            return "block -> next block";
+
+        case CHAIN_NAV_RULE_NEXT_TXN_ID_TO_TXN:
+            return "next txn id -> txn";
+
+        case CHAIN_NAV_RULE_TXN_TO_NEXT_TXN_ID:
+            return "txn -> next txn id";
+
+        case CHAIN_NAV_RULE_TXN_TO_NEXT_TXN:
+            return "txn -> next txn";
+
+        default:
+            return "unknown";
+    }
+}
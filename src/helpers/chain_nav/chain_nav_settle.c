@@ -0,0 +1,66 @@
+/**
+ * \file helpers/chain_nav/chain_nav_settle.c
+ *
+ * \brief Settle a prediction and free its entry.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chain_nav_internal.h"
+
+/**
+ * \brief Settle a prediction and free its entry.
+ *
+ * The outcome is added to the counters and to the score of the rule that
+ * made the prediction, where a probe by a disabled rule weighs as much as
+ * the predictions it passed up. Any result still held by the entry is
+ * disposed.
+ *
+ * The caller must hold the lock.
+ *
+ * \param nav           The navigation layer.
+ * \param entry         The entry to free.
+ * \param used          true if a request matched the prediction.
+ */
+void chain_nav_settle(chain_nav* nav, chain_nav_entry* entry, bool used)
+{
+    chain_nav_score* score;
+    uint64_t weight;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != nav);
+    MODEL_ASSERT(NULL != entry);
+    MODEL_ASSERT(CHAIN_NAV_ENTRY_FREE != entry->state);
+
+    /* a probe stands in for the predictions passed up between probes. */
+    score = &nav->scores[entry->rule];
+    weight = entry->probe ? nav->opts.probe_interval : 1;
+    if (used)
+    {
+        score->used += weight;
+        ++nav->stats.used;
+        ++nav->stats.rules[entry->rule].used;
+    }
+    else
+    {
+        score->wasted += weight;
+        ++nav->stats.wasted;
+        ++nav->stats.rules[entry->rule].wasted;
+    }
+
+    /* decay the score, so that old outcomes count for less. */
+    while (score->used + score->wasted >= CHAIN_NAV_SCORE_WINDOW)
+    {
+        score->used /= 2;
+        score->wasted /= 2;
+    }
+
+    if (CHAIN_NAV_ENTRY_READY == entry->state
+     && STATUS_SUCCESS == entry->retval)
+    {
+        read_result_dispose(&entry->result);
+    }
+
+    entry->state = CHAIN_NAV_ENTRY_FREE;
+    entry->claimed = false;
+}
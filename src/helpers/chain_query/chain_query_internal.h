@@ -0,0 +1,67 @@
+/**
+ * \file helpers/chain_query/chain_query_internal.h
+ *
+ * \brief Internal declarations for columnar chain queries.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/chain_query.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The default number of threads scanning a table.
+ */
+#define CHAIN_QUERY_DEFAULT_THREADS                             4
+
+/**
+ * \brief The state shared by the threads running one query.
+ *
+ * next_chunk is the index of the next chunk to be claimed.
+ */
+typedef struct chain_query_scan chain_query_scan;
+
+struct chain_query_scan
+{
+    const chain_query_table* table;
+    const chain_query_predicate* pred;
+    const chain_query_options* opts;
+    size_t chunk_count;
+    atomic_size_t next_chunk;
+};
+
+/**
+ * \brief One thread scanning a table.
+ *
+ * Each worker counts its own matches, which are summed once it is joined.
+ */
+typedef struct chain_query_worker chain_query_worker;
+
+struct chain_query_worker
+{
+    chain_query_scan* scan;
+    pthread_t thread;
+    uint64_t rows_matched;
+};
+
+/**
+ * \brief Entry point for a scanning thread.
+ *
+ * Chunks are claimed and filtered until none remain.
+ *
+ * \param context       The worker.
+ *
+ * \returns NULL.
+ */
+void* chain_query_worker_main(void* context);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,26 @@
+/**
+ * \file helpers/chain_query/chain_query_options_init.c
+ *
+ * \brief Initialize query options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+/**
+ * \brief Initialize query options with their defaults.
+ *
+ * The defaults scan on four threads with the fastest supported UUID kernels
+ * and visit no rows.
+ *
+ * \param opts          The options to initialize.
+ */
+void chain_query_options_init(chain_query_options* opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->threads = CHAIN_QUERY_DEFAULT_THREADS;
+    opts->impl = uuid_column_impl_best();
+}
@@ -0,0 +1,22 @@
+/**
+ * \file helpers/chain_query/chain_query_predicate_init.c
+ *
+ * \brief Initialize a predicate that matches every row.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+/**
+ * \brief Initialize a predicate that matches every row.
+ *
+ * \param pred          The predicate to initialize.
+ */
+void chain_query_predicate_init(chain_query_predicate* pred)
+{
+    memset(pred, 0, sizeof(*pred));
+    pred->height_max = UINT64_MAX;
+}
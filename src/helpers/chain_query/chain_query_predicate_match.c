@@ -0,0 +1,63 @@
+/**
+ * \file helpers/chain_query/chain_query_predicate_match.c
+ *
+ * \brief Test a single exported record against a predicate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+/**
+ * \brief Test a single exported record against a predicate.
+ *
+ * This is the row-at-a-time form of the test that \ref chain_query_run
+ * applies to whole columns.
+ *
+ * \param pred          The predicate.
+ * \param record        The record to test.
+ *
+ * \returns true if the record matches.
+ */
+bool chain_query_predicate_match(
+    const chain_query_predicate* pred, const chain_export_record* record)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pred);
+    MODEL_ASSERT(NULL != record);
+
+    if ((pred->fields & CHAIN_QUERY_FIELD_HEIGHT)
+     && (record->block_height < pred->height_min
+      || record->block_height > pred->height_max))
+    {
+        return false;
+    }
+
+    if ((pred->fields & CHAIN_QUERY_FIELD_ARTIFACT_ID)
+     && 0 != memcmp(record->artifact_id, pred->artifact_id, 16))
+    {
+        return false;
+    }
+
+    if ((pred->fields & CHAIN_QUERY_FIELD_ARTIFACT_TYPE)
+     && 0 != memcmp(record->artifact_type, pred->artifact_type, 16))
+    {
+        return false;
+    }
+
+    if ((pred->fields & CHAIN_QUERY_FIELD_CERT_TYPE)
+     && 0 != memcmp(record->cert_type, pred->cert_type, 16))
+    {
+        return false;
+    }
+
+    if ((pred->fields & CHAIN_QUERY_FIELD_SIGNER_ID)
+     && 0 != memcmp(record->signer_id, pred->signer_id, 16))
+    {
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,122 @@
+/**
+ * \file helpers/chain_query/chain_query_run.c
+ *
+ * \brief Run a query over a table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Run a query over a table.
+ *
+ * The table is split into chunks of \ref CHAIN_QUERY_CHUNK_ROWS rows, which
+ * the scanning threads claim in turn. Each chunk is filtered one column at a
+ * time into a row mask, so each predicate field touches only its own column.
+ *
+ * \param table         The table to query.
+ * \param alloc         The allocator to use for this operation.
+ * \param pred          The predicate selecting rows.
+ * \param opts          The query options.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_QUERY_OUT_OF_MEMORY if the scan could not be set up.
+ *      - ERROR_CHAIN_QUERY_THREAD_CREATE if a scanning thread could not be
+ *        started.
+ */
+status chain_query_run(
+    const chain_query_table* table, RCPR_SYM(allocator)* alloc,
+    const chain_query_predicate* pred, const chain_query_options* opts,
+    chain_query_result* result)
+{
+    status retval = STATUS_SUCCESS;
+    chain_query_scan scan;
+    chain_query_worker* workers;
+    size_t threads, started = 1;
+    uint64_t start_ns;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+    MODEL_ASSERT(NULL != pred);
+    MODEL_ASSERT(NULL != opts);
+    MODEL_ASSERT(NULL != result);
+    MODEL_ASSERT(uuid_column_impl_supported(opts->impl));
+
+    memset(&scan, 0, sizeof(scan));
+    scan.table = table;
+    scan.pred = pred;
+    scan.opts = opts;
+    scan.chunk_count =
+        (table->row_count + CHAIN_QUERY_CHUNK_ROWS - 1)
+            / CHAIN_QUERY_CHUNK_ROWS;
+    atomic_init(&scan.next_chunk, 0);
+
+    /* there is no point in more threads than chunks. */
+    threads = opts->threads;
+    if (threads > scan.chunk_count)
+    {
+        threads = scan.chunk_count;
+    }
+    if (0 == threads)
+    {
+        threads = 1;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&workers, threads * sizeof(*workers));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_QUERY_OUT_OF_MEMORY;
+    }
+
+    memset(workers, 0, threads * sizeof(*workers));
+    for (size_t i = 0; i < threads; ++i)
+    {
+        workers[i].scan = &scan;
+    }
+
+    start_ns = latency_clock_now_ns();
+
+    /* the caller scans as worker 0; the others get threads of their own. */
+    for (; started < threads; ++started)
+    {
+        if (0 !=
+                pthread_create(
+                    &workers[started].thread, NULL, &chain_query_worker_main,
+                    &workers[started]))
+        {
+            /* the threads already started finish the scan without it. */
+            fprintf(stderr, "Error starting chain query thread.\n");
+            retval = ERROR_CHAIN_QUERY_THREAD_CREATE;
+            break;
+        }
+    }
+
+    (void)chain_query_worker_main(&workers[0]);
+
+    memset(result, 0, sizeof(*result));
+    result->rows_matched = workers[0].rows_matched;
+    for (size_t i = 1; i < started; ++i)
+    {
+        pthread_join(workers[i].thread, NULL);
+        result->rows_matched += workers[i].rows_matched;
+    }
+
+    result->elapsed_ns = latency_clock_now_ns() - start_ns;
+    result->rows_scanned = table->row_count;
+
+    (void)rcpr_allocator_reclaim(alloc, workers);
+
+    return retval;
+}
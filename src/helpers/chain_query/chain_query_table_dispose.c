@@ -0,0 +1,33 @@
+/**
+ * \file helpers/chain_query/chain_query_table_dispose.c
+ *
+ * \brief Release the columns of a table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release the columns of a table.
+ *
+ * \param table         The table to release.
+ * \param alloc         The allocator used to initialize the table.
+ */
+void chain_query_table_dispose(
+    chain_query_table* table, RCPR_SYM(allocator)* alloc)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+
+    if (NULL != table->data)
+    {
+        (void)rcpr_allocator_reclaim(alloc, table->data);
+    }
+
+    memset(table, 0, sizeof(*table));
+}
@@ -0,0 +1,84 @@
+/**
+ * \file helpers/chain_query/chain_query_table_init.c
+ *
+ * \brief Decode exported records into a columnar table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* the number of UUID columns in a table. */
+#define CHAIN_QUERY_UUID_COLUMNS                                6
+
+/**
+ * \brief Decode exported records into a columnar table.
+ *
+ * \param table         The table to initialize. On success, the caller must
+ *                      release it by calling \ref chain_query_table_dispose.
+ * \param alloc         The allocator to use for this operation.
+ * \param records       The records to decode.
+ * \param count         The number of records.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_QUERY_OUT_OF_MEMORY if the columns could not be
+ *        allocated.
+ */
+status chain_query_table_init(
+    chain_query_table* table, RCPR_SYM(allocator)* alloc,
+    const chain_export_record* records, size_t count)
+{
+    status retval;
+    uint8_t* data;
+    const size_t uuid_bytes = count * UUID_COLUMN_ENTRY_SIZE;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+    MODEL_ASSERT(NULL != records || 0 == count);
+
+    memset(table, 0, sizeof(*table));
+
+    /* all columns share one allocation, with the heights first so that they
+     * stay aligned. An empty table still gets a byte. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, &table->data,
+            count * sizeof(uint64_t)
+                + CHAIN_QUERY_UUID_COLUMNS * uuid_bytes + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_CHAIN_QUERY_OUT_OF_MEMORY;
+    }
+
+    data = (uint8_t*)table->data;
+    table->row_count = count;
+    table->block_height = (uint64_t*)data;
+    data += count * sizeof(uint64_t);
+    table->txn_id = data;
+    table->block_id = (data += uuid_bytes);
+    table->artifact_id = (data += uuid_bytes);
+    table->artifact_type = (data += uuid_bytes);
+    table->cert_type = (data += uuid_bytes);
+    table->signer_id = (data += uuid_bytes);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t offset = i * UUID_COLUMN_ENTRY_SIZE;
+
+        table->block_height[i] = records[i].block_height;
+        memcpy(table->txn_id + offset, records[i].txn_id, 16);
+        memcpy(table->block_id + offset, records[i].block_id, 16);
+        memcpy(table->artifact_id + offset, records[i].artifact_id, 16);
+        memcpy(table->artifact_type + offset, records[i].artifact_type, 16);
+        memcpy(table->cert_type + offset, records[i].cert_type, 16);
+        memcpy(table->signer_id + offset, records[i].signer_id, 16);
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/**
+ * \file helpers/chain_query/chain_query_worker_main.c
+ *
+ * \brief Entry point for a scanning thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chain_query_internal.h"
+
+/* forward decls. */
+static uint64_t chain_query_chunk(
+    const chain_query_scan* scan, size_t first, size_t count, uint8_t* mask);
+
+/**
+ * \brief Entry point for a scanning thread.
+ *
+ * Chunks are claimed and filtered until none remain.
+ *
+ * \param context       The worker.
+ *
+ * \returns NULL.
+ */
+void* chain_query_worker_main(void* context)
+{
+    chain_query_worker* worker = (chain_query_worker*)context;
+    chain_query_scan* scan = worker->scan;
+    const size_t rows = scan->table->row_count;
+    uint8_t mask[CHAIN_QUERY_CHUNK_ROWS];
+    size_t chunk, first, count;
+
+    for (;;)
+    {
+        chunk =
+            atomic_fetch_add_explicit(
+                &scan->next_chunk, 1, memory_order_relaxed);
+        if (chunk >= scan->chunk_count)
+        {
+            break;
+        }
+
+        first = chunk * CHAIN_QUERY_CHUNK_ROWS;
+        count = rows - first;
+        if (count > CHAIN_QUERY_CHUNK_ROWS)
+        {
+            count = CHAIN_QUERY_CHUNK_ROWS;
+        }
+
+        worker->rows_matched += chain_query_chunk(scan, first, count, mask);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Filter one chunk of rows and visit its matches.
+ *
+ * The height range is tested first, without branches, and each UUID field
+ * then clears the rows it rejects. A chunk with no rows left skips the
+ * remaining columns.
+ *
+ * \param scan          The query.
+ * \param first         The first row of the chunk.
+ * \param count         The number of rows in the chunk.
+ * \param mask          Scratch space of \ref CHAIN_QUERY_CHUNK_ROWS bytes.
+ *
+ * \returns the number of matching rows.
+ */
+static uint64_t chain_query_chunk(
+    const chain_query_scan* scan, size_t first, size_t count, uint8_t* mask)
+{
+    const chain_query_table* table = scan->table;
+    const chain_query_predicate* pred = scan->pred;
+    const uuid_column_impl impl = scan->opts->impl;
+    const size_t offset = first * UUID_COLUMN_ENTRY_SIZE;
+    const uint8_t* columns[] = {
+        table->artifact_id, table->artifact_type, table->cert_type,
+        table->signer_id };
+    const uint8_t* values[] = {
+        pred->artifact_id, pred->artifact_type, pred->cert_type,
+        pred->signer_id };
+    const unsigned int fields[] = {
+        CHAIN_QUERY_FIELD_ARTIFACT_ID, CHAIN_QUERY_FIELD_ARTIFACT_TYPE,
+        CHAIN_QUERY_FIELD_CERT_TYPE, CHAIN_QUERY_FIELD_SIGNER_ID };
+    uint64_t matched = count;
+
+    if (pred->fields & CHAIN_QUERY_FIELD_HEIGHT)
+    {
+        const uint64_t* height = table->block_height + first;
+
+        matched = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            mask[i] =
+                (height[i] >= pred->height_min)
+              & (height[i] <= pred->height_max);
+            matched += mask[i];
+        }
+    }
+    else
+    {
+        memset(mask, 1, count);
+    }
+
+    for (size_t f = 0; f < sizeof(fields) / sizeof(fields[0]); ++f)
+    {
+        if (0 == matched)
+        {
+            return 0;
+        }
+
+        if (pred->fields & fields[f])
+        {
+            uuid_column_filter(
+                impl, columns[f] + offset, count, values[f], mask);
+
+            matched = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                matched += mask[i];
+            }
+        }
+    }
+
+    if (NULL != scan->opts->visit && 0 != matched)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (mask[i])
+            {
+                scan->opts->visit(scan->opts->context, table, first + i);
+            }
+        }
+    }
+
+    return matched;
+}
@@ -0,0 +1,113 @@
+/**
+ * \file helpers/chain_seed/chain_seed_transactions.c
+ *
+ * \brief Submit a number of test transactions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Submit a number of test transactions on the given session.
+ *
+ * Each transaction creates a new artifact and is signed by the session's
+ * private certificate.
+ *
+ * \param session       The session on which the transactions are submitted.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param builder_opts  Certificate builder options for this operation.
+ * \param count         The number of transactions to submit.
+ * \param txn_ids       Array of count uuids to receive the transaction ids, or
+ *                      NULL.
+ * \param artifact_ids  Array of count uuids to receive the artifact ids, or
+ *                      NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status chain_seed_transactions(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts,
+    size_t count, vpr_uuid* txn_ids, vpr_uuid* artifact_ids)
+{
+    status retval;
+    const rcpr_uuid* client_id;
+    const vccrypt_buffer_t* client_sign_priv;
+    vccrypt_buffer_t cert_buffer;
+    vpr_uuid txn_uuid, artifact_uuid;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != builder_opts);
+
+    /* get the client artifact id. */
+    retval = vcblockchain_entity_get_artifact_id(&client_id, session->cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* get the client private signing key. */
+    retval =
+        vcblockchain_entity_private_cert_get_private_signing_key(
+            &client_sign_priv, session->cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        /* create a test transaction certificate. */
+        retval =
+            create_transaction_cert(
+                &cert_buffer, (rcpr_uuid*)&txn_uuid,
+                (rcpr_uuid*)&artifact_uuid, builder_opts, client_id,
+                client_sign_priv);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error creating transaction certificate.\n");
+            retval = ERROR_TRANSACTION_CERT_CREATE;
+            goto done;
+        }
+
+        /* submit and verify the certificate. */
+        retval =
+            submit_and_verify_txn(
+                session->sock, alloc, suite, &session->client_iv,
+                &session->server_iv, &session->shared_secret, &txn_uuid,
+                &artifact_uuid, &cert_buffer);
+        dispose((disposable_t*)&cert_buffer);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        if (NULL != txn_ids)
+        {
+            memcpy(&txn_ids[i], &txn_uuid, sizeof(txn_uuid));
+        }
+
+        if (NULL != artifact_ids)
+        {
+            memcpy(&artifact_ids[i], &artifact_uuid, sizeof(artifact_uuid));
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,87 @@
+/**
+ * \file helpers/chain_seed/chain_wait_for_transaction.c
+ *
+ * \brief Wait until a transaction has been canonized.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * \brief Wait until the given transaction has been canonized into a block.
+ *
+ * The transaction's block id is polled every poll_interval_ms milliseconds.
+ *
+ * \param session           The session used to poll agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param txn_id            The transaction to wait for.
+ * \param poll_interval_ms  The polling interval, in milliseconds.
+ * \param timeout_ms        The maximum time to wait, in milliseconds.
+ * \param block_id          The uuid to receive the block id on success, or
+ *                          NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_CHAIN_SEED_CANONIZATION_TIMEOUT if the transaction was not
+ *        canonized in time.
+ *      - a non-zero error code on failure.
+ */
+status chain_wait_for_transaction(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const vpr_uuid* txn_id,
+    unsigned int poll_interval_ms, unsigned int timeout_ms,
+    vpr_uuid* block_id)
+{
+    status retval;
+    vpr_uuid txn_block_id;
+    unsigned int waited_ms = 0;
+    struct timespec interval = {
+        .tv_sec = poll_interval_ms / 1000,
+        .tv_nsec = (long)(poll_interval_ms % 1000) * 1000000L };
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != txn_id);
+
+    for (;;)
+    {
+        /* a transaction only has a block id once it has been canonized. */
+        retval =
+            get_and_verify_txn_block_id(
+                session->sock, alloc, suite, &session->client_iv,
+                &session->server_iv, &session->shared_secret, txn_id,
+                &txn_block_id);
+        if (STATUS_SUCCESS == retval)
+        {
+            break;
+        }
+
+        /* the session is unusable after a transport error. */
+        if (status_is_transport_error(retval))
+        {
+            return retval;
+        }
+
+        if (waited_ms >= timeout_ms)
+        {
+            return ERROR_CHAIN_SEED_CANONIZATION_TIMEOUT;
+        }
+
+        nanosleep(&interval, NULL);
+        waited_ms += poll_interval_ms;
+    }
+
+    if (NULL != block_id)
+    {
+        memcpy(block_id, &txn_block_id, sizeof(txn_block_id));
+    }
+
+    return STATUS_SUCCESS;
+}
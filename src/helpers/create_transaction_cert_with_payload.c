@@ -0,0 +1,300 @@
+/**
+ * \file helpers/create_transaction_cert_with_payload.c
+ *
+ * \brief Create a test transaction certificate with a payload of any size.
+ *
+ * \copyright 2021-2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <vccert/fields.h>
+
+RCPR_IMPORT_uuid;
+
+static const rcpr_uuid TEST_CERT_TYPE = { .data = {
+    0x76, 0x13, 0x1b, 0x90, 0xc1, 0x0f, 0x47, 0xfb,
+    0xab, 0x83, 0x86, 0x0d, 0x87, 0xf1, 0x3c, 0x08 } };
+
+static const rcpr_uuid TEST_ARTIFACT_TYPE = { .data = {
+    0x67, 0x7f, 0x58, 0xf7, 0xb0, 0xa8, 0x45, 0x07,
+    0x9e, 0xff, 0x6b, 0x18, 0x1d, 0xb7, 0x06, 0xb7 } };
+
+static const rcpr_uuid ZERO_UUID = { .data = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } };
+
+/* the largest value of a short field. */
+#define SHORT_FIELD_MAX_SIZE 0xFFFF
+
+/* room for every field except the payload, and for the signature. */
+#define CERT_FIXED_SIZE 16384
+
+/* the size of the type and size header of a short field. */
+#define SHORT_FIELD_HEADER_SIZE 4
+
+static status create_random_uuids(
+    vccrypt_suite_options_t* suite, rcpr_uuid* txn_uuid,
+    rcpr_uuid* artifact_uuid);
+
+/**
+ * \brief Create a transaction certificate suitable for testing, carrying the
+ * given payload in its custom field.
+ *
+ * A short field holds at most 64 KiB, so a larger payload is split across
+ * consecutive custom fields.
+ *
+ * \param cert_buffer       Pointer to an uninitialized certificate buffer that
+ *                          is initialized with the contents of this certificate
+ *                          on success.
+ * \param txn_uuid          Pointer to a uuid field that is populated with the
+ *                          transaction uuid on success.
+ * \param artifact_uuid     Pointer to a uuid field that is populated with the
+ *                          artifact uuid on success.
+ * \param builder_opts      Certificate builder options for this operation.
+ * \param client_id         ID of the client signing this certificate.
+ * \param client_privkey    Private signing key of the client.
+ * \param payload           The payload.
+ * \param payload_size      The size of the payload, which may be zero.
+ *
+ * \note On success, the caller owns the cert_buffer and must dispose it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status create_transaction_cert_with_payload(
+    vccrypt_buffer_t* cert_buffer, rcpr_uuid* txn_uuid,
+    rcpr_uuid* artifact_uuid, vccert_builder_options_t* builder_opts,
+    const rcpr_uuid* signer_id, const vccrypt_buffer_t* client_privkey,
+    const uint8_t* payload, size_t payload_size)
+{
+    status retval;
+    vccert_builder_context_t builder;
+    size_t chunks = (payload_size + SHORT_FIELD_MAX_SIZE - 1)
+                  / SHORT_FIELD_MAX_SIZE;
+    size_t chunk_size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != cert_buffer);
+    MODEL_ASSERT(NULL != txn_uuid);
+    MODEL_ASSERT(NULL != artifact_uuid);
+    MODEL_ASSERT(prop_valid_builder_options(builder_opts));
+    MODEL_ASSERT(NULL != payload || 0 == payload_size);
+
+    /* create random UUIDs for the transaction and artifact ids. */
+    retval =
+        create_random_uuids(
+            builder_opts->crypto_suite, txn_uuid, artifact_uuid);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create a certificate builder instance. */
+    retval = vccert_builder_init(
+        builder_opts, &builder,
+        CERT_FIXED_SIZE + payload_size + chunks * SHORT_FIELD_HEADER_SIZE);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* add certificate version. */
+    retval =
+        vccert_builder_add_short_uint32(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add crypto suite. */
+    retval =
+        vccert_builder_add_short_uint16(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_CRYPTO_SUITE,
+            VCCRYPT_SUITE_VELO_V1);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add certificate type. */
+    retval =
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, TEST_CERT_TYPE.data);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add artifact type. */
+    retval =
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_TYPE, TEST_ARTIFACT_TYPE.data);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add transaction id (certificate id). */
+    retval =
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID, txn_uuid->data);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add artifact id. */
+    retval =
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, artifact_uuid->data);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add previous certificate id. */
+    retval =
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID,
+            ZERO_UUID.data);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add previous artifact state. */
+    retval =
+        vccert_builder_add_short_uint32(
+            &builder, VCCERT_FIELD_TYPE_PREVIOUS_ARTIFACT_STATE, 0xFFFFFFFF);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add new artifact state. */
+    retval =
+        vccert_builder_add_short_uint32(
+            &builder, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, 0x00000000);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* add our custom field, split into short fields. */
+    for (size_t offset = 0; offset < payload_size; offset += chunk_size)
+    {
+        chunk_size = payload_size - offset;
+        if (chunk_size > SHORT_FIELD_MAX_SIZE)
+        {
+            chunk_size = SHORT_FIELD_MAX_SIZE;
+        }
+
+        retval =
+            vccert_builder_add_short_buffer(
+                &builder, 0x0400, payload + offset, chunk_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_builder;
+        }
+    }
+
+    /* sign the certificate. */
+    retval =
+        vccert_builder_sign(
+            &builder, signer_id->data, client_privkey);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* get the signed certificate pointer and size. */
+    size_t cert_size = 0;
+    const uint8_t* cert = vccert_builder_emit(&builder, &cert_size);
+
+    /* create a buffer large enough for this certficate. */
+    retval =
+        vccrypt_buffer_init(cert_buffer, builder_opts->alloc_opts, cert_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_builder;
+    }
+
+    /* copy data to the caller's cert buffer. */
+    retval =
+        vccrypt_buffer_read_data(cert_buffer, cert, cert_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)cert_buffer);
+        goto cleanup_builder;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_builder;
+
+cleanup_builder:
+    dispose((disposable_t*)&builder);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Create random UUIDs for the certificate.
+ *
+ * \param suite         The crypto suite to use for this operation.
+ * \param txn_uuid      Pointer to UUID field to receive the transaction UUID.
+ * \param artifact_uuid Pointer to UUID field to receive the artifact UUID.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status create_random_uuids(
+    vccrypt_suite_options_t* suite, rcpr_uuid* txn_uuid,
+    rcpr_uuid* artifact_uuid)
+{
+    status retval;
+    vccrypt_prng_context_t prng;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vccrypt_suite_valid(suite));
+    MODEL_ASSERT(NULL != txn_uuid);
+    MODEL_ASSERT(NULL != artifact_uuid);
+
+    /* create a prng instance. */
+    retval = vccrypt_suite_prng_init(suite, &prng);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create a random transaction uuid. */
+    retval = vccrypt_prng_read_c(&prng, txn_uuid->data, 16);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_prng;
+    }
+
+    /* create a random artifact uuid. */
+    retval = vccrypt_prng_read_c(&prng, artifact_uuid->data, 16);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_prng;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_prng;
+
+cleanup_prng:
+    dispose((disposable_t*)&prng);
+
+done:
+    return retval;
+}
@@ -0,0 +1,46 @@
+/**
+ * \file helpers/env_helpers/env_get_double.c
+ *
+ * \brief Read a floating point value from the environment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/env_helpers.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * \brief Read a floating point value from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The value to use if the variable is unset or invalid.
+ *
+ * \returns the value from the environment, or the default value.
+ */
+double env_get_double(const char* name, double default_value)
+{
+    const char* value_str;
+    char* endptr;
+    double value;
+
+    /* attempt to read the value from the environment. */
+    value_str = getenv(name);
+    if (NULL == value_str)
+    {
+        return default_value;
+    }
+
+    /* attempt to convert this value to a double. */
+    errno = 0;
+    value = strtod(value_str, &endptr);
+    if (0 != errno || endptr == value_str || '\0' != *endptr)
+    {
+        fprintf(stderr, "Bad %s value.\n", name);
+        return default_value;
+    }
+
+    printf("Using %g for %s.\n", value, name);
+    return value;
+}
@@ -0,0 +1,47 @@
+/**
+ * \file helpers/env_helpers/env_get_size.c
+ *
+ * \brief Read a size value from the environment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/env_helpers.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * \brief Read a size value from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The value to use if the variable is unset or invalid.
+ *
+ * \returns the size from the environment, or the default value.
+ */
+size_t env_get_size(const char* name, size_t default_value)
+{
+    const char* value_str;
+    char* endptr;
+    size_t value;
+
+    /* attempt to read the value from the environment. */
+    value_str = getenv(name);
+    if (NULL == value_str)
+    {
+        return default_value;
+    }
+
+    /* attempt to convert this value to a size_t value. */
+    errno = 0;
+    value = (size_t)strtoumax(value_str, &endptr, 10);
+    if (0 != errno || endptr == value_str || '\0' != *endptr)
+    {
+        fprintf(stderr, "Bad %s value.\n", name);
+        return default_value;
+    }
+
+    printf("Using %zu for %s.\n", value, name);
+    return value;
+}
@@ -0,0 +1,34 @@
+/**
+ * \file helpers/env_helpers/env_get_string.c
+ *
+ * \brief Read a string value from the environment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/env_helpers.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * \brief Read a string value from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The value to use if the variable is unset or empty.
+ *
+ * \returns the string from the environment, or the default value.
+ */
+const char* env_get_string(const char* name, const char* default_value)
+{
+    const char* value;
+
+    /* attempt to read the value from the environment. */
+    value = getenv(name);
+    if (NULL == value || '\0' == *value)
+    {
+        return default_value;
+    }
+
+    printf("Using %s for %s.\n", value, name);
+    return value;
+}
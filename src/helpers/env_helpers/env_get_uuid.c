@@ -0,0 +1,101 @@
+/**
+ * \file helpers/env_helpers/env_get_uuid.c
+ *
+ * \brief Read a UUID value from the environment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <ctype.h>
+#include <helpers/env_helpers.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* forward decls. */
+static int env_hex_digit(char ch);
+
+/**
+ * \brief Read a UUID value from the environment.
+ *
+ * The value is written in the usual 8-4-4-4-12 hex form.
+ *
+ * \param name          The name of the environment variable.
+ * \param value         The 16 bytes to receive the UUID; left unchanged if
+ *                      the variable is unset or invalid.
+ *
+ * \returns true if a UUID was read from the environment.
+ */
+bool env_get_uuid(const char* name, uint8_t* value)
+{
+    const char* value_str;
+    uint8_t tmp[16];
+    size_t pos = 0;
+    int hi, lo;
+
+    /* attempt to read the value from the environment. */
+    value_str = getenv(name);
+    if (NULL == value_str || '\0' == *value_str)
+    {
+        return false;
+    }
+
+    /* the value must be 36 characters, with dashes at the usual places. */
+    if (36 != strlen(value_str))
+    {
+        goto bad_value;
+    }
+
+    for (size_t i = 0; i < sizeof(tmp); ++i)
+    {
+        if (8 == pos || 13 == pos || 18 == pos || 23 == pos)
+        {
+            if ('-' != value_str[pos])
+            {
+                goto bad_value;
+            }
+
+            ++pos;
+        }
+
+        hi = env_hex_digit(value_str[pos]);
+        lo = env_hex_digit(value_str[pos + 1]);
+        if (hi < 0 || lo < 0)
+        {
+            goto bad_value;
+        }
+
+        tmp[i] = (uint8_t)(hi << 4 | lo);
+        pos += 2;
+    }
+
+    memcpy(value, tmp, sizeof(tmp));
+    printf("Using %s for %s.\n", value_str, name);
+    return true;
+
+bad_value:
+    fprintf(stderr, "Bad %s value.\n", name);
+    return false;
+}
+
+/**
+ * \brief Convert a hex digit to its value.
+ *
+ * \param ch            The character to convert.
+ *
+ * \returns the value of the digit, or -1 if it is not a hex digit.
+ */
+static int env_hex_digit(char ch)
+{
+    if (!isxdigit((unsigned char)ch))
+    {
+        return -1;
+    }
+
+    if (isdigit((unsigned char)ch))
+    {
+        return ch - '0';
+    }
+
+    return tolower((unsigned char)ch) - 'a' + 10;
+}
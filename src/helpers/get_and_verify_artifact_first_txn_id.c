@@ -6,6 +6,7 @@
  * \copyright 2021-2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <helpers/agentd_status.h>
 #include <helpers/conn_helpers.h>
 #include <helpers/status_codes.h>
 #include <stdio.h>
@@ -97,6 +98,7 @@ status get_and_verify_artifact_first_txn_id(
     /* verify that the status was successful. */
     if (STATUS_SUCCESS != status)
     {
+        agentd_status_record(status);
         fprintf(stderr, "Unexpected get first txn id status (%x).\n", status);
         retval = ERROR_FIRST_TXN_ID_STATUS;
         goto cleanup_get_first_txn_id_response;
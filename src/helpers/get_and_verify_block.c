@@ -6,6 +6,7 @@
  * \copyright 2021-2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <helpers/agentd_status.h>
 #include <helpers/conn_helpers.h>
 #include <helpers/status_codes.h>
 #include <stdio.h>
@@ -102,6 +103,7 @@ status get_and_verify_block(
     /* verify that the status was successful. */
     if (STATUS_SUCCESS != status)
     {
+        agentd_status_record(status);
         fprintf(stderr, "Unexpected status (%x).\n", status);
         retval = ERROR_GET_BLOCK_STATUS;
         goto cleanup_get_block_response;
@@ -6,6 +6,7 @@
  * \copyright 2021-2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <helpers/agentd_status.h>
 #include <helpers/conn_helpers.h>
 #include <helpers/status_codes.h>
 #include <stdio.h>
@@ -94,6 +95,7 @@ status get_and_verify_block_id_by_height(
     /* verify status. */
     if (STATUS_SUCCESS != status)
     {
+        agentd_status_record(status);
         fprintf(stderr, "fail status from agentd. (%x)\n", status);
         retval = ERROR_BLOCK_ID_BY_HEIGHT_STATUS;
         goto cleanup_resp;
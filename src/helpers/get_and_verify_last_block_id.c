@@ -6,6 +6,7 @@
  * \copyright 2021-2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <helpers/agentd_status.h>
 #include <helpers/conn_helpers.h>
 #include <helpers/status_codes.h>
 #include <stdio.h>
@@ -93,6 +94,7 @@ status get_and_verify_last_block_id(
     /* verify status. */
     if (STATUS_SUCCESS != status)
     {
+        agentd_status_record(status);
         fprintf(stderr, "fail status from agentd. (%x)\n", status);
         retval = ERROR_LATEST_BLOCK_ID_STATUS;
         goto cleanup_resp;
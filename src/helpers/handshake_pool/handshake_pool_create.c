@@ -0,0 +1,172 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_create.c
+ *
+ * \brief Create a handshake pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+
+#include "handshake_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a handshake pool for a client credential.
+ *
+ * The server certificate and one entry are loaded before this returns, so
+ * bad credentials are reported here rather than on the first handshake. The
+ * refill thread then fills the rest of the pool.
+ *
+ * \param pool          Pointer to the pool pointer to receive the pool on
+ *                      success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param file          The OS file abstraction to use for this operation,
+ *                      which must outlive the pool.
+ * \param suite         The crypto suite to use for this operation, which
+ *                      must outlive the pool.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ * \param opts          The pool options.
+ *
+ * \note On success, the caller owns the pool and must release it by calling
+ * \ref handshake_pool_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_create(
+    handshake_pool** pool, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, const char* clientpriv,
+    const char* serverpub, const handshake_pool_options* opts)
+{
+    status retval, release_retval;
+    handshake_pool* tmp;
+    size_t clientpriv_size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != clientpriv);
+    MODEL_ASSERT(NULL != serverpub);
+    MODEL_ASSERT(NULL != opts);
+
+    if (0 == opts->capacity)
+    {
+        fprintf(stderr, "A handshake pool needs room for an entry.\n");
+        retval = ERROR_HANDSHAKE_POOL_SETUP;
+        goto done;
+    }
+
+    /* allocate the pool. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_HANDSHAKE_POOL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->file = file;
+    tmp->suite = suite;
+    tmp->capacity = opts->capacity;
+    pthread_mutex_init(&tmp->lock, NULL);
+    pthread_cond_init(&tmp->refill, NULL);
+
+    /* the refill thread reloads the client certificate for every entry. */
+    clientpriv_size = strlen(clientpriv) + 1;
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->clientpriv, clientpriv_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_HANDSHAKE_POOL_OUT_OF_MEMORY;
+        goto cleanup_pool;
+    }
+
+    memcpy(tmp->clientpriv, clientpriv, clientpriv_size);
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->entries,
+            tmp->capacity * sizeof(handshake_pool_entry));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_HANDSHAKE_POOL_OUT_OF_MEMORY;
+        goto cleanup_pool;
+    }
+
+    memset(tmp->entries, 0, tmp->capacity * sizeof(handshake_pool_entry));
+
+    /* the server certificate is shared by every handshake. */
+    retval =
+        entity_public_certificate_create_from_file(
+            &tmp->server_cert, file, suite, serverpub);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* get server artifact id. */
+    retval =
+        vcblockchain_entity_get_artifact_id(
+            &tmp->server_id, tmp->server_cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* get server public encryption key. */
+    retval =
+        vcblockchain_entity_get_public_encryption_key(
+            &tmp->server_pubkey, tmp->server_cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* compute the first entry here, to check the client credential. */
+    retval = handshake_pool_produce(tmp, &tmp->entries[0]);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    tmp->count = 1;
+    tmp->stats.produced = 1;
+
+    if (0 !=
+            pthread_create(
+                &tmp->refill_thread, NULL, &handshake_pool_refill_main, tmp))
+    {
+        fprintf(stderr, "Error starting handshake pool refill thread.\n");
+        retval = ERROR_HANDSHAKE_POOL_SETUP;
+        goto cleanup_pool;
+    }
+
+    tmp->refill_started = true;
+
+    /* success. */
+    *pool = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_pool:
+    /* handshake_pool_release handles partially constructed pools. */
+    release_retval = handshake_pool_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,61 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_entry_dispose.c
+ *
+ * \brief Dispose of a handshake pool entry.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <rcpr/resource.h>
+#include <string.h>
+
+#include "handshake_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Dispose of an entry.
+ *
+ * \param pool          The handshake pool.
+ * \param entry         The entry to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_entry_dispose(
+    handshake_pool* pool, handshake_pool_entry* entry)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != entry);
+
+    /* a handshake that succeeded has handed its certificate on. */
+    if (NULL != entry->cert)
+    {
+        release_retval =
+            resource_release(
+                vcblockchain_entity_private_cert_resource_handle(
+                    entry->cert));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    dispose((disposable_t*)&entry->key_nonce);
+    dispose((disposable_t*)&entry->challenge_nonce);
+
+    release_retval = rcpr_allocator_reclaim(pool->alloc, entry->request);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    memset(entry, 0, sizeof(*entry));
+
+    return retval;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_get_stats.c
+ *
+ * \brief Get a snapshot of the handshake pool counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "handshake_pool_internal.h"
+
+/**
+ * \brief Get a snapshot of the pool counters.
+ *
+ * \param pool          The handshake pool.
+ * \param stats         The structure to receive the counters.
+ */
+void handshake_pool_get_stats(
+    handshake_pool* pool, handshake_pool_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != stats);
+
+    pthread_mutex_lock(&pool->lock);
+    *stats = pool->stats;
+    stats->available = pool->count;
+    pthread_mutex_unlock(&pool->lock);
+}
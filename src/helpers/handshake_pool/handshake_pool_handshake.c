@@ -0,0 +1,123 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_handshake.c
+ *
+ * \brief Perform the agentd handshake with precomputed material.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <rcpr/resource.h>
+#include <stdio.h>
+#include <vcblockchain/error_codes.h>
+
+#include "handshake_pool_internal.h"
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Perform the agentd handshake with precomputed material.
+ *
+ * This returns the same values as \ref agentd_connection_handshake, and
+ * likewise leaves the socket to the caller.
+ *
+ * \param pool          The handshake pool.
+ * \param sock          The socket connection to agentd.
+ * \param alloc         The allocator to use for this operation.
+ * \param cert          Pointer to the entity private certificate pointer that
+ *                      will receive the client private entity certificate on
+ *                      success.
+ * \param shared_secret Pointer to a vccrypt buffer that will be initialized on
+ *                      success with the shared secret for this session.
+ * \param client_iv     Pointer to the uint64_t value that will be updated with
+ *                      the client_iv on success.
+ * \param server_iv     Pointer to the uint64_t value that will be updated with
+ *                      the server_iv on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_handshake(
+    handshake_pool* pool, RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vcblockchain_entity_private_cert** cert, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv)
+{
+    bool success = false;
+    status retval, release_retval;
+    handshake_pool_entry entry;
+    const vccrypt_buffer_t* client_privkey;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != cert);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != server_iv);
+
+    retval = handshake_pool_take(pool, &entry);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* get client private encryption key. */
+    retval =
+        vcblockchain_entity_private_cert_get_private_encryption_key(
+            &client_privkey, entry.cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_entry;
+    }
+
+    /* send the precomputed handshake request. */
+    retval = psock_write_raw_data(sock, entry.request, entry.request_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error sending handshake request to agentd.\n");
+        retval = ERROR_SEND_HANDSHAKE_REQ;
+        goto cleanup_entry;
+    }
+
+    /* receive the response and acknowledge it. */
+    retval =
+        agentd_connection_handshake_finish(
+            sock, alloc, pool->suite, pool->server_id, pool->server_pubkey,
+            client_privkey, &entry.key_nonce, &entry.challenge_nonce,
+            shared_secret, client_iv, server_iv);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_entry;
+    }
+
+    /* success; the caller owns the certificate from here on. */
+    success = true;
+    *cert = entry.cert;
+    entry.cert = NULL;
+
+cleanup_entry:
+    release_retval = handshake_pool_entry_dispose(pool, &entry);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* if something went wrong during cleanup, clean up the return values. */
+    if (success && STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)shared_secret);
+        release_retval =
+            resource_release(
+                vcblockchain_entity_private_cert_resource_handle(*cert));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,120 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_internal.h
+ *
+ * \brief Internal declarations for the handshake pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/handshake_pool.h>
+#include <pthread.h>
+#include <rcpr/uuid.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The default number of entries kept ready.
+ */
+#define HANDSHAKE_POOL_DEFAULT_CAPACITY                         4
+
+/**
+ * \brief The material for one handshake.
+ *
+ * request holds the encoded handshake request carrying the two nonces, as
+ * vcblockchain_protocol_sendreq_handshake_request would have written it to
+ * the socket.
+ */
+typedef struct handshake_pool_entry handshake_pool_entry;
+
+struct handshake_pool_entry
+{
+    vcblockchain_entity_private_cert* cert;
+    vccrypt_buffer_t key_nonce;
+    vccrypt_buffer_t challenge_nonce;
+    void* request;
+    size_t request_size;
+};
+
+/**
+ * \brief The handshake pool.
+ *
+ * Ready entries are kept in a ring of capacity entries starting at head. The
+ * refill thread waits on refill while the ring is full. Everything but the
+ * fields set at creation is guarded by lock.
+ */
+struct handshake_pool
+{
+    RCPR_SYM(allocator)* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    char* clientpriv;
+    vcblockchain_entity_public_cert* server_cert;
+    const RCPR_SYM(rcpr_uuid)* server_id;
+    const vccrypt_buffer_t* server_pubkey;
+    size_t capacity;
+    pthread_mutex_t lock;
+    pthread_cond_t refill;
+    handshake_pool_entry* entries;
+    size_t head;
+    size_t count;
+    bool stopping;
+    pthread_t refill_thread;
+    bool refill_started;
+    handshake_pool_stats stats;
+};
+
+/**
+ * \brief Entry point for the refill thread.
+ *
+ * \param context       The handshake pool.
+ *
+ * \returns NULL.
+ */
+void* handshake_pool_refill_main(void* context);
+
+/**
+ * \brief Compute the material for one handshake.
+ *
+ * \param pool          The handshake pool.
+ * \param entry         The entry to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_produce(
+    handshake_pool* pool, handshake_pool_entry* entry);
+
+/**
+ * \brief Take a ready entry, or compute one if none is ready.
+ *
+ * \param pool          The handshake pool.
+ * \param entry         The entry to receive the material.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_take(handshake_pool* pool, handshake_pool_entry* entry);
+
+/**
+ * \brief Dispose of an entry.
+ *
+ * \param pool          The handshake pool.
+ * \param entry         The entry to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_entry_dispose(
+    handshake_pool* pool, handshake_pool_entry* entry);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
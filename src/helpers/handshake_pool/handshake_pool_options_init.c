@@ -0,0 +1,24 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_options_init.c
+ *
+ * \brief Initialize handshake pool options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "handshake_pool_internal.h"
+
+/**
+ * \brief Initialize handshake pool options with their defaults.
+ *
+ * The default keeps four entries ready.
+ *
+ * \param opts          The options to initialize.
+ */
+void handshake_pool_options_init(handshake_pool_options* opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->capacity = HANDSHAKE_POOL_DEFAULT_CAPACITY;
+}
@@ -0,0 +1,134 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_produce.c
+ *
+ * \brief Compute the material for one handshake.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/status_codes.h>
+#include <rcpr/resource.h>
+#include <stdio.h>
+#include <string.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/error_codes.h>
+
+#include "handshake_pool_internal.h"
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+/**
+ * \brief Compute the material for one handshake.
+ *
+ * The request is encoded into a buffer socket by the same vcblockchain call
+ * that the unpooled handshake makes against the real socket, so its bytes
+ * are exactly what that call would have sent.
+ *
+ * \param pool          The handshake pool.
+ * \param entry         The entry to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_produce(
+    handshake_pool* pool, handshake_pool_entry* entry)
+{
+    bool success = false;
+    status retval, release_retval;
+    const rcpr_uuid* client_id;
+    psock* request_sock;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != entry);
+
+    memset(entry, 0, sizeof(*entry));
+
+    /* read the private key. */
+    retval =
+        entity_private_certificate_create_from_file(
+            &entry->cert, pool->file, pool->suite, pool->clientpriv);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* get client artifact id. */
+    retval = vcblockchain_entity_get_artifact_id(&client_id, entry->cert);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_cert;
+    }
+
+    /* a buffer socket with no input collects the encoded request. */
+    retval = psock_create_from_buffer(&request_sock, pool->alloc, NULL, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_cert;
+    }
+
+    /* draw the nonces and encode the handshake request. */
+    retval =
+        vcblockchain_protocol_sendreq_handshake_request(
+            request_sock, pool->suite, (const vpr_uuid*)client_id,
+            &entry->key_nonce, &entry->challenge_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error encoding handshake request.\n");
+        retval = ERROR_SEND_HANDSHAKE_REQ;
+        goto cleanup_request_sock;
+    }
+
+    retval =
+        psock_from_buffer_get_output_buffer(
+            request_sock, pool->alloc, &entry->request,
+            &entry->request_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_nonces;
+    }
+
+    /* success. */
+    success = true;
+    goto cleanup_request_sock;
+
+cleanup_nonces:
+    dispose((disposable_t*)&entry->key_nonce);
+    dispose((disposable_t*)&entry->challenge_nonce);
+
+cleanup_request_sock:
+    release_retval = resource_release(psock_resource_handle(request_sock));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* the entry is complete; discard it if the cleanup above failed. */
+    if (success)
+    {
+        if (STATUS_SUCCESS != retval)
+        {
+            handshake_pool_entry_dispose(pool, entry);
+        }
+
+        goto done;
+    }
+
+cleanup_cert:
+    release_retval =
+        resource_release(
+            vcblockchain_entity_private_cert_resource_handle(entry->cert));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    entry->cert = NULL;
+
+done:
+    return retval;
+}
@@ -0,0 +1,68 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_refill_main.c
+ *
+ * \brief Entry point for the handshake pool refill thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <stdio.h>
+
+#include "handshake_pool_internal.h"
+
+/**
+ * \brief Entry point for the refill thread.
+ *
+ * The thread computes entries while the ring has room, and sleeps while it
+ * is full. Only this thread adds entries, so the slot after the last ready
+ * entry is always free once the ring isn't full. If an entry can't be
+ * computed, the thread stops; handshakes then compute their entries inline
+ * and report the error themselves.
+ *
+ * \param context       The handshake pool.
+ *
+ * \returns NULL.
+ */
+void* handshake_pool_refill_main(void* context)
+{
+    handshake_pool* pool = (handshake_pool*)context;
+    handshake_pool_entry entry;
+    status retval;
+    uint64_t start;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        while (!pool->stopping && pool->count == pool->capacity)
+        {
+            pthread_cond_wait(&pool->refill, &pool->lock);
+        }
+
+        if (pool->stopping)
+        {
+            break;
+        }
+
+        pthread_mutex_unlock(&pool->lock);
+        start = latency_clock_now_ns();
+        retval = handshake_pool_produce(pool, &entry);
+        pthread_mutex_lock(&pool->lock);
+
+        pool->stats.produce_ns += latency_clock_now_ns() - start;
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(
+                stderr, "Handshake pool refill stopped (%x).\n", retval);
+            break;
+        }
+
+        pool->entries[(pool->head + pool->count) % pool->capacity] = entry;
+        ++pool->count;
+        ++pool->stats.produced;
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
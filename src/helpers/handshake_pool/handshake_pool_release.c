@@ -0,0 +1,95 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_release.c
+ *
+ * \brief Release a handshake pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <rcpr/resource.h>
+
+#include "handshake_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Release a handshake pool, discarding any unused entries.
+ *
+ * \param pool          The handshake pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_release(handshake_pool* pool)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = pool->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    if (pool->refill_started)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->stopping = true;
+        pthread_cond_signal(&pool->refill);
+        pthread_mutex_unlock(&pool->lock);
+
+        pthread_join(pool->refill_thread, NULL);
+    }
+
+    /* unused entries hold nonces that were never sent; discard them. */
+    for (size_t i = 0; i < pool->count; ++i)
+    {
+        release_retval =
+            handshake_pool_entry_dispose(
+                pool, &pool->entries[(pool->head + i) % pool->capacity]);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != pool->server_cert)
+    {
+        release_retval =
+            resource_release(
+                vcblockchain_entity_public_cert_resource_handle(
+                    pool->server_cert));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != pool->entries)
+    {
+        release_retval = rcpr_allocator_reclaim(alloc, pool->entries);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != pool->clientpriv)
+    {
+        release_retval = rcpr_allocator_reclaim(alloc, pool->clientpriv);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    pthread_cond_destroy(&pool->refill);
+    pthread_mutex_destroy(&pool->lock);
+
+    release_retval = rcpr_allocator_reclaim(alloc, pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
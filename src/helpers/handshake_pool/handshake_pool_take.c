@@ -0,0 +1,44 @@
+/**
+ * \file helpers/handshake_pool/handshake_pool_take.c
+ *
+ * \brief Take a ready handshake pool entry.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "handshake_pool_internal.h"
+
+/**
+ * \brief Take a ready entry, or compute one if none is ready.
+ *
+ * \param pool          The handshake pool.
+ * \param entry         The entry to receive the material.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status handshake_pool_take(handshake_pool* pool, handshake_pool_entry* entry)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != entry);
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->count > 0)
+    {
+        *entry = pool->entries[pool->head];
+        pool->head = (pool->head + 1) % pool->capacity;
+        --pool->count;
+        ++pool->stats.hits;
+        pthread_cond_signal(&pool->refill);
+        pthread_mutex_unlock(&pool->lock);
+
+        return STATUS_SUCCESS;
+    }
+
+    ++pool->stats.misses;
+    pthread_mutex_unlock(&pool->lock);
+
+    return handshake_pool_produce(pool, entry);
+}
@@ -0,0 +1,52 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_acquire.c
+ *
+ * \brief Take a slot from a large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "large_buffer_pool_internal.h"
+
+/**
+ * \brief Take a slot from the pool.
+ *
+ * \param pool          The pool.
+ * \param size          The number of bytes needed.
+ *
+ * \returns the slot, or NULL if size is larger than a slot or every slot is
+ * in use.
+ */
+void* large_buffer_pool_acquire(large_buffer_pool* pool, size_t size)
+{
+    void* slot = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    if (size > pool->slot_size)
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+
+    if (pool->free_count > 0)
+    {
+        pool->free_count -= 1;
+        slot =
+            pool->base
+                + pool->free_slots[pool->free_count] * pool->slot_size;
+
+        pool->stats.acquired += 1;
+        pool->stats.in_use += 1;
+        if (pool->stats.in_use > pool->stats.peak_in_use)
+        {
+            pool->stats.peak_in_use = pool->stats.in_use;
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return slot;
+}
@@ -0,0 +1,197 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_allocator_init.c
+ *
+ * \brief Initialize allocator options backed by a large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "large_buffer_pool_internal.h"
+
+/* forward decls. */
+static void* pool_allocate(void* options, size_t size);
+static void pool_release(void* options, void* mem);
+static void* pool_reallocate(
+    void* options, void* mem, size_t old_size, size_t new_size);
+static int pool_control(void* options, uint32_t key, void* value);
+static void pool_dispose(void* disp);
+static void* try_acquire(large_buffer_pool_allocator* opts, size_t size);
+
+/**
+ * \brief Initialize allocator options that serve large allocations from a
+ * pool and everything else from a fallback allocator.
+ *
+ * \param alloc_opts    The allocator options to initialize. These must be
+ *                      disposed before the pool is released.
+ * \param pool          The pool.
+ * \param fallback      The allocator options for everything else, which
+ *                      must outlive these options.
+ */
+void large_buffer_pool_allocator_init(
+    large_buffer_pool_allocator* alloc_opts, large_buffer_pool* pool,
+    allocator_options_t* fallback)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != fallback);
+
+    memset(alloc_opts, 0, sizeof(*alloc_opts));
+    alloc_opts->options.hdr.dispose = &pool_dispose;
+    alloc_opts->options.allocator_allocate = &pool_allocate;
+    alloc_opts->options.allocator_release = &pool_release;
+    alloc_opts->options.allocator_reallocate = &pool_reallocate;
+    alloc_opts->options.allocator_control = &pool_control;
+    alloc_opts->options.context = pool;
+    alloc_opts->pool = pool;
+    alloc_opts->fallback = fallback;
+}
+
+/**
+ * \brief Allocate from the pool if the request is large, and from the
+ * fallback otherwise.
+ *
+ * \param options       The pool allocator options.
+ * \param size          The size of the allocation.
+ *
+ * \returns the memory, or NULL on failure.
+ */
+static void* pool_allocate(void* options, size_t size)
+{
+    large_buffer_pool_allocator* opts = (large_buffer_pool_allocator*)options;
+    void* mem = try_acquire(opts, size);
+
+    if (NULL != mem)
+    {
+        return mem;
+    }
+
+    return allocate(opts->fallback, size);
+}
+
+/**
+ * \brief Return memory to the pool or the fallback, whichever owns it.
+ *
+ * \param options       The pool allocator options.
+ * \param mem           The memory to release.
+ */
+static void pool_release(void* options, void* mem)
+{
+    large_buffer_pool_allocator* opts = (large_buffer_pool_allocator*)options;
+
+    if (!large_buffer_pool_return(opts->pool, mem))
+    {
+        release(opts->fallback, mem);
+    }
+}
+
+/**
+ * \brief Resize memory, moving it between the pool and the fallback as its
+ * size requires.
+ *
+ * \param options       The pool allocator options.
+ * \param mem           The memory to resize.
+ * \param old_size      The current size of the memory.
+ * \param new_size      The requested size.
+ *
+ * \returns the resized memory, or NULL on failure.
+ */
+static void* pool_reallocate(
+    void* options, void* mem, size_t old_size, size_t new_size)
+{
+    large_buffer_pool_allocator* opts = (large_buffer_pool_allocator*)options;
+    large_buffer_pool* pool = opts->pool;
+    uint8_t* bytes = (uint8_t*)mem;
+    void* moved;
+    bool pooled = bytes >= pool->base && bytes < pool->base + pool->map_size;
+
+    /* a slot can grow in place up to its size. */
+    if (pooled && new_size <= pool->slot_size)
+    {
+        return mem;
+    }
+
+    if (!pooled)
+    {
+        moved = try_acquire(opts, new_size);
+        if (NULL == moved)
+        {
+            return reallocate(opts->fallback, mem, old_size, new_size);
+        }
+    }
+    else
+    {
+        moved = allocate(opts->fallback, new_size);
+        if (NULL == moved)
+        {
+            return NULL;
+        }
+    }
+
+    memcpy(moved, mem, old_size < new_size ? old_size : new_size);
+    pool_release(options, mem);
+
+    return moved;
+}
+
+/**
+ * \brief Pass a control request to the fallback allocator.
+ *
+ * \param options       The pool allocator options.
+ * \param key           The control key.
+ * \param value         The control value.
+ *
+ * \returns the fallback allocator's answer.
+ */
+static int pool_control(void* options, uint32_t key, void* value)
+{
+    large_buffer_pool_allocator* opts = (large_buffer_pool_allocator*)options;
+
+    return allocator_control(opts->fallback, key, value);
+}
+
+/**
+ * \brief Dispose of pool allocator options.
+ *
+ * The pool and the fallback have their own owners, so there is nothing to
+ * release.
+ *
+ * \param disp          The pool allocator options.
+ */
+static void pool_dispose(void* disp)
+{
+    large_buffer_pool_allocator* opts = (large_buffer_pool_allocator*)disp;
+
+    memset(opts, 0, sizeof(*opts));
+}
+
+/**
+ * \brief Take a slot for a request that is large enough to pool.
+ *
+ * \param opts          The pool allocator options.
+ * \param size          The size of the allocation.
+ *
+ * \returns the slot, or NULL if the request should go to the fallback.
+ */
+static void* try_acquire(large_buffer_pool_allocator* opts, size_t size)
+{
+    large_buffer_pool* pool = opts->pool;
+    void* mem;
+
+    if (size < pool->min_size)
+    {
+        return NULL;
+    }
+
+    mem = large_buffer_pool_acquire(pool, size);
+    if (NULL == mem)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->stats.fallbacks += 1;
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    return mem;
+}
@@ -0,0 +1,22 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_backing_get.c
+ *
+ * \brief Get the backing of a large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "large_buffer_pool_internal.h"
+
+/**
+ * \brief Get the backing the pool ended up with.
+ *
+ * \param pool          The pool.
+ *
+ * \returns the backing, which is never LARGE_BUFFER_POOL_BACKING_AUTO.
+ */
+large_buffer_pool_backing large_buffer_pool_backing_get(
+    const large_buffer_pool* pool)
+{
+    return pool->backing;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_backing_name.c
+ *
+ * \brief Get a printable name for a large buffer pool backing.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/large_buffer_pool.h>
+
+/**
+ * \brief Get a printable name for a backing.
+ *
+ * \param backing       The backing.
+ *
+ * \returns the name.
+ */
+const char* large_buffer_pool_backing_name(large_buffer_pool_backing backing)
+{
+    switch (backing)
+    {
+        case LARGE_BUFFER_POOL_BACKING_AUTO:
+            return "auto";
+
+        case LARGE_BUFFER_POOL_BACKING_HUGETLB:
+            return "hugetlb";
+
+        case LARGE_BUFFER_POOL_BACKING_THP:
+            return "thp";
+
+        case LARGE_BUFFER_POOL_BACKING_BASE_PAGES:
+            return "base pages";
+
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,275 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_create.c
+ *
+ * \brief Create a large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "large_buffer_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static size_t huge_page_size(void);
+static status map_slots(
+    large_buffer_pool* pool, large_buffer_pool_backing backing, bool prefault);
+
+/**
+ * \brief Create a pool, mapping and optionally pre-faulting its slots.
+ *
+ * \param pool          Pointer to the pool pointer to receive the pool on
+ *                      success.
+ * \param alloc         The allocator to use for this operation.
+ * \param opts          The pool options.
+ *
+ * \note On success, the caller owns the pool and must release it by calling
+ * \ref large_buffer_pool_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LARGE_BUFFER_POOL_MAP if the requested backing could not be
+ *        mapped.
+ *      - a non-zero error code on failure.
+ */
+status large_buffer_pool_create(
+    large_buffer_pool** pool, RCPR_SYM(allocator)* alloc,
+    const large_buffer_pool_options* opts)
+{
+    status retval, release_retval;
+    large_buffer_pool* tmp;
+    size_t page = huge_page_size();
+    uint64_t start;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != opts);
+    MODEL_ASSERT(opts->slot_size > 0);
+    MODEL_ASSERT(opts->slot_count > 0);
+
+    /* allocate the pool. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_LARGE_BUFFER_POOL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->slot_size = (opts->slot_size + page - 1) / page * page;
+    tmp->slot_count = opts->slot_count;
+    tmp->min_size = opts->min_size;
+    tmp->map_size = tmp->slot_size * tmp->slot_count;
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->free_slots,
+            tmp->slot_count * sizeof(size_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_LARGE_BUFFER_POOL_OUT_OF_MEMORY;
+        goto cleanup_pool;
+    }
+
+    /* hand out low slots first. */
+    for (size_t i = 0; i < tmp->slot_count; ++i)
+    {
+        tmp->free_slots[i] = tmp->slot_count - 1 - i;
+    }
+
+    tmp->free_count = tmp->slot_count;
+
+    start = latency_clock_now_ns();
+    if (LARGE_BUFFER_POOL_BACKING_AUTO == opts->backing)
+    {
+        retval =
+            map_slots(tmp, LARGE_BUFFER_POOL_BACKING_HUGETLB, opts->prefault);
+        if (STATUS_SUCCESS != retval)
+        {
+            retval =
+                map_slots(tmp, LARGE_BUFFER_POOL_BACKING_THP, opts->prefault);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            retval =
+                map_slots(
+                    tmp, LARGE_BUFFER_POOL_BACKING_BASE_PAGES,
+                    opts->prefault);
+        }
+    }
+    else
+    {
+        retval = map_slots(tmp, opts->backing, opts->prefault);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Error mapping %zu bytes of %s buffers.\n", tmp->map_size,
+            large_buffer_pool_backing_name(opts->backing));
+        goto cleanup_free_slots;
+    }
+
+    tmp->stats.prefault_ns = latency_clock_now_ns() - start;
+
+    if (0 != pthread_mutex_init(&tmp->lock, NULL))
+    {
+        retval = ERROR_LARGE_BUFFER_POOL_OUT_OF_MEMORY;
+        goto cleanup_mapping;
+    }
+
+    /* success. */
+    *pool = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_mapping:
+    munmap(tmp->base, tmp->map_size);
+
+cleanup_free_slots:
+    release_retval = rcpr_allocator_reclaim(alloc, tmp->free_slots);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_pool:
+    release_retval = rcpr_allocator_reclaim(alloc, tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Read the default huge page size from /proc/meminfo.
+ *
+ * \returns the huge page size in bytes.
+ */
+static size_t huge_page_size(void)
+{
+    FILE* f;
+    char line[128];
+    unsigned long kb;
+    size_t size = LARGE_BUFFER_POOL_DEFAULT_HUGE_PAGE_SIZE;
+
+    f = fopen("/proc/meminfo", "r");
+    if (NULL == f)
+    {
+        return size;
+    }
+
+    while (NULL != fgets(line, sizeof(line), f))
+    {
+        if (1 == sscanf(line, "Hugepagesize: %lu kB", &kb))
+        {
+            size = kb * 1024;
+            break;
+        }
+    }
+
+    fclose(f);
+
+    return size;
+}
+
+/**
+ * \brief Map the slots of a pool with the given backing.
+ *
+ * Transparent huge pages are only used for aligned ranges, so the mapping is
+ * over-allocated by a huge page and trimmed to an aligned start.
+ *
+ * \param pool          The pool, whose map size is set.
+ * \param backing       The backing to try.
+ * \param prefault      true to touch every page now.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, with base and backing set.
+ *      - ERROR_LARGE_BUFFER_POOL_MAP if the backing isn't available.
+ */
+static status map_slots(
+    large_buffer_pool* pool, large_buffer_pool_backing backing, bool prefault)
+{
+    size_t huge = huge_page_size();
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t len = pool->map_size;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    uint8_t* mem;
+    uintptr_t aligned;
+
+    switch (backing)
+    {
+        case LARGE_BUFFER_POOL_BACKING_HUGETLB:
+            /* populating reserves and clears every huge page up front. */
+            flags |= MAP_HUGETLB | (prefault ? MAP_POPULATE : 0);
+            break;
+
+        case LARGE_BUFFER_POOL_BACKING_THP:
+            len += huge;
+            break;
+
+        case LARGE_BUFFER_POOL_BACKING_BASE_PAGES:
+            flags |= prefault ? MAP_POPULATE : 0;
+            break;
+
+        default:
+            return ERROR_LARGE_BUFFER_POOL_MAP;
+    }
+
+    mem = mmap(NULL, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (MAP_FAILED == mem)
+    {
+        return ERROR_LARGE_BUFFER_POOL_MAP;
+    }
+
+    if (LARGE_BUFFER_POOL_BACKING_THP == backing)
+    {
+        /* trim the mapping to a huge page aligned range. */
+        aligned = ((uintptr_t)mem + huge - 1) & ~(uintptr_t)(huge - 1);
+        if (aligned > (uintptr_t)mem)
+        {
+            munmap(mem, aligned - (uintptr_t)mem);
+        }
+
+        if ((uintptr_t)mem + len > aligned + pool->map_size)
+        {
+            munmap(
+                (uint8_t*)(aligned + pool->map_size),
+                (uintptr_t)mem + len - aligned - pool->map_size);
+        }
+
+        mem = (uint8_t*)aligned;
+
+        if (0 != madvise(mem, pool->map_size, MADV_HUGEPAGE))
+        {
+            munmap(mem, pool->map_size);
+            return ERROR_LARGE_BUFFER_POOL_MAP;
+        }
+
+        /* MAP_POPULATE would fault before madvise, so touch every page. */
+        if (prefault)
+        {
+            for (size_t offset = 0; offset < pool->map_size; offset += page)
+            {
+                ((volatile uint8_t*)mem)[offset] = 0;
+            }
+        }
+    }
+
+    pool->base = mem;
+    pool->backing = backing;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_get_stats.c
+ *
+ * \brief Get a snapshot of the large buffer pool counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "large_buffer_pool_internal.h"
+
+/**
+ * \brief Get a snapshot of the pool counters.
+ *
+ * \param pool          The pool.
+ * \param stats         The structure to receive the counters.
+ */
+void large_buffer_pool_get_stats(
+    large_buffer_pool* pool, large_buffer_pool_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != stats);
+
+    pthread_mutex_lock(&pool->lock);
+    *stats = pool->stats;
+    pthread_mutex_unlock(&pool->lock);
+}
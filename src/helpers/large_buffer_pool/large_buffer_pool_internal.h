@@ -0,0 +1,48 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_internal.h
+ *
+ * \brief Internal declarations for the large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/large_buffer_pool.h>
+#include <pthread.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The huge page size assumed when /proc/meminfo doesn't say.
+ */
+#define LARGE_BUFFER_POOL_DEFAULT_HUGE_PAGE_SIZE        (2 * 1024 * 1024)
+
+/**
+ * \brief The pool.
+ *
+ * The slots are laid out back to back in a single mapping, so a pointer
+ * belongs to the pool exactly when it lies inside the mapping. Free slots are
+ * kept on a stack, so the most recently returned slot, whose pages are most
+ * likely still in the TLB and cache, is reused first.
+ */
+struct large_buffer_pool
+{
+    RCPR_SYM(allocator)* alloc;
+    pthread_mutex_t lock;
+    uint8_t* base;
+    size_t map_size;
+    size_t slot_size;
+    size_t slot_count;
+    size_t min_size;
+    large_buffer_pool_backing backing;
+    size_t* free_slots;
+    size_t free_count;
+    large_buffer_pool_stats stats;
+};
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,28 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_options_init.c
+ *
+ * \brief Initialize large buffer pool options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/large_buffer_pool.h>
+#include <string.h>
+
+/**
+ * \brief Initialize pool options with their defaults.
+ *
+ * The defaults are eight 8 MiB slots, pooling allocations of 256 KiB and
+ * up, with automatic backing, pre-faulted.
+ *
+ * \param opts          The options to initialize.
+ */
+void large_buffer_pool_options_init(large_buffer_pool_options* opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->slot_size = 8 * 1024 * 1024;
+    opts->slot_count = 8;
+    opts->min_size = 256 * 1024;
+    opts->backing = LARGE_BUFFER_POOL_BACKING_AUTO;
+    opts->prefault = true;
+}
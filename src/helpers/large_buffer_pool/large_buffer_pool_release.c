@@ -0,0 +1,51 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_release.c
+ *
+ * \brief Release a large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <sys/mman.h>
+
+#include "large_buffer_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a pool, unmapping its slots.
+ *
+ * Every slot must have been returned.
+ *
+ * \param pool          The pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status large_buffer_pool_release(large_buffer_pool* pool)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = pool->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(pool->free_count == pool->slot_count);
+
+    munmap(pool->base, pool->map_size);
+    pthread_mutex_destroy(&pool->lock);
+
+    release_retval = rcpr_allocator_reclaim(alloc, pool->free_slots);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
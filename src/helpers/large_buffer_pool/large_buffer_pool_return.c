@@ -0,0 +1,44 @@
+/**
+ * \file helpers/large_buffer_pool/large_buffer_pool_return.c
+ *
+ * \brief Return a slot to a large buffer pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "large_buffer_pool_internal.h"
+
+/**
+ * \brief Return a slot to the pool.
+ *
+ * \param pool          The pool.
+ * \param ptr           The memory to return.
+ *
+ * \returns true if ptr is a slot of this pool and was returned, and false if
+ * it belongs to some other allocator.
+ */
+bool large_buffer_pool_return(large_buffer_pool* pool, void* ptr)
+{
+    uint8_t* mem = (uint8_t*)ptr;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    if (mem < pool->base || mem >= pool->base + pool->map_size)
+    {
+        return false;
+    }
+
+    MODEL_ASSERT(0 == (mem - pool->base) % pool->slot_size);
+
+    pthread_mutex_lock(&pool->lock);
+
+    pool->free_slots[pool->free_count] =
+        (size_t)(mem - pool->base) / pool->slot_size;
+    pool->free_count += 1;
+    pool->stats.in_use -= 1;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return true;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file helpers/latency_histogram/latency_clock_now_ns.c
+ *
+ * \brief Read the monotonic clock in nanoseconds.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <time.h>
+
+/**
+ * \brief Read the monotonic clock.
+ *
+ * \returns the current monotonic time in nanoseconds.
+ */
+uint64_t latency_clock_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,21 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_init.c
+ *
+ * \brief Initialize a latency histogram.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <string.h>
+
+/**
+ * \brief Initialize or reset a latency histogram.
+ *
+ * \param hist          The histogram to initialize.
+ */
+void latency_histogram_init(latency_histogram* hist)
+{
+    memset(hist, 0, sizeof(*hist));
+    hist->min = UINT64_MAX;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_internal.h
+ *
+ * \brief Internal bucket math for the latency histogram.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/latency_histogram.h>
+
+/**
+ * \brief Get the bucket index for a given value.
+ *
+ * Values below the sub-bucket count are stored exactly. Larger values are
+ * stored in the sub-bucket of their power of two selected by the bits just
+ * below their most significant bit.
+ *
+ * \param value         The value to bucket.
+ *
+ * \returns the bucket index for this value.
+ */
+static inline unsigned int latency_histogram_bucket_index(uint64_t value)
+{
+    unsigned int exponent, sub_bucket;
+
+    if (value < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return (unsigned int)value;
+    }
+
+    exponent = 63U - (unsigned int)__builtin_clzll(value);
+    sub_bucket =
+        (unsigned int)(value >> (exponent - LATENCY_HISTOGRAM_SUB_BUCKET_BITS))
+            & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1U);
+
+    return
+        (exponent - LATENCY_HISTOGRAM_SUB_BUCKET_BITS + 1U)
+            * LATENCY_HISTOGRAM_SUB_BUCKETS
+        + sub_bucket;
+}
+
+/**
+ * \brief Get the largest value that maps to the given bucket index.
+ *
+ * \param index         The bucket index.
+ *
+ * \returns the upper bound of this bucket.
+ */
+static inline uint64_t latency_histogram_bucket_upper_bound(unsigned int index)
+{
+    unsigned int exponent, sub_bucket, shift;
+    uint64_t lower;
+
+    if (index < LATENCY_HISTOGRAM_SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    exponent =
+        index / LATENCY_HISTOGRAM_SUB_BUCKETS
+            + LATENCY_HISTOGRAM_SUB_BUCKET_BITS - 1U;
+    sub_bucket = index % LATENCY_HISTOGRAM_SUB_BUCKETS;
+    shift = exponent - LATENCY_HISTOGRAM_SUB_BUCKET_BITS;
+    lower = ((uint64_t)(LATENCY_HISTOGRAM_SUB_BUCKETS + sub_bucket)) << shift;
+
+    return lower + ((UINT64_C(1) << shift) - 1U);
+}
@@ -0,0 +1,26 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_mean.c
+ *
+ * \brief Get the mean of a latency histogram.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+/**
+ * \brief Get the mean of all samples in this histogram.
+ *
+ * \param hist          The histogram to query.
+ *
+ * \returns the mean in nanoseconds, or 0 if the histogram is empty.
+ */
+uint64_t latency_histogram_mean(const latency_histogram* hist)
+{
+    if (0 == hist->total)
+    {
+        return 0;
+    }
+
+    return hist->sum / hist->total;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_merge.c
+ *
+ * \brief Merge two latency histograms.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+/**
+ * \brief Merge the samples from one histogram into another.
+ *
+ * \param dest          The histogram receiving the samples.
+ * \param src           The histogram providing the samples.
+ */
+void latency_histogram_merge(
+    latency_histogram* dest, const latency_histogram* src)
+{
+    for (unsigned int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; ++i)
+    {
+        dest->counts[i] += src->counts[i];
+    }
+
+    dest->total += src->total;
+    dest->sum += src->sum;
+
+    if (src->min < dest->min)
+    {
+        dest->min = src->min;
+    }
+
+    if (src->max > dest->max)
+    {
+        dest->max = src->max;
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_percentile.c
+ *
+ * \brief Query a percentile from a latency histogram.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "latency_histogram_internal.h"
+
+/**
+ * \brief Get the value at the given percentile.
+ *
+ * \param hist          The histogram to query.
+ * \param percentile    The percentile to query, from 0.0 to 100.0.
+ *
+ * \returns the upper bound of the bucket holding the requested percentile, in
+ * nanoseconds, or 0 if the histogram is empty.
+ */
+uint64_t latency_histogram_percentile(
+    const latency_histogram* hist, double percentile)
+{
+    uint64_t target, seen = 0;
+    uint64_t value;
+
+    if (0 == hist->total)
+    {
+        return 0;
+    }
+
+    /* compute the rank of the requested sample, rounding up. */
+    if (percentile <= 0.0)
+    {
+        target = 1;
+    }
+    else if (percentile >= 100.0)
+    {
+        return hist->max;
+    }
+    else
+    {
+        target = (uint64_t)((percentile / 100.0) * (double)hist->total);
+        if ((double)target < (percentile / 100.0) * (double)hist->total)
+        {
+            target += 1;
+        }
+
+        if (0 == target)
+        {
+            target = 1;
+        }
+    }
+
+    /* walk the buckets until we have seen the target rank. */
+    for (unsigned int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; ++i)
+    {
+        seen += hist->counts[i];
+        if (seen >= target)
+        {
+            /* never report beyond the largest recorded sample. */
+            value = latency_histogram_bucket_upper_bound(i);
+            return value < hist->max ? value : hist->max;
+        }
+    }
+
+    return hist->max;
+}
@@ -0,0 +1,36 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_print.c
+ *
+ * \brief Print a summary of a latency histogram.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <inttypes.h>
+
+/**
+ * \brief Print a one line summary of this histogram.
+ *
+ * The summary includes the sample count, mean, p50, p90, p99, p99.9, and max,
+ * all reported in microseconds.
+ *
+ * \param hist          The histogram to print.
+ * \param out           The stream to which the summary is written.
+ * \param label         A label to prefix the summary.
+ */
+void latency_histogram_print(
+    const latency_histogram* hist, FILE* out, const char* label)
+{
+    fprintf(
+        out,
+        "%-24s n=%-10" PRIu64 " mean=%.1fus p50=%.1fus p90=%.1fus "
+        "p99=%.1fus p99.9=%.1fus max=%.1fus\n",
+        label, hist->total,
+        latency_histogram_mean(hist) / 1000.0,
+        latency_histogram_percentile(hist, 50.0) / 1000.0,
+        latency_histogram_percentile(hist, 90.0) / 1000.0,
+        latency_histogram_percentile(hist, 99.0) / 1000.0,
+        latency_histogram_percentile(hist, 99.9) / 1000.0,
+        (0 == hist->total ? 0 : hist->max) / 1000.0);
+}
@@ -0,0 +1,34 @@
+/**
+ * \file helpers/latency_histogram/latency_histogram_record.c
+ *
+ * \brief Record a sample in a latency histogram.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "latency_histogram_internal.h"
+
+/**
+ * \brief Record a latency sample.
+ *
+ * \param hist          The histogram to update.
+ * \param value_ns      The sample, in nanoseconds.
+ */
+void latency_histogram_record(latency_histogram* hist, uint64_t value_ns)
+{
+    hist->counts[latency_histogram_bucket_index(value_ns)] += 1;
+    hist->total += 1;
+    hist->sum += value_ns;
+
+    if (value_ns < hist->min)
+    {
+        hist->min = value_ns;
+    }
+
+    if (value_ns > hist->max)
+    {
+        hist->max = value_ns;
+    }
+}
@@ -0,0 +1,46 @@
+/**
+ * \file helpers/load_stats/load_stats_add_failures.c
+ *
+ * \brief Add failures of a given kind to load stats.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "load_stats_internal.h"
+
+/**
+ * \brief Add failures of the given kind to these stats.
+ *
+ * \param stats         The stats to update.
+ * \param code          The helper error code.
+ * \param agentd_status The status reported by agentd.
+ * \param count         The number of failures to add.
+ */
+void load_stats_add_failures(
+    load_stats* stats, status code, uint32_t agentd_status, uint64_t count)
+{
+    load_failure_kind* kind;
+
+    /* look for an existing entry for this kind. */
+    for (size_t i = 0; i < stats->kind_count; ++i)
+    {
+        kind = &stats->kinds[i];
+        if (kind->code == code && kind->agentd_status == agentd_status)
+        {
+            kind->count += count;
+            return;
+        }
+    }
+
+    /* if the table is full, count these failures as untracked. */
+    if (LOAD_STATS_MAX_FAILURE_KINDS == stats->kind_count)
+    {
+        stats->untracked_failures += count;
+        return;
+    }
+
+    kind = &stats->kinds[stats->kind_count++];
+    kind->code = code;
+    kind->agentd_status = agentd_status;
+    kind->count = count;
+}
@@ -0,0 +1,23 @@
+/**
+ * \file helpers/load_stats/load_stats_init.c
+ *
+ * \brief Initialize load stats.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "load_stats_internal.h"
+
+/**
+ * \brief Initialize or reset load stats.
+ *
+ * \param stats         The stats to initialize.
+ */
+void load_stats_init(load_stats* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    latency_histogram_init(&stats->success_latency);
+    latency_histogram_init(&stats->failure_latency);
+}
@@ -0,0 +1,30 @@
+/**
+ * \file helpers/load_stats/load_stats_internal.h
+ *
+ * \brief Internal functions for load stats.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/load_stats.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Add failures of the given kind to these stats.
+ *
+ * \param stats         The stats to update.
+ * \param code          The helper error code.
+ * \param agentd_status The status reported by agentd.
+ * \param count         The number of failures to add.
+ */
+void load_stats_add_failures(
+    load_stats* stats, status code, uint32_t agentd_status, uint64_t count);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,30 @@
+/**
+ * \file helpers/load_stats/load_stats_merge.c
+ *
+ * \brief Merge one set of load stats into another.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "load_stats_internal.h"
+
+/**
+ * \brief Merge one set of load stats into another.
+ *
+ * \param dest          The stats receiving the results.
+ * \param src           The stats providing the results.
+ */
+void load_stats_merge(load_stats* dest, const load_stats* src)
+{
+    latency_histogram_merge(&dest->success_latency, &src->success_latency);
+    latency_histogram_merge(&dest->failure_latency, &src->failure_latency);
+
+    for (size_t i = 0; i < src->kind_count; ++i)
+    {
+        load_stats_add_failures(
+            dest, src->kinds[i].code, src->kinds[i].agentd_status,
+            src->kinds[i].count);
+    }
+
+    dest->untracked_failures += src->untracked_failures;
+}
@@ -0,0 +1,133 @@
+/**
+ * \file helpers/load_stats/load_stats_print.c
+ *
+ * \brief Print a summary of load stats.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "load_stats_internal.h"
+
+/* forward decls. */
+static void print_breakdown(
+    const load_stats* stats, FILE* out, const char* label, double elapsed_s,
+    bool by_agentd_status);
+
+/**
+ * \brief Print a summary of these load stats.
+ *
+ * The summary includes the success and failure latency distributions, then
+ * the failure count broken down by helper error code and by agentd status,
+ * each with its share of all requests and its rate per second.
+ *
+ * \param stats         The stats to print.
+ * \param out           The stream to which the summary is written.
+ * \param label         A label to prefix the summary.
+ * \param elapsed_s     The duration of the run, in seconds.
+ */
+void load_stats_print(
+    const load_stats* stats, FILE* out, const char* label, double elapsed_s)
+{
+    char sublabel[128];
+    uint64_t failures = stats->failure_latency.total;
+    uint64_t requests = stats->success_latency.total + failures;
+
+    snprintf(sublabel, sizeof(sublabel), "%s ok", label);
+    latency_histogram_print(&stats->success_latency, out, sublabel);
+
+    if (0 == failures)
+    {
+        return;
+    }
+
+    snprintf(sublabel, sizeof(sublabel), "%s failed", label);
+    latency_histogram_print(&stats->failure_latency, out, sublabel);
+
+    fprintf(
+        out, "%s failures: %" PRIu64 " of %" PRIu64 " (%.2f%%), %.2f/s\n",
+        label, failures, requests, 100.0 * failures / requests,
+        elapsed_s > 0.0 ? failures / elapsed_s : 0.0);
+
+    print_breakdown(stats, out, label, elapsed_s, false);
+    print_breakdown(stats, out, label, elapsed_s, true);
+
+    if (stats->untracked_failures > 0)
+    {
+        fprintf(
+            out, "%s   untracked: %" PRIu64 "\n", label,
+            stats->untracked_failures);
+    }
+}
+
+/**
+ * \brief Print the failure counts grouped by one half of the failure kind.
+ *
+ * \param stats         The stats to print.
+ * \param out           The stream to which the breakdown is written.
+ * \param label         A label to prefix the breakdown.
+ * \param elapsed_s     The duration of the run, in seconds.
+ * \param by_agentd_status  Group by agentd status if true, or by helper code
+ *                      if false.
+ */
+static void print_breakdown(
+    const load_stats* stats, FILE* out, const char* label, double elapsed_s,
+    bool by_agentd_status)
+{
+    bool printed[LOAD_STATS_MAX_FAILURE_KINDS];
+    uint64_t requests =
+        stats->success_latency.total + stats->failure_latency.total;
+
+    memset(printed, 0, sizeof(printed));
+
+    for (size_t i = 0; i < stats->kind_count; ++i)
+    {
+        uint64_t count = 0;
+        uint32_t key =
+            by_agentd_status
+                ? stats->kinds[i].agentd_status
+                : (uint32_t)stats->kinds[i].code;
+
+        if (printed[i])
+        {
+            continue;
+        }
+
+        /* sum every kind sharing this key. */
+        for (size_t j = i; j < stats->kind_count; ++j)
+        {
+            uint32_t other =
+                by_agentd_status
+                    ? stats->kinds[j].agentd_status
+                    : (uint32_t)stats->kinds[j].code;
+
+            if (other == key)
+            {
+                count += stats->kinds[j].count;
+                printed[j] = true;
+            }
+        }
+
+        if (!by_agentd_status)
+        {
+            fprintf(out, "%s   helper code %u:", label, key);
+        }
+        else if (AGENTD_STATUS_NONE == key)
+        {
+            fprintf(out, "%s   agentd status none:", label);
+        }
+        else
+        {
+            fprintf(out, "%s   agentd status %x:", label, key);
+        }
+
+        fprintf(
+            out, " %" PRIu64 " (%.2f%%), %.2f/s\n", count,
+            100.0 * count / requests,
+            elapsed_s > 0.0 ? count / elapsed_s : 0.0);
+    }
+}
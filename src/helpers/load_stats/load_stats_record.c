@@ -0,0 +1,34 @@
+/**
+ * \file helpers/load_stats/load_stats_record.c
+ *
+ * \brief Record the outcome of a request in load stats.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+
+#include "load_stats_internal.h"
+
+/**
+ * \brief Record the outcome of a request.
+ *
+ * On failure, the agentd status is taken from \ref agentd_status_last, so the
+ * caller should clear it before issuing a request that does not go through a
+ * session pool.
+ *
+ * \param stats         The stats to update.
+ * \param retval        The status returned by the request.
+ * \param latency_ns    The latency of the request, in nanoseconds.
+ */
+void load_stats_record(load_stats* stats, status retval, uint64_t latency_ns)
+{
+    if (STATUS_SUCCESS == retval)
+    {
+        latency_histogram_record(&stats->success_latency, latency_ns);
+        return;
+    }
+
+    latency_histogram_record(&stats->failure_latency, latency_ns);
+    load_stats_add_failures(stats, retval, agentd_status_last(), 1);
+}
@@ -0,0 +1,23 @@
+/**
+ * \file helpers/mpsc_queue/mpsc_queue_init.c
+ *
+ * \brief Initialize an empty queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/mpsc_queue.h>
+#include <stddef.h>
+
+/**
+ * \brief Initialize an empty queue.
+ *
+ * \param queue         The queue to initialize.
+ */
+void mpsc_queue_init(mpsc_queue* queue)
+{
+    /* the stub node keeps the queue non-empty so producers never see NULL. */
+    atomic_init(&queue->stub.next, NULL);
+    atomic_init(&queue->head, &queue->stub);
+    queue->tail = &queue->stub;
+}
@@ -0,0 +1,66 @@
+/**
+ * \file helpers/mpsc_queue/mpsc_queue_pop.c
+ *
+ * \brief Pop the oldest node from the queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/mpsc_queue.h>
+#include <stddef.h>
+
+/**
+ * \brief Pop the oldest node from the queue.
+ *
+ * This must only be called from the consumer thread. A push that has started
+ * but not yet linked its node is not visible, so NULL may be returned while a
+ * producer is mid-push; callers that know an item is coming should retry.
+ *
+ * \param queue         The queue.
+ *
+ * \returns the oldest node, or NULL if no linked node is available.
+ */
+mpsc_queue_node* mpsc_queue_pop(mpsc_queue* queue)
+{
+    mpsc_queue_node* tail = queue->tail;
+    mpsc_queue_node* next;
+
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+    /* skip over the stub node. */
+    if (&queue->stub == tail)
+    {
+        if (NULL == next)
+        {
+            return NULL;
+        }
+
+        queue->tail = next;
+        tail = next;
+        next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    }
+
+    if (NULL != next)
+    {
+        queue->tail = next;
+        return tail;
+    }
+
+    /* tail is the last linked node; a producer may be mid-push behind it. */
+    if (tail != atomic_load_explicit(&queue->head, memory_order_acquire))
+    {
+        return NULL;
+    }
+
+    /* re-insert the stub so the last real node can be handed out. */
+    mpsc_queue_push(queue, &queue->stub);
+
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if (NULL != next)
+    {
+        queue->tail = next;
+        return tail;
+    }
+
+    return NULL;
+}
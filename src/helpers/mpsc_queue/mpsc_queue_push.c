@@ -0,0 +1,29 @@
+/**
+ * \file helpers/mpsc_queue/mpsc_queue_push.c
+ *
+ * \brief Push a node onto the queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/mpsc_queue.h>
+#include <stddef.h>
+
+/**
+ * \brief Push a node onto the queue.
+ *
+ * This may be called from any number of threads at once.
+ *
+ * \param queue         The queue.
+ * \param node          The node to push.
+ */
+void mpsc_queue_push(mpsc_queue* queue, mpsc_queue_node* node)
+{
+    mpsc_queue_node* prev;
+
+    atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+
+    /* claim the head, then link the previous head to this node. */
+    prev = atomic_exchange_explicit(&queue->head, node, memory_order_acq_rel);
+    atomic_store_explicit(&prev->next, node, memory_order_release);
+}
@@ -0,0 +1,154 @@
+/**
+ * \file helpers/parallel_session/parallel_session_create.c
+ *
+ * \brief Create a parallel session and start its threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+
+#include "parallel_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a parallel session over an established session.
+ *
+ * \param ps            Pointer to the parallel session pointer to receive
+ *                      the parallel session on success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param suite         The crypto suite to use for this operation.
+ * \param session       The session, which must outlive the parallel session.
+ * \param descriptor    The session's socket descriptor, which remains owned
+ *                      by the session.
+ * \param opts          The parallel session options.
+ *
+ * \note On success, the caller owns the parallel session and must release it
+ * by calling \ref parallel_session_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_create(
+    parallel_session** ps, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, agentd_session* session, int descriptor,
+    const parallel_session_options* opts)
+{
+    status retval, release_retval;
+    parallel_session* tmp;
+    size_t ring_size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(descriptor >= 0);
+    MODEL_ASSERT(NULL != opts);
+
+    if (0 == opts->workers || 0 == opts->window || 0 == opts->max_frame_size)
+    {
+        return ERROR_PARALLEL_SESSION_SETUP;
+    }
+
+    /* allocate the parallel session. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_PARALLEL_SESSION_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->suite = suite;
+    tmp->session = session;
+    tmp->descriptor = descriptor;
+    tmp->wake_fd = -1;
+    memcpy(&tmp->opts, opts, sizeof(tmp->opts));
+    tmp->client_iv = session->client_iv;
+    tmp->server_iv = session->server_iv;
+    tmp->stats.workers = opts->workers;
+    pthread_mutex_init(&tmp->lock, NULL);
+    pthread_cond_init(&tmp->work_ready, NULL);
+    pthread_cond_init(&tmp->tx_changed, NULL);
+    pthread_cond_init(&tmp->rx_changed, NULL);
+
+    /* parallel_session_release handles partially constructed sessions. */
+    ring_size = opts->window * sizeof(parallel_session_job);
+    if (STATUS_SUCCESS !=
+            rcpr_allocator_allocate(alloc, (void**)&tmp->tx, ring_size)
+     || STATUS_SUCCESS !=
+            rcpr_allocator_allocate(alloc, (void**)&tmp->rx, ring_size)
+     || STATUS_SUCCESS !=
+            rcpr_allocator_allocate(
+                alloc, (void**)&tmp->workers,
+                opts->workers * sizeof(pthread_t)))
+    {
+        retval = ERROR_PARALLEL_SESSION_OUT_OF_MEMORY;
+        goto cleanup_session;
+    }
+
+    memset(tmp->tx, 0, ring_size);
+    memset(tmp->rx, 0, ring_size);
+
+    /* the reader polls this to learn that it should stop. */
+    tmp->wake_fd = eventfd(0, EFD_CLOEXEC);
+    if (tmp->wake_fd < 0)
+    {
+        retval = ERROR_PARALLEL_SESSION_SETUP;
+        goto cleanup_session;
+    }
+
+    tmp->start_ns = latency_clock_now_ns();
+    for (; tmp->workers_started < opts->workers; ++tmp->workers_started)
+    {
+        if (0 !=
+                pthread_create(
+                    &tmp->workers[tmp->workers_started], NULL,
+                    &parallel_session_worker_main, tmp))
+        {
+            goto fail_thread;
+        }
+    }
+
+    if (0 !=
+            pthread_create(
+                &tmp->writer, NULL, &parallel_session_writer_main, tmp))
+    {
+        goto fail_thread;
+    }
+
+    tmp->writer_started = true;
+
+    if (0 !=
+            pthread_create(
+                &tmp->reader, NULL, &parallel_session_reader_main, tmp))
+    {
+        goto fail_thread;
+    }
+
+    tmp->reader_started = true;
+
+    /* success. */
+    *ps = tmp;
+    return STATUS_SUCCESS;
+
+fail_thread:
+    fprintf(stderr, "Error starting parallel session threads.\n");
+    retval = ERROR_PARALLEL_SESSION_SETUP;
+
+cleanup_session:
+    release_retval = parallel_session_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,80 @@
+/**
+ * \file helpers/parallel_session/parallel_session_decrypt.c
+ *
+ * \brief Decrypt the response of a decrypt job.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <vcblockchain/protocol.h>
+
+#include "parallel_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Decrypt the response of a decrypt job, reclaiming its frame.
+ *
+ * \param ps            The parallel session.
+ * \param job           The job.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_decrypt(
+    parallel_session* ps, parallel_session_job* job)
+{
+    status retval, release_retval;
+    psock* sock;
+    uint64_t iv = job->iv;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != job);
+
+    retval =
+        psock_create_from_buffer(
+            &sock, ps->alloc, (const char*)job->data, job->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_data;
+    }
+
+    retval =
+        vcblockchain_protocol_recvresp(
+            sock, ps->alloc, ps->suite, &iv, &ps->session->shared_secret,
+            &job->response);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sock;
+    }
+
+    /* the reader assigned IVs one per frame; anything else is a bad frame. */
+    if (iv != job->iv + 1)
+    {
+        dispose((disposable_t*)&job->response);
+        retval = ERROR_PARALLEL_SESSION_BAD_FRAME;
+    }
+
+cleanup_sock:
+    release_retval = resource_release(psock_resource_handle(sock));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        if (STATUS_SUCCESS == retval)
+        {
+            dispose((disposable_t*)&job->response);
+        }
+
+        retval = release_retval;
+    }
+
+cleanup_data:
+    rcpr_allocator_reclaim(ps->alloc, job->data);
+    job->data = NULL;
+
+    return retval;
+}
@@ -0,0 +1,82 @@
+/**
+ * \file helpers/parallel_session/parallel_session_encrypt.c
+ *
+ * \brief Encrypt the request of an encrypt job.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "parallel_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Encrypt the request of an encrypt job.
+ *
+ * The IV of each request is assigned when it is sent, on the understanding
+ * that writing a request uses exactly one IV. A request that uses a
+ * different number fails with ERROR_PARALLEL_SESSION_BAD_FRAME, since every
+ * request after it would be encrypted with the wrong key stream.
+ *
+ * \param ps            The parallel session.
+ * \param job           The job.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_encrypt(
+    parallel_session* ps, parallel_session_job* job)
+{
+    status retval, release_retval;
+    psock* sock;
+    uint64_t iv = job->iv;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != job);
+
+    /* a buffer socket with no input collects the encrypted request. */
+    retval = psock_create_from_buffer(&sock, ps->alloc, NULL, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        job->encode(
+            sock, ps->suite, &iv, &ps->session->shared_secret, job->context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sock;
+    }
+
+    if (iv != job->iv + 1)
+    {
+        retval = ERROR_PARALLEL_SESSION_BAD_FRAME;
+        goto cleanup_sock;
+    }
+
+    retval =
+        psock_from_buffer_get_output_buffer(
+            sock, ps->alloc, &job->data, &job->size);
+
+cleanup_sock:
+    release_retval = resource_release(psock_resource_handle(sock));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        if (STATUS_SUCCESS == retval)
+        {
+            rcpr_allocator_reclaim(ps->alloc, job->data);
+            job->data = NULL;
+        }
+
+        retval = release_retval;
+    }
+
+    return retval;
+}
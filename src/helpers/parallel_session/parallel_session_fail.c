@@ -0,0 +1,32 @@
+/**
+ * \file helpers/parallel_session/parallel_session_fail.c
+ *
+ * \brief Record the first error of a parallel session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Record the first error of the session and wake every thread.
+ *
+ * The caller must hold the lock.
+ *
+ * \param ps            The parallel session.
+ * \param retval        The error.
+ */
+void parallel_session_fail(parallel_session* ps, status retval)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(STATUS_SUCCESS != retval);
+
+    if (STATUS_SUCCESS == ps->failed)
+    {
+        ps->failed = retval;
+    }
+
+    pthread_cond_broadcast(&ps->tx_changed);
+    pthread_cond_broadcast(&ps->rx_changed);
+}
@@ -0,0 +1,38 @@
+/**
+ * \file helpers/parallel_session/parallel_session_flush.c
+ *
+ * \brief Wait until every queued request has been written.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Wait until every queued request has been written.
+ *
+ * \param ps            The parallel session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code if the session has failed.
+ */
+status parallel_session_flush(parallel_session* ps)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+
+    /* the writer drains the window even after a failure. */
+    pthread_mutex_lock(&ps->lock);
+    while (ps->tx_count > 0)
+    {
+        pthread_cond_wait(&ps->tx_changed, &ps->lock);
+    }
+
+    retval = ps->failed;
+    pthread_mutex_unlock(&ps->lock);
+
+    return retval;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file helpers/parallel_session/parallel_session_frame_prefix_size.c
+ *
+ * \brief Get the size of the prefix of an authenticated frame.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Get the size of the frame prefix holding its type, size and MAC.
+ *
+ * An authenticated frame starts with its type and payload size, four bytes
+ * each, followed by the MAC of the frame and then the payload.
+ *
+ * \param ps            The parallel session.
+ *
+ * \returns the prefix size.
+ */
+size_t parallel_session_frame_prefix_size(const parallel_session* ps)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+
+    return 2 * sizeof(uint32_t) + ps->suite->mac_short_opts.mac_size;
+}
@@ -0,0 +1,83 @@
+/**
+ * \file helpers/parallel_session/parallel_session_frame_size.c
+ *
+ * \brief Get the size of an authenticated frame from its prefix.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <helpers/status_codes.h>
+#include <vccrypt/suite.h>
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Get the size of a frame from its prefix.
+ *
+ * The type and payload size at the start of a frame are encrypted with the
+ * frame's key stream, so only those eight bytes are decrypted here. The MAC
+ * and payload are left to the worker that decrypts the whole frame.
+ *
+ * \param ps            The parallel session.
+ * \param iv            The IV of the frame.
+ * \param prefix        The first \ref parallel_session_frame_prefix_size
+ *                      bytes of the frame.
+ * \param size          Pointer to receive the size of the whole frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_PARALLEL_SESSION_BAD_FRAME if the frame is too large.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_frame_size(
+    const parallel_session* ps, uint64_t iv, const void* prefix,
+    size_t* size)
+{
+    status retval;
+    vccrypt_stream_context_t stream;
+    uint32_t header[2];
+    size_t offset = 0;
+    size_t payload_size;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != prefix);
+    MODEL_ASSERT(NULL != size);
+
+    retval =
+        vccrypt_suite_stream_init(
+            ps->suite, &stream, &ps->session->shared_secret);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = vccrypt_stream_continue_decryption(&stream, &iv, sizeof(iv), 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    retval =
+        vccrypt_stream_decrypt(
+            &stream, prefix, sizeof(header), header, &offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    payload_size = ntohl(header[1]);
+    if (payload_size > ps->opts.max_frame_size)
+    {
+        retval = ERROR_PARALLEL_SESSION_BAD_FRAME;
+        goto cleanup_stream;
+    }
+
+    *size = parallel_session_frame_prefix_size(ps) + payload_size;
+
+cleanup_stream:
+    dispose((disposable_t*)&stream);
+
+    return retval;
+}
@@ -0,0 +1,32 @@
+/**
+ * \file helpers/parallel_session/parallel_session_get_stats.c
+ *
+ * \brief Get a snapshot of the parallel session counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <string.h>
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Get a snapshot of the parallel session counters.
+ *
+ * \param ps            The parallel session.
+ * \param stats         The structure to receive the counters.
+ */
+void parallel_session_get_stats(
+    parallel_session* ps, parallel_session_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != stats);
+
+    pthread_mutex_lock(&ps->lock);
+    memcpy(stats, &ps->stats, sizeof(*stats));
+    pthread_mutex_unlock(&ps->lock);
+
+    stats->elapsed_ns = latency_clock_now_ns() - ps->start_ns;
+}
@@ -0,0 +1,213 @@
+/**
+ * \file helpers/parallel_session/parallel_session_internal.h
+ *
+ * \brief Internal declarations for the parallel session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/parallel_session.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The most workers chosen by default.
+ */
+#define PARALLEL_SESSION_DEFAULT_MAX_WORKERS                    8
+
+/**
+ * \brief The default largest frame accepted from the peer.
+ */
+#define PARALLEL_SESSION_DEFAULT_MAX_FRAME_SIZE     (256 * 1024 * 1024)
+
+/**
+ * \brief Job kinds.
+ */
+#define PARALLEL_SESSION_JOB_ENCRYPT                            0
+#define PARALLEL_SESSION_JOB_DECRYPT                            1
+
+/**
+ * \brief One frame on its way through the workers.
+ *
+ * An encrypt job turns encode and context into the encrypted frame in data.
+ * A decrypt job turns the encrypted frame in data into response, and
+ * reclaims data. Either way, iv is the IV of the frame, and done is set once
+ * a worker has finished with it, with its outcome in retval.
+ */
+typedef struct parallel_session_job parallel_session_job;
+
+struct parallel_session_job
+{
+    int kind;
+    uint64_t iv;
+    session_frame_encode_fn encode;
+    void* context;
+    void* data;
+    size_t size;
+    vccrypt_buffer_t response;
+    status retval;
+    bool done;
+    parallel_session_job* next;
+};
+
+/**
+ * \brief The parallel session.
+ *
+ * tx and rx are rings of window jobs each, holding requests from the time
+ * they are sent until they are written, and responses from the time they are
+ * read until they are returned. Jobs waiting for a worker are also linked
+ * from work_head to work_tail.
+ *
+ * client_iv and server_iv are the IVs of the next request to be sent and the
+ * next response to be read. expected counts responses owed by the peer that
+ * the reader hasn't started on. failed holds the first error; once set, no
+ * further frames are written or read.
+ *
+ * Everything but the fields set at creation is guarded by lock.
+ */
+struct parallel_session
+{
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    agentd_session* session;
+    int descriptor;
+    int wake_fd;
+    parallel_session_options opts;
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t tx_changed;
+    pthread_cond_t rx_changed;
+    parallel_session_job* tx;
+    size_t tx_head;
+    size_t tx_count;
+    parallel_session_job* rx;
+    size_t rx_head;
+    size_t rx_count;
+    parallel_session_job* work_head;
+    parallel_session_job* work_tail;
+    uint64_t client_iv;
+    uint64_t server_iv;
+    uint64_t expected;
+    status failed;
+    bool closed;
+    bool stopping;
+    pthread_t* workers;
+    size_t workers_started;
+    pthread_t reader;
+    bool reader_started;
+    pthread_t writer;
+    bool writer_started;
+    uint64_t start_ns;
+    parallel_session_stats stats;
+};
+
+/**
+ * \brief Entry point for a worker thread.
+ *
+ * \param context       The parallel session.
+ *
+ * \returns NULL.
+ */
+void* parallel_session_worker_main(void* context);
+
+/**
+ * \brief Entry point for the reader thread.
+ *
+ * \param context       The parallel session.
+ *
+ * \returns NULL.
+ */
+void* parallel_session_reader_main(void* context);
+
+/**
+ * \brief Entry point for the writer thread.
+ *
+ * \param context       The parallel session.
+ *
+ * \returns NULL.
+ */
+void* parallel_session_writer_main(void* context);
+
+/**
+ * \brief Queue a job for the workers.
+ *
+ * The caller must hold the lock.
+ *
+ * \param ps            The parallel session.
+ * \param job           The job.
+ */
+void parallel_session_push_work(
+    parallel_session* ps, parallel_session_job* job);
+
+/**
+ * \brief Record the first error of the session and wake every thread.
+ *
+ * The caller must hold the lock.
+ *
+ * \param ps            The parallel session.
+ * \param retval        The error.
+ */
+void parallel_session_fail(parallel_session* ps, status retval);
+
+/**
+ * \brief Encrypt the request of an encrypt job.
+ *
+ * \param ps            The parallel session.
+ * \param job           The job.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_encrypt(
+    parallel_session* ps, parallel_session_job* job);
+
+/**
+ * \brief Decrypt the response of a decrypt job, reclaiming its frame.
+ *
+ * \param ps            The parallel session.
+ * \param job           The job.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_decrypt(
+    parallel_session* ps, parallel_session_job* job);
+
+/**
+ * \brief Get the size of the frame prefix holding its type, size and MAC.
+ *
+ * \param ps            The parallel session.
+ *
+ * \returns the prefix size.
+ */
+size_t parallel_session_frame_prefix_size(const parallel_session* ps);
+
+/**
+ * \brief Get the size of a frame from its prefix.
+ *
+ * \param ps            The parallel session.
+ * \param iv            The IV of the frame.
+ * \param prefix        The first \ref parallel_session_frame_prefix_size
+ *                      bytes of the frame.
+ * \param size          Pointer to receive the size of the whole frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_PARALLEL_SESSION_BAD_FRAME if the frame is too large.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_frame_size(
+    const parallel_session* ps, uint64_t iv, const void* prefix,
+    size_t* size);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
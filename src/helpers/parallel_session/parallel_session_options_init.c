@@ -0,0 +1,40 @@
+/**
+ * \file helpers/parallel_session/parallel_session_options_init.c
+ *
+ * \brief Initialize parallel session options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <unistd.h>
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Initialize parallel session options with their defaults.
+ *
+ * The defaults use one worker per online CPU, up to 8, keep twice as many
+ * frames in flight as there are workers, and accept frames of up to
+ * 256 MiB.
+ *
+ * \param opts          The options to initialize.
+ */
+void parallel_session_options_init(parallel_session_options* opts)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != opts);
+
+    memset(opts, 0, sizeof(*opts));
+
+    opts->workers = (cpus > 0) ? (size_t)cpus : 1;
+    if (opts->workers > PARALLEL_SESSION_DEFAULT_MAX_WORKERS)
+    {
+        opts->workers = PARALLEL_SESSION_DEFAULT_MAX_WORKERS;
+    }
+
+    opts->window = 2 * opts->workers;
+    opts->max_frame_size = PARALLEL_SESSION_DEFAULT_MAX_FRAME_SIZE;
+}
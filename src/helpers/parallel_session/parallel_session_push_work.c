@@ -0,0 +1,38 @@
+/**
+ * \file helpers/parallel_session/parallel_session_push_work.c
+ *
+ * \brief Queue a job for the workers.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Queue a job for the workers.
+ *
+ * The caller must hold the lock.
+ *
+ * \param ps            The parallel session.
+ * \param job           The job.
+ */
+void parallel_session_push_work(
+    parallel_session* ps, parallel_session_job* job)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != job);
+
+    job->next = NULL;
+    if (NULL == ps->work_tail)
+    {
+        ps->work_head = job;
+    }
+    else
+    {
+        ps->work_tail->next = job;
+    }
+
+    ps->work_tail = job;
+    pthread_cond_signal(&ps->work_ready);
+}
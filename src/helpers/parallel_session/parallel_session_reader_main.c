@@ -0,0 +1,194 @@
+/**
+ * \file helpers/parallel_session/parallel_session_reader_main.c
+ *
+ * \brief Entry point for the parallel session reader.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "parallel_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static status read_fully(parallel_session* ps, uint8_t* data, size_t size);
+
+/**
+ * \brief Entry point for the reader thread.
+ *
+ * The reader reads one frame at a time while responses are outstanding and
+ * the receive window has room, and queues each for a worker to decrypt.
+ *
+ * \param context       The parallel session.
+ *
+ * \returns NULL.
+ */
+void* parallel_session_reader_main(void* context)
+{
+    parallel_session* ps = (parallel_session*)context;
+    parallel_session_job* job;
+    status retval;
+    size_t prefix_size = parallel_session_frame_prefix_size(ps);
+    uint8_t* prefix;
+    uint8_t* frame;
+    size_t frame_size;
+    uint64_t iv;
+
+    retval = rcpr_allocator_allocate(ps->alloc, (void**)&prefix, prefix_size);
+
+    pthread_mutex_lock(&ps->lock);
+    if (STATUS_SUCCESS != retval)
+    {
+        parallel_session_fail(ps, ERROR_PARALLEL_SESSION_OUT_OF_MEMORY);
+        pthread_mutex_unlock(&ps->lock);
+        return NULL;
+    }
+
+    for (;;)
+    {
+        while (!ps->stopping && STATUS_SUCCESS == ps->failed
+            && (0 == ps->expected || ps->rx_count == ps->opts.window))
+        {
+            pthread_cond_wait(&ps->rx_changed, &ps->lock);
+        }
+
+        if (ps->stopping || STATUS_SUCCESS != ps->failed)
+        {
+            break;
+        }
+
+        iv = ps->server_iv;
+        pthread_mutex_unlock(&ps->lock);
+
+        /* the prefix gives the size of the rest of the frame. */
+        frame = NULL;
+        retval = read_fully(ps, prefix, prefix_size);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = parallel_session_frame_size(ps, iv, prefix, &frame_size);
+        }
+        if (STATUS_SUCCESS == retval)
+        {
+            retval =
+                rcpr_allocator_allocate(
+                    ps->alloc, (void**)&frame, frame_size);
+            if (STATUS_SUCCESS != retval)
+            {
+                frame = NULL;
+                retval = ERROR_PARALLEL_SESSION_OUT_OF_MEMORY;
+            }
+        }
+        if (STATUS_SUCCESS == retval)
+        {
+            memcpy(frame, prefix, prefix_size);
+            retval =
+                read_fully(
+                    ps, frame + prefix_size, frame_size - prefix_size);
+        }
+
+        pthread_mutex_lock(&ps->lock);
+        if (STATUS_SUCCESS != retval)
+        {
+            if (NULL != frame)
+            {
+                rcpr_allocator_reclaim(ps->alloc, frame);
+            }
+
+            if (ERROR_PARALLEL_SESSION_CLOSED == retval)
+            {
+                ps->closed = true;
+                pthread_cond_broadcast(&ps->rx_changed);
+            }
+            else
+            {
+                parallel_session_fail(ps, retval);
+            }
+
+            break;
+        }
+
+        job = &ps->rx[(ps->rx_head + ps->rx_count) % ps->opts.window];
+        memset(job, 0, sizeof(*job));
+        job->kind = PARALLEL_SESSION_JOB_DECRYPT;
+        job->iv = iv;
+        job->data = frame;
+        job->size = frame_size;
+        ++ps->rx_count;
+        --ps->expected;
+        ++ps->server_iv;
+        ++ps->stats.frames_received;
+        ps->stats.bytes_received += frame_size;
+        parallel_session_push_work(ps, job);
+    }
+    pthread_mutex_unlock(&ps->lock);
+
+    rcpr_allocator_reclaim(ps->alloc, prefix);
+
+    return NULL;
+}
+
+/**
+ * \brief Read exactly size bytes from the session socket.
+ *
+ * \param ps            The parallel session.
+ * \param data          The buffer to read into.
+ * \param size          The number of bytes to read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_PARALLEL_SESSION_CLOSED if the peer closed the connection or
+ *        the session is stopping.
+ *      - ERROR_PARALLEL_SESSION_IO if the read failed.
+ */
+static status read_fully(parallel_session* ps, uint8_t* data, size_t size)
+{
+    struct pollfd fds[2];
+    ssize_t received;
+
+    fds[0].fd = ps->descriptor;
+    fds[0].events = POLLIN;
+    fds[1].fd = ps->wake_fd;
+    fds[1].events = POLLIN;
+
+    while (size > 0)
+    {
+        /* wait for data or for the session to stop. */
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            return ERROR_PARALLEL_SESSION_IO;
+        }
+
+        if (0 != fds[1].revents)
+        {
+            return ERROR_PARALLEL_SESSION_CLOSED;
+        }
+
+        received = read(ps->descriptor, data, size);
+        if (received > 0)
+        {
+            data += received;
+            size -= (size_t)received;
+        }
+        else if (0 == received)
+        {
+            return ERROR_PARALLEL_SESSION_CLOSED;
+        }
+        else if (EINTR != errno && EAGAIN != errno)
+        {
+            return ERROR_PARALLEL_SESSION_IO;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file helpers/parallel_session/parallel_session_recv.c
+ *
+ * \brief Get the next response of a parallel session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Get the next response, blocking until it is decrypted.
+ *
+ * \param ps            The parallel session.
+ * \param response      The buffer to initialize with the decrypted response
+ *                      on success, which the caller must dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_PARALLEL_SESSION_CLOSED if no response is outstanding or the
+ *        peer closed the connection.
+ *      - a non-zero error code if the session has failed.
+ */
+status parallel_session_recv(
+    parallel_session* ps, vccrypt_buffer_t* response)
+{
+    status retval;
+    parallel_session_job* job;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != response);
+
+    pthread_mutex_lock(&ps->lock);
+    for (;;)
+    {
+        /* responses are returned in the order they were read. */
+        if (ps->rx_count > 0 && ps->rx[ps->rx_head].done)
+        {
+            job = &ps->rx[ps->rx_head];
+            retval = job->retval;
+            if (STATUS_SUCCESS == retval)
+            {
+                vccrypt_buffer_move(response, &job->response);
+            }
+            else
+            {
+                parallel_session_fail(ps, retval);
+            }
+
+            ps->rx_head = (ps->rx_head + 1) % ps->opts.window;
+            --ps->rx_count;
+            pthread_cond_broadcast(&ps->rx_changed);
+            break;
+        }
+
+        if (0 == ps->rx_count
+         && (0 == ps->expected || ps->closed
+          || STATUS_SUCCESS != ps->failed))
+        {
+            retval =
+                (STATUS_SUCCESS != ps->failed)
+                    ? ps->failed : ERROR_PARALLEL_SESSION_CLOSED;
+            break;
+        }
+
+        pthread_cond_wait(&ps->rx_changed, &ps->lock);
+    }
+    pthread_mutex_unlock(&ps->lock);
+
+    return retval;
+}
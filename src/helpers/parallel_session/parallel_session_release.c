@@ -0,0 +1,130 @@
+/**
+ * \file helpers/parallel_session/parallel_session_release.c
+ *
+ * \brief Release a parallel session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <unistd.h>
+
+#include "parallel_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a parallel session.
+ *
+ * Queued requests are written first. Responses that were read but not
+ * returned are discarded, and the reader stops waiting for any that are
+ * still outstanding.
+ *
+ * \param ps            The parallel session to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status parallel_session_release(parallel_session* ps)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    parallel_session_job* job;
+    uint64_t one = 1;
+    ssize_t written;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+
+    pthread_mutex_lock(&ps->lock);
+    ps->stopping = true;
+    pthread_cond_broadcast(&ps->work_ready);
+    pthread_cond_broadcast(&ps->tx_changed);
+    pthread_cond_broadcast(&ps->rx_changed);
+    pthread_mutex_unlock(&ps->lock);
+
+    /* wake the reader if it is waiting on the socket. */
+    if (ps->wake_fd >= 0)
+    {
+        written = write(ps->wake_fd, &one, sizeof(one));
+        if (sizeof(one) != written)
+        {
+            retval = ERROR_PARALLEL_SESSION_IO;
+        }
+    }
+
+    /* the writer needs the workers to finish encrypting its requests. */
+    if (ps->reader_started)
+    {
+        pthread_join(ps->reader, NULL);
+    }
+
+    if (ps->writer_started)
+    {
+        pthread_join(ps->writer, NULL);
+    }
+
+    for (size_t i = 0; i < ps->workers_started; ++i)
+    {
+        pthread_join(ps->workers[i], NULL);
+    }
+
+    /* every queued job has been run; discard unreturned responses. */
+    for (size_t i = 0; NULL != ps->rx && i < ps->rx_count; ++i)
+    {
+        job = &ps->rx[(ps->rx_head + i) % ps->opts.window];
+        if (job->done && STATUS_SUCCESS == job->retval)
+        {
+            dispose((disposable_t*)&job->response);
+        }
+    }
+
+    /* the session carries on from the IVs of the last frames. */
+    ps->session->client_iv = ps->client_iv;
+    ps->session->server_iv = ps->server_iv;
+
+    if (ps->wake_fd >= 0)
+    {
+        close(ps->wake_fd);
+    }
+
+    pthread_cond_destroy(&ps->rx_changed);
+    pthread_cond_destroy(&ps->tx_changed);
+    pthread_cond_destroy(&ps->work_ready);
+    pthread_mutex_destroy(&ps->lock);
+
+    if (NULL != ps->workers)
+    {
+        release_retval = rcpr_allocator_reclaim(ps->alloc, ps->workers);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != ps->rx)
+    {
+        release_retval = rcpr_allocator_reclaim(ps->alloc, ps->rx);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != ps->tx)
+    {
+        release_retval = rcpr_allocator_reclaim(ps->alloc, ps->tx);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = rcpr_allocator_reclaim(ps->alloc, ps);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,68 @@
+/**
+ * \file helpers/parallel_session/parallel_session_send.c
+ *
+ * \brief Queue a request on a parallel session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Queue a request, blocking while the send window is full.
+ *
+ * The request is encrypted later by a worker, so context must remain valid
+ * until \ref parallel_session_flush or \ref parallel_session_release
+ * returns.
+ *
+ * \param ps            The parallel session.
+ * \param encode        The function writing the request.
+ * \param context       The request arguments passed to encode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code if the session has failed.
+ */
+status parallel_session_send(
+    parallel_session* ps, session_frame_encode_fn encode, void* context)
+{
+    status retval;
+    parallel_session_job* job;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != ps);
+    MODEL_ASSERT(NULL != encode);
+
+    pthread_mutex_lock(&ps->lock);
+    while (STATUS_SUCCESS == ps->failed && ps->tx_count == ps->opts.window)
+    {
+        pthread_cond_wait(&ps->tx_changed, &ps->lock);
+    }
+
+    retval = ps->failed;
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* each request takes the next IV, so it can be encrypted out of turn. */
+    job = &ps->tx[(ps->tx_head + ps->tx_count) % ps->opts.window];
+    memset(job, 0, sizeof(*job));
+    job->kind = PARALLEL_SESSION_JOB_ENCRYPT;
+    job->iv = ps->client_iv++;
+    job->encode = encode;
+    job->context = context;
+    ++ps->tx_count;
+    parallel_session_push_work(ps, job);
+
+    /* the reader waits for responses to be owed. */
+    ++ps->expected;
+    pthread_cond_broadcast(&ps->rx_changed);
+
+done:
+    pthread_mutex_unlock(&ps->lock);
+
+    return retval;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file helpers/parallel_session/parallel_session_worker_main.c
+ *
+ * \brief Entry point for a parallel session worker.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "parallel_session_internal.h"
+
+/**
+ * \brief Entry point for a worker thread.
+ *
+ * Workers keep taking jobs until the session stops and no job is left, so
+ * requests sent before the session is released are still encrypted.
+ *
+ * \param context       The parallel session.
+ *
+ * \returns NULL.
+ */
+void* parallel_session_worker_main(void* context)
+{
+    parallel_session* ps = (parallel_session*)context;
+    parallel_session_job* job;
+    status retval;
+    uint64_t start;
+
+    pthread_mutex_lock(&ps->lock);
+    for (;;)
+    {
+        while (NULL == ps->work_head && !ps->stopping)
+        {
+            pthread_cond_wait(&ps->work_ready, &ps->lock);
+        }
+
+        job = ps->work_head;
+        if (NULL == job)
+        {
+            break;
+        }
+
+        ps->work_head = job->next;
+        if (NULL == ps->work_head)
+        {
+            ps->work_tail = NULL;
+        }
+
+        /* frames are independent, so the crypto runs unlocked. */
+        pthread_mutex_unlock(&ps->lock);
+        start = latency_clock_now_ns();
+        if (PARALLEL_SESSION_JOB_ENCRYPT == job->kind)
+        {
+            retval = parallel_session_encrypt(ps, job);
+        }
+        else
+        {
+            retval = parallel_session_decrypt(ps, job);
+        }
+        pthread_mutex_lock(&ps->lock);
+
+        ps->stats.crypto_ns += latency_clock_now_ns() - start;
+        job->retval = retval;
+        job->done = true;
+        pthread_cond_broadcast(
+            (PARALLEL_SESSION_JOB_ENCRYPT == job->kind)
+                ? &ps->tx_changed : &ps->rx_changed);
+    }
+    pthread_mutex_unlock(&ps->lock);
+
+    return NULL;
+}
@@ -0,0 +1,122 @@
+/**
+ * \file helpers/parallel_session/parallel_session_writer_main.c
+ *
+ * \brief Entry point for the parallel session writer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <sys/socket.h>
+
+#include "parallel_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static status write_fully(
+    parallel_session* ps, const uint8_t* data, size_t size);
+
+/**
+ * \brief Entry point for the writer thread.
+ *
+ * The writer writes requests in the order they were sent, each once its
+ * worker has encrypted it. After a failure, it keeps draining requests
+ * without writing them. It exits once the session stops and every request
+ * has been drained.
+ *
+ * \param context       The parallel session.
+ *
+ * \returns NULL.
+ */
+void* parallel_session_writer_main(void* context)
+{
+    parallel_session* ps = (parallel_session*)context;
+    parallel_session_job* job;
+    status retval;
+
+    pthread_mutex_lock(&ps->lock);
+    for (;;)
+    {
+        while (!(ps->tx_count > 0 && ps->tx[ps->tx_head].done)
+            && !(ps->stopping && 0 == ps->tx_count))
+        {
+            pthread_cond_wait(&ps->tx_changed, &ps->lock);
+        }
+
+        if (0 == ps->tx_count)
+        {
+            break;
+        }
+
+        job = &ps->tx[ps->tx_head];
+        retval = job->retval;
+        if (STATUS_SUCCESS == retval && STATUS_SUCCESS == ps->failed)
+        {
+            pthread_mutex_unlock(&ps->lock);
+            retval = write_fully(ps, job->data, job->size);
+            pthread_mutex_lock(&ps->lock);
+
+            if (STATUS_SUCCESS == retval)
+            {
+                ++ps->stats.frames_sent;
+                ps->stats.bytes_sent += job->size;
+            }
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            parallel_session_fail(ps, retval);
+        }
+
+        if (NULL != job->data)
+        {
+            rcpr_allocator_reclaim(ps->alloc, job->data);
+            job->data = NULL;
+        }
+
+        ps->tx_head = (ps->tx_head + 1) % ps->opts.window;
+        --ps->tx_count;
+        pthread_cond_broadcast(&ps->tx_changed);
+    }
+    pthread_mutex_unlock(&ps->lock);
+
+    return NULL;
+}
+
+/**
+ * \brief Write exactly size bytes to the session socket.
+ *
+ * \param ps            The parallel session.
+ * \param data          The bytes to write.
+ * \param size          The number of bytes to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_PARALLEL_SESSION_IO if the write failed.
+ */
+static status write_fully(
+    parallel_session* ps, const uint8_t* data, size_t size)
+{
+    ssize_t sent;
+
+    while (size > 0)
+    {
+        sent = send(ps->descriptor, data, size, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            return ERROR_PARALLEL_SESSION_IO;
+        }
+
+        data += sent;
+        size -= (size_t)sent;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/**
+ * \file helpers/ping_protocol/ping_protocol_sentinel_serve_request.c
+ *
+ * \brief Read and answer a single extended API request as a ping sentinel.
+ *
+ * \copyright 2022-2023 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/ping_protocol.h>
+#include <helpers/ping_protocol/verbs.h>
+#include <helpers/status_codes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+
+/**
+ * \brief Read a single extended API client request and answer it as a ping
+ * sentinel.
+ *
+ * Ping requests are answered with a success status and a payload of the given
+ * size. Requests for any other verb are answered with
+ * ERROR_READ_EXTENDED_API_INVALID_VERB.
+ *
+ * \param sock          The socket connection with agentd.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param client_iv     The client-side initialization vector counter.
+ * \param server_iv     The server-side initialization vector counter.
+ * \param shared_secret The computed shared secret for this session.
+ * \param payload_size  The size of the response payload.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status ping_protocol_sentinel_serve_request(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, uint64_t* client_iv, uint64_t* server_iv,
+    vccrypt_buffer_t* shared_secret, size_t payload_size)
+{
+    status retval;
+    vccrypt_buffer_t response, send_response;
+    vccrypt_buffer_t response_body;
+    uint32_t request_id, offset, status_code;
+    bool fail_response = false;
+    uint32_t fail_code;
+    protocol_resp_extended_api_client_request client_resp;
+
+    /* read a response from the API. */
+    retval =
+        vcblockchain_protocol_recvresp(
+            sock, alloc, suite, server_iv, shared_secret, &response);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_READ_EXTENDED_API_RESPONSE;
+        goto done;
+    }
+
+    /* decode the header. */
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &offset, &status_code, &response);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_READ_EXTENDED_API_RESPONSE_DECODE_HEADER;
+        goto cleanup_response;
+    }
+
+    /* verify that this is a client request. */
+    if (PROTOCOL_REQ_ID_EXTENDED_API_CLIENTREQ != request_id)
+    {
+        retval = ERROR_READ_EXTENDED_API_BAD_REQUEST_ID;
+        goto cleanup_response;
+    }
+
+    /* decode the client request. */
+    retval =
+        vcblockchain_protocol_decode_resp_extended_api_client_request(
+            &client_resp, suite->alloc_opts, response.data, response.size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_READ_EXTENDED_API_DECODE_RESPONSE;
+        goto cleanup_response;
+    }
+
+    /* verify the verb id. */
+    if (memcmp(&HELPERS_PING_PROTOCOL_VERB_PING, &client_resp.verb_id, 16))
+    {
+        fail_response = true;
+        fail_code = ERROR_READ_EXTENDED_API_INVALID_VERB;
+    }
+
+    /* create a dummy response body. */
+    retval =
+        vccrypt_buffer_init(&response_body, suite->alloc_opts, payload_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_READ_EXTENDED_API_OUT_OF_MEMORY;
+        goto cleanup_client_resp;
+    }
+
+    /* send the response. */
+    if (fail_response)
+    {
+        retval =
+            vcblockchain_protocol_sendreq_extended_api_response(
+                sock, suite, client_iv, shared_secret, client_resp.offset,
+                fail_code, &response_body);
+    }
+    else
+    {
+        retval =
+            vcblockchain_protocol_sendreq_extended_api_response(
+                sock, suite, client_iv, shared_secret, client_resp.offset,
+                STATUS_SUCCESS, &response_body);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_WRITE_EXTENDED_API_RESPONSE;
+        goto cleanup_response_body;
+    }
+
+    /* read a response from the API. */
+    retval =
+        vcblockchain_protocol_recvresp(
+            sock, alloc, suite, server_iv, shared_secret, &send_response);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_READ_EXTENDED_API_RESPONSE;
+        goto cleanup_response_body;
+    }
+
+    /* decode the header. */
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &offset, &status_code, &send_response);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_READ_EXTENDED_API_RESPONSE_DECODE_HEADER;
+        goto cleanup_send_response;
+    }
+
+    /* verify that this is a send response. */
+    if (PROTOCOL_REQ_ID_EXTENDED_API_SENDRESP != request_id)
+    {
+        retval = ERROR_READ_EXTENDED_API_BAD_REQUEST_ID;
+        goto cleanup_send_response;
+    }
+
+    /* either way, we are done. */
+    goto cleanup_send_response;
+
+cleanup_send_response:
+    dispose((disposable_t*)&send_response);
+
+cleanup_response_body:
+    dispose((disposable_t*)&response_body);
+
+cleanup_client_resp:
+    dispose((disposable_t*)&client_resp);
+
+cleanup_response:
+    dispose((disposable_t*)&response);
+
+done:
+    return retval;
+}
@@ -0,0 +1,173 @@
+/**
+ * \file helpers/pipeline/pipeline_create.c
+ *
+ * \brief Create a pipeline and start its threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pipeline_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a pipeline and start its threads.
+ *
+ * \param pipe          Pointer to the pipeline pointer to receive the
+ *                      pipeline on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param stages        The stages, in order.
+ * \param stage_count   The number of stages.
+ *
+ * \note On success, the caller owns the pipeline and must release it by
+ * calling \ref pipeline_release when it is no longer needed. The stage names
+ * and contexts must outlive the pipeline.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pipeline_create(
+    pipeline** pipe, RCPR_SYM(allocator)* alloc,
+    const pipeline_stage_ops* stages, size_t stage_count)
+{
+    status retval, release_retval;
+    pipeline* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pipe);
+    MODEL_ASSERT(NULL != stages);
+    MODEL_ASSERT(stage_count > 0);
+
+    /* allocate the pipeline. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_PIPELINE_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->stages, stage_count * sizeof(pipeline_stage));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_PIPELINE_OUT_OF_MEMORY;
+        goto cleanup_pipe;
+    }
+
+    memset(tmp->stages, 0, stage_count * sizeof(pipeline_stage));
+    tmp->stage_count = stage_count;
+
+    /* set up every stage before starting any thread. */
+    for (size_t i = 0; i < stage_count; ++i)
+    {
+        pipeline_stage* stage = &tmp->stages[i];
+        size_t capacity =
+            stages[i].queue_capacity > 0
+                ? stages[i].queue_capacity : PIPELINE_DEFAULT_QUEUE_CAPACITY;
+
+        stage->pipe = tmp;
+        stage->index = i;
+        memcpy(&stage->ops, &stages[i], sizeof(stage->ops));
+        atomic_init(&stage->live_threads, stages[i].threads);
+        pthread_mutex_init(&stage->stats_lock, NULL);
+        stage->stats.name = stages[i].name;
+        stage->stats.threads = stages[i].threads;
+        stage->stats.queue_capacity = capacity;
+
+        retval =
+            rcpr_allocator_allocate(
+                alloc, (void**)&stage->threads,
+                stages[i].threads * sizeof(pipeline_thread));
+        if (STATUS_SUCCESS != retval)
+        {
+            retval = ERROR_PIPELINE_OUT_OF_MEMORY;
+            goto cleanup_stages;
+        }
+
+        memset(stage->threads, 0, stages[i].threads * sizeof(pipeline_thread));
+
+        retval = pipeline_queue_init(&stage->input, alloc, capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_stages;
+        }
+    }
+
+    /* start the threads. */
+    tmp->start_ns = latency_clock_now_ns();
+    for (size_t i = 0; i < stage_count; ++i)
+    {
+        pipeline_stage* stage = &tmp->stages[i];
+
+        for (size_t j = 0; j < stage->ops.threads; ++j)
+        {
+            stage->threads[j].stage = stage;
+            stage->threads[j].index = j;
+
+            if (0 !=
+                    pthread_create(
+                        &stage->threads[j].thread, NULL, &pipeline_thread_main,
+                        &stage->threads[j]))
+            {
+                fprintf(
+                    stderr, "Error starting %s thread %zu.\n",
+                    stage->ops.name, j);
+                retval = ERROR_PIPELINE_THREAD_CREATE;
+                goto cleanup_threads;
+            }
+
+            stage->threads[j].started = true;
+        }
+    }
+
+    /* success. */
+    *pipe = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_threads:
+    /* threads that never started still count down, so every queue closes. */
+    for (size_t i = 0; i < stage_count; ++i)
+    {
+        pipeline_stage* stage = &tmp->stages[i];
+
+        for (size_t j = 0; j < stage->ops.threads; ++j)
+        {
+            if (!stage->threads[j].started
+             && 1 == atomic_fetch_sub(&stage->live_threads, 1)
+             && i + 1 < stage_count)
+            {
+                pipeline_queue_close(&tmp->stages[i + 1].input);
+            }
+        }
+    }
+
+cleanup_stages:
+    /* pipeline_release handles partially constructed pipelines. */
+    release_retval = pipeline_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    goto done;
+
+cleanup_pipe:
+    release_retval = rcpr_allocator_reclaim(alloc, tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,51 @@
+/**
+ * \file helpers/pipeline/pipeline_finish.c
+ *
+ * \brief Drain the pipeline and stop its threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Close the pipeline input, then wait for every item to pass through
+ * every stage and for every stage thread to exit.
+ *
+ * \param pipe          The pipeline.
+ */
+void pipeline_finish(pipeline* pipe)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pipe);
+
+    if (pipe->finished)
+    {
+        return;
+    }
+
+    /* each stage closes the next once its last thread exits. */
+    if (NULL != pipe->stages[0].input.items)
+    {
+        pipeline_queue_close(&pipe->stages[0].input);
+    }
+
+    for (size_t i = 0; i < pipe->stage_count; ++i)
+    {
+        pipeline_stage* stage = &pipe->stages[i];
+
+        for (size_t j = 0; NULL != stage->threads && j < stage->ops.threads;
+             ++j)
+        {
+            if (stage->threads[j].started)
+            {
+                pthread_join(stage->threads[j].thread, NULL);
+            }
+        }
+    }
+
+    pipe->end_ns = latency_clock_now_ns();
+    pipe->finished = true;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file helpers/pipeline/pipeline_get_stats.c
+ *
+ * \brief Get the counters of each stage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Get the counters of each stage.
+ *
+ * This must be called after \ref pipeline_finish.
+ *
+ * \param pipe          The pipeline.
+ * \param stats         Array of one entry per stage to receive the counters.
+ */
+void pipeline_get_stats(pipeline* pipe, pipeline_stage_stats* stats)
+{
+    uint64_t elapsed_ns = pipe->end_ns - pipe->start_ns;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pipe);
+    MODEL_ASSERT(NULL != stats);
+    MODEL_ASSERT(pipe->finished);
+
+    for (size_t i = 0; i < pipe->stage_count; ++i)
+    {
+        pipeline_stage* stage = &pipe->stages[i];
+
+        stats[i] = stage->stats;
+        stats[i].elapsed_ns = elapsed_ns;
+        stats[i].queue_mean =
+            elapsed_ns > 0 ? stage->input.occupancy_area / elapsed_ns : 0.0;
+        stats[i].queue_max = stage->input.max_count;
+    }
+}
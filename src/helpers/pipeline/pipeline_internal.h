@@ -0,0 +1,146 @@
+/**
+ * \file helpers/pipeline/pipeline_internal.h
+ *
+ * \brief Internal declarations for the staged pipeline.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/pipeline.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+typedef struct pipeline_queue pipeline_queue;
+typedef struct pipeline_stage pipeline_stage;
+typedef struct pipeline_thread pipeline_thread;
+
+/**
+ * \brief A bounded queue of items.
+ *
+ * occupancy_area is the integral of the queue depth over time, from which
+ * the time-weighted mean depth is computed.
+ */
+struct pipeline_queue
+{
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    void** items;
+    size_t capacity;
+    size_t head;
+    size_t count;
+    bool closed;
+    uint64_t last_change_ns;
+    double occupancy_area;
+    size_t max_count;
+};
+
+/**
+ * \brief A thread of a stage.
+ */
+struct pipeline_thread
+{
+    pipeline_stage* stage;
+    size_t index;
+    pthread_t thread;
+    bool started;
+};
+
+/**
+ * \brief A stage, its input queue, and its threads.
+ *
+ * live_threads counts the threads still running; the last one to exit closes
+ * the input queue of the next stage.
+ */
+struct pipeline_stage
+{
+    pipeline* pipe;
+    size_t index;
+    pipeline_stage_ops ops;
+    pipeline_queue input;
+    pipeline_thread* threads;
+    atomic_size_t live_threads;
+    pthread_mutex_t stats_lock;
+    pipeline_stage_stats stats;
+};
+
+struct pipeline
+{
+    RCPR_SYM(allocator)* alloc;
+    pipeline_stage* stages;
+    size_t stage_count;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    bool finished;
+};
+
+/**
+ * \brief Entry point for a stage thread.
+ *
+ * \param context       The \ref pipeline_thread for this thread.
+ *
+ * \returns NULL.
+ */
+void* pipeline_thread_main(void* context);
+
+/**
+ * \brief Initialize a bounded queue.
+ *
+ * \param queue         The queue to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param capacity      The maximum number of queued items.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pipeline_queue_init(
+    pipeline_queue* queue, RCPR_SYM(allocator)* alloc, size_t capacity);
+
+/**
+ * \brief Push an item, blocking while the queue is full.
+ *
+ * \param queue         The queue.
+ * \param item          The item to push.
+ *
+ * \returns the time spent waiting for room, in nanoseconds.
+ */
+uint64_t pipeline_queue_push(pipeline_queue* queue, void* item);
+
+/**
+ * \brief Pop an item, blocking while the queue is empty and open.
+ *
+ * \param queue         The queue.
+ * \param stall_ns      Pointer to receive the time spent waiting, in
+ *                      nanoseconds.
+ *
+ * \returns the item, or NULL once the queue is closed and empty.
+ */
+void* pipeline_queue_pop(pipeline_queue* queue, uint64_t* stall_ns);
+
+/**
+ * \brief Close a queue, waking every thread waiting on it.
+ *
+ * \param queue         The queue.
+ */
+void pipeline_queue_close(pipeline_queue* queue);
+
+/**
+ * \brief Release a queue.
+ *
+ * \param queue         The queue.
+ * \param alloc         The allocator used to initialize the queue.
+ */
+void pipeline_queue_dispose(
+    pipeline_queue* queue, RCPR_SYM(allocator)* alloc);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,78 @@
+/**
+ * \file helpers/pipeline/pipeline_print_stats.c
+ *
+ * \brief Print a table of stage counters and name the bottleneck.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/pipeline.h>
+#include <inttypes.h>
+
+/* forward decls. */
+static double share(uint64_t ns, const pipeline_stage_stats* stats);
+
+/**
+ * \brief Print a table of stage counters and name the bottleneck.
+ *
+ * The bottleneck is the stage whose threads were busy for the largest share
+ * of the run.
+ *
+ * \param stats         The stage counters.
+ * \param stage_count   The number of stages.
+ * \param out           The stream to print to.
+ */
+void pipeline_print_stats(
+    const pipeline_stage_stats* stats, size_t stage_count, FILE* out)
+{
+    size_t bottleneck = 0;
+    double elapsed_s;
+
+    fprintf(
+        out, "%-12s %7s %10s %8s %10s %6s %9s %10s %18s\n", "stage",
+        "threads", "items", "failed", "items/s", "busy%", "in-stall%",
+        "out-stall%", "queue mean/max/cap");
+
+    for (size_t i = 0; i < stage_count; ++i)
+    {
+        elapsed_s = stats[i].elapsed_ns / 1e9;
+
+        fprintf(
+            out,
+            "%-12s %7zu %10" PRIu64 " %8" PRIu64 " %10.0f %6.1f %9.1f %10.1f"
+            " %8.1f/%zu/%zu\n",
+            stats[i].name, stats[i].threads, stats[i].items,
+            stats[i].failures,
+            elapsed_s > 0 ? stats[i].items / elapsed_s : 0.0,
+            share(stats[i].busy_ns, &stats[i]),
+            share(stats[i].input_stall_ns, &stats[i]),
+            share(stats[i].output_stall_ns, &stats[i]), stats[i].queue_mean,
+            stats[i].queue_max, stats[i].queue_capacity);
+
+        if (share(stats[i].busy_ns, &stats[i])
+                > share(stats[bottleneck].busy_ns, &stats[bottleneck]))
+        {
+            bottleneck = i;
+        }
+    }
+
+    fprintf(
+        out, "bottleneck: %s (%.1f%% busy)\n", stats[bottleneck].name,
+        share(stats[bottleneck].busy_ns, &stats[bottleneck]));
+}
+
+/**
+ * \brief Express a time summed over a stage's threads as a share of the
+ * run.
+ *
+ * \param ns            The time summed over the stage's threads.
+ * \param stats         The stage counters.
+ *
+ * \returns the share, in percent.
+ */
+static double share(uint64_t ns, const pipeline_stage_stats* stats)
+{
+    double capacity = (double)stats->elapsed_ns * stats->threads;
+
+    return capacity > 0 ? 100.0 * ns / capacity : 0.0;
+}
@@ -0,0 +1,25 @@
+/**
+ * \file helpers/pipeline/pipeline_push.c
+ *
+ * \brief Push an item into the first stage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Push an item into the first stage, blocking while its queue is
+ * full.
+ *
+ * \param pipe          The pipeline.
+ * \param item          The item to push.
+ */
+void pipeline_push(pipeline* pipe, void* item)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pipe);
+    MODEL_ASSERT(!pipe->finished);
+
+    (void)pipeline_queue_push(&pipe->stages[0].input, item);
+}
@@ -0,0 +1,25 @@
+/**
+ * \file helpers/pipeline/pipeline_queue_close.c
+ *
+ * \brief Close a queue, waking every thread waiting on it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Close a queue, waking every thread waiting on it.
+ *
+ * \param queue         The queue.
+ */
+void pipeline_queue_close(pipeline_queue* queue)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+
+    pthread_mutex_lock(&queue->lock);
+    queue->closed = true;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_mutex_unlock(&queue->lock);
+}
@@ -0,0 +1,35 @@
+/**
+ * \file helpers/pipeline/pipeline_queue_dispose.c
+ *
+ * \brief Release a queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "pipeline_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a queue.
+ *
+ * \param queue         The queue.
+ * \param alloc         The allocator used to initialize the queue.
+ */
+void pipeline_queue_dispose(
+    pipeline_queue* queue, RCPR_SYM(allocator)* alloc)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+
+    if (NULL == queue->items)
+    {
+        return;
+    }
+
+    pthread_cond_destroy(&queue->not_full);
+    pthread_cond_destroy(&queue->not_empty);
+    pthread_mutex_destroy(&queue->lock);
+    (void)rcpr_allocator_reclaim(alloc, queue->items);
+    queue->items = NULL;
+}
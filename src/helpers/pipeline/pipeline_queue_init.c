@@ -0,0 +1,54 @@
+/**
+ * \file helpers/pipeline/pipeline_queue_init.c
+ *
+ * \brief Initialize a bounded queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "pipeline_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Initialize a bounded queue.
+ *
+ * \param queue         The queue to initialize.
+ * \param alloc         The allocator to use for this operation.
+ * \param capacity      The maximum number of queued items.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pipeline_queue_init(
+    pipeline_queue* queue, RCPR_SYM(allocator)* alloc, size_t capacity)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(capacity > 0);
+
+    memset(queue, 0, sizeof(*queue));
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&queue->items, capacity * sizeof(void*));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_PIPELINE_OUT_OF_MEMORY;
+    }
+
+    queue->capacity = capacity;
+    queue->last_change_ns = latency_clock_now_ns();
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->not_empty, NULL);
+    pthread_cond_init(&queue->not_full, NULL);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,63 @@
+/**
+ * \file helpers/pipeline/pipeline_queue_pop.c
+ *
+ * \brief Pop an item, blocking while the queue is empty and open.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Pop an item, blocking while the queue is empty and open.
+ *
+ * \param queue         The queue.
+ * \param stall_ns      Pointer to receive the time spent waiting, in
+ *                      nanoseconds.
+ *
+ * \returns the item, or NULL once the queue is closed and empty.
+ */
+void* pipeline_queue_pop(pipeline_queue* queue, uint64_t* stall_ns)
+{
+    void* item = NULL;
+    uint64_t start, now;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(NULL != stall_ns);
+
+    *stall_ns = 0;
+
+    pthread_mutex_lock(&queue->lock);
+
+    if (0 == queue->count && !queue->closed)
+    {
+        start = latency_clock_now_ns();
+        while (0 == queue->count && !queue->closed)
+        {
+            pthread_cond_wait(&queue->not_empty, &queue->lock);
+        }
+        *stall_ns = latency_clock_now_ns() - start;
+    }
+
+    if (queue->count > 0)
+    {
+        /* account for the time spent at the old depth. */
+        now = latency_clock_now_ns();
+        queue->occupancy_area +=
+            (double)queue->count * (now - queue->last_change_ns);
+        queue->last_change_ns = now;
+
+        item = queue->items[queue->head];
+        queue->head = (queue->head + 1) % queue->capacity;
+        queue->count -= 1;
+
+        pthread_cond_signal(&queue->not_full);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return item;
+}
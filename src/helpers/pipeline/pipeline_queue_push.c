@@ -0,0 +1,58 @@
+/**
+ * \file helpers/pipeline/pipeline_queue_push.c
+ *
+ * \brief Push an item, blocking while the queue is full.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Push an item, blocking while the queue is full.
+ *
+ * \param queue         The queue.
+ * \param item          The item to push.
+ *
+ * \returns the time spent waiting for room, in nanoseconds.
+ */
+uint64_t pipeline_queue_push(pipeline_queue* queue, void* item)
+{
+    uint64_t stall_ns = 0, start, now;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(NULL != item);
+
+    pthread_mutex_lock(&queue->lock);
+
+    if (queue->count == queue->capacity)
+    {
+        start = latency_clock_now_ns();
+        while (queue->count == queue->capacity)
+        {
+            pthread_cond_wait(&queue->not_full, &queue->lock);
+        }
+        stall_ns = latency_clock_now_ns() - start;
+    }
+
+    /* account for the time spent at the old depth. */
+    now = latency_clock_now_ns();
+    queue->occupancy_area +=
+        (double)queue->count * (now - queue->last_change_ns);
+    queue->last_change_ns = now;
+
+    queue->items[(queue->head + queue->count) % queue->capacity] = item;
+    queue->count += 1;
+    if (queue->count > queue->max_count)
+    {
+        queue->max_count = queue->count;
+    }
+
+    pthread_cond_signal(&queue->not_empty);
+    pthread_mutex_unlock(&queue->lock);
+
+    return stall_ns;
+}
@@ -0,0 +1,70 @@
+/**
+ * \file helpers/pipeline/pipeline_release.c
+ *
+ * \brief Release a pipeline.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "pipeline_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a pipeline.
+ *
+ * If \ref pipeline_finish has not been called, it is called first.
+ *
+ * \param pipe          The pipeline to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status pipeline_release(pipeline* pipe)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = pipe->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pipe);
+
+    pipeline_finish(pipe);
+
+    for (size_t i = 0; i < pipe->stage_count; ++i)
+    {
+        pipeline_stage* stage = &pipe->stages[i];
+
+        /* stages past the point of failure in create were never set up. */
+        if (NULL == stage->pipe)
+        {
+            continue;
+        }
+
+        pipeline_queue_dispose(&stage->input, alloc);
+        pthread_mutex_destroy(&stage->stats_lock);
+
+        if (NULL != stage->threads)
+        {
+            release_retval = rcpr_allocator_reclaim(alloc, stage->threads);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, pipe->stages);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, pipe);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,107 @@
+/**
+ * \file helpers/pipeline/pipeline_thread_main.c
+ *
+ * \brief Entry point for a stage thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/latency_histogram.h>
+#include <stdio.h>
+
+#include "pipeline_internal.h"
+
+/**
+ * \brief Entry point for a stage thread.
+ *
+ * \param context       The \ref pipeline_thread for this thread.
+ *
+ * \returns NULL.
+ */
+void* pipeline_thread_main(void* context)
+{
+    pipeline_thread* thread = (pipeline_thread*)context;
+    pipeline_stage* stage = thread->stage;
+    pipeline* pipe = stage->pipe;
+    pipeline_stage* next =
+        stage->index + 1 < pipe->stage_count
+            ? &pipe->stages[stage->index + 1] : NULL;
+    const pipeline_stage_ops* ops = &stage->ops;
+    pipeline_stage_stats local = { 0 };
+    void* state = NULL;
+    void* item;
+    void* out;
+    bool ready = true;
+    uint64_t stall_ns, start;
+    status retval;
+
+    if (NULL != ops->thread_init
+     && STATUS_SUCCESS
+            != ops->thread_init(ops->context, thread->index, &state))
+    {
+        fprintf(
+            stderr, "Error setting up %s thread %zu.\n", ops->name,
+            thread->index);
+        ready = false;
+    }
+
+    while (NULL != (item = pipeline_queue_pop(&stage->input, &stall_ns)))
+    {
+        local.input_stall_ns += stall_ns;
+
+        /* a thread that could not be set up still drains its input. */
+        if (!ready)
+        {
+            local.failures += 1;
+            if (NULL != ops->discard)
+            {
+                ops->discard(ops->context, item);
+            }
+
+            continue;
+        }
+
+        out = NULL;
+        start = latency_clock_now_ns();
+        retval = ops->process(ops->context, state, item, &out);
+        local.busy_ns += latency_clock_now_ns() - start;
+
+        if (STATUS_SUCCESS != retval)
+        {
+            local.failures += 1;
+            continue;
+        }
+
+        local.items += 1;
+
+        if (NULL != out && NULL != next)
+        {
+            local.output_stall_ns += pipeline_queue_push(&next->input, out);
+        }
+        else if (NULL != out && NULL != ops->discard)
+        {
+            ops->discard(ops->context, out);
+        }
+    }
+
+    if (ready && NULL != ops->thread_dispose)
+    {
+        ops->thread_dispose(ops->context, state);
+    }
+
+    pthread_mutex_lock(&stage->stats_lock);
+    stage->stats.items += local.items;
+    stage->stats.failures += local.failures;
+    stage->stats.busy_ns += local.busy_ns;
+    stage->stats.input_stall_ns += local.input_stall_ns;
+    stage->stats.output_stall_ns += local.output_stall_ns;
+    pthread_mutex_unlock(&stage->stats_lock);
+
+    /* the last thread out closes the next stage's input. */
+    if (1 == atomic_fetch_sub(&stage->live_threads, 1) && NULL != next)
+    {
+        pipeline_queue_close(&next->input);
+    }
+
+    return NULL;
+}
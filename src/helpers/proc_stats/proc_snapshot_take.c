@@ -0,0 +1,240 @@
+/**
+ * \file helpers/proc_stats/proc_snapshot_take.c
+ *
+ * \brief Take a resource usage snapshot of processes with a given name.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <ctype.h>
+#include <dirent.h>
+#include <helpers/proc_stats.h>
+#include <helpers/status_codes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* forward decls. */
+static bool read_cmdline(pid_t pid, const char* name, proc_info* info);
+static void read_stat(pid_t pid, proc_info* info);
+static void read_rss(pid_t pid, proc_info* info);
+static void read_fd_count(pid_t pid, proc_info* info);
+
+/**
+ * \brief Take a snapshot of every process with the given name.
+ *
+ * A process matches if the final path component of its argv[0] equals name.
+ * Processes that exit while the snapshot is taken are skipped. Reading fd
+ * counts requires permission to list /proc/PID/fd; processes for which this
+ * is denied are reported with an fd count of zero.
+ *
+ * \param snapshot      The snapshot to populate.
+ * \param name          The process name to match, e.g. "agentd".
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status proc_snapshot_take(proc_snapshot* snapshot, const char* name)
+{
+    DIR* proc;
+    struct dirent* ent;
+    proc_info* info;
+    pid_t pid;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != snapshot);
+    MODEL_ASSERT(NULL != name);
+
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    proc = opendir("/proc");
+    if (NULL == proc)
+    {
+        fprintf(stderr, "Error opening /proc.\n");
+        return ERROR_PROC_STATS_OPEN;
+    }
+
+    while (NULL != (ent = readdir(proc))
+        && snapshot->count < PROC_SNAPSHOT_MAX_PROCESSES)
+    {
+        /* only numeric entries are processes. */
+        if (!isdigit((unsigned char)ent->d_name[0]))
+        {
+            continue;
+        }
+
+        pid = (pid_t)atoi(ent->d_name);
+        if (pid == getpid())
+        {
+            continue;
+        }
+
+        info = &snapshot->procs[snapshot->count];
+        memset(info, 0, sizeof(*info));
+        info->pid = pid;
+
+        if (!read_cmdline(pid, name, info))
+        {
+            continue;
+        }
+
+        read_stat(pid, info);
+        read_rss(pid, info);
+        read_fd_count(pid, info);
+
+        snapshot->total_rss_bytes += info->rss_bytes;
+        snapshot->total_fds += info->fd_count;
+        snapshot->count += 1;
+    }
+
+    closedir(proc);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the command line of a process and check its name.
+ *
+ * \param pid           The process to read.
+ * \param name          The process name to match.
+ * \param info          The process info receiving the command line.
+ *
+ * \returns true if the process name matches, and false otherwise.
+ */
+static bool read_cmdline(pid_t pid, const char* name, proc_info* info)
+{
+    char path[64];
+    FILE* f;
+    size_t len;
+    const char* base;
+
+    snprintf(path, sizeof(path), "/proc/%d/cmdline", (int)pid);
+    f = fopen(path, "r");
+    if (NULL == f)
+    {
+        return false;
+    }
+
+    len = fread(info->cmdline, 1, sizeof(info->cmdline) - 1, f);
+    fclose(f);
+    info->cmdline[len] = 0;
+
+    /* argv[0] ends at the first NUL. */
+    base = strrchr(info->cmdline, '/');
+    base = (NULL == base) ? info->cmdline : base + 1;
+    if (strcmp(base, name))
+    {
+        return false;
+    }
+
+    /* make the remaining arguments printable. */
+    for (size_t i = 0; i < len; ++i)
+    {
+        if (0 == info->cmdline[i])
+        {
+            info->cmdline[i] = ' ';
+        }
+    }
+
+    while (len > 0 && ' ' == info->cmdline[len - 1])
+    {
+        info->cmdline[--len] = 0;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Read the parent pid of a process.
+ *
+ * \param pid           The process to read.
+ * \param info          The process info receiving the parent pid.
+ */
+static void read_stat(pid_t pid, proc_info* info)
+{
+    char path[64];
+    char buf[512];
+    FILE* f;
+    size_t len;
+    const char* rparen;
+    char state;
+    int ppid;
+
+    snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+    f = fopen(path, "r");
+    if (NULL == f)
+    {
+        return;
+    }
+
+    len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = 0;
+
+    /* the command name may contain spaces, so parse after the last paren. */
+    rparen = strrchr(buf, ')');
+    if (NULL != rparen && 2 == sscanf(rparen + 1, " %c %d", &state, &ppid))
+    {
+        info->ppid = (pid_t)ppid;
+    }
+}
+
+/**
+ * \brief Read the resident set size of a process.
+ *
+ * \param pid           The process to read.
+ * \param info          The process info receiving the resident set size.
+ */
+static void read_rss(pid_t pid, proc_info* info)
+{
+    char path[64];
+    FILE* f;
+    unsigned long long size, resident;
+
+    snprintf(path, sizeof(path), "/proc/%d/statm", (int)pid);
+    f = fopen(path, "r");
+    if (NULL == f)
+    {
+        return;
+    }
+
+    if (2 == fscanf(f, "%llu %llu", &size, &resident))
+    {
+        info->rss_bytes = resident * (uint64_t)sysconf(_SC_PAGESIZE);
+    }
+
+    fclose(f);
+}
+
+/**
+ * \brief Count the open file descriptors of a process.
+ *
+ * \param pid           The process to read.
+ * \param info          The process info receiving the fd count.
+ */
+static void read_fd_count(pid_t pid, proc_info* info)
+{
+    char path[64];
+    DIR* dir;
+    struct dirent* ent;
+
+    snprintf(path, sizeof(path), "/proc/%d/fd", (int)pid);
+    dir = opendir(path);
+    if (NULL == dir)
+    {
+        return;
+    }
+
+    while (NULL != (ent = readdir(dir)))
+    {
+        if ('.' != ent->d_name[0])
+        {
+            info->fd_count += 1;
+        }
+    }
+
+    closedir(dir);
+}
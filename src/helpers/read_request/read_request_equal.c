@@ -0,0 +1,44 @@
+/**
+ * \file helpers/read_request/read_request_equal.c
+ *
+ * \brief Compare two read requests.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/read_request.h>
+#include <string.h>
+
+/**
+ * \brief Determine whether two requests ask for the same thing.
+ *
+ * Only the fields used by the request type are compared.
+ *
+ * \param lhs               The first request.
+ * \param rhs               The second request.
+ *
+ * \returns true if the requests are identical.
+ */
+bool read_request_equal(const read_request* lhs, const read_request* rhs)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != lhs);
+    MODEL_ASSERT(NULL != rhs);
+
+    if (lhs->type != rhs->type)
+    {
+        return false;
+    }
+
+    switch (lhs->type)
+    {
+        case READ_REQUEST_LATEST_BLOCK_ID_GET:
+            return true;
+
+        case READ_REQUEST_BLOCK_ID_BY_HEIGHT_GET:
+            return lhs->height == rhs->height;
+
+        default:
+            return 0 == memcmp(&lhs->id, &rhs->id, sizeof(lhs->id));
+    }
+}
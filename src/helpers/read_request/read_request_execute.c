@@ -0,0 +1,142 @@
+/**
+ * \file helpers/read_request/read_request_execute.c
+ *
+ * \brief Execute a read request on a session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/conn_helpers.h>
+#include <helpers/read_request.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * \brief Execute a read request on the given session.
+ *
+ * \param session           The session on which this request is executed.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param req               The request to execute.
+ * \param result            The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status read_request_execute(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const read_request* req,
+    read_result* result)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != result);
+
+    memset(result, 0, sizeof(*result));
+
+    switch (req->type)
+    {
+        case READ_REQUEST_BLOCK_GET:
+            retval =
+                get_and_verify_block(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->cert, &result->prev_id, &result->next_id);
+            result->has_cert = (STATUS_SUCCESS == retval);
+            break;
+
+        case READ_REQUEST_TXN_GET:
+            retval =
+                get_and_verify_txn(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->cert, &result->prev_id, &result->next_id,
+                    &result->artifact_id, &result->block_id);
+            result->has_cert = (STATUS_SUCCESS == retval);
+            break;
+
+        case READ_REQUEST_LATEST_BLOCK_ID_GET:
+            retval =
+                get_and_verify_last_block_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_NEXT_BLOCK_ID_GET:
+            retval =
+                get_and_verify_next_block_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_PREV_BLOCK_ID_GET:
+            retval =
+                get_and_verify_prev_block_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_BLOCK_ID_BY_HEIGHT_GET:
+            retval =
+                get_and_verify_block_id_by_height(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, req->height,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_NEXT_TXN_ID_GET:
+            retval =
+                get_and_verify_next_txn_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_PREV_TXN_ID_GET:
+            retval =
+                get_and_verify_prev_txn_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_TXN_BLOCK_ID_GET:
+            retval =
+                get_and_verify_txn_block_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_ARTIFACT_FIRST_TXN_ID_GET:
+            retval =
+                get_and_verify_artifact_first_txn_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        case READ_REQUEST_ARTIFACT_LAST_TXN_ID_GET:
+            retval =
+                get_and_verify_artifact_last_txn_id(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, &req->id,
+                    &result->id);
+            break;
+
+        default:
+            fprintf(stderr, "Unknown read request type (%x).\n", req->type);
+            retval = ERROR_READ_REQUEST_INVALID_TYPE;
+            break;
+    }
+
+    return retval;
+}
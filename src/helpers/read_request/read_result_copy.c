@@ -0,0 +1,50 @@
+/**
+ * \file helpers/read_request/read_result_copy.c
+ *
+ * \brief Copy a read result.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/read_request.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+
+/**
+ * \brief Copy a read result, duplicating its certificate buffer.
+ *
+ * \param dest              The uninitialized result receiving the copy. On
+ *                          success, the caller owns it and must release it
+ *                          by calling \ref read_result_dispose.
+ * \param src               The result to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_READ_RESULT_OUT_OF_MEMORY if the buffer could not be copied.
+ */
+status read_result_copy(read_result* dest, const read_result* src)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != dest);
+    MODEL_ASSERT(NULL != src);
+
+    memcpy(dest, src, sizeof(*dest));
+    if (!src->has_cert)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        vccrypt_buffer_init(&dest->cert, src->cert.alloc_opts, src->cert.size);
+    if (STATUS_SUCCESS != retval)
+    {
+        dest->has_cert = false;
+        return ERROR_READ_RESULT_OUT_OF_MEMORY;
+    }
+
+    memcpy(dest->cert.data, src->cert.data, src->cert.size);
+
+    return STATUS_SUCCESS;
+}
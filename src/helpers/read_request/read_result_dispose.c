@@ -0,0 +1,26 @@
+/**
+ * \file helpers/read_request/read_result_dispose.c
+ *
+ * \brief Dispose of a read result.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/read_request.h>
+
+/**
+ * \brief Release any buffer owned by a read result.
+ *
+ * \param result            The result to dispose.
+ */
+void read_result_dispose(read_result* result)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != result);
+
+    if (result->has_cert)
+    {
+        dispose((disposable_t*)&result->cert);
+        result->has_cert = false;
+    }
+}
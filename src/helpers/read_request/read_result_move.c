@@ -0,0 +1,37 @@
+/**
+ * \file helpers/read_request/read_result_move.c
+ *
+ * \brief Move a read result.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/read_request.h>
+#include <string.h>
+
+/**
+ * \brief Move a read result from one location to another.
+ *
+ * \param dest              The uninitialized result receiving the value.
+ * \param src               The result whose value is moved.
+ */
+void read_result_move(read_result* dest, read_result* src)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != dest);
+    MODEL_ASSERT(NULL != src);
+
+    memcpy(&dest->id, &src->id, sizeof(dest->id));
+    memcpy(&dest->prev_id, &src->prev_id, sizeof(dest->prev_id));
+    memcpy(&dest->next_id, &src->next_id, sizeof(dest->next_id));
+    memcpy(&dest->artifact_id, &src->artifact_id, sizeof(dest->artifact_id));
+    memcpy(&dest->block_id, &src->block_id, sizeof(dest->block_id));
+
+    /* only the certificate buffer has ownership to transfer. */
+    dest->has_cert = src->has_cert;
+    if (src->has_cert)
+    {
+        vccrypt_buffer_move(&dest->cert, &src->cert);
+        src->has_cert = false;
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ * \file helpers/recv_and_verify_ping_response.c
+ *
+ * \brief Receive and verify the extended api ping response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <vcblockchain/protocol.h>
+
+/**
+ * \brief Receive and verify the response to an extended api ping request.
+ *
+ * \param sock              The socket connection with agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param server_iv         The server-side initialization vector counter.
+ * \param shared_secret     The computed shared secret for this session.
+ * \param offset            The offset used for the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status recv_and_verify_ping_response(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    vccrypt_buffer_t* shared_secret, uint32_t offset)
+{
+    status retval;
+    vccrypt_buffer_t ping_request_response;
+
+    /* get the response. */
+    retval =
+        vcblockchain_protocol_recvresp(
+            sock, alloc, suite, server_iv, shared_secret,
+            &ping_request_response);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Failed to receive extended api ping response.\n");
+        retval = ERROR_PING_RESPONSE_RECEIVE;
+        goto done;
+    }
+
+    /* verify the response. */
+    retval = verify_ping_response(suite, &ping_request_response, offset);
+    dispose((disposable_t*)&ping_request_response);
+
+done:
+    return retval;
+}
@@ -6,6 +6,7 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <helpers/agentd_status.h>
 #include <helpers/conn_helpers.h>
 #include <helpers/status_codes.h>
 #include <stdio.h>
@@ -95,6 +96,7 @@ status send_and_verify_enable_extended_api(
     /* verify that the status was successful. */
     if (STATUS_SUCCESS != status)
     {
+        agentd_status_record(status);
         fprintf(
             stderr, "Unexpected extended api enable status (%x).\n", status);
         retval = ERROR_EXTENDED_API_ENABLE_STATUS;
@@ -11,8 +11,6 @@
 #include <helpers/status_codes.h>
 #include <stdio.h>
 #include <string.h>
-#include <vcblockchain/protocol.h>
-#include <vcblockchain/protocol/serialization.h>
 
 /**
  * \brief Send an extended api ping protocol request and response.
@@ -38,9 +36,6 @@ status send_and_verify_ping_request(
     const vpr_uuid* ping_sentinel_id, size_t payload_size)
 {
     status retval;
-    vccrypt_buffer_t ping_request_response;
-    uint32_t request_id, resp_offset, status_code;
-    protocol_resp_extended_api ping_resp;
     vccrypt_buffer_t payload;
 
     /* create the ping payload */
@@ -64,85 +59,10 @@ status send_and_verify_ping_request(
         goto cleanup_payload;
     }
 
-    /* get the response. */
+    /* get and verify the response. */
     retval =
-        vcblockchain_protocol_recvresp(
-            sock, alloc, suite, server_iv, shared_secret,
-            &ping_request_response);
-    if (STATUS_SUCCESS != retval)
-    {
-        fprintf(stderr, "Failed to receive extended api ping response.\n");
-        retval = ERROR_PING_RESPONSE_RECEIVE;
-        goto cleanup_payload;
-    }
-
-    /* decode the response header. */
-    retval =
-        vcblockchain_protocol_response_decode_header(
-            &request_id, &resp_offset, &status_code, &ping_request_response);
-    if (STATUS_SUCCESS != retval)
-    {
-        fprintf(stderr, "Error decoding extended api ping response.\n");
-        retval = ERROR_PING_RESPONSE_DECODE_HEADER;
-        goto cleanup_buffer;
-    }
-
-    /* verify that the request id matches. */
-    if (PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV != request_id)
-    {
-        fprintf(
-            stderr, "Unexpected extended api ping response id (%x).\n",
-            request_id);
-        retval = ERROR_PING_RESPONSE_ID;
-    }
-
-    /* verify that the status was successful. */
-    if (STATUS_SUCCESS != status_code)
-    {
-        fprintf(
-            stderr, "Unexpected extended api ping response status (%x).\n",
-            status_code);
-        retval = ERROR_PING_RESPONSE_STATUS_CODE;
-    }
-
-    /* verify that the offset is correct. */
-    if (offset != resp_offset)
-    {
-        fprintf(
-            stderr, "Unexpected extended api ping response offset (%x).\n",
-            resp_offset);
-        retval = ERROR_PING_RESPONSE_OFFSET;
-    }
-
-    /* if we failed one of the checks above, error out. */
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_buffer;
-    }
-
-    /* decode the response. */
-    retval =
-        vcblockchain_protocol_decode_resp_extended_api(
-            &ping_resp, suite->alloc_opts, ping_request_response.data,
-            ping_request_response.size);
-    if (STATUS_SUCCESS != retval)
-    {
-        fprintf(
-            stderr, "Could not decode extended api ping response (%x).\n",
-            retval);
-        retval = ERROR_PING_RESPONSE_DECODE;
-        goto cleanup_buffer;
-    }
-
-    /* success. */
-    retval = STATUS_SUCCESS;
-    goto cleanup_response;
-
-cleanup_response:
-    dispose((disposable_t*)&ping_resp);
-
-cleanup_buffer:
-    dispose((disposable_t*)&ping_request_response);
+        recv_and_verify_ping_response(
+            sock, alloc, suite, server_iv, shared_secret, offset);
 
 cleanup_payload:
     dispose(&payload.hdr);
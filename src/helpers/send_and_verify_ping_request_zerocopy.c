@@ -0,0 +1,119 @@
+/**
+ * \file helpers/send_and_verify_ping_request_zerocopy.c
+ *
+ * \brief Send the extended api ping request through a zero-copy sender and
+ * verify the response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/conn_helpers.h>
+#include <helpers/ping_protocol.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Send an extended api ping protocol request through a zero-copy
+ * sender and verify the response.
+ *
+ * The request is encrypted into a frame allocated with alloc, which is handed
+ * to the sender; the sender's release callback must reclaim it with alloc.
+ * The response is read from sock, which must wrap the sender's socket.
+ *
+ * \param sender            The zero-copy sender for the connection.
+ * \param sock              The socket connection with agentd.
+ * \param alloc             The allocator to use for this operation.
+ * \param suite             The crypto suite to use for this operation.
+ * \param client_iv         The client-side initialization vector counter.
+ * \param server_iv         The server-side initialization vector counter.
+ * \param shared_secret     The computed shared secret for this session.
+ * \param offset            The offset to use for this request.
+ * \param ping_sentinel_id  The UUID of the ping sentinel.
+ * \param payload_size      The size of the payload to send.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status send_and_verify_ping_request_zerocopy(
+    zerocopy_sender* sender, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* alloc, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, uint64_t* server_iv, vccrypt_buffer_t* shared_secret,
+    uint32_t offset, const vpr_uuid* ping_sentinel_id, size_t payload_size)
+{
+    status retval, release_retval;
+    vccrypt_buffer_t payload;
+    psock* frame_sock;
+    void* frame;
+    size_t frame_size;
+    uint64_t frame_iv = *client_iv;
+
+    /* create the ping payload */
+    retval = vccrypt_buffer_init(&payload, suite->alloc_opts, payload_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* a buffer socket with no input collects the encrypted request. */
+    retval = psock_create_from_buffer(&frame_sock, alloc, NULL, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* encode the ping protocol request. */
+    retval =
+        ping_protocol_sendreq_ping(
+            frame_sock, suite, &frame_iv, shared_secret, ping_sentinel_id,
+            offset, &payload);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Failed to encode extended api ping request. (%x).\n",
+            retval);
+        retval = ERROR_PING_REQUEST_SEND;
+        goto cleanup_frame_sock;
+    }
+
+    retval =
+        psock_from_buffer_get_output_buffer(
+            frame_sock, alloc, &frame, &frame_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_frame_sock;
+    }
+
+    /* the sender owns the frame from here on. */
+    *client_iv = frame_iv;
+    retval = zerocopy_sender_send(sender, frame, frame_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Failed to send extended api ping request. (%x).\n",
+            retval);
+        retval = ERROR_PING_REQUEST_SEND;
+        goto cleanup_frame_sock;
+    }
+
+    /* get and verify the response. */
+    retval =
+        recv_and_verify_ping_response(
+            sock, alloc, suite, server_iv, shared_secret, offset);
+
+cleanup_frame_sock:
+    release_retval = resource_release(psock_resource_handle(frame_sock));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_payload:
+    dispose(&payload.hdr);
+
+done:
+    return retval;
+}
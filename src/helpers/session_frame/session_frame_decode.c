@@ -0,0 +1,89 @@
+/**
+ * \file helpers/session_frame/session_frame_decode.c
+ *
+ * \brief Decrypt a response from memory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/session_frame.h>
+#include <helpers/status_codes.h>
+#include <rcpr/resource.h>
+#include <vcblockchain/protocol.h>
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Decrypt a response for a session from the bytes received so far.
+ *
+ * The data must start at a frame boundary. If it doesn't yet hold a whole
+ * frame, the session's server IV is left untouched and the caller should
+ * try again once more bytes arrive.
+ *
+ * \param session       The session the response belongs to.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param data          The bytes received.
+ * \param size          The number of bytes received.
+ * \param response      The buffer to initialize with the decrypted response
+ *                      on success, which the caller must dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_SESSION_FRAME_INCOMPLETE if the data doesn't decode yet.
+ *      - a non-zero error code on failure.
+ */
+status session_frame_decode(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, const void* data, size_t size,
+    vccrypt_buffer_t* response)
+{
+    status retval, release_retval;
+    psock* sock;
+    uint64_t server_iv;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != data || 0 == size);
+    MODEL_ASSERT(NULL != response);
+
+    if (0 == size)
+    {
+        return ERROR_SESSION_FRAME_INCOMPLETE;
+    }
+
+    retval = psock_create_from_buffer(&sock, alloc, (const char*)data, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* a short read fails the decode; only commit the IV on success. */
+    server_iv = session->server_iv;
+    retval =
+        vcblockchain_protocol_recvresp(
+            sock, alloc, suite, &server_iv, &session->shared_secret,
+            response);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_SESSION_FRAME_INCOMPLETE;
+    }
+    else
+    {
+        session->server_iv = server_iv;
+    }
+
+    release_retval = resource_release(psock_resource_handle(sock));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        if (STATUS_SUCCESS == retval)
+        {
+            dispose((disposable_t*)response);
+        }
+
+        retval = release_retval;
+    }
+
+    return retval;
+}
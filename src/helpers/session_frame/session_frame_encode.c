@@ -0,0 +1,83 @@
+/**
+ * \file helpers/session_frame/session_frame_encode.c
+ *
+ * \brief Encrypt a request into memory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/session_frame.h>
+#include <rcpr/resource.h>
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Encrypt a request for a session into memory instead of its socket.
+ *
+ * Transports that write the socket descriptor themselves use this to produce
+ * the exact bytes the blocking path would have written. The session's client
+ * IV advances as if the request had been sent, and is left untouched on
+ * failure.
+ *
+ * \param session       The session the request belongs to.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param encode        The function writing the request.
+ * \param context       The request arguments passed to encode.
+ * \param frame         Pointer to receive the encrypted frame on success,
+ *                      which the caller must reclaim with alloc.
+ * \param frame_size    Pointer to receive the size of the frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_frame_encode(
+    agentd_session* session, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, session_frame_encode_fn encode,
+    void* context, void** frame, size_t* frame_size)
+{
+    status retval, release_retval;
+    psock* sock;
+    uint64_t client_iv;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != encode);
+    MODEL_ASSERT(NULL != frame);
+    MODEL_ASSERT(NULL != frame_size);
+
+    /* a buffer socket with no input collects what is written to it. */
+    retval = psock_create_from_buffer(&sock, alloc, NULL, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    client_iv = session->client_iv;
+    retval =
+        encode(sock, suite, &client_iv, &session->shared_secret, context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sock;
+    }
+
+    retval =
+        psock_from_buffer_get_output_buffer(sock, alloc, frame, frame_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sock;
+    }
+
+    session->client_iv = client_iv;
+
+cleanup_sock:
+    release_retval = resource_release(psock_resource_handle(sock));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file helpers/session_pool/session_pool_call_unref_and_unlock.c
+ *
+ * \brief Drop a reference to a session pool call.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "session_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Drop one reference to a call, releasing it on the last reference.
+ *
+ * The caller must hold the call lock, which is released by this function.
+ *
+ * \param pool          The pool that owns the call.
+ * \param call          The call to release.
+ */
+void session_pool_call_unref_and_unlock(
+    session_pool* pool, session_pool_call* call)
+{
+    bool last;
+
+    call->refcount -= 1;
+    last = (0 == call->refcount);
+    pthread_mutex_unlock(&call->lock);
+
+    if (last)
+    {
+        /* a result that no one collected is released with the call. */
+        read_result_dispose(&call->result);
+        pthread_cond_destroy(&call->cond);
+        pthread_mutex_destroy(&call->lock);
+        (void)rcpr_allocator_reclaim(pool->alloc, call);
+    }
+}
@@ -0,0 +1,145 @@
+/**
+ * \file helpers/session_pool/session_pool_create.c
+ *
+ * \brief Create a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "session_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a session pool.
+ *
+ * \param pool          Pointer to the session pool pointer to receive the pool
+ *                      on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param session_count The number of sessions to open.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the caller owns the pool and must release it by calling
+ * \ref session_pool_release when it is no longer needed. The allocator and
+ * crypto suite must outlive the pool. Hedging starts out disabled, and
+ * requests are distributed round robin.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_create(
+    session_pool** pool, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, size_t session_count,
+    const char* hostaddr, unsigned int hostport, const char* clientpriv,
+    const char* serverpub)
+{
+    status retval, release_retval;
+    session_pool* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(session_count > 0);
+
+    /* allocate the pool. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_SESSION_POOL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->suite = suite;
+    atomic_init(&tmp->next_worker, 0);
+    atomic_init(&tmp->selection, SESSION_POOL_SELECT_ROUND_ROBIN);
+    pthread_mutex_init(&tmp->stats_lock, NULL);
+    latency_histogram_init(&tmp->wire_latency);
+
+    /* allocate the workers. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->workers,
+            session_count * sizeof(session_pool_worker));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_SESSION_POOL_OUT_OF_MEMORY;
+        goto cleanup_pool;
+    }
+
+    memset(tmp->workers, 0, session_count * sizeof(session_pool_worker));
+    tmp->worker_count = session_count;
+
+    /* connect each session and start its worker. */
+    for (size_t i = 0; i < session_count; ++i)
+    {
+        session_pool_worker* worker = &tmp->workers[i];
+
+        worker->pool = tmp;
+        worker->index = i;
+        atomic_init(&worker->outstanding, 0);
+        atomic_init(&worker->failed, false);
+        pthread_mutex_init(&worker->lock, NULL);
+        pthread_cond_init(&worker->cond, NULL);
+
+        retval =
+            agentd_session_init(
+                &worker->session, alloc, file, suite, hostaddr, hostport,
+                clientpriv, serverpub);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error connecting pooled session %zu.\n", i);
+            goto cleanup_workers;
+        }
+
+        worker->connected = true;
+
+        if (0 !=
+                pthread_create(
+                    &worker->thread, NULL, &session_pool_worker_thread,
+                    worker))
+        {
+            fprintf(stderr, "Error starting pooled session thread %zu.\n", i);
+            retval = ERROR_SESSION_POOL_THREAD_CREATE;
+            goto cleanup_workers;
+        }
+
+        worker->thread_started = true;
+    }
+
+    /* success. */
+    *pool = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_workers:
+    /* session_pool_release handles partially constructed pools. */
+    release_retval = session_pool_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    goto done;
+
+cleanup_pool:
+    pthread_mutex_destroy(&tmp->stats_lock);
+    release_retval = rcpr_allocator_reclaim(alloc, tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file helpers/session_pool/session_pool_enqueue.c
+ *
+ * \brief Queue a request on a session pool worker.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "session_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Queue a copy of a call's request on the given worker.
+ *
+ * The caller must hold the call lock. On success, the call's refcount and
+ * outstanding counts are incremented.
+ *
+ * \param pool          The pool that owns the worker.
+ * \param worker        The worker on which the job is queued.
+ * \param call          The call to which this job belongs.
+ * \param req           The request to copy into the job.
+ * \param copy          0 for the original request, 1 for a hedge.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_enqueue(
+    session_pool* pool, session_pool_worker* worker, session_pool_call* call,
+    const read_request* req, unsigned int copy)
+{
+    status retval;
+    session_pool_job* job;
+
+    /* allocate the job. */
+    retval = rcpr_allocator_allocate(pool->alloc, (void**)&job, sizeof(*job));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_SESSION_POOL_OUT_OF_MEMORY;
+    }
+
+    job->next = NULL;
+    job->call = call;
+    job->req = *req;
+    job->copy = copy;
+    job->send_ns = 0;
+
+    /* the job holds a reference to the call until it completes. */
+    call->refcount += 1;
+    call->outstanding += 1;
+
+    atomic_fetch_add(&worker->outstanding, 1);
+
+    pthread_mutex_lock(&worker->lock);
+    if (NULL == worker->tail)
+    {
+        worker->head = worker->tail = job;
+    }
+    else
+    {
+        worker->tail->next = job;
+        worker->tail = job;
+    }
+    pthread_cond_signal(&worker->cond);
+    pthread_mutex_unlock(&worker->lock);
+
+    pthread_mutex_lock(&pool->stats_lock);
+    pool->stats.wire_requests += 1;
+    pthread_mutex_unlock(&pool->stats_lock);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,26 @@
+/**
+ * \file helpers/session_pool/session_pool_get_stats.c
+ *
+ * \brief Get the counters of a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "session_pool_internal.h"
+
+/**
+ * \brief Get a snapshot of the pool counters.
+ *
+ * \param pool          The pool to query.
+ * \param stats         The structure to receive the counters.
+ */
+void session_pool_get_stats(session_pool* pool, session_pool_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != stats);
+
+    pthread_mutex_lock(&pool->stats_lock);
+    *stats = pool->stats;
+    pthread_mutex_unlock(&pool->stats_lock);
+}
@@ -0,0 +1,39 @@
+/**
+ * \file helpers/session_pool/session_pool_hedge_delay.c
+ *
+ * \brief Compute the hedge delay of a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "session_pool_internal.h"
+
+/**
+ * \brief Get the current hedge delay for this pool.
+ *
+ * \param pool          The pool to query.
+ *
+ * \returns the hedge delay in nanoseconds.
+ */
+uint64_t session_pool_hedge_delay(session_pool* pool)
+{
+    uint64_t delay;
+
+    pthread_mutex_lock(&pool->stats_lock);
+
+    delay = pool->hedge.min_delay_ns;
+    if (pool->wire_latency.total >= pool->hedge.warmup_samples)
+    {
+        uint64_t observed =
+            latency_histogram_percentile(
+                &pool->wire_latency, pool->hedge.percentile);
+        if (observed > delay)
+        {
+            delay = observed;
+        }
+    }
+
+    pthread_mutex_unlock(&pool->stats_lock);
+
+    return delay;
+}
@@ -0,0 +1,157 @@
+/**
+ * \file helpers/session_pool/session_pool_internal.h
+ *
+ * \brief Internal structures for the session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/session_pool.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+typedef struct session_pool_call session_pool_call;
+typedef struct session_pool_job session_pool_job;
+typedef struct session_pool_worker session_pool_worker;
+
+/**
+ * \brief A logical read shared by its original request and any hedge.
+ *
+ * The call is reference counted by the waiting caller and by every job that
+ * has not yet completed. The first successful job moves its result into the
+ * call; if every job fails, the last failure and the agentd status behind it
+ * are reported.
+ */
+struct session_pool_call
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    unsigned int refcount;
+    unsigned int outstanding;
+    bool done;
+    unsigned int winner;
+    status retval;
+    uint32_t agentd_status;
+    read_result result;
+};
+
+/**
+ * \brief One copy of a read request queued on a worker.
+ */
+struct session_pool_job
+{
+    session_pool_job* next;
+    session_pool_call* call;
+    read_request req;
+    unsigned int copy;
+    uint64_t send_ns;
+};
+
+/**
+ * \brief A session and the thread that drives it.
+ */
+struct session_pool_worker
+{
+    session_pool* pool;
+    size_t index;
+    agentd_session session;
+    bool connected;
+    bool thread_started;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    session_pool_job* head;
+    session_pool_job* tail;
+    bool quiesce;
+    atomic_size_t outstanding;
+    atomic_bool failed;
+};
+
+struct session_pool
+{
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    session_pool_worker* workers;
+    size_t worker_count;
+    atomic_size_t next_worker;
+    atomic_int selection;
+    pthread_mutex_t stats_lock;
+    session_pool_hedge_policy hedge;
+    session_pool_stats stats;
+    latency_histogram wire_latency;
+};
+
+/**
+ * \brief Entry point for a session pool worker thread.
+ *
+ * \param context       The \ref session_pool_worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* session_pool_worker_thread(void* context);
+
+/**
+ * \brief Queue a copy of a call's request on the given worker.
+ *
+ * The caller must hold the call lock. On success, the call's refcount and
+ * outstanding counts are incremented.
+ *
+ * \param pool          The pool that owns the worker.
+ * \param worker        The worker on which the job is queued.
+ * \param call          The call to which this job belongs.
+ * \param req           The request to copy into the job.
+ * \param copy          0 for the original request, 1 for a hedge.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_enqueue(
+    session_pool* pool, session_pool_worker* worker, session_pool_call* call,
+    const read_request* req, unsigned int copy);
+
+/**
+ * \brief Select a worker for a new request.
+ *
+ * The worker is chosen according to the pool's selection policy. Workers
+ * whose sessions have failed are skipped while a healthy worker remains.
+ *
+ * \param pool          The pool from which a worker is selected.
+ * \param exclude       A worker that must not be selected, or NULL.
+ *
+ * \returns the selected worker, or NULL if no other worker exists.
+ */
+session_pool_worker* session_pool_select_worker(
+    session_pool* pool, const session_pool_worker* exclude);
+
+/**
+ * \brief Get the current hedge delay for this pool.
+ *
+ * \param pool          The pool to query.
+ *
+ * \returns the hedge delay in nanoseconds.
+ */
+uint64_t session_pool_hedge_delay(session_pool* pool);
+
+/**
+ * \brief Drop one reference to a call, releasing it on the last reference.
+ *
+ * The caller must hold the call lock, which is released by this function.
+ *
+ * \param pool          The pool that owns the call.
+ * \param call          The call to release.
+ */
+void session_pool_call_unref_and_unlock(
+    session_pool* pool, session_pool_call* call);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
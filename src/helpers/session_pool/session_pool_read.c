@@ -0,0 +1,167 @@
+/**
+ * \file helpers/session_pool/session_pool_read.c
+ *
+ * \brief Execute a read request on a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_status.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <time.h>
+
+#include "session_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static void deadline_from_ns(struct timespec* ts, uint64_t deadline_ns);
+
+/**
+ * \brief Execute a read request on the pool, blocking until it completes.
+ *
+ * \param pool          The pool on which the request is executed.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \note On failure, the status reported by agentd, if any, is available to the
+ * calling thread through \ref agentd_status_last.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_read(
+    session_pool* pool, const read_request* req, read_result* result)
+{
+    status retval;
+    session_pool_call* call;
+    session_pool_worker* primary;
+    session_pool_worker* secondary;
+    session_pool_hedge_policy hedge;
+    pthread_condattr_t condattr;
+    struct timespec deadline;
+    bool hedged = false;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != result);
+
+    pthread_mutex_lock(&pool->stats_lock);
+    pool->stats.requests += 1;
+    hedge = pool->hedge;
+    pthread_mutex_unlock(&pool->stats_lock);
+
+    /* create the call shared by the request and any hedge. */
+    retval = rcpr_allocator_allocate(pool->alloc, (void**)&call, sizeof(*call));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_SESSION_POOL_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(call, 0, sizeof(*call));
+    call->refcount = 1;
+    pthread_mutex_init(&call->lock, NULL);
+    pthread_condattr_init(&condattr);
+    pthread_condattr_setclock(&condattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&call->cond, &condattr);
+    pthread_condattr_destroy(&condattr);
+
+    pthread_mutex_lock(&call->lock);
+
+    /* send the original request. */
+    primary = session_pool_select_worker(pool, NULL);
+    retval = session_pool_enqueue(pool, primary, call, req, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_call;
+    }
+
+    /* wait for the hedge delay before hedging on a second session. */
+    if (hedge.enabled && pool->worker_count > 1)
+    {
+        deadline_from_ns(
+            &deadline,
+            latency_clock_now_ns() + session_pool_hedge_delay(pool));
+
+        while (!call->done)
+        {
+            if (ETIMEDOUT !=
+                    pthread_cond_timedwait(&call->cond, &call->lock, &deadline))
+            {
+                continue;
+            }
+
+            if (!call->done)
+            {
+                secondary = session_pool_select_worker(pool, primary);
+                if (NULL != secondary
+                 && STATUS_SUCCESS ==
+                        session_pool_enqueue(pool, secondary, call, req, 1))
+                {
+                    hedged = true;
+                }
+            }
+
+            break;
+        }
+    }
+
+    /* wait for the winning answer. */
+    while (!call->done)
+    {
+        pthread_cond_wait(&call->cond, &call->lock);
+    }
+
+    retval = call->retval;
+    if (STATUS_SUCCESS == retval)
+    {
+        read_result_move(result, &call->result);
+    }
+    else
+    {
+        /* surface the agentd status to the caller's thread. */
+        agentd_status_record(call->agentd_status);
+    }
+
+    pthread_mutex_lock(&pool->stats_lock);
+    if (hedged)
+    {
+        pool->stats.hedges += 1;
+        if (1 == call->winner && STATUS_SUCCESS == retval)
+        {
+            pool->stats.hedge_wins += 1;
+        }
+    }
+    if (STATUS_SUCCESS != retval)
+    {
+        pool->stats.failures += 1;
+    }
+    pthread_mutex_unlock(&pool->stats_lock);
+
+    goto cleanup_call;
+
+cleanup_call:
+    session_pool_call_unref_and_unlock(pool, call);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Convert a monotonic deadline in nanoseconds to a timespec.
+ *
+ * \param ts            The timespec to populate.
+ * \param deadline_ns   The deadline in nanoseconds.
+ */
+static void deadline_from_ns(struct timespec* ts, uint64_t deadline_ns)
+{
+    ts->tv_sec = (time_t)(deadline_ns / UINT64_C(1000000000));
+    ts->tv_nsec = (long)(deadline_ns % UINT64_C(1000000000));
+}
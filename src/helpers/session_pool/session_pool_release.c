@@ -0,0 +1,90 @@
+/**
+ * \file helpers/session_pool/session_pool_release.c
+ *
+ * \brief Release a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "session_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Close every session in the pool and release it.
+ *
+ * Queued requests are drained before each session is closed.
+ *
+ * \param pool          The pool to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status session_pool_release(session_pool* pool)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = pool->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    /* ask every running worker to drain its queue and stop. */
+    for (size_t i = 0; i < pool->worker_count; ++i)
+    {
+        session_pool_worker* worker = &pool->workers[i];
+
+        if (worker->thread_started)
+        {
+            pthread_mutex_lock(&worker->lock);
+            worker->quiesce = true;
+            pthread_cond_signal(&worker->cond);
+            pthread_mutex_unlock(&worker->lock);
+        }
+    }
+
+    /* join the workers and release their sessions. */
+    for (size_t i = 0; i < pool->worker_count; ++i)
+    {
+        session_pool_worker* worker = &pool->workers[i];
+
+        if (worker->thread_started)
+        {
+            pthread_join(worker->thread, NULL);
+        }
+
+        if (worker->connected)
+        {
+            release_retval = agentd_session_dispose(&worker->session);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        /* workers past the point of failure in create were never set up. */
+        if (NULL != worker->pool)
+        {
+            pthread_cond_destroy(&worker->cond);
+            pthread_mutex_destroy(&worker->lock);
+        }
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, pool->workers);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    pthread_mutex_destroy(&pool->stats_lock);
+
+    release_retval = rcpr_allocator_reclaim(alloc, pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file helpers/session_pool/session_pool_reset_stats.c
+ *
+ * \brief Reset the counters of a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "session_pool_internal.h"
+
+/**
+ * \brief Reset the pool counters and observed latencies.
+ *
+ * \param pool          The pool to reset.
+ */
+void session_pool_reset_stats(session_pool* pool)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    pthread_mutex_lock(&pool->stats_lock);
+    memset(&pool->stats, 0, sizeof(pool->stats));
+    latency_histogram_init(&pool->wire_latency);
+    pthread_mutex_unlock(&pool->stats_lock);
+}
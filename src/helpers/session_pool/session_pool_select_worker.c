@@ -0,0 +1,189 @@
+/**
+ * \file helpers/session_pool/session_pool_select_worker.c
+ *
+ * \brief Select a worker for a new request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <pthread.h>
+
+#include "session_pool_internal.h"
+
+/* forward decls. */
+static session_pool_worker* select_round_robin(
+    session_pool* pool, const session_pool_worker* exclude);
+static session_pool_worker* select_least_loaded(
+    session_pool* pool, const session_pool_worker* exclude);
+static bool candidate(
+    const session_pool_worker* worker, const session_pool_worker* exclude);
+static uint64_t next_random(void);
+
+/**
+ * \brief Select a worker for a new request.
+ *
+ * The worker is chosen according to the pool's selection policy. Workers
+ * whose sessions have failed are skipped while a healthy worker remains.
+ *
+ * \param pool          The pool from which a worker is selected.
+ * \param exclude       A worker that must not be selected, or NULL.
+ *
+ * \returns the selected worker, or NULL if no other worker exists.
+ */
+session_pool_worker* session_pool_select_worker(
+    session_pool* pool, const session_pool_worker* exclude)
+{
+    switch (atomic_load(&pool->selection))
+    {
+        case SESSION_POOL_SELECT_LEAST_LOADED:
+            return select_least_loaded(pool, exclude);
+
+        case SESSION_POOL_SELECT_ROUND_ROBIN:
+        default:
+            return select_round_robin(pool, exclude);
+    }
+}
+
+/**
+ * \brief Select the next worker in turn.
+ *
+ * \param pool          The pool from which a worker is selected.
+ * \param exclude       A worker that must not be selected, or NULL.
+ *
+ * \returns the selected worker, or NULL if no other worker exists.
+ */
+static session_pool_worker* select_round_robin(
+    session_pool* pool, const session_pool_worker* exclude)
+{
+    session_pool_worker* fallback = NULL;
+    size_t start = atomic_fetch_add(&pool->next_worker, 1);
+
+    /* round robin, starting from the next worker in turn. */
+    for (size_t i = 0; i < pool->worker_count; ++i)
+    {
+        session_pool_worker* worker =
+            &pool->workers[(start + i) % pool->worker_count];
+
+        if (worker == exclude)
+        {
+            continue;
+        }
+
+        if (candidate(worker, exclude))
+        {
+            return worker;
+        }
+
+        if (NULL == fallback)
+        {
+            fallback = worker;
+        }
+    }
+
+    /* every candidate has failed; let the caller see the failure. */
+    return fallback;
+}
+
+/**
+ * \brief Select the less loaded of two randomly chosen workers.
+ *
+ * \param pool          The pool from which a worker is selected.
+ * \param exclude       A worker that must not be selected, or NULL.
+ *
+ * \returns the selected worker, or NULL if no other worker exists.
+ */
+static session_pool_worker* select_least_loaded(
+    session_pool* pool, const session_pool_worker* exclude)
+{
+    session_pool_worker* first;
+    session_pool_worker* second;
+    size_t count = pool->worker_count;
+    size_t a, b;
+
+    /* with one candidate or none there is nothing to choose between. */
+    if (count < 2 || (2 == count && NULL != exclude))
+    {
+        return select_round_robin(pool, exclude);
+    }
+
+    if (2 == count)
+    {
+        /* with two workers, compare both. */
+        a = 0;
+        b = 1;
+    }
+    else
+    {
+        /* pick two distinct workers at random. */
+        a = next_random() % count;
+        b = next_random() % (count - 1);
+        if (b >= a)
+        {
+            b += 1;
+        }
+    }
+
+    first = &pool->workers[a];
+    second = &pool->workers[b];
+
+    /* if either sample is unusable, fall back to scanning in turn. */
+    if (!candidate(first, exclude))
+    {
+        return
+            candidate(second, exclude)
+                ? second : select_round_robin(pool, exclude);
+    }
+
+    if (!candidate(second, exclude))
+    {
+        return first;
+    }
+
+    /* prefer the worker with fewer outstanding requests. */
+    if (atomic_load(&second->outstanding) < atomic_load(&first->outstanding))
+    {
+        return second;
+    }
+
+    return first;
+}
+
+/**
+ * \brief Determine whether a worker may receive a new request.
+ *
+ * \param worker        The worker to check.
+ * \param exclude       A worker that must not be selected, or NULL.
+ *
+ * \returns true if the worker is healthy and not excluded.
+ */
+static bool candidate(
+    const session_pool_worker* worker, const session_pool_worker* exclude)
+{
+    return worker != exclude && !atomic_load(&worker->failed);
+}
+
+/**
+ * \brief Get the next value from a per-thread xorshift generator.
+ *
+ * Session selection needs speed and independence between threads, not
+ * unpredictability, so a cryptographic generator is not required here.
+ *
+ * \returns a pseudorandom 64-bit value.
+ */
+static uint64_t next_random(void)
+{
+    static _Thread_local uint64_t state = 0;
+
+    if (0 == state)
+    {
+        state =
+            (latency_clock_now_ns() ^ (uint64_t)(uintptr_t)&state)
+                | UINT64_C(1);
+    }
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+}
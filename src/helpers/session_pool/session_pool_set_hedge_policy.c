@@ -0,0 +1,27 @@
+/**
+ * \file helpers/session_pool/session_pool_set_hedge_policy.c
+ *
+ * \brief Set the hedging policy of a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "session_pool_internal.h"
+
+/**
+ * \brief Set the hedging policy for this pool.
+ *
+ * \param pool          The pool to update.
+ * \param policy        The new hedging policy.
+ */
+void session_pool_set_hedge_policy(
+    session_pool* pool, const session_pool_hedge_policy* policy)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != policy);
+
+    pthread_mutex_lock(&pool->stats_lock);
+    pool->hedge = *policy;
+    pthread_mutex_unlock(&pool->stats_lock);
+}
@@ -0,0 +1,24 @@
+/**
+ * \file helpers/session_pool/session_pool_set_selection_policy.c
+ *
+ * \brief Set the session selection policy of a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "session_pool_internal.h"
+
+/**
+ * \brief Set the session selection policy for this pool.
+ *
+ * \param pool          The pool to update.
+ * \param policy        The new selection policy.
+ */
+void session_pool_set_selection_policy(
+    session_pool* pool, session_pool_selection_policy policy)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+
+    atomic_store(&pool->selection, (int)policy);
+}
@@ -0,0 +1,149 @@
+/**
+ * \file helpers/session_pool/session_pool_worker_thread.c
+ *
+ * \brief Worker thread driving one pooled session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/status_codes.h>
+
+#include "session_pool_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static void session_pool_job_complete(
+    session_pool* pool, session_pool_job* job, status retval,
+    uint32_t agentd_status, read_result* result);
+
+/**
+ * \brief Entry point for a session pool worker thread.
+ *
+ * \param context       The \ref session_pool_worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* session_pool_worker_thread(void* context)
+{
+    session_pool_worker* worker = (session_pool_worker*)context;
+    session_pool* pool = worker->pool;
+    session_pool_job* job;
+    read_result result;
+    status retval;
+
+    for (;;)
+    {
+        /* wait for a job or for the pool to shut down. */
+        pthread_mutex_lock(&worker->lock);
+        while (NULL == worker->head && !worker->quiesce)
+        {
+            pthread_cond_wait(&worker->cond, &worker->lock);
+        }
+
+        if (NULL == worker->head)
+        {
+            pthread_mutex_unlock(&worker->lock);
+            break;
+        }
+
+        job = worker->head;
+        worker->head = job->next;
+        if (NULL == worker->head)
+        {
+            worker->tail = NULL;
+        }
+        pthread_mutex_unlock(&worker->lock);
+
+        agentd_status_clear();
+
+        /* a session with a transport error can't be trusted again. */
+        if (atomic_load(&worker->failed))
+        {
+            retval = ERROR_SESSION_POOL_SESSION_FAILED;
+        }
+        else
+        {
+            /* time the read from here, so queueing is not counted. */
+            job->send_ns = latency_clock_now_ns();
+            retval =
+                read_request_execute(
+                    &worker->session, pool->alloc, pool->suite, &job->req,
+                    &result);
+            if (status_is_transport_error(retval))
+            {
+                atomic_store(&worker->failed, true);
+            }
+        }
+
+        atomic_fetch_sub(&worker->outstanding, 1);
+        session_pool_job_complete(
+            pool, job, retval, agentd_status_last(), &result);
+    }
+
+    /* close the session gracefully if it is still healthy. */
+    if (!atomic_load(&worker->failed))
+    {
+        (void)send_and_verify_close_connection(
+            worker->session.sock, pool->alloc, pool->suite,
+            &worker->session.client_iv, &worker->session.server_iv,
+            &worker->session.shared_secret);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Complete a job, publishing its result to its call if it won.
+ *
+ * \param pool          The pool that owns this job.
+ * \param job           The job to complete.
+ * \param retval        The status of the job.
+ * \param agentd_status The failure status reported by agentd, if any.
+ * \param result        The result of the job, valid on success.
+ */
+static void session_pool_job_complete(
+    session_pool* pool, session_pool_job* job, status retval,
+    uint32_t agentd_status, read_result* result)
+{
+    session_pool_call* call = job->call;
+
+    /* successful wire latencies feed the hedge delay. */
+    pthread_mutex_lock(&pool->stats_lock);
+    if (STATUS_SUCCESS == retval)
+    {
+        latency_histogram_record(
+            &pool->wire_latency, latency_clock_now_ns() - job->send_ns);
+    }
+    pthread_mutex_unlock(&pool->stats_lock);
+
+    pthread_mutex_lock(&call->lock);
+    call->outstanding -= 1;
+
+    if (!call->done
+     && (STATUS_SUCCESS == retval || 0 == call->outstanding))
+    {
+        /* first success wins; otherwise the last failure is reported. */
+        call->done = true;
+        call->winner = job->copy;
+        call->retval = retval;
+        call->agentd_status = agentd_status;
+        if (STATUS_SUCCESS == retval)
+        {
+            read_result_move(&call->result, result);
+        }
+        pthread_cond_broadcast(&call->cond);
+    }
+    else if (STATUS_SUCCESS == retval)
+    {
+        /* the other copy already answered. */
+        read_result_dispose(result);
+    }
+
+    session_pool_call_unref_and_unlock(pool, call);
+
+    (void)rcpr_allocator_reclaim(pool->alloc, job);
+}
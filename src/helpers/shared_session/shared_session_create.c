@@ -0,0 +1,106 @@
+/**
+ * \file helpers/shared_session/shared_session_create.c
+ *
+ * \brief Create a shared session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "shared_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a shared session.
+ *
+ * \param session       Pointer to the shared session pointer to receive the
+ *                      session on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the caller owns the session and must release it by
+ * calling \ref shared_session_release when it is no longer needed. The
+ * allocator and crypto suite must outlive the session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status shared_session_create(
+    shared_session** session, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, const char* hostaddr,
+    unsigned int hostport, const char* clientpriv, const char* serverpub)
+{
+    status retval, release_retval;
+    shared_session* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+
+    /* allocate the session. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_SHARED_SESSION_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->suite = suite;
+    mpsc_queue_init(&tmp->queue);
+    sem_init(&tmp->pending, 0, 0);
+    atomic_init(&tmp->queued, 0);
+    atomic_init(&tmp->quiesce, false);
+
+    /* connect the session. */
+    retval =
+        agentd_session_init(
+            &tmp->session, alloc, file, suite, hostaddr, hostport, clientpriv,
+            serverpub);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error connecting shared session.\n");
+        goto cleanup_session;
+    }
+
+    tmp->connected = true;
+
+    /* start the I/O thread. */
+    if (0 !=
+            pthread_create(
+                &tmp->thread, NULL, &shared_session_io_thread, tmp))
+    {
+        fprintf(stderr, "Error starting shared session thread.\n");
+        retval = ERROR_SHARED_SESSION_THREAD_CREATE;
+        goto cleanup_session;
+    }
+
+    tmp->thread_started = true;
+
+    /* success. */
+    *session = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_session:
+    /* shared_session_release handles partially constructed sessions. */
+    release_retval = shared_session_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
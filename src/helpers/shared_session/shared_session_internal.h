@@ -0,0 +1,56 @@
+/**
+ * \file helpers/shared_session/shared_session_internal.h
+ *
+ * \brief Internal declarations for the shared session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/agentd_session.h>
+#include <helpers/shared_session.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A session, its request queue, and the I/O thread that drives it.
+ *
+ * Each submit increments queued, pushes its request, and posts pending, so
+ * the I/O thread wakes once per request. Release sets quiesce and posts
+ * pending one extra time; the I/O thread stops when it wakes to find quiesce
+ * set and nothing queued.
+ */
+struct shared_session
+{
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    agentd_session session;
+    bool connected;
+    bool thread_started;
+    pthread_t thread;
+    mpsc_queue queue;
+    sem_t pending;
+    atomic_size_t queued;
+    atomic_bool quiesce;
+    bool failed;
+};
+
+/**
+ * \brief Entry point for the shared session I/O thread.
+ *
+ * \param context       The \ref shared_session for this thread.
+ *
+ * \returns NULL.
+ */
+void* shared_session_io_thread(void* context);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,111 @@
+/**
+ * \file helpers/shared_session/shared_session_io_thread.c
+ *
+ * \brief Entry point for the shared session I/O thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_status.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/status_codes.h>
+#include <sched.h>
+
+#include "shared_session_internal.h"
+
+/* forward decls. */
+static shared_session_request* shared_session_next_request(
+    shared_session* session);
+
+/**
+ * \brief Entry point for the shared session I/O thread.
+ *
+ * \param context       The \ref shared_session for this thread.
+ *
+ * \returns NULL.
+ */
+void* shared_session_io_thread(void* context)
+{
+    shared_session* session = (shared_session*)context;
+    shared_session_request* request;
+
+    while (NULL != (request = shared_session_next_request(session)))
+    {
+        agentd_status_clear();
+
+        /* a session with a transport error can't be trusted again. */
+        if (session->failed)
+        {
+            request->retval = ERROR_SHARED_SESSION_FAILED;
+        }
+        else
+        {
+            request->retval =
+                read_request_execute(
+                    &session->session, session->alloc, session->suite,
+                    &request->req, &request->result);
+            if (status_is_transport_error(request->retval))
+            {
+                session->failed = true;
+            }
+        }
+
+        request->agentd_status = agentd_status_last();
+        request->complete(request, request->context);
+    }
+
+    /* close the session gracefully if it is still healthy. */
+    if (!session->failed)
+    {
+        (void)send_and_verify_close_connection(
+            session->session.sock, session->alloc, session->suite,
+            &session->session.client_iv, &session->session.server_iv,
+            &session->session.shared_secret);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Wait for the next request.
+ *
+ * \param session       The shared session.
+ *
+ * \returns the next request, or NULL once the session is quiesced and its
+ * queue is drained.
+ */
+static shared_session_request* shared_session_next_request(
+    shared_session* session)
+{
+    mpsc_queue_node* node;
+
+    /* every submit and the final quiesce each post once. */
+    for (;;)
+    {
+        while (0 != sem_wait(&session->pending) && EINTR == errno)
+            ;
+
+        if (0 != atomic_load(&session->queued))
+        {
+            break;
+        }
+
+        /* with nothing queued, stop only once release has asked. */
+        if (atomic_load(&session->quiesce))
+        {
+            return NULL;
+        }
+    }
+
+    /* the request is counted before it is linked; wait for the link. */
+    while (NULL == (node = mpsc_queue_pop(&session->queue)))
+    {
+        sched_yield();
+    }
+
+    atomic_fetch_sub(&session->queued, 1);
+
+    return (shared_session_request*)node;
+}
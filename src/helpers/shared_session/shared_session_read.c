@@ -0,0 +1,84 @@
+/**
+ * \file helpers/shared_session/shared_session_read.c
+ *
+ * \brief Execute a read request on a shared session, blocking until it
+ * completes.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_status.h>
+#include <string.h>
+
+#include "shared_session_internal.h"
+
+/* forward decls. */
+static void shared_session_read_complete(
+    shared_session_request* request, void* context);
+
+/**
+ * \brief Execute a read request on a shared session, blocking until it
+ * completes.
+ *
+ * \param session       The session on which the request is executed.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \note On failure, the status reported by agentd, if any, is available to the
+ * calling thread through \ref agentd_status_last.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status shared_session_read(
+    shared_session* session, const read_request* req, read_result* result)
+{
+    shared_session_request request;
+    sem_t done;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != result);
+
+    /* the request lives on this stack until its completion posts done. */
+    sem_init(&done, 0, 0);
+    memcpy(&request.req, req, sizeof(request.req));
+    request.complete = &shared_session_read_complete;
+    request.context = &done;
+
+    shared_session_submit(session, &request);
+
+    while (0 != sem_wait(&done) && EINTR == errno)
+        ;
+
+    sem_destroy(&done);
+
+    if (STATUS_SUCCESS != request.retval)
+    {
+        agentd_status_record(request.agentd_status);
+        return request.retval;
+    }
+
+    read_result_move(result, &request.result);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Wake the thread waiting on a blocking read.
+ *
+ * \param request       The completed request.
+ * \param context       The semaphore on which the reader waits.
+ */
+static void shared_session_read_complete(
+    shared_session_request* request, void* context)
+{
+    (void)request;
+
+    sem_post((sem_t*)context);
+}
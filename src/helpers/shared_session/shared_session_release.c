@@ -0,0 +1,58 @@
+/**
+ * \file helpers/shared_session/shared_session_release.c
+ *
+ * \brief Close a shared session and release it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "shared_session_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Close a shared session and release it.
+ *
+ * Requests already submitted are completed before the session is closed. No
+ * request may be submitted once release has started.
+ *
+ * \param session       The session to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status shared_session_release(shared_session* session)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+
+    /* ask the I/O thread to drain the queue and stop. */
+    if (session->thread_started)
+    {
+        atomic_store(&session->quiesce, true);
+        sem_post(&session->pending);
+        pthread_join(session->thread, NULL);
+    }
+
+    if (session->connected)
+    {
+        release_retval = agentd_session_dispose(&session->session);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    sem_destroy(&session->pending);
+
+    release_retval = rcpr_allocator_reclaim(session->alloc, session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,32 @@
+/**
+ * \file helpers/shared_session/shared_session_submit.c
+ *
+ * \brief Submit a request to a shared session without waiting for it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "shared_session_internal.h"
+
+/**
+ * \brief Submit a request to a shared session without waiting for it.
+ *
+ * The caller fills in req, complete, and context before submitting. This
+ * never blocks and may be called from any number of threads at once.
+ *
+ * \param session       The session on which the request is executed.
+ * \param request       The request to submit.
+ */
+void shared_session_submit(
+    shared_session* session, shared_session_request* request)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != request);
+    MODEL_ASSERT(NULL != request->complete);
+
+    /* count the request first so the I/O thread waits for the push. */
+    atomic_fetch_add(&session->queued, 1);
+    mpsc_queue_push(&session->queue, &request->node);
+    sem_post(&session->pending);
+}
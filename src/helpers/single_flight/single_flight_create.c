@@ -0,0 +1,59 @@
+/**
+ * \file helpers/single_flight/single_flight_create.c
+ *
+ * \brief Create a single-flight layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "single_flight_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a single-flight layer.
+ *
+ * \param sf            Pointer to the single-flight pointer to receive the
+ *                      layer on success.
+ * \param alloc         The allocator to use for this operation, which must
+ *                      be safe to use from several threads.
+ * \param read          The read backend.
+ * \param context       The backend context, which must outlive the layer.
+ *
+ * \note On success, the caller owns the layer and must release it by calling
+ * \ref single_flight_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_create(
+    single_flight** sf, RCPR_SYM(allocator)* alloc, single_flight_read_fn read,
+    void* context)
+{
+    status retval;
+    single_flight* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+    MODEL_ASSERT(NULL != read);
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_SINGLE_FLIGHT_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->read = read;
+    tmp->context = context;
+    pthread_mutex_init(&tmp->lock, NULL);
+
+    *sf = tmp;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file helpers/single_flight/single_flight_find.c
+ *
+ * \brief Find the flight for a read request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "single_flight_internal.h"
+
+/**
+ * \brief Find the flight for a request.
+ *
+ * The caller must hold the lock.
+ *
+ * \param sf            The single-flight layer.
+ * \param req           The request.
+ *
+ * \returns the flight carrying an identical request, or NULL.
+ */
+single_flight_flight* single_flight_find(
+    single_flight* sf, const read_request* req)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+    MODEL_ASSERT(NULL != req);
+
+    for (single_flight_flight* flight = sf->flights; NULL != flight;
+         flight = flight->next)
+    {
+        if (read_request_equal(&flight->req, req))
+        {
+            return flight;
+        }
+    }
+
+    return NULL;
+}
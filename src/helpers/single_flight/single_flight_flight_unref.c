@@ -0,0 +1,37 @@
+/**
+ * \file helpers/single_flight/single_flight_flight_unref.c
+ *
+ * \brief Drop a reference to a completed flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "single_flight_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Drop a reference to a completed flight, freeing it with the last.
+ *
+ * The caller must hold the lock.
+ *
+ * \param sf            The single-flight layer.
+ * \param flight        The flight.
+ */
+void single_flight_flight_unref(
+    single_flight* sf, single_flight_flight* flight)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+    MODEL_ASSERT(NULL != flight);
+    MODEL_ASSERT(flight->done);
+
+    if (--flight->refs > 0)
+    {
+        return;
+    }
+
+    read_result_dispose(&flight->result);
+    pthread_cond_destroy(&flight->done_cond);
+    rcpr_allocator_reclaim(sf->alloc, flight);
+}
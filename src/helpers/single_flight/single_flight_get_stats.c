@@ -0,0 +1,26 @@
+/**
+ * \file helpers/single_flight/single_flight_get_stats.c
+ *
+ * \brief Get a snapshot of the single-flight counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "single_flight_internal.h"
+
+/**
+ * \brief Get a snapshot of the layer counters.
+ *
+ * \param sf            The single-flight layer.
+ * \param stats         The structure to receive the counters.
+ */
+void single_flight_get_stats(single_flight* sf, single_flight_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+    MODEL_ASSERT(NULL != stats);
+
+    pthread_mutex_lock(&sf->lock);
+    *stats = sf->stats;
+    pthread_mutex_unlock(&sf->lock);
+}
@@ -0,0 +1,83 @@
+/**
+ * \file helpers/single_flight/single_flight_internal.h
+ *
+ * \brief Internal declarations for the single-flight layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/single_flight.h>
+#include <pthread.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief One wire request and the callers waiting on it.
+ *
+ * refs counts the sender and every caller that joined it. A flight is linked
+ * into the in-flight list until its result is in, and freed by whichever
+ * caller drops the last reference.
+ */
+typedef struct single_flight_flight single_flight_flight;
+
+struct single_flight_flight
+{
+    read_request req;
+    read_result result;
+    status retval;
+    uint32_t agentd_status;
+    size_t refs;
+    bool done;
+    pthread_cond_t done_cond;
+    single_flight_flight* next;
+};
+
+/**
+ * \brief The single-flight layer.
+ *
+ * The in-flight list holds at most one flight per calling thread, so a
+ * linear search is cheap. Everything but the fields set at creation is
+ * guarded by lock.
+ */
+struct single_flight
+{
+    RCPR_SYM(allocator)* alloc;
+    single_flight_read_fn read;
+    void* context;
+    pthread_mutex_t lock;
+    single_flight_flight* flights;
+    single_flight_stats stats;
+};
+
+/**
+ * \brief Find the flight for a request.
+ *
+ * The caller must hold the lock.
+ *
+ * \param sf            The single-flight layer.
+ * \param req           The request.
+ *
+ * \returns the flight carrying an identical request, or NULL.
+ */
+single_flight_flight* single_flight_find(
+    single_flight* sf, const read_request* req);
+
+/**
+ * \brief Drop a reference to a completed flight, freeing it with the last.
+ *
+ * The caller must hold the lock.
+ *
+ * \param sf            The single-flight layer.
+ * \param flight        The flight.
+ */
+void single_flight_flight_unref(
+    single_flight* sf, single_flight_flight* flight);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
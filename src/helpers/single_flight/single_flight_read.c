@@ -0,0 +1,195 @@
+/**
+ * \file helpers/single_flight/single_flight_read.c
+ *
+ * \brief Execute a read request through the single-flight layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "single_flight_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static status single_flight_join(
+    single_flight* sf, single_flight_flight* flight, read_result* result);
+static status single_flight_send(
+    single_flight* sf, const read_request* req, read_result* result);
+
+/**
+ * \brief Execute a read request, joining an identical one in flight.
+ *
+ * \param sf            The single-flight layer.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success. The caller owns
+ *                      this result and must release it by calling
+ *                      \ref read_result_dispose.
+ *
+ * \note On failure, the status reported by agentd, if any, is available to the
+ * calling thread through \ref agentd_status_last, whether or not the caller
+ * sent the request itself.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_SINGLE_FLIGHT_OUT_OF_MEMORY if the request could not be
+ *        tracked.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_read(
+    single_flight* sf, const read_request* req, read_result* result)
+{
+    single_flight_flight* flight;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != result);
+
+    pthread_mutex_lock(&sf->lock);
+    ++sf->stats.requests;
+
+    flight = single_flight_find(sf, req);
+    if (NULL != flight)
+    {
+        return single_flight_join(sf, flight, result);
+    }
+
+    return single_flight_send(sf, req, result);
+}
+
+/**
+ * \brief Wait for a flight in progress and copy its result.
+ *
+ * The lock is held on entry and released on return.
+ *
+ * \param sf            The single-flight layer.
+ * \param flight        The flight to join.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status single_flight_join(
+    single_flight* sf, single_flight_flight* flight, read_result* result)
+{
+    status retval;
+
+    ++flight->refs;
+    ++sf->stats.joined;
+    if (flight->refs > sf->stats.peak_waiters)
+    {
+        sf->stats.peak_waiters = flight->refs;
+    }
+
+    while (!flight->done)
+    {
+        pthread_cond_wait(&flight->done_cond, &sf->lock);
+    }
+
+    pthread_mutex_unlock(&sf->lock);
+
+    /* a completed flight is read-only, and our reference keeps it alive. */
+    retval = flight->retval;
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = read_result_copy(result, &flight->result);
+    }
+    else if (AGENTD_STATUS_NONE != flight->agentd_status)
+    {
+        agentd_status_record(flight->agentd_status);
+    }
+
+    pthread_mutex_lock(&sf->lock);
+    single_flight_flight_unref(sf, flight);
+    pthread_mutex_unlock(&sf->lock);
+
+    return retval;
+}
+
+/**
+ * \brief Send a request as a new flight and share its result.
+ *
+ * The lock is held on entry and released on return.
+ *
+ * \param sf            The single-flight layer.
+ * \param req           The request to send.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status single_flight_send(
+    single_flight* sf, const read_request* req, read_result* result)
+{
+    status retval;
+    single_flight_flight* flight;
+    single_flight_flight** link;
+
+    retval =
+        rcpr_allocator_allocate(sf->alloc, (void**)&flight, sizeof(*flight));
+    if (STATUS_SUCCESS != retval)
+    {
+        ++sf->stats.failures;
+        pthread_mutex_unlock(&sf->lock);
+        return ERROR_SINGLE_FLIGHT_OUT_OF_MEMORY;
+    }
+
+    memset(flight, 0, sizeof(*flight));
+    memcpy(&flight->req, req, sizeof(flight->req));
+    flight->refs = 1;
+    pthread_cond_init(&flight->done_cond, NULL);
+    flight->next = sf->flights;
+    sf->flights = flight;
+    ++sf->stats.wire_requests;
+    if (0 == sf->stats.peak_waiters)
+    {
+        sf->stats.peak_waiters = 1;
+    }
+
+    pthread_mutex_unlock(&sf->lock);
+
+    agentd_status_clear();
+    retval = sf->read(sf->context, req, &flight->result);
+
+    pthread_mutex_lock(&sf->lock);
+    flight->retval = retval;
+    if (STATUS_SUCCESS != retval)
+    {
+        ++sf->stats.failures;
+        flight->agentd_status = agentd_status_last();
+    }
+
+    /* later requests go to the wire again, so unlink before waking. */
+    link = &sf->flights;
+    while (*link != flight)
+    {
+        link = &(*link)->next;
+    }
+
+    *link = flight->next;
+    flight->done = true;
+    pthread_cond_broadcast(&flight->done_cond);
+
+    /* with nobody else waiting, the result can be handed over whole. */
+    if (STATUS_SUCCESS == retval && 1 == flight->refs)
+    {
+        read_result_move(result, &flight->result);
+    }
+    else if (STATUS_SUCCESS == retval)
+    {
+        pthread_mutex_unlock(&sf->lock);
+        retval = read_result_copy(result, &flight->result);
+        pthread_mutex_lock(&sf->lock);
+    }
+
+    single_flight_flight_unref(sf, flight);
+    pthread_mutex_unlock(&sf->lock);
+
+    return retval;
+}
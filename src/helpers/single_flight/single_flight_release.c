@@ -0,0 +1,33 @@
+/**
+ * \file helpers/single_flight/single_flight_release.c
+ *
+ * \brief Release a single-flight layer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "single_flight_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a single-flight layer.
+ *
+ * No read may be in progress.
+ *
+ * \param sf            The layer to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_release(single_flight* sf)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+    MODEL_ASSERT(NULL == sf->flights);
+
+    pthread_mutex_destroy(&sf->lock);
+
+    return rcpr_allocator_reclaim(sf->alloc, sf);
+}
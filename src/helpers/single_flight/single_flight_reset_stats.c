@@ -0,0 +1,26 @@
+/**
+ * \file helpers/single_flight/single_flight_reset_stats.c
+ *
+ * \brief Reset the single-flight counters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "single_flight_internal.h"
+
+/**
+ * \brief Reset the layer counters.
+ *
+ * \param sf            The single-flight layer.
+ */
+void single_flight_reset_stats(single_flight* sf)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sf);
+
+    pthread_mutex_lock(&sf->lock);
+    memset(&sf->stats, 0, sizeof(sf->stats));
+    pthread_mutex_unlock(&sf->lock);
+}
@@ -0,0 +1,26 @@
+/**
+ * \file helpers/single_flight/single_flight_session_pool_read.c
+ *
+ * \brief A single-flight read backend over a session pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "single_flight_internal.h"
+
+/**
+ * \brief A \ref single_flight_read_fn backed by a session pool.
+ *
+ * \param context       The \ref session_pool.
+ * \param req           The request to execute.
+ * \param result        The result to populate on success.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status single_flight_session_pool_read(
+    void* context, const read_request* req, read_result* result)
+{
+    return session_pool_read((session_pool*)context, req, result);
+}
@@ -0,0 +1,68 @@
+/**
+ * \file helpers/status_is_transport_error.c
+ *
+ * \brief Determine whether a helper status code is a transport error.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/error_class.h>
+#include <helpers/status_codes.h>
+
+/**
+ * \brief Determine whether a helper status code is a transport error.
+ *
+ * A transport error means that a request could not be written or a response
+ * could not be read. After such an error, the client and server IVs of the
+ * session can no longer be trusted to be in sync, so the session must be
+ * discarded. All other helper errors leave the session usable.
+ *
+ * \param code          The helper status code to classify.
+ *
+ * \returns true if this is a transport error and false otherwise.
+ */
+bool status_is_transport_error(status code)
+{
+    switch (code)
+    {
+        case ERROR_SEND_BLOCK_REQ:
+        case ERROR_RECV_BLOCK_RESP:
+        case ERROR_SEND_TXN_REQ:
+        case ERROR_RECV_TXN_RESP:
+        case ERROR_SEND_NEXT_BLOCK_ID_REQ:
+        case ERROR_RECV_NEXT_BLOCK_ID_RESP:
+        case ERROR_AGENTD_SOCKET_CONNECT:
+        case ERROR_SEND_LATEST_BLOCK_ID_REQ:
+        case ERROR_RECV_LATEST_BLOCK_ID_RESP:
+        case ERROR_SEND_PREV_BLOCK_ID_REQ:
+        case ERROR_RECV_PREV_BLOCK_ID_RESP:
+        case ERROR_SEND_FIRST_TXN_ID_REQ:
+        case ERROR_RECV_FIRST_TXN_ID_RESP:
+        case ERROR_SEND_LAST_TXN_ID_REQ:
+        case ERROR_RECV_LAST_TXN_ID_RESP:
+        case ERROR_SEND_BLOCK_ID_BY_HEIGHT_REQ:
+        case ERROR_RECV_BLOCK_ID_BY_HEIGHT_RESP:
+        case ERROR_SEND_NEXT_TXN_ID_REQ:
+        case ERROR_RECV_NEXT_TXN_ID_RESP:
+        case ERROR_SEND_PREV_TXN_ID_REQ:
+        case ERROR_RECV_PREV_TXN_ID_RESP:
+        case ERROR_SEND_HANDSHAKE_REQ:
+        case ERROR_RECV_HANDSHAKE_RESP:
+        case ERROR_SEND_HANDSHAKE_ACK:
+        case ERROR_RECV_HANDSHAKE_ACK:
+        case ERROR_SEND_TXN_BLOCK_ID_REQ:
+        case ERROR_RECV_TXN_BLOCK_ID_RESP:
+        case ERROR_SEND_STATUS_REQ:
+        case ERROR_RECV_STATUS_RESP:
+        case ERROR_SEND_CLOSE_REQ:
+        case ERROR_RECV_CLOSE_RESP:
+        case ERROR_EXTENDED_API_ENABLE_REQ:
+        case ERROR_RECV_EXTENDED_API_ENABLE_RESP:
+        case ERROR_PING_REQUEST_SEND:
+        case ERROR_PING_RESPONSE_RECEIVE:
+            return true;
+
+        default:
+            return false;
+    }
+}
@@ -6,6 +6,7 @@
  * \copyright 2021-2022 Velo Payments, Inc.  All rights reserved.
  */
 
+#include <helpers/agentd_status.h>
 #include <helpers/conn_helpers.h>
 #include <helpers/status_codes.h>
 #include <rcpr/status.h>
@@ -96,6 +97,7 @@ status submit_and_verify_txn(
     /* verify that the status was successful. */
     if (STATUS_SUCCESS != status)
     {
+        agentd_status_record(status);
         fprintf(stderr, "Unexpected submit status (%x).\n", status);
         retval = ERROR_TXN_SUBMIT_STATUS;
         goto cleanup_submit_response;
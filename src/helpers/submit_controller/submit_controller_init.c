@@ -0,0 +1,24 @@
+/**
+ * \file helpers/submit_controller/submit_controller_init.c
+ *
+ * \brief Initialize a submit controller.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/submit_controller.h>
+#include <string.h>
+
+/**
+ * \brief Initialize a submit controller.
+ *
+ * \param ctrl          The controller to initialize.
+ * \param opts          The options to use.
+ */
+void submit_controller_init(
+    submit_controller* ctrl, const submit_controller_options* opts)
+{
+    memset(ctrl, 0, sizeof(*ctrl));
+    memcpy(&ctrl->opts, opts, sizeof(ctrl->opts));
+    ctrl->window = opts->initial_window;
+}
@@ -0,0 +1,82 @@
+/**
+ * \file helpers/submit_controller/submit_controller_on_ack.c
+ *
+ * \brief Update the window from an acknowledgement.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/submit_controller.h>
+#include <stdbool.h>
+
+/* the weight of a new sample in the smoothed latency, as for TCP SRTT. */
+#define LATENCY_GAIN (1.0 / 8.0)
+
+/**
+ * \brief Update the window from an acknowledgement.
+ *
+ * \param ctrl          The controller.
+ * \param ack           The acknowledgement.
+ */
+void submit_controller_on_ack(
+    submit_controller* ctrl, const submit_window_ack* ack)
+{
+    const submit_controller_options* opts = &ctrl->opts;
+    bool rejected = STATUS_SUCCESS != ack->status;
+    bool slow = false;
+    uint64_t target;
+
+    ctrl->acks_since_decrease += 1;
+
+    if (!rejected)
+    {
+        if (0 == ctrl->min_latency_ns
+         || ack->latency_ns < ctrl->min_latency_ns)
+        {
+            ctrl->min_latency_ns = ack->latency_ns;
+        }
+
+        if (0 == ctrl->smoothed_latency_ns)
+        {
+            ctrl->smoothed_latency_ns = ack->latency_ns;
+        }
+        else
+        {
+            ctrl->smoothed_latency_ns +=
+                LATENCY_GAIN
+                    * ((double)ack->latency_ns - ctrl->smoothed_latency_ns);
+        }
+
+        target = submit_controller_target_ns(ctrl);
+        slow = ctrl->smoothed_latency_ns > target;
+    }
+
+    if (!rejected && !slow)
+    {
+        /* additive increase: one step per window of acknowledgements. */
+        ctrl->window += opts->additive_increase / ctrl->window;
+        if (ctrl->window > opts->max_window)
+        {
+            ctrl->window = opts->max_window;
+        }
+    }
+    else if (ctrl->acks_since_decrease >= (uint64_t)ctrl->window)
+    {
+        /* multiplicative decrease, once per window of acknowledgements. */
+        ctrl->window *= opts->multiplicative_decrease;
+        if (ctrl->window < opts->min_window)
+        {
+            ctrl->window = opts->min_window;
+        }
+
+        ctrl->acks_since_decrease = 0;
+        if (rejected)
+        {
+            ctrl->reject_decreases += 1;
+        }
+        else
+        {
+            ctrl->latency_decreases += 1;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+/**
+ * \file helpers/submit_controller/submit_controller_options_init.c
+ *
+ * \brief Initialize submit controller options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/submit_controller.h>
+#include <string.h>
+
+/**
+ * \brief Initialize submit controller options with their defaults.
+ *
+ * The window ranges from 1 to 256 and starts at 1. It grows by 1 per window
+ * of acknowledgements, halves on overload, and the latency target is twice
+ * the lowest latency seen.
+ *
+ * \param opts          The options to initialize.
+ */
+void submit_controller_options_init(submit_controller_options* opts)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->min_window = 1;
+    opts->max_window = 256;
+    opts->initial_window = 1;
+    opts->additive_increase = 1.0;
+    opts->multiplicative_decrease = 0.5;
+    opts->latency_tolerance = 2.0;
+}
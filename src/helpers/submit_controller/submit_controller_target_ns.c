@@ -0,0 +1,27 @@
+/**
+ * \file helpers/submit_controller/submit_controller_target_ns.c
+ *
+ * \brief Get the current latency target.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/submit_controller.h>
+
+/**
+ * \brief Return the current latency target.
+ *
+ * \param ctrl          The controller.
+ *
+ * \returns the latency target in nanoseconds, or 0 before the first
+ * accepted acknowledgement when the target is derived.
+ */
+uint64_t submit_controller_target_ns(const submit_controller* ctrl)
+{
+    if (0 != ctrl->opts.latency_target_ns)
+    {
+        return ctrl->opts.latency_target_ns;
+    }
+
+    return (uint64_t)(ctrl->min_latency_ns * ctrl->opts.latency_tolerance);
+}
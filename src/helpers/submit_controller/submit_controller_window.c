@@ -0,0 +1,21 @@
+/**
+ * \file helpers/submit_controller/submit_controller_window.c
+ *
+ * \brief Get the current window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/submit_controller.h>
+
+/**
+ * \brief Return the current window.
+ *
+ * \param ctrl          The controller.
+ *
+ * \returns the number of submissions that may be in flight.
+ */
+size_t submit_controller_window(const submit_controller* ctrl)
+{
+    return (size_t)ctrl->window;
+}
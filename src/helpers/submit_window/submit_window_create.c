@@ -0,0 +1,90 @@
+/**
+ * \file helpers/submit_window/submit_window_create.c
+ *
+ * \brief Create a submission window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "submit_window_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a submission window.
+ *
+ * \param win           Pointer to the window pointer to receive the window on
+ *                      success.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param session       The session to submit on.
+ * \param window        The maximum number of submissions in flight. The
+ *                      limit may later be lowered and raised back up to
+ *                      this with \ref submit_window_set_limit.
+ * \param on_ack        Optional function called for each acknowledgement.
+ * \param context       The context passed to on_ack.
+ *
+ * \note On success, the caller owns the window and must release it by calling
+ * \ref submit_window_release when it is no longer needed. The session must
+ * outlive the window.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status submit_window_create(
+    submit_window** win, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, agentd_session* session, size_t window,
+    submit_window_ack_fn on_ack, void* context)
+{
+    status retval;
+    submit_window* tmp;
+    size_t capacity = 1;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(window > 0);
+
+    while (capacity < window)
+    {
+        capacity <<= 1;
+    }
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_SUBMIT_WINDOW_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->suite = suite;
+    tmp->session = session;
+    tmp->window = window;
+    tmp->max_window = window;
+    tmp->capacity = capacity;
+    tmp->on_ack = on_ack;
+    tmp->context = context;
+    latency_histogram_init(&tmp->stats.latency);
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->slots,
+            capacity * sizeof(submit_window_slot));
+    if (STATUS_SUCCESS != retval)
+    {
+        (void)rcpr_allocator_reclaim(alloc, tmp);
+        return ERROR_SUBMIT_WINDOW_OUT_OF_MEMORY;
+    }
+
+    memset(tmp->slots, 0, capacity * sizeof(submit_window_slot));
+
+    /* success. */
+    *win = tmp;
+
+    return STATUS_SUCCESS;
+}
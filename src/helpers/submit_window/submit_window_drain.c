@@ -0,0 +1,37 @@
+/**
+ * \file helpers/submit_window/submit_window_drain.c
+ *
+ * \brief Wait for every submission in flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "submit_window_internal.h"
+
+/**
+ * \brief Wait for the acknowledgement of every submission in flight.
+ *
+ * \param win           The window.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on a transport or protocol failure.
+ */
+status submit_window_drain(submit_window* win)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+
+    while (win->in_flight > 0)
+    {
+        retval = submit_window_receive(win);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file helpers/submit_window/submit_window_in_flight.c
+ *
+ * \brief Get the number of submissions in flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "submit_window_internal.h"
+
+/**
+ * \brief Return the number of submissions in flight.
+ *
+ * \param win           The window.
+ *
+ * \returns the number of submissions in flight.
+ */
+size_t submit_window_in_flight(const submit_window* win)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+
+    return win->in_flight;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file helpers/submit_window/submit_window_internal.h
+ *
+ * \brief Internal declarations for the submission window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/submit_window.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A submission in flight.
+ */
+typedef struct submit_window_slot submit_window_slot;
+
+struct submit_window_slot
+{
+    bool in_use;
+    uint32_t offset;
+    vpr_uuid txn_id;
+    uint64_t send_ns;
+    void* context;
+};
+
+/**
+ * \brief The window.
+ *
+ * window is the current limit, and max_window the limit given at creation.
+ * The slot of a submission is its offset modulo capacity, which is a power of
+ * two no smaller than max_window so that slots survive offset wrap.
+ */
+struct submit_window
+{
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    agentd_session* session;
+    size_t window;
+    size_t max_window;
+    size_t capacity;
+    size_t in_flight;
+    uint32_t next_offset;
+    submit_window_slot* slots;
+    submit_window_ack_fn on_ack;
+    void* context;
+    submit_window_stats stats;
+};
+
+/**
+ * \brief Receive one acknowledgement and retire its submission.
+ *
+ * \param win           The window.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, including when agentd rejected the
+ *        transaction.
+ *      - a non-zero error code on a transport or protocol failure.
+ */
+status submit_window_receive(submit_window* win);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,108 @@
+/**
+ * \file helpers/submit_window/submit_window_receive.c
+ *
+ * \brief Receive one acknowledgement.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/data.h>
+
+#include "submit_window_internal.h"
+
+/**
+ * \brief Receive one acknowledgement and retire its submission.
+ *
+ * \param win           The window.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success, including when agentd rejected the
+ *        transaction.
+ *      - a non-zero error code on a transport or protocol failure.
+ */
+status submit_window_receive(submit_window* win)
+{
+    status retval;
+    agentd_session* session = win->session;
+    uint32_t request_id, status, offset;
+    vccrypt_buffer_t resp;
+    submit_window_slot* slot;
+    submit_window_ack ack;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+    MODEL_ASSERT(win->in_flight > 0);
+
+    retval =
+        vcblockchain_protocol_recvresp(
+            session->sock, win->alloc, win->suite, &session->server_iv,
+            &session->shared_secret, &resp);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error receiving response from submit.\n");
+        return ERROR_RECV_TXN_RESP;
+    }
+
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &offset, &status, &resp);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error decoding response from submit.\n");
+        retval = ERROR_DECODE_TXN_RESP;
+        goto cleanup_resp;
+    }
+
+    if (PROTOCOL_REQ_ID_TRANSACTION_SUBMIT != request_id)
+    {
+        fprintf(stderr, "Unexpected request id (%x).\n", request_id);
+        retval = ERROR_TXN_SUBMIT_REQUEST_ID;
+        goto cleanup_resp;
+    }
+
+    /* the offset must belong to a submission in flight. */
+    slot = &win->slots[offset & (win->capacity - 1)];
+    if (!slot->in_use || slot->offset != offset)
+    {
+        fprintf(stderr, "Unexpected submit offset (%x).\n", offset);
+        retval = ERROR_TXN_SUBMIT_OFFSET;
+        goto cleanup_resp;
+    }
+
+    ack.txn_id = &slot->txn_id;
+    ack.offset = offset;
+    ack.agentd_status = status;
+    ack.latency_ns = latency_clock_now_ns() - slot->send_ns;
+    ack.context = slot->context;
+
+    if (STATUS_SUCCESS == status)
+    {
+        ack.status = STATUS_SUCCESS;
+        win->stats.accepted += 1;
+        latency_histogram_record(&win->stats.latency, ack.latency_ns);
+    }
+    else
+    {
+        agentd_status_record(status);
+        ack.status = ERROR_TXN_SUBMIT_STATUS;
+        win->stats.rejected += 1;
+    }
+
+    if (NULL != win->on_ack)
+    {
+        win->on_ack(win->context, &ack);
+    }
+
+    slot->in_use = false;
+    win->in_flight -= 1;
+    retval = STATUS_SUCCESS;
+
+cleanup_resp:
+    dispose((disposable_t*)&resp);
+
+    return retval;
+}
@@ -0,0 +1,42 @@
+/**
+ * \file helpers/submit_window/submit_window_release.c
+ *
+ * \brief Release a submission window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "submit_window_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a window.
+ *
+ * Submissions still in flight are abandoned; call \ref submit_window_drain
+ * first to keep the session usable.
+ *
+ * \param win           The window to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status submit_window_release(submit_window* win)
+{
+    status retval, release_retval;
+    RCPR_SYM(allocator)* alloc = win->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+
+    retval = rcpr_allocator_reclaim(alloc, win->slots);
+
+    release_retval = rcpr_allocator_reclaim(alloc, win);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
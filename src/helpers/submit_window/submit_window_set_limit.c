@@ -0,0 +1,37 @@
+/**
+ * \file helpers/submit_window/submit_window_set_limit.c
+ *
+ * \brief Change the number of submissions that may be in flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "submit_window_internal.h"
+
+/**
+ * \brief Change the number of submissions that may be in flight.
+ *
+ * A lower limit takes effect as acknowledgements arrive; submissions already
+ * in flight are not recalled. This may be called from the acknowledgement
+ * function.
+ *
+ * \param win           The window.
+ * \param limit         The new limit, which is clamped to between 1 and the
+ *                      window given at creation.
+ */
+void submit_window_set_limit(submit_window* win, size_t limit)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+
+    if (0 == limit)
+    {
+        limit = 1;
+    }
+    else if (limit > win->max_window)
+    {
+        limit = win->max_window;
+    }
+
+    win->window = limit;
+}
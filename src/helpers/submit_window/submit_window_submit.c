@@ -0,0 +1,87 @@
+/**
+ * \file helpers/submit_window/submit_window_submit.c
+ *
+ * \brief Submit a transaction through a window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+#include <vcblockchain/protocol.h>
+
+#include "submit_window_internal.h"
+
+/**
+ * \brief Submit a transaction, first waiting for an acknowledgement if the
+ * window is full.
+ *
+ * \param win           The window.
+ * \param txn_id        The transaction id.
+ * \param artifact_id   The artifact id.
+ * \param cert          The transaction certificate. It is sent before this
+ *                      function returns and may then be released.
+ * \param context       A value passed back in the acknowledgement.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on a transport or protocol failure, after
+ *        which the session can't be used.
+ */
+status submit_window_submit(
+    submit_window* win, const vpr_uuid* txn_id, const vpr_uuid* artifact_id,
+    const vccrypt_buffer_t* cert, void* context)
+{
+    status retval;
+    agentd_session* session = win->session;
+    uint32_t offset = win->next_offset;
+    submit_window_slot* slot = &win->slots[offset & (win->capacity - 1)];
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+    MODEL_ASSERT(NULL != txn_id);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != cert);
+
+    /* wait for room, and for a straggler still holding this slot. */
+    if (win->in_flight >= win->window || slot->in_use)
+    {
+        win->stats.full_waits += 1;
+    }
+
+    while (win->in_flight >= win->window || slot->in_use)
+    {
+        retval = submit_window_receive(win);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    slot->send_ns = latency_clock_now_ns();
+
+    retval =
+        vcblockchain_protocol_sendreq_transaction_submit(
+            session->sock, win->suite, &session->client_iv,
+            &session->shared_secret, offset, txn_id, artifact_id,
+            cert->data, cert->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error submitting transaction.\n");
+        return ERROR_SEND_TXN_REQ;
+    }
+
+    slot->in_use = true;
+    slot->offset = offset;
+    slot->context = context;
+    memcpy(&slot->txn_id, txn_id, sizeof(slot->txn_id));
+
+    win->in_flight += 1;
+    win->stats.submitted += 1;
+
+    /* the offset is unsigned, so this wraps from 0xFFFFFFFF to 0. */
+    ++win->next_offset;
+
+    return STATUS_SUCCESS;
+}
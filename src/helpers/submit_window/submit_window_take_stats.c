@@ -0,0 +1,28 @@
+/**
+ * \file helpers/submit_window/submit_window_take_stats.c
+ *
+ * \brief Get the counters of a window, and reset them.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "submit_window_internal.h"
+
+/**
+ * \brief Get the counters of a window, and reset them.
+ *
+ * \param win           The window.
+ * \param stats         Pointer to receive the counters.
+ */
+void submit_window_take_stats(submit_window* win, submit_window_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != win);
+    MODEL_ASSERT(NULL != stats);
+
+    memcpy(stats, &win->stats, sizeof(*stats));
+    memset(&win->stats, 0, sizeof(win->stats));
+    latency_histogram_init(&win->stats.latency);
+}
@@ -0,0 +1,150 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_create.c
+ *
+ * \brief Create a task scheduler.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "task_scheduler_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a task scheduler.
+ *
+ * \param sched         Pointer to the scheduler pointer to receive the
+ *                      scheduler on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param file          The OS file abstraction to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param worker_count  The number of workers, each with its own session.
+ * \param hostaddr      The host IP address for this operation.
+ * \param hostport      The host port for this operation.
+ * \param clientpriv    The file name of the client private certificate (must
+ *                      not be encrypted).
+ * \param serverpub     The file name of the server public certificate.
+ *
+ * \note On success, the caller owns the scheduler and must release it by
+ * calling \ref task_scheduler_release when it is no longer needed. The
+ * allocator and crypto suite must outlive the scheduler. Stealing starts out
+ * enabled.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status task_scheduler_create(
+    task_scheduler** sched, RCPR_SYM(allocator)* alloc, file* file,
+    vccrypt_suite_options_t* suite, size_t worker_count,
+    const char* hostaddr, unsigned int hostport, const char* clientpriv,
+    const char* serverpub)
+{
+    status retval, release_retval;
+    task_scheduler* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sched);
+    MODEL_ASSERT(worker_count > 0);
+
+    /* allocate the scheduler. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_TASK_SCHEDULER_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->suite = suite;
+    atomic_init(&tmp->next_worker, 0);
+    atomic_init(&tmp->queued, 0);
+    atomic_init(&tmp->pending, 0);
+    atomic_init(&tmp->sleepers, 0);
+    atomic_init(&tmp->stealing, true);
+    pthread_mutex_init(&tmp->lock, NULL);
+    pthread_cond_init(&tmp->work_cond, NULL);
+    pthread_cond_init(&tmp->done_cond, NULL);
+
+    /* allocate the workers. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->workers,
+            worker_count * sizeof(task_scheduler_worker));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_TASK_SCHEDULER_OUT_OF_MEMORY;
+        goto cleanup_sched;
+    }
+
+    memset(tmp->workers, 0, worker_count * sizeof(task_scheduler_worker));
+    tmp->worker_count = worker_count;
+
+    /* connect each session and start its worker. */
+    for (size_t i = 0; i < worker_count; ++i)
+    {
+        task_scheduler_worker* worker = &tmp->workers[i];
+
+        worker->sched = tmp;
+        worker->index = i;
+        worker->random = 0x9E3779B97F4A7C15ULL * (i + 1);
+        atomic_init(&worker->depth, 0);
+        pthread_mutex_init(&worker->lock, NULL);
+
+        retval =
+            agentd_session_init(
+                &worker->session, alloc, file, suite, hostaddr, hostport,
+                clientpriv, serverpub);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error connecting scheduler session %zu.\n", i);
+            goto cleanup_workers;
+        }
+
+        worker->connected = true;
+
+        if (0 !=
+                pthread_create(
+                    &worker->thread, NULL, &task_scheduler_worker_thread,
+                    worker))
+        {
+            fprintf(stderr, "Error starting scheduler thread %zu.\n", i);
+            retval = ERROR_TASK_SCHEDULER_THREAD_CREATE;
+            goto cleanup_workers;
+        }
+
+        worker->thread_started = true;
+    }
+
+    /* success. */
+    *sched = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_workers:
+    /* task_scheduler_release handles partially constructed schedulers. */
+    release_retval = task_scheduler_release(tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    goto done;
+
+cleanup_sched:
+    pthread_cond_destroy(&tmp->done_cond);
+    pthread_cond_destroy(&tmp->work_cond);
+    pthread_mutex_destroy(&tmp->lock);
+    release_retval = rcpr_allocator_reclaim(alloc, tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,96 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_internal.h
+ *
+ * \brief Internal declarations for the task scheduler.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/task_scheduler.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+typedef struct task_scheduler_task task_scheduler_task;
+typedef struct task_scheduler_worker task_scheduler_worker;
+
+/**
+ * \brief A spawned task, linked into a worker's deque.
+ */
+struct task_scheduler_task
+{
+    task_scheduler_task* older;
+    task_scheduler_task* newer;
+    task_scheduler_fn fn;
+    void* arg;
+};
+
+/**
+ * \brief A worker, its session, and its deque.
+ *
+ * The owner pops the newest task; thieves take the oldest. Both ends are
+ * guarded by the worker lock, which is only contended while stealing.
+ */
+struct task_scheduler_worker
+{
+    task_scheduler* sched;
+    size_t index;
+    agentd_session session;
+    bool connected;
+    bool thread_started;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    task_scheduler_task* oldest;
+    task_scheduler_task* newest;
+    atomic_size_t depth;
+    uint64_t random;
+    task_scheduler_worker_stats stats;
+};
+
+/**
+ * \brief The scheduler.
+ *
+ * queued counts tasks sitting in any deque, and pending counts tasks spawned
+ * but not yet finished. Idle workers sleep on work_cond, and callers of
+ * \ref task_scheduler_wait sleep on done_cond, both under lock. sleepers
+ * lets spawn skip the lock when no worker is asleep.
+ */
+struct task_scheduler
+{
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    task_scheduler_worker* workers;
+    size_t worker_count;
+    atomic_size_t next_worker;
+    atomic_size_t queued;
+    atomic_size_t pending;
+    atomic_size_t sleepers;
+    atomic_bool stealing;
+    pthread_mutex_t lock;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    bool quiesce;
+};
+
+/**
+ * \brief The worker running on this thread, or NULL outside of a worker.
+ */
+extern _Thread_local task_scheduler_worker* task_scheduler_current_worker;
+
+/**
+ * \brief Entry point for a task scheduler worker thread.
+ *
+ * \param context       The \ref task_scheduler_worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* task_scheduler_worker_thread(void* context);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,86 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_release.c
+ *
+ * \brief Run every remaining task, then stop the workers and release the
+ * scheduler.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "task_scheduler_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Run every remaining task, then stop the workers and release the
+ * scheduler.
+ *
+ * \param sched         The scheduler to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status task_scheduler_release(task_scheduler* sched)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    RCPR_SYM(allocator)* alloc = sched->alloc;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sched);
+
+    /* stealing lets any worker finish tasks queued on a worker that failed
+     * to start. */
+    atomic_store(&sched->stealing, true);
+    task_scheduler_wait(sched);
+
+    /* wake every worker and let them exit. */
+    pthread_mutex_lock(&sched->lock);
+    sched->quiesce = true;
+    pthread_cond_broadcast(&sched->work_cond);
+    pthread_mutex_unlock(&sched->lock);
+
+    /* join the workers and release their sessions. */
+    for (size_t i = 0; i < sched->worker_count; ++i)
+    {
+        task_scheduler_worker* worker = &sched->workers[i];
+
+        if (worker->thread_started)
+        {
+            pthread_join(worker->thread, NULL);
+        }
+
+        if (worker->connected)
+        {
+            release_retval = agentd_session_dispose(&worker->session);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        /* workers past the point of failure in create were never set up. */
+        if (NULL != worker->sched)
+        {
+            pthread_mutex_destroy(&worker->lock);
+        }
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, sched->workers);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    pthread_cond_destroy(&sched->done_cond);
+    pthread_cond_destroy(&sched->work_cond);
+    pthread_mutex_destroy(&sched->lock);
+
+    release_retval = rcpr_allocator_reclaim(alloc, sched);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
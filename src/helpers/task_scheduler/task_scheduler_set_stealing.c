@@ -0,0 +1,31 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_set_stealing.c
+ *
+ * \brief Enable or disable stealing.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "task_scheduler_internal.h"
+
+/**
+ * \brief Enable or disable stealing.
+ *
+ * With stealing disabled, each worker only runs the tasks given to it, which
+ * is a static partition of the work. This is useful as a baseline.
+ *
+ * \param sched         The scheduler.
+ * \param enabled       true to enable stealing.
+ */
+void task_scheduler_set_stealing(task_scheduler* sched, bool enabled)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sched);
+
+    atomic_store(&sched->stealing, enabled);
+
+    /* idle workers re-check what they may run. */
+    pthread_mutex_lock(&sched->lock);
+    pthread_cond_broadcast(&sched->work_cond);
+    pthread_mutex_unlock(&sched->lock);
+}
@@ -0,0 +1,88 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_spawn.c
+ *
+ * \brief Spawn a task.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "task_scheduler_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Spawn a task.
+ *
+ * A task spawned from a running task is pushed onto its worker's own deque.
+ * A task spawned from any other thread is given to the workers in turn.
+ *
+ * \param sched         The scheduler.
+ * \param fn            The task function.
+ * \param arg           The argument passed to the task function.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status task_scheduler_spawn(
+    task_scheduler* sched, task_scheduler_fn fn, void* arg)
+{
+    status retval;
+    task_scheduler_task* task;
+    task_scheduler_worker* worker = task_scheduler_current_worker;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sched);
+    MODEL_ASSERT(NULL != fn);
+
+    retval =
+        rcpr_allocator_allocate(sched->alloc, (void**)&task, sizeof(*task));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_TASK_SCHEDULER_OUT_OF_MEMORY;
+    }
+
+    task->fn = fn;
+    task->arg = arg;
+    task->newer = NULL;
+
+    /* tasks from outside the scheduler are dealt out round robin. */
+    if (NULL == worker || worker->sched != sched)
+    {
+        worker =
+            &sched->workers[
+                atomic_fetch_add(&sched->next_worker, 1)
+                    % sched->worker_count];
+    }
+
+    atomic_fetch_add(&sched->pending, 1);
+
+    /* push onto the newest end of the deque. */
+    pthread_mutex_lock(&worker->lock);
+    task->older = worker->newest;
+    if (NULL == worker->newest)
+    {
+        worker->oldest = task;
+    }
+    else
+    {
+        worker->newest->newer = task;
+    }
+    worker->newest = task;
+    atomic_fetch_add(&worker->depth, 1);
+    atomic_fetch_add(&sched->queued, 1);
+    pthread_mutex_unlock(&worker->lock);
+
+    /* a sleeping worker counts itself before checking for work, so either it
+     * sees this task or this sees it. */
+    if (0 != atomic_load(&sched->sleepers))
+    {
+        pthread_mutex_lock(&sched->lock);
+        pthread_cond_broadcast(&sched->work_cond);
+        pthread_mutex_unlock(&sched->lock);
+    }
+
+    return STATUS_SUCCESS;
+}
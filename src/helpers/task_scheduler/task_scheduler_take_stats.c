@@ -0,0 +1,35 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_take_stats.c
+ *
+ * \brief Get the counters of each worker, and reset them.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "task_scheduler_internal.h"
+
+/**
+ * \brief Get the counters of each worker, and reset them.
+ *
+ * This should be called while the scheduler is idle.
+ *
+ * \param sched         The scheduler.
+ * \param stats         Array of one entry per worker to receive the counters.
+ */
+void task_scheduler_take_stats(
+    task_scheduler* sched, task_scheduler_worker_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sched);
+    MODEL_ASSERT(NULL != stats);
+
+    /* workers update their counters before finishing each task, so the
+     * counters are stable once the scheduler is idle. */
+    for (size_t i = 0; i < sched->worker_count; ++i)
+    {
+        stats[i] = sched->workers[i].stats;
+        memset(&sched->workers[i].stats, 0, sizeof(stats[i]));
+    }
+}
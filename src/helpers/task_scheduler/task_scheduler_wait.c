@@ -0,0 +1,30 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_wait.c
+ *
+ * \brief Wait until every spawned task has run.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "task_scheduler_internal.h"
+
+/**
+ * \brief Wait until every spawned task, and every task they spawned, has
+ * run.
+ *
+ * This must not be called from a task.
+ *
+ * \param sched         The scheduler.
+ */
+void task_scheduler_wait(task_scheduler* sched)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sched);
+
+    pthread_mutex_lock(&sched->lock);
+    while (0 != atomic_load(&sched->pending))
+    {
+        pthread_cond_wait(&sched->done_cond, &sched->lock);
+    }
+    pthread_mutex_unlock(&sched->lock);
+}
@@ -0,0 +1,234 @@
+/**
+ * \file helpers/task_scheduler/task_scheduler_worker_thread.c
+ *
+ * \brief Entry point for a task scheduler worker thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/conn_helpers.h>
+#include <helpers/latency_histogram.h>
+
+#include "task_scheduler_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+_Thread_local task_scheduler_worker* task_scheduler_current_worker = NULL;
+
+/* forward decls. */
+static task_scheduler_task* task_scheduler_pop_newest(
+    task_scheduler_worker* worker);
+static task_scheduler_task* task_scheduler_steal(
+    task_scheduler_worker* thief);
+static bool task_scheduler_sleep(task_scheduler_worker* worker);
+
+/**
+ * \brief Entry point for a task scheduler worker thread.
+ *
+ * \param context       The \ref task_scheduler_worker for this thread.
+ *
+ * \returns NULL.
+ */
+void* task_scheduler_worker_thread(void* context)
+{
+    task_scheduler_worker* worker = (task_scheduler_worker*)context;
+    task_scheduler* sched = worker->sched;
+    task_scheduler_task* task;
+    bool stolen;
+    uint64_t start;
+
+    task_scheduler_current_worker = worker;
+
+    for (;;)
+    {
+        /* run our own newest task, or steal the oldest task of another. */
+        stolen = false;
+        task = task_scheduler_pop_newest(worker);
+        if (NULL == task && atomic_load(&sched->stealing))
+        {
+            task = task_scheduler_steal(worker);
+            stolen = (NULL != task);
+        }
+
+        if (NULL == task)
+        {
+            if (!task_scheduler_sleep(worker))
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        start = latency_clock_now_ns();
+        task->fn(sched, &worker->session, task->arg);
+        (void)rcpr_allocator_reclaim(sched->alloc, task);
+
+        worker->stats.busy_ns += latency_clock_now_ns() - start;
+        worker->stats.tasks += 1;
+        worker->stats.steals += stolen ? 1 : 0;
+
+        /* the last task to finish wakes anyone waiting. */
+        if (1 == atomic_fetch_sub(&sched->pending, 1))
+        {
+            pthread_mutex_lock(&sched->lock);
+            pthread_cond_broadcast(&sched->done_cond);
+            pthread_mutex_unlock(&sched->lock);
+        }
+    }
+
+    /* close the session gracefully. */
+    (void)send_and_verify_close_connection(
+        worker->session.sock, sched->alloc, sched->suite,
+        &worker->session.client_iv, &worker->session.server_iv,
+        &worker->session.shared_secret);
+
+    task_scheduler_current_worker = NULL;
+
+    return NULL;
+}
+
+/**
+ * \brief Pop the newest task from a worker's own deque.
+ *
+ * \param worker        The worker.
+ *
+ * \returns the task, or NULL if the deque is empty.
+ */
+static task_scheduler_task* task_scheduler_pop_newest(
+    task_scheduler_worker* worker)
+{
+    task_scheduler_task* task;
+
+    if (0 == atomic_load(&worker->depth))
+    {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&worker->lock);
+    task = worker->newest;
+    if (NULL != task)
+    {
+        worker->newest = task->older;
+        if (NULL == worker->newest)
+        {
+            worker->oldest = NULL;
+        }
+        else
+        {
+            worker->newest->newer = NULL;
+        }
+
+        atomic_fetch_sub(&worker->depth, 1);
+        atomic_fetch_sub(&worker->sched->queued, 1);
+    }
+    pthread_mutex_unlock(&worker->lock);
+
+    return task;
+}
+
+/**
+ * \brief Steal the oldest task of another worker.
+ *
+ * Victims are scanned from a random starting point, so idle workers don't all
+ * converge on the same victim.
+ *
+ * \param thief         The worker looking for work.
+ *
+ * \returns the stolen task, or NULL if every other deque is empty.
+ */
+static task_scheduler_task* task_scheduler_steal(
+    task_scheduler_worker* thief)
+{
+    task_scheduler* sched = thief->sched;
+    task_scheduler_worker* victim;
+    task_scheduler_task* task;
+    size_t start;
+
+    if (0 == atomic_load(&sched->queued))
+    {
+        return NULL;
+    }
+
+    /* xorshift64 */
+    thief->random ^= thief->random << 13;
+    thief->random ^= thief->random >> 7;
+    thief->random ^= thief->random << 17;
+    start = thief->random % sched->worker_count;
+
+    for (size_t i = 0; i < sched->worker_count; ++i)
+    {
+        victim = &sched->workers[(start + i) % sched->worker_count];
+        if (victim == thief || 0 == atomic_load(&victim->depth))
+        {
+            continue;
+        }
+
+        pthread_mutex_lock(&victim->lock);
+        task = victim->oldest;
+        if (NULL != task)
+        {
+            victim->oldest = task->newer;
+            if (NULL == victim->oldest)
+            {
+                victim->newest = NULL;
+            }
+            else
+            {
+                victim->oldest->older = NULL;
+            }
+
+            atomic_fetch_sub(&victim->depth, 1);
+            atomic_fetch_sub(&sched->queued, 1);
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (NULL != task)
+        {
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Sleep until there may be work for this worker.
+ *
+ * \param worker        The worker.
+ *
+ * \returns true if the worker should look for work again, or false if the
+ * scheduler is shutting down.
+ */
+static bool task_scheduler_sleep(task_scheduler_worker* worker)
+{
+    task_scheduler* sched = worker->sched;
+    bool keep_running = true;
+
+    pthread_mutex_lock(&sched->lock);
+    atomic_fetch_add(&sched->sleepers, 1);
+
+    for (;;)
+    {
+        /* with stealing, any queued task is ours to run. */
+        if (0 != atomic_load(&worker->depth)
+         || (atomic_load(&sched->stealing)
+          && 0 != atomic_load(&sched->queued)))
+        {
+            break;
+        }
+
+        if (sched->quiesce)
+        {
+            keep_running = false;
+            break;
+        }
+
+        pthread_cond_wait(&sched->work_cond, &sched->lock);
+    }
+
+    atomic_fetch_sub(&sched->sleepers, 1);
+    pthread_mutex_unlock(&sched->lock);
+
+    return keep_running;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file helpers/uring_transport/uring_transport_add_session.c
+ *
+ * \brief Add a session to an io_uring transport.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "uring_transport_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Add a session to a transport.
+ *
+ * The session and its descriptor remain owned by the caller and must outlive
+ * the transport. While a request is outstanding on it, the session must not
+ * be used through any other path.
+ *
+ * \param transport     The transport.
+ * \param session       The session, whose socket wraps descriptor.
+ * \param descriptor    The socket descriptor of the session, as passed to
+ *                      \ref agentd_session_init_from_descriptor.
+ * \param index         Pointer to receive the index identifying the session
+ *                      in this transport.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_add_session(
+    uring_transport* transport, agentd_session* session, int descriptor,
+    size_t* index)
+{
+    status retval;
+    uring_transport_session* s;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(descriptor >= 0);
+    MODEL_ASSERT(NULL != index);
+
+    if (transport->session_count == transport->max_sessions)
+    {
+        return ERROR_URING_TRANSPORT_OUT_OF_MEMORY;
+    }
+
+    s = &transport->sessions[transport->session_count];
+    memset(s, 0, sizeof(*s));
+    s->session = session;
+    s->descriptor = descriptor;
+    s->rx_capacity = URING_TRANSPORT_RX_INITIAL_CAPACITY;
+
+    retval =
+        rcpr_allocator_allocate(
+            transport->alloc, (void**)&s->rx, s->rx_capacity);
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_URING_TRANSPORT_OUT_OF_MEMORY;
+    }
+
+    *index = transport->session_count++;
+
+    return STATUS_SUCCESS;
+}
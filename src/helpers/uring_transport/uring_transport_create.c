@@ -0,0 +1,182 @@
+/**
+ * \file helpers/uring_transport/uring_transport_create.c
+ *
+ * \brief Create an io_uring transport.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "uring_transport_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a transport.
+ *
+ * \param transport     Pointer to the transport pointer to receive the
+ *                      transport on success.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param max_sessions  The largest number of sessions that will be added.
+ *
+ * \note On success, the caller owns the transport and must release it by
+ * calling \ref uring_transport_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_SETUP if the kernel doesn't support io_uring
+ *        or it is disabled.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_create(
+    uring_transport** transport, RCPR_SYM(allocator)* alloc,
+    vccrypt_suite_options_t* suite, size_t max_sessions)
+{
+    status retval;
+    uring_transport* tmp;
+    struct io_uring_params params;
+    unsigned entries = 1;
+    uint8_t* sq;
+    uint8_t* cq;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(max_sessions > 0);
+
+    /* each session may have a send and a receive in the queue at once. */
+    while (entries < 2 * max_sessions && entries < 32768)
+    {
+        entries *= 2;
+    }
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_URING_TRANSPORT_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->suite = suite;
+    tmp->max_sessions = max_sessions;
+    tmp->sq_ring = MAP_FAILED;
+    tmp->cq_ring = MAP_FAILED;
+    tmp->sqes = MAP_FAILED;
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->sessions,
+            max_sessions * sizeof(uring_transport_session));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = ERROR_URING_TRANSPORT_OUT_OF_MEMORY;
+        goto cleanup_transport;
+    }
+
+    memset(&params, 0, sizeof(params));
+    tmp->ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (tmp->ring_fd < 0)
+    {
+        retval = ERROR_URING_TRANSPORT_SETUP;
+        goto cleanup_sessions;
+    }
+
+    /* map the submission and completion rings, which may share a mapping. */
+    tmp->sq_ring_size =
+        params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    tmp->cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (tmp->cq_ring_size > tmp->sq_ring_size)
+        {
+            tmp->sq_ring_size = tmp->cq_ring_size;
+        }
+        tmp->cq_ring_size = 0;
+    }
+
+    tmp->sq_ring =
+        mmap(
+            NULL, tmp->sq_ring_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, tmp->ring_fd, IORING_OFF_SQ_RING);
+    if (MAP_FAILED == tmp->sq_ring)
+    {
+        retval = ERROR_URING_TRANSPORT_SETUP;
+        goto cleanup_ring;
+    }
+
+    if (0 == tmp->cq_ring_size)
+    {
+        tmp->cq_ring = tmp->sq_ring;
+    }
+    else
+    {
+        tmp->cq_ring =
+            mmap(
+                NULL, tmp->cq_ring_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, tmp->ring_fd, IORING_OFF_CQ_RING);
+        if (MAP_FAILED == tmp->cq_ring)
+        {
+            retval = ERROR_URING_TRANSPORT_SETUP;
+            goto cleanup_ring;
+        }
+    }
+
+    tmp->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    tmp->sqes =
+        mmap(
+            NULL, tmp->sqes_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, tmp->ring_fd, IORING_OFF_SQES);
+    if (MAP_FAILED == tmp->sqes)
+    {
+        retval = ERROR_URING_TRANSPORT_SETUP;
+        goto cleanup_ring;
+    }
+
+    sq = (uint8_t*)tmp->sq_ring;
+    tmp->sq_head = (unsigned*)(sq + params.sq_off.head);
+    tmp->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    tmp->sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+    tmp->sq_array = (unsigned*)(sq + params.sq_off.array);
+    tmp->sq_entries = params.sq_entries;
+    tmp->sq_tail_local = *tmp->sq_tail;
+
+    cq = (uint8_t*)tmp->cq_ring;
+    tmp->cq_head = (unsigned*)(cq + params.cq_off.head);
+    tmp->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    tmp->cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+    tmp->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+    *transport = tmp;
+
+    return STATUS_SUCCESS;
+
+cleanup_ring:
+    if (MAP_FAILED != tmp->sqes)
+    {
+        munmap(tmp->sqes, tmp->sqes_size);
+    }
+    if (MAP_FAILED != tmp->cq_ring && tmp->cq_ring != tmp->sq_ring)
+    {
+        munmap(tmp->cq_ring, tmp->cq_ring_size);
+    }
+    if (MAP_FAILED != tmp->sq_ring)
+    {
+        munmap(tmp->sq_ring, tmp->sq_ring_size);
+    }
+    close(tmp->ring_fd);
+
+cleanup_sessions:
+    rcpr_allocator_reclaim(alloc, tmp->sessions);
+
+cleanup_transport:
+    rcpr_allocator_reclaim(alloc, tmp);
+
+    return retval;
+}
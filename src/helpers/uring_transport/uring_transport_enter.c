@@ -0,0 +1,67 @@
+/**
+ * \file helpers/uring_transport/uring_transport_enter.c
+ *
+ * \brief Submit queued entries and wait for completions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "uring_transport_internal.h"
+
+/**
+ * \brief Call io_uring_enter, submitting every queued entry.
+ *
+ * \param transport     The transport.
+ * \param min_complete  The number of completions to wait for.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_IO on failure.
+ */
+status uring_transport_enter(
+    uring_transport* transport, unsigned min_complete)
+{
+    long submitted;
+    unsigned flags = (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+
+    /* make the filled entries visible to the kernel. */
+    __atomic_store_n(
+        transport->sq_tail, transport->sq_tail_local, __ATOMIC_RELEASE);
+
+    for (;;)
+    {
+        ++transport->stats.enters;
+        submitted =
+            syscall(
+                __NR_io_uring_enter, transport->ring_fd, transport->to_submit,
+                min_complete, flags, NULL, 0);
+        if (submitted >= 0)
+        {
+            break;
+        }
+
+        /* a full completion queue clears once the caller reaps it. */
+        if (EBUSY == errno || EAGAIN == errno)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        if (EINTR != errno)
+        {
+            return ERROR_URING_TRANSPORT_IO;
+        }
+    }
+
+    transport->to_submit -= (unsigned)submitted;
+    transport->stats.submitted += (uint64_t)submitted;
+
+    return STATUS_SUCCESS;
+}
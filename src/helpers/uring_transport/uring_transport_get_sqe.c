@@ -0,0 +1,63 @@
+/**
+ * \file helpers/uring_transport/uring_transport_get_sqe.c
+ *
+ * \brief Get a free submission entry.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "uring_transport_internal.h"
+
+/**
+ * \brief Get a free submission entry, submitting queued entries first if the
+ * submission queue is full.
+ *
+ * The entry is zeroed and already counted in to_submit.
+ *
+ * \param transport     The transport.
+ * \param sqe           Pointer to receive the entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_IO on failure.
+ */
+status uring_transport_get_sqe(
+    uring_transport* transport, struct io_uring_sqe** sqe)
+{
+    status retval;
+    unsigned head, index;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(NULL != sqe);
+
+    head = __atomic_load_n(transport->sq_head, __ATOMIC_ACQUIRE);
+    if (transport->sq_tail_local - head >= transport->sq_entries)
+    {
+        retval = uring_transport_enter(transport, 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        head = __atomic_load_n(transport->sq_head, __ATOMIC_ACQUIRE);
+        if (transport->sq_tail_local - head >= transport->sq_entries)
+        {
+            return ERROR_URING_TRANSPORT_IO;
+        }
+    }
+
+    index = transport->sq_tail_local & *transport->sq_mask;
+    *sqe = &transport->sqes[index];
+    memset(*sqe, 0, sizeof(**sqe));
+    transport->sq_array[index] = index;
+
+    /* the tail is published on the next enter, once the entry is filled. */
+    ++transport->sq_tail_local;
+    ++transport->to_submit;
+
+    return STATUS_SUCCESS;
+}
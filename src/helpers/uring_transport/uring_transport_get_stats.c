@@ -0,0 +1,25 @@
+/**
+ * \file helpers/uring_transport/uring_transport_get_stats.c
+ *
+ * \brief Get the counters of an io_uring transport.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "uring_transport_internal.h"
+
+/**
+ * \brief Get a snapshot of the transport counters.
+ *
+ * \param transport     The transport.
+ * \param stats         The structure to receive the counters.
+ */
+void uring_transport_get_stats(
+    const uring_transport* transport, uring_transport_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(NULL != stats);
+
+    *stats = transport->stats;
+}
@@ -0,0 +1,155 @@
+/**
+ * \file helpers/uring_transport/uring_transport_internal.h
+ *
+ * \brief Internal declarations for the io_uring transport.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/uring_transport.h>
+#include <linux/io_uring.h>
+#include <stdbool.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief The initial receive buffer size of a session.
+ */
+#define URING_TRANSPORT_RX_INITIAL_CAPACITY                     16384
+
+/**
+ * \brief Operation tags, kept in the low bit of the completion user data.
+ * The session index occupies the remaining bits.
+ */
+#define URING_TRANSPORT_OP_SEND                                 0
+#define URING_TRANSPORT_OP_RECV                                 1
+
+/**
+ * \brief The user data of cancellation requests, whose completions are
+ * ignored.
+ */
+#define URING_TRANSPORT_CANCEL_TAG                              UINT64_MAX
+
+/**
+ * \brief The state of one session.
+ *
+ * tx holds the encrypted request until every byte of it is written. rx
+ * accumulates response bytes until they decode as a whole frame. awaiting is
+ * set from the time a request is queued until its completion is returned.
+ */
+typedef struct uring_transport_session uring_transport_session;
+
+struct uring_transport_session
+{
+    agentd_session* session;
+    int descriptor;
+    void* tx;
+    size_t tx_size;
+    size_t tx_offset;
+    uint8_t* rx;
+    size_t rx_size;
+    size_t rx_capacity;
+    bool send_pending;
+    bool recv_pending;
+    bool awaiting;
+    bool failed;
+};
+
+/**
+ * \brief The transport.
+ *
+ * The rings are shared with the kernel. sq_tail_local is the tail of
+ * submission entries filled in but not yet consumed by io_uring_enter, of
+ * which there are to_submit. inflight counts send and receive operations
+ * the kernel has not completed.
+ */
+struct uring_transport
+{
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    int ring_fd;
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    struct io_uring_sqe* sqes;
+    size_t sqes_size;
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    unsigned sq_entries;
+    unsigned sq_tail_local;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+    unsigned to_submit;
+    size_t inflight;
+    uring_transport_session* sessions;
+    size_t session_count;
+    size_t max_sessions;
+    uring_transport_stats stats;
+};
+
+/**
+ * \brief Call io_uring_enter, submitting every queued entry.
+ *
+ * \param transport     The transport.
+ * \param min_complete  The number of completions to wait for.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_IO on failure.
+ */
+status uring_transport_enter(
+    uring_transport* transport, unsigned min_complete);
+
+/**
+ * \brief Get a free submission entry, submitting queued entries first if the
+ * submission queue is full.
+ *
+ * The entry is zeroed and already counted in to_submit.
+ *
+ * \param transport     The transport.
+ * \param sqe           Pointer to receive the entry.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_IO on failure.
+ */
+status uring_transport_get_sqe(
+    uring_transport* transport, struct io_uring_sqe** sqe);
+
+/**
+ * \brief Queue a send of the unwritten remainder of a session's request.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_queue_send(uring_transport* transport, size_t index);
+
+/**
+ * \brief Queue a receive into the free space of a session's receive buffer,
+ * growing the buffer first if it is full.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_queue_recv(uring_transport* transport, size_t index);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,72 @@
+/**
+ * \file helpers/uring_transport/uring_transport_queue_recv.c
+ *
+ * \brief Queue a receive for a session's response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "uring_transport_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Queue a receive into the free space of a session's receive buffer,
+ * growing the buffer first if it is full.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_queue_recv(uring_transport* transport, size_t index)
+{
+    status retval;
+    struct io_uring_sqe* sqe;
+    uint8_t* rx;
+    uring_transport_session* s = &transport->sessions[index];
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(index < transport->session_count);
+    MODEL_ASSERT(!s->recv_pending);
+
+    /* large responses, such as blocks, outgrow the initial buffer. */
+    if (s->rx_size == s->rx_capacity)
+    {
+        retval =
+            rcpr_allocator_allocate(
+                transport->alloc, (void**)&rx, 2 * s->rx_capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            return ERROR_URING_TRANSPORT_OUT_OF_MEMORY;
+        }
+
+        memcpy(rx, s->rx, s->rx_size);
+        rcpr_allocator_reclaim(transport->alloc, s->rx);
+        s->rx = rx;
+        s->rx_capacity *= 2;
+    }
+
+    retval = uring_transport_get_sqe(transport, &sqe);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = s->descriptor;
+    sqe->addr = (uint64_t)(uintptr_t)(s->rx + s->rx_size);
+    sqe->len = (uint32_t)(s->rx_capacity - s->rx_size);
+    sqe->user_data = ((uint64_t)index << 1) | URING_TRANSPORT_OP_RECV;
+
+    s->recv_pending = true;
+    ++transport->inflight;
+
+    return STATUS_SUCCESS;
+}
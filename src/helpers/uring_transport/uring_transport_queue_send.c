@@ -0,0 +1,51 @@
+/**
+ * \file helpers/uring_transport/uring_transport_queue_send.c
+ *
+ * \brief Queue the send of a session's request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <sys/socket.h>
+
+#include "uring_transport_internal.h"
+
+/**
+ * \brief Queue a send of the unwritten remainder of a session's request.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_queue_send(uring_transport* transport, size_t index)
+{
+    status retval;
+    struct io_uring_sqe* sqe;
+    uring_transport_session* s = &transport->sessions[index];
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(index < transport->session_count);
+    MODEL_ASSERT(s->tx_offset < s->tx_size);
+
+    retval = uring_transport_get_sqe(transport, &sqe);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = s->descriptor;
+    sqe->addr = (uint64_t)(uintptr_t)((uint8_t*)s->tx + s->tx_offset);
+    sqe->len = (uint32_t)(s->tx_size - s->tx_offset);
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = ((uint64_t)index << 1) | URING_TRANSPORT_OP_SEND;
+
+    s->send_pending = true;
+    ++transport->inflight;
+
+    return STATUS_SUCCESS;
+}
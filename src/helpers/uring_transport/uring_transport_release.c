@@ -0,0 +1,108 @@
+/**
+ * \file helpers/uring_transport/uring_transport_release.c
+ *
+ * \brief Release an io_uring transport.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "uring_transport_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a transport.
+ *
+ * Outstanding requests are cancelled first.
+ *
+ * \param transport     The transport to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_release(uring_transport* transport)
+{
+    status retval = STATUS_SUCCESS;
+    struct io_uring_sqe* sqe;
+    unsigned head, tail;
+    const struct io_uring_cqe* cqe;
+    uring_transport_session* s;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+
+    /* the kernel may still write into the buffers of pending operations. */
+    for (size_t i = 0; i < transport->session_count; ++i)
+    {
+        s = &transport->sessions[i];
+        for (uint64_t op = 0; op < 2; ++op)
+        {
+            if ((0 == op && !s->send_pending) || (1 == op && !s->recv_pending))
+            {
+                continue;
+            }
+
+            retval = uring_transport_get_sqe(transport, &sqe);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto drained;
+            }
+
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = ((uint64_t)i << 1) | op;
+            sqe->user_data = URING_TRANSPORT_CANCEL_TAG;
+        }
+    }
+
+    while (transport->inflight > 0)
+    {
+        retval = uring_transport_enter(transport, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto drained;
+        }
+
+        head = *transport->cq_head;
+        tail = __atomic_load_n(transport->cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head)
+        {
+            cqe = &transport->cqes[head & *transport->cq_mask];
+            if (URING_TRANSPORT_CANCEL_TAG != cqe->user_data)
+            {
+                --transport->inflight;
+            }
+        }
+
+        __atomic_store_n(transport->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+drained:
+    /* closing the ring cancels anything left before the buffers go. */
+    munmap(transport->sqes, transport->sqes_size);
+    if (transport->cq_ring != transport->sq_ring)
+    {
+        munmap(transport->cq_ring, transport->cq_ring_size);
+    }
+    munmap(transport->sq_ring, transport->sq_ring_size);
+    close(transport->ring_fd);
+
+    for (size_t i = 0; i < transport->session_count; ++i)
+    {
+        s = &transport->sessions[i];
+        if (NULL != s->tx)
+        {
+            rcpr_allocator_reclaim(transport->alloc, s->tx);
+        }
+        rcpr_allocator_reclaim(transport->alloc, s->rx);
+    }
+
+    rcpr_allocator_reclaim(transport->alloc, transport->sessions);
+    rcpr_allocator_reclaim(transport->alloc, transport);
+
+    return retval;
+}
@@ -0,0 +1,97 @@
+/**
+ * \file helpers/uring_transport/uring_transport_send.c
+ *
+ * \brief Queue a request on an io_uring transport session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+
+#include "uring_transport_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Queue a request on a session.
+ *
+ * The request is encrypted now, but is not written until the next call to
+ * \ref uring_transport_wait, which submits every queued request at once.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ * \param encode        The function writing the request.
+ * \param context       The request arguments passed to encode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_BUSY if the session already has a request
+ *        outstanding.
+ *      - ERROR_URING_TRANSPORT_CLOSED if the session has failed.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_send(
+    uring_transport* transport, size_t index, session_frame_encode_fn encode,
+    void* context)
+{
+    status retval;
+    uring_transport_session* s;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(index < transport->session_count);
+    MODEL_ASSERT(NULL != encode);
+
+    s = &transport->sessions[index];
+    if (s->failed)
+    {
+        return ERROR_URING_TRANSPORT_CLOSED;
+    }
+
+    if (s->awaiting || s->send_pending)
+    {
+        return ERROR_URING_TRANSPORT_BUSY;
+    }
+
+    retval =
+        session_frame_encode(
+            s->session, transport->alloc, transport->suite, encode, context,
+            &s->tx, &s->tx_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    s->tx_offset = 0;
+    s->awaiting = true;
+
+    retval = uring_transport_queue_send(transport, index);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    /* the receive goes into the same batch as the send. */
+    if (!s->recv_pending)
+    {
+        retval = uring_transport_queue_recv(transport, index);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto fail;
+        }
+    }
+
+    return STATUS_SUCCESS;
+
+fail:
+    /* the client IV has moved on, so the session can't be reused. */
+    s->failed = true;
+    s->awaiting = false;
+    if (!s->send_pending)
+    {
+        rcpr_allocator_reclaim(transport->alloc, s->tx);
+        s->tx = NULL;
+    }
+
+    return retval;
+}
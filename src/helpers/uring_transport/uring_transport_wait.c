@@ -0,0 +1,231 @@
+/**
+ * \file helpers/uring_transport/uring_transport_wait.c
+ *
+ * \brief Submit queued operations and collect completed requests.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <string.h>
+
+#include "uring_transport_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/* forward decls. */
+static status uring_transport_handle_cqe(
+    uring_transport* transport, const struct io_uring_cqe* cqe,
+    uring_transport_completion* completion, bool* completed);
+static void uring_transport_fail(
+    uring_transport* transport, size_t index, status retval,
+    uring_transport_completion* completion, bool* completed);
+
+/**
+ * \brief Submit every queued operation and wait for requests to complete.
+ *
+ * This blocks until at least one request completes, then returns as many
+ * completions as are ready, up to max.
+ *
+ * \param transport     The transport.
+ * \param completions   Array to receive the completions.
+ * \param max           The size of the array.
+ * \param count         Pointer to receive the number of completions, which is
+ *                      zero only if no request was outstanding.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status uring_transport_wait(
+    uring_transport* transport, uring_transport_completion* completions,
+    size_t max, size_t* count)
+{
+    status retval;
+    unsigned head, tail;
+    bool completed;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != transport);
+    MODEL_ASSERT(NULL != completions);
+    MODEL_ASSERT(max > 0);
+    MODEL_ASSERT(NULL != count);
+
+    *count = 0;
+
+    for (;;)
+    {
+        /* reap whatever is ready, leaving the rest for the next call. */
+        head = *transport->cq_head;
+        tail = __atomic_load_n(transport->cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail && *count < max)
+        {
+            retval =
+                uring_transport_handle_cqe(
+                    transport, &transport->cqes[head & *transport->cq_mask],
+                    &completions[*count], &completed);
+            ++head;
+            __atomic_store_n(transport->cq_head, head, __ATOMIC_RELEASE);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            if (completed)
+            {
+                ++*count;
+            }
+        }
+
+        if (*count > 0 || 0 == transport->inflight)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        /* one call submits the whole batch and waits for the first reply. */
+        retval = uring_transport_enter(transport, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+}
+
+/**
+ * \brief Handle one completion queue entry.
+ *
+ * \param transport     The transport.
+ * \param cqe           The entry.
+ * \param completion    The completion to populate if a request finished.
+ * \param completed     Set to true if completion was populated.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code if the transport itself failed.
+ */
+static status uring_transport_handle_cqe(
+    uring_transport* transport, const struct io_uring_cqe* cqe,
+    uring_transport_completion* completion, bool* completed)
+{
+    status retval;
+    size_t index;
+    uring_transport_session* s;
+
+    *completed = false;
+    ++transport->stats.completed;
+
+    if (URING_TRANSPORT_CANCEL_TAG == cqe->user_data)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    --transport->inflight;
+    index = (size_t)(cqe->user_data >> 1);
+    s = &transport->sessions[index];
+
+    if (URING_TRANSPORT_OP_SEND == (cqe->user_data & 1))
+    {
+        s->send_pending = false;
+        if (-EINTR == cqe->res || -EAGAIN == cqe->res)
+        {
+            return uring_transport_queue_send(transport, index);
+        }
+
+        if (cqe->res < 0)
+        {
+            rcpr_allocator_reclaim(transport->alloc, s->tx);
+            s->tx = NULL;
+            uring_transport_fail(
+                transport, index, ERROR_URING_TRANSPORT_IO, completion,
+                completed);
+            return STATUS_SUCCESS;
+        }
+
+        /* a short send leaves the rest of the frame for another round. */
+        s->tx_offset += (size_t)cqe->res;
+        if (s->tx_offset < s->tx_size)
+        {
+            return uring_transport_queue_send(transport, index);
+        }
+
+        rcpr_allocator_reclaim(transport->alloc, s->tx);
+        s->tx = NULL;
+
+        return STATUS_SUCCESS;
+    }
+
+    s->recv_pending = false;
+    if (-EINTR == cqe->res || -EAGAIN == cqe->res)
+    {
+        return uring_transport_queue_recv(transport, index);
+    }
+
+    if (cqe->res <= 0)
+    {
+        uring_transport_fail(
+            transport, index,
+            (0 == cqe->res) ? ERROR_URING_TRANSPORT_CLOSED
+                            : ERROR_URING_TRANSPORT_IO,
+            completion, completed);
+        return STATUS_SUCCESS;
+    }
+
+    s->rx_size += (size_t)cqe->res;
+    if (!s->awaiting)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        session_frame_decode(
+            s->session, transport->alloc, transport->suite, s->rx,
+            s->rx_size, &completion->response);
+    if (ERROR_SESSION_FRAME_INCOMPLETE == retval)
+    {
+        return uring_transport_queue_recv(transport, index);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        uring_transport_fail(transport, index, retval, completion, completed);
+        return STATUS_SUCCESS;
+    }
+
+    s->rx_size = 0;
+    s->awaiting = false;
+    completion->session = index;
+    completion->retval = STATUS_SUCCESS;
+    *completed = true;
+    ++transport->stats.responses;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Mark a session as failed, reporting its outstanding request once.
+ *
+ * \param transport     The transport.
+ * \param index         The session index.
+ * \param retval        The error to report.
+ * \param completion    The completion to populate.
+ * \param completed     Set to true if completion was populated.
+ */
+static void uring_transport_fail(
+    uring_transport* transport, size_t index, status retval,
+    uring_transport_completion* completion, bool* completed)
+{
+    uring_transport_session* s = &transport->sessions[index];
+
+    s->failed = true;
+    if (!s->awaiting)
+    {
+        return;
+    }
+
+    s->awaiting = false;
+    memset(completion, 0, sizeof(*completion));
+    completion->session = index;
+    completion->retval = retval;
+    *completed = true;
+}
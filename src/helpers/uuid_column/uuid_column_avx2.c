@@ -0,0 +1,164 @@
+/**
+ * \file helpers/uuid_column/uuid_column_avx2.c
+ *
+ * \brief AVX2 UUID column kernels.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "uuid_column_internal.h"
+
+#if defined(UUID_COLUMN_X86)
+
+#include <immintrin.h>
+
+/* the low and high entries of a 256-bit comparison mask. */
+#define LOW_ENTRY   0x0000FFFFU
+#define HIGH_ENTRY  0xFFFF0000U
+
+/**
+ * \brief Find the first entry of a column equal to a UUID.
+ *
+ * Two entries fill one 256-bit register, which is compared against the UUID
+ * broadcast to both lanes. Four entries are compared per iteration, and the
+ * group holding a match is rescanned one entry at a time.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to find.
+ *
+ * \returns the index of the entry, or count if there is none.
+ */
+__attribute__((target("avx2")))
+size_t uuid_column_avx2_find(
+    const uint8_t* column, size_t count, const uint8_t* id)
+{
+    const __m256i needle =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)id));
+    const uint8_t* row;
+    uint32_t m0, m1;
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        row = column + i * UUID_COLUMN_ENTRY_SIZE;
+        m0 = (uint32_t)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)row), needle));
+        m1 = (uint32_t)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)(row + 32)), needle));
+
+        /* one branch per group; matches are rare. */
+        if ((LOW_ENTRY == (m0 & LOW_ENTRY))
+          | (HIGH_ENTRY == (m0 & HIGH_ENTRY))
+          | (LOW_ENTRY == (m1 & LOW_ENTRY))
+          | (HIGH_ENTRY == (m1 & HIGH_ENTRY)))
+        {
+            break;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        row = column + i * UUID_COLUMN_ENTRY_SIZE;
+        if (0xFFFF
+                == _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(
+                        _mm_loadu_si128((const __m128i*)row),
+                        _mm256_castsi256_si128(needle))))
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Count the entries of a column equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to count.
+ *
+ * \returns the number of equal entries.
+ */
+__attribute__((target("avx2")))
+size_t uuid_column_avx2_count(
+    const uint8_t* column, size_t count, const uint8_t* id)
+{
+    const __m256i needle =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)id));
+    const uint8_t* row;
+    uint32_t mask;
+    size_t matches = 0, i = 0;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        row = column + i * UUID_COLUMN_ENTRY_SIZE;
+        mask = (uint32_t)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)row), needle));
+
+        matches +=
+            (LOW_ENTRY == (mask & LOW_ENTRY))
+          + (HIGH_ENTRY == (mask & HIGH_ENTRY));
+    }
+
+    if (i < count)
+    {
+        row = column + i * UUID_COLUMN_ENTRY_SIZE;
+        matches +=
+            0xFFFF
+         == _mm_movemask_epi8(
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)row),
+                    _mm256_castsi256_si128(needle)));
+    }
+
+    return matches;
+}
+
+/**
+ * \brief Clear the mask of every entry of a column not equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to keep.
+ * \param mask          One byte per entry, 1 to keep it and 0 to drop it.
+ */
+__attribute__((target("avx2")))
+void uuid_column_avx2_filter(
+    const uint8_t* column, size_t count, const uint8_t* id, uint8_t* mask)
+{
+    const __m256i needle =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)id));
+    const uint8_t* row;
+    uint32_t bits;
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        row = column + i * UUID_COLUMN_ENTRY_SIZE;
+        bits = (uint32_t)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)row), needle));
+
+        mask[i] &= LOW_ENTRY == (bits & LOW_ENTRY);
+        mask[i + 1] &= HIGH_ENTRY == (bits & HIGH_ENTRY);
+    }
+
+    if (i < count)
+    {
+        row = column + i * UUID_COLUMN_ENTRY_SIZE;
+        mask[i] &=
+            0xFFFF
+         == _mm_movemask_epi8(
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)row),
+                    _mm256_castsi256_si128(needle)));
+    }
+}
+
+#endif /* defined(UUID_COLUMN_X86) */
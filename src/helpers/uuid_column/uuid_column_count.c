@@ -0,0 +1,32 @@
+/**
+ * \file helpers/uuid_column/uuid_column_count.c
+ *
+ * \brief Count the entries of a column equal to a UUID.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/parameters.h>
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Count the entries of a column equal to a UUID.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to count.
+ *
+ * \returns the number of equal entries.
+ */
+size_t uuid_column_count(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != column || 0 == count);
+    MODEL_ASSERT(NULL != id);
+
+    return uuid_column_kernels_get(impl)->count(column, count, id);
+}
@@ -0,0 +1,49 @@
+/**
+ * \file helpers/uuid_column/uuid_column_count_many.c
+ *
+ * \brief Count the matches of each of many candidate UUIDs in a column.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/parameters.h>
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Count the matches of each of many candidate UUIDs in a column.
+ *
+ * Given a column of artifact IDs, this counts the transactions of each
+ * candidate artifact.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param ids           The candidates, as a column.
+ * \param id_count      The number of candidates.
+ * \param counts        Array of one entry per candidate to receive its
+ *                      number of matches.
+ *
+ * \returns the total number of matches.
+ */
+size_t uuid_column_count_many(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* ids, size_t id_count, size_t* counts)
+{
+    const uuid_column_kernels* kernels = uuid_column_kernels_get(impl);
+    size_t total = 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != column || 0 == count);
+    MODEL_ASSERT(NULL != ids || 0 == id_count);
+    MODEL_ASSERT(NULL != counts || 0 == id_count);
+
+    for (size_t i = 0; i < id_count; ++i)
+    {
+        counts[i] =
+            kernels->count(column, count, ids + i * UUID_COLUMN_ENTRY_SIZE);
+        total += counts[i];
+    }
+
+    return total;
+}
@@ -0,0 +1,36 @@
+/**
+ * \file helpers/uuid_column/uuid_column_filter.c
+ *
+ * \brief Filter a row mask by a UUID column.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/parameters.h>
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Clear the mask of every entry of a column not equal to a UUID.
+ *
+ * Filtering the same mask by several columns keeps the rows that match on
+ * all of them, as a columnar scan with several equality predicates does.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to keep.
+ * \param mask          One byte per entry, 1 to keep it and 0 to drop it.
+ *                      Entries equal to the UUID are left as they are.
+ */
+void uuid_column_filter(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* id, uint8_t* mask)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != column || 0 == count);
+    MODEL_ASSERT(NULL != id);
+    MODEL_ASSERT(NULL != mask || 0 == count);
+
+    uuid_column_kernels_get(impl)->filter(column, count, id, mask);
+}
@@ -0,0 +1,32 @@
+/**
+ * \file helpers/uuid_column/uuid_column_find.c
+ *
+ * \brief Find the first entry of a column equal to a UUID.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/parameters.h>
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Find the first entry of a column equal to a UUID.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to find.
+ *
+ * \returns the index of the entry, or count if there is none.
+ */
+size_t uuid_column_find(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != column || 0 == count);
+    MODEL_ASSERT(NULL != id);
+
+    return uuid_column_kernels_get(impl)->find(column, count, id);
+}
@@ -0,0 +1,46 @@
+/**
+ * \file helpers/uuid_column/uuid_column_find_many.c
+ *
+ * \brief Find each of many candidate UUIDs in a column.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/parameters.h>
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Find each of many candidate UUIDs in a column.
+ *
+ * \param impl          The implementation, which must be supported.
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param ids           The candidates, as a column.
+ * \param id_count      The number of candidates.
+ * \param indexes       Array of one entry per candidate to receive the index
+ *                      of its first match, or count if there is none.
+ *
+ * \returns the number of candidates found.
+ */
+size_t uuid_column_find_many(
+    uuid_column_impl impl, const uint8_t* column, size_t count,
+    const uint8_t* ids, size_t id_count, size_t* indexes)
+{
+    const uuid_column_kernels* kernels = uuid_column_kernels_get(impl);
+    size_t found = 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != column || 0 == count);
+    MODEL_ASSERT(NULL != ids || 0 == id_count);
+    MODEL_ASSERT(NULL != indexes || 0 == id_count);
+
+    for (size_t i = 0; i < id_count; ++i)
+    {
+        indexes[i] =
+            kernels->find(column, count, ids + i * UUID_COLUMN_ENTRY_SIZE);
+        found += indexes[i] < count;
+    }
+
+    return found;
+}
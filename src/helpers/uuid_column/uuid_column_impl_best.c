@@ -0,0 +1,29 @@
+/**
+ * \file helpers/uuid_column/uuid_column_impl_best.c
+ *
+ * \brief Select the fastest implementation for this CPU.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Return the fastest implementation that can run on this CPU.
+ *
+ * \returns the implementation.
+ */
+uuid_column_impl uuid_column_impl_best(void)
+{
+    if (uuid_column_impl_supported(UUID_COLUMN_IMPL_AVX2))
+    {
+        return UUID_COLUMN_IMPL_AVX2;
+    }
+
+    if (uuid_column_impl_supported(UUID_COLUMN_IMPL_SSE2))
+    {
+        return UUID_COLUMN_IMPL_SSE2;
+    }
+
+    return UUID_COLUMN_IMPL_SCALAR;
+}
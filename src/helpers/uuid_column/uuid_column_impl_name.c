@@ -0,0 +1,34 @@
+/**
+ * \file helpers/uuid_column/uuid_column_impl_name.c
+ *
+ * \brief Get the name of an implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Return the name of an implementation.
+ *
+ * \param impl          The implementation.
+ *
+ * \returns the name.
+ */
+const char* uuid_column_impl_name(uuid_column_impl impl)
+{
+    switch (impl)
+    {
+        case UUID_COLUMN_IMPL_SCALAR:
+            return "scalar";
+
+        case UUID_COLUMN_IMPL_SSE2:
+            return "sse2";
+
+        case UUID_COLUMN_IMPL_AVX2:
+            return "avx2";
+
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * \file helpers/uuid_column/uuid_column_impl_supported.c
+ *
+ * \brief Check whether an implementation can run on this CPU.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Return true if the given implementation can run on this CPU.
+ *
+ * \param impl          The implementation.
+ *
+ * \returns true if the implementation is supported.
+ */
+bool uuid_column_impl_supported(uuid_column_impl impl)
+{
+    switch (impl)
+    {
+        case UUID_COLUMN_IMPL_SCALAR:
+            return true;
+
+#if defined(UUID_COLUMN_X86)
+        case UUID_COLUMN_IMPL_SSE2:
+            return __builtin_cpu_supports("sse2");
+
+        case UUID_COLUMN_IMPL_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif /* defined(UUID_COLUMN_X86) */
+
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * \file helpers/uuid_column/uuid_column_internal.h
+ *
+ * \brief Internal declarations for the UUID column kernels.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/uuid_column.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief Defined when the SSE2 and AVX2 kernels are built.
+ *
+ * The AVX2 kernels are compiled with a function target attribute rather than
+ * a build flag, so that one binary runs everywhere and selects a kernel at
+ * run time.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define UUID_COLUMN_X86
+#endif
+
+/**
+ * \brief The kernels of one implementation.
+ */
+typedef struct uuid_column_kernels uuid_column_kernels;
+
+struct uuid_column_kernels
+{
+    size_t (*find)(const uint8_t* column, size_t count, const uint8_t* id);
+    size_t (*count)(const uint8_t* column, size_t count, const uint8_t* id);
+    void (*filter)(
+        const uint8_t* column, size_t count, const uint8_t* id,
+        uint8_t* mask);
+};
+
+/**
+ * \brief Get the kernels of an implementation.
+ *
+ * \param impl          The implementation, which must be supported.
+ *
+ * \returns the kernels.
+ */
+const uuid_column_kernels* uuid_column_kernels_get(uuid_column_impl impl);
+
+size_t uuid_column_scalar_find(
+    const uint8_t* column, size_t count, const uint8_t* id);
+size_t uuid_column_scalar_count(
+    const uint8_t* column, size_t count, const uint8_t* id);
+void uuid_column_scalar_filter(
+    const uint8_t* column, size_t count, const uint8_t* id, uint8_t* mask);
+
+#if defined(UUID_COLUMN_X86)
+size_t uuid_column_sse2_find(
+    const uint8_t* column, size_t count, const uint8_t* id);
+size_t uuid_column_sse2_count(
+    const uint8_t* column, size_t count, const uint8_t* id);
+void uuid_column_sse2_filter(
+    const uint8_t* column, size_t count, const uint8_t* id, uint8_t* mask);
+size_t uuid_column_avx2_find(
+    const uint8_t* column, size_t count, const uint8_t* id);
+size_t uuid_column_avx2_count(
+    const uint8_t* column, size_t count, const uint8_t* id);
+void uuid_column_avx2_filter(
+    const uint8_t* column, size_t count, const uint8_t* id, uint8_t* mask);
+#endif /* defined(UUID_COLUMN_X86) */
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
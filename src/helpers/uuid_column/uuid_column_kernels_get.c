@@ -0,0 +1,51 @@
+/**
+ * \file helpers/uuid_column/uuid_column_kernels_get.c
+ *
+ * \brief Get the kernels of an implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/parameters.h>
+
+#include "uuid_column_internal.h"
+
+static const uuid_column_kernels scalar_kernels = {
+    &uuid_column_scalar_find, &uuid_column_scalar_count,
+    &uuid_column_scalar_filter };
+
+#if defined(UUID_COLUMN_X86)
+static const uuid_column_kernels sse2_kernels = {
+    &uuid_column_sse2_find, &uuid_column_sse2_count,
+    &uuid_column_sse2_filter };
+static const uuid_column_kernels avx2_kernels = {
+    &uuid_column_avx2_find, &uuid_column_avx2_count,
+    &uuid_column_avx2_filter };
+#endif /* defined(UUID_COLUMN_X86) */
+
+/**
+ * \brief Get the kernels of an implementation.
+ *
+ * \param impl          The implementation, which must be supported.
+ *
+ * \returns the kernels.
+ */
+const uuid_column_kernels* uuid_column_kernels_get(uuid_column_impl impl)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(uuid_column_impl_supported(impl));
+
+    switch (impl)
+    {
+#if defined(UUID_COLUMN_X86)
+        case UUID_COLUMN_IMPL_SSE2:
+            return &sse2_kernels;
+
+        case UUID_COLUMN_IMPL_AVX2:
+            return &avx2_kernels;
+#endif /* defined(UUID_COLUMN_X86) */
+
+        default:
+            return &scalar_kernels;
+    }
+}
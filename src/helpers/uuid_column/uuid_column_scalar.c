@@ -0,0 +1,89 @@
+/**
+ * \file helpers/uuid_column/uuid_column_scalar.c
+ *
+ * \brief Portable UUID column kernels.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "uuid_column_internal.h"
+
+/**
+ * \brief Return true if two UUIDs are equal.
+ *
+ * Each UUID is compared as two 64-bit words, without the constant time
+ * guarantee of crypto_memcmp.
+ */
+static inline bool uuid_equal(const uint8_t* lhs, const uint8_t* rhs)
+{
+    uint64_t l[2], r[2];
+
+    memcpy(l, lhs, sizeof(l));
+    memcpy(r, rhs, sizeof(r));
+
+    return 0 == ((l[0] ^ r[0]) | (l[1] ^ r[1]));
+}
+
+/**
+ * \brief Find the first entry of a column equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to find.
+ *
+ * \returns the index of the entry, or count if there is none.
+ */
+size_t uuid_column_scalar_find(
+    const uint8_t* column, size_t count, const uint8_t* id)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (uuid_equal(column + i * UUID_COLUMN_ENTRY_SIZE, id))
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Count the entries of a column equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to count.
+ *
+ * \returns the number of equal entries.
+ */
+size_t uuid_column_scalar_count(
+    const uint8_t* column, size_t count, const uint8_t* id)
+{
+    size_t matches = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        matches += uuid_equal(column + i * UUID_COLUMN_ENTRY_SIZE, id);
+    }
+
+    return matches;
+}
+
+/**
+ * \brief Clear the mask of every entry of a column not equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to keep.
+ * \param mask          One byte per entry, 1 to keep it and 0 to drop it.
+ */
+void uuid_column_scalar_filter(
+    const uint8_t* column, size_t count, const uint8_t* id, uint8_t* mask)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        mask[i] &= uuid_equal(column + i * UUID_COLUMN_ENTRY_SIZE, id);
+    }
+}
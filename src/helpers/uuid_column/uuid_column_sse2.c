@@ -0,0 +1,121 @@
+/**
+ * \file helpers/uuid_column/uuid_column_sse2.c
+ *
+ * \brief SSE2 UUID column kernels.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "uuid_column_internal.h"
+
+#if defined(UUID_COLUMN_X86)
+
+#include <emmintrin.h>
+
+/**
+ * \brief Find the first entry of a column equal to a UUID.
+ *
+ * One entry fills one 128-bit register; an entry matches when all sixteen
+ * byte lanes compare equal. Four entries are compared per iteration, and
+ * the group holding a match is rescanned one entry at a time.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to find.
+ *
+ * \returns the index of the entry, or count if there is none.
+ */
+__attribute__((target("sse2")))
+size_t uuid_column_sse2_find(
+    const uint8_t* column, size_t count, const uint8_t* id)
+{
+    const __m128i needle = _mm_loadu_si128((const __m128i*)id);
+    const __m128i* rows = (const __m128i*)column;
+    int m0, m1, m2, m3;
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        m0 = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i), needle));
+        m1 = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i + 1), needle));
+        m2 = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i + 2), needle));
+        m3 = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i + 3), needle));
+
+        /* one branch per group; matches are rare. */
+        if ((0xFFFF == m0) | (0xFFFF == m1) | (0xFFFF == m2)
+          | (0xFFFF == m3))
+        {
+            break;
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        m0 = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i), needle));
+        if (0xFFFF == m0)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Count the entries of a column equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to count.
+ *
+ * \returns the number of equal entries.
+ */
+__attribute__((target("sse2")))
+size_t uuid_column_sse2_count(
+    const uint8_t* column, size_t count, const uint8_t* id)
+{
+    const __m128i needle = _mm_loadu_si128((const __m128i*)id);
+    const __m128i* rows = (const __m128i*)column;
+    size_t matches = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        matches +=
+            0xFFFF
+         == _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i), needle));
+    }
+
+    return matches;
+}
+
+/**
+ * \brief Clear the mask of every entry of a column not equal to a UUID.
+ *
+ * \param column        The column.
+ * \param count         The number of entries in the column.
+ * \param id            The UUID to keep.
+ * \param mask          One byte per entry, 1 to keep it and 0 to drop it.
+ */
+__attribute__((target("sse2")))
+void uuid_column_sse2_filter(
+    const uint8_t* column, size_t count, const uint8_t* id, uint8_t* mask)
+{
+    const __m128i needle = _mm_loadu_si128((const __m128i*)id);
+    const __m128i* rows = (const __m128i*)column;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        mask[i] &=
+            0xFFFF
+         == _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_loadu_si128(rows + i), needle));
+    }
+}
+
+#endif /* defined(UUID_COLUMN_X86) */
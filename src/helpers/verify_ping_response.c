@@ -0,0 +1,100 @@
+/**
+ * \file helpers/verify_ping_response.c
+ *
+ * \brief Verify a decrypted extended api ping response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/agentd_status.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+
+/**
+ * \brief Verify a decrypted response to an extended api ping request.
+ *
+ * \param suite             The crypto suite to use for this operation.
+ * \param response          The decrypted response, which remains owned by
+ *                          the caller.
+ * \param offset            The offset used for the request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status verify_ping_response(
+    vccrypt_suite_options_t* suite, vccrypt_buffer_t* response,
+    uint32_t offset)
+{
+    status retval;
+    uint32_t request_id, resp_offset, status_code;
+    protocol_resp_extended_api ping_resp;
+
+    /* decode the response header. */
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &resp_offset, &status_code, response);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error decoding extended api ping response.\n");
+        retval = ERROR_PING_RESPONSE_DECODE_HEADER;
+        goto done;
+    }
+
+    /* verify that the request id matches. */
+    if (PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV != request_id)
+    {
+        fprintf(
+            stderr, "Unexpected extended api ping response id (%x).\n",
+            request_id);
+        retval = ERROR_PING_RESPONSE_ID;
+    }
+
+    /* verify that the status was successful. */
+    if (STATUS_SUCCESS != status_code)
+    {
+        agentd_status_record(status_code);
+        fprintf(
+            stderr, "Unexpected extended api ping response status (%x).\n",
+            status_code);
+        retval = ERROR_PING_RESPONSE_STATUS_CODE;
+    }
+
+    /* verify that the offset is correct. */
+    if (offset != resp_offset)
+    {
+        fprintf(
+            stderr, "Unexpected extended api ping response offset (%x).\n",
+            resp_offset);
+        retval = ERROR_PING_RESPONSE_OFFSET;
+    }
+
+    /* if we failed one of the checks above, error out. */
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* decode the response. */
+    retval =
+        vcblockchain_protocol_decode_resp_extended_api(
+            &ping_resp, suite->alloc_opts, response->data, response->size);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Could not decode extended api ping response (%x).\n",
+            retval);
+        retval = ERROR_PING_RESPONSE_DECODE;
+        goto done;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    dispose((disposable_t*)&ping_resp);
+
+done:
+    return retval;
+}
@@ -0,0 +1,31 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_abandon.c
+ *
+ * \brief Give up on the pending frames of a failed socket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "zerocopy_sender_internal.h"
+
+/**
+ * \brief Release every pending frame without waiting for its notification.
+ *
+ * \param sender        The sender.
+ */
+void zerocopy_sender_abandon(zerocopy_sender* sender)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+
+    while (sender->pending_count > 0)
+    {
+        --sender->pending_count;
+        if (NULL != sender->opts.release)
+        {
+            sender->opts.release(
+                sender->opts.context,
+                sender->pending[sender->pending_count].frame);
+        }
+    }
+}
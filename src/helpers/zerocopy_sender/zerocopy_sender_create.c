@@ -0,0 +1,79 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_create.c
+ *
+ * \brief Create a zero-copy sender.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <helpers/status_codes.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include "zerocopy_sender_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Create a sender for a connected stream socket.
+ *
+ * \param sender        Pointer to the sender pointer to receive the sender on
+ *                      success.
+ * \param alloc         The allocator to use for this operation.
+ * \param descriptor    The socket, which remains owned by the caller and
+ *                      must outlive the sender. The kernel numbers zero-copy
+ *                      sends per socket, so no other sender may ever have
+ *                      used this socket.
+ * \param opts          The sender options.
+ *
+ * \note On success, the caller owns the sender and must release it by calling
+ * \ref zerocopy_sender_release when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status zerocopy_sender_create(
+    zerocopy_sender** sender, RCPR_SYM(allocator)* alloc, int descriptor,
+    const zerocopy_sender_options* opts)
+{
+    status retval;
+    zerocopy_sender* tmp;
+    int one = 1;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+    MODEL_ASSERT(descriptor >= 0);
+    MODEL_ASSERT(NULL != opts);
+    MODEL_ASSERT(opts->max_pending > 0);
+
+    retval = rcpr_allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return ERROR_ZEROCOPY_SENDER_OUT_OF_MEMORY;
+    }
+
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->alloc = alloc;
+    tmp->descriptor = descriptor;
+    tmp->opts = *opts;
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&tmp->pending,
+            opts->max_pending * sizeof(zerocopy_sender_pending));
+    if (STATUS_SUCCESS != retval)
+    {
+        rcpr_allocator_reclaim(alloc, tmp);
+        return ERROR_ZEROCOPY_SENDER_OUT_OF_MEMORY;
+    }
+
+    /* without SO_ZEROCOPY, every frame takes the normal path. */
+    tmp->stats.enabled =
+        0 == setsockopt(descriptor, SOL_SOCKET, SO_ZEROCOPY, &one,
+                        sizeof(one));
+
+    *sender = tmp;
+
+    return STATUS_SUCCESS;
+}
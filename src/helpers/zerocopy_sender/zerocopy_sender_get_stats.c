@@ -0,0 +1,25 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_get_stats.c
+ *
+ * \brief Get the counters of a zero-copy sender.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "zerocopy_sender_internal.h"
+
+/**
+ * \brief Get a snapshot of the sender counters.
+ *
+ * \param sender        The sender.
+ * \param stats         The structure to receive the counters.
+ */
+void zerocopy_sender_get_stats(
+    const zerocopy_sender* sender, zerocopy_sender_stats* stats)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+    MODEL_ASSERT(NULL != stats);
+
+    *stats = sender->stats;
+}
@@ -0,0 +1,79 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_internal.h
+ *
+ * \brief Internal declarations for the zero-copy sender.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#include <helpers/zerocopy_sender.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/**
+ * \brief A frame the kernel may still be reading.
+ *
+ * Each send call with MSG_ZEROCOPY that queues data is numbered, and the
+ * kernel reports completed calls as ranges of those numbers. first_id and
+ * last_id span the calls made for this frame, and outstanding counts those
+ * not yet reported.
+ */
+typedef struct zerocopy_sender_pending zerocopy_sender_pending;
+
+struct zerocopy_sender_pending
+{
+    void* frame;
+    uint32_t first_id;
+    uint32_t last_id;
+    uint32_t outstanding;
+    bool copied;
+};
+
+/**
+ * \brief The sender.
+ *
+ * next_id is the number the kernel will give the next zero-copy send call.
+ */
+struct zerocopy_sender
+{
+    RCPR_SYM(allocator)* alloc;
+    int descriptor;
+    zerocopy_sender_options opts;
+    uint32_t next_id;
+    zerocopy_sender_pending* pending;
+    size_t pending_count;
+    zerocopy_sender_stats stats;
+};
+
+/**
+ * \brief Release completed frames until at most limit remain pending.
+ *
+ * \param sender        The sender.
+ * \param limit         The number of frames that may remain pending, or
+ *                      SIZE_MAX to only release what has already completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SENDER_IO if the socket failed.
+ */
+status zerocopy_sender_reap_until(zerocopy_sender* sender, size_t limit);
+
+/**
+ * \brief Release every pending frame without waiting for its notification.
+ *
+ * This is only for a socket that has failed, whose notifications may never
+ * arrive. The kernel keeps its own references to the pinned pages, so the
+ * memory stays valid, but a reused frame may change data that was never
+ * going to be delivered anyway.
+ *
+ * \param sender        The sender.
+ */
+void zerocopy_sender_abandon(zerocopy_sender* sender);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
@@ -0,0 +1,29 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_options_init.c
+ *
+ * \brief Initialize zero-copy sender options with their defaults.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "zerocopy_sender_internal.h"
+
+/**
+ * \brief Initialize sender options with their defaults.
+ *
+ * The defaults send frames of 1 MiB and up without copying, with up to 8
+ * frames pending, and no release callback.
+ *
+ * \param opts          The options to initialize.
+ */
+void zerocopy_sender_options_init(zerocopy_sender_options* opts)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != opts);
+
+    memset(opts, 0, sizeof(*opts));
+    opts->min_size = 1024 * 1024;
+    opts->max_pending = 8;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_reap.c
+ *
+ * \brief Release frames the kernel has finished with.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "zerocopy_sender_internal.h"
+
+/**
+ * \brief Release every frame the kernel has finished with, optionally
+ * waiting until that is every pending frame.
+ *
+ * \param sender        The sender.
+ * \param wait          If true, block until no frame is pending.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SENDER_IO if the socket failed.
+ */
+status zerocopy_sender_reap(zerocopy_sender* sender, bool wait)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+
+    return zerocopy_sender_reap_until(sender, wait ? 0 : SIZE_MAX);
+}
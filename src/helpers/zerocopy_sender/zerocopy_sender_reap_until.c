@@ -0,0 +1,175 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_reap_until.c
+ *
+ * \brief Process zero-copy completion notifications.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <time.h>
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include "zerocopy_sender_internal.h"
+
+/* forward decls. */
+static void zerocopy_sender_complete(
+    zerocopy_sender* sender, uint32_t lo, uint32_t hi, bool copied);
+
+/**
+ * \brief Release completed frames until at most limit remain pending.
+ *
+ * \param sender        The sender.
+ * \param limit         The number of frames that may remain pending, or
+ *                      SIZE_MAX to only release what has already completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SENDER_IO if the socket failed.
+ */
+status zerocopy_sender_reap_until(zerocopy_sender* sender, size_t limit)
+{
+    struct msghdr msg;
+    struct cmsghdr* cmsg;
+    const struct sock_extended_err* err;
+    struct pollfd pfd;
+    char control[128];
+    ssize_t received;
+    bool hung_up = false;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+
+    while (sender->pending_count > 0)
+    {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        received =
+            recvmsg(sender->descriptor, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+        if (received < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        else if (received < 0 && (EAGAIN == errno || EWOULDBLOCK == errno))
+        {
+            if (SIZE_MAX == limit || sender->pending_count <= limit)
+            {
+                return STATUS_SUCCESS;
+            }
+
+            /* a dead socket that has nothing more to report never will. */
+            if (hung_up)
+            {
+                return ERROR_ZEROCOPY_SENDER_IO;
+            }
+
+            /* a non-empty error queue shows up as POLLERR. */
+            pfd.fd = sender->descriptor;
+            pfd.events = 0;
+            pfd.revents = 0;
+            if (poll(&pfd, 1, -1) < 0 && EINTR != errno)
+            {
+                return ERROR_ZEROCOPY_SENDER_IO;
+            }
+
+            hung_up = 0 != (pfd.revents & (POLLHUP | POLLNVAL));
+
+            continue;
+        }
+        else if (received < 0)
+        {
+            return ERROR_ZEROCOPY_SENDER_IO;
+        }
+
+        for (cmsg = CMSG_FIRSTHDR(&msg); NULL != cmsg;
+             cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (!((SOL_IP == cmsg->cmsg_level
+                        && IP_RECVERR == cmsg->cmsg_type)
+                  || (SOL_IPV6 == cmsg->cmsg_level
+                        && IPV6_RECVERR == cmsg->cmsg_type)))
+            {
+                continue;
+            }
+
+            err = (const struct sock_extended_err*)CMSG_DATA(cmsg);
+            if (SO_EE_ORIGIN_ZEROCOPY != err->ee_origin)
+            {
+                /* a real socket error; the next send reports it. */
+                continue;
+            }
+
+            ++sender->stats.notifications;
+            zerocopy_sender_complete(
+                sender, err->ee_info, err->ee_data,
+                0 != (err->ee_code & SO_EE_CODE_ZEROCOPY_COPIED));
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Apply a completed range of send calls to the pending frames,
+ * releasing those with nothing left outstanding.
+ *
+ * \param sender        The sender.
+ * \param lo            The first completed call.
+ * \param hi            The last completed call.
+ * \param copied        Whether the kernel copied the data after all.
+ */
+static void zerocopy_sender_complete(
+    zerocopy_sender* sender, uint32_t lo, uint32_t hi, bool copied)
+{
+    zerocopy_sender_pending* p;
+    uint32_t first, last;
+
+    for (size_t i = 0; i < sender->pending_count; )
+    {
+        p = &sender->pending[i];
+
+        /* ids are compared as distances from lo, so wrapping is harmless. */
+        first = p->first_id - lo;
+        last = p->last_id - lo;
+        if (first <= hi - lo || last <= hi - lo || first > last)
+        {
+            if (first > last)
+            {
+                first = 0;
+            }
+            if (last > hi - lo)
+            {
+                last = hi - lo;
+            }
+
+            p->outstanding -= last - first + 1;
+            p->copied = p->copied || copied;
+        }
+
+        if (0 != p->outstanding)
+        {
+            ++i;
+            continue;
+        }
+
+        if (p->copied)
+        {
+            ++sender->stats.copied_frames;
+        }
+
+        if (NULL != sender->opts.release)
+        {
+            sender->opts.release(sender->opts.context, p->frame);
+        }
+
+        /* order doesn't matter; fill the hole with the last entry. */
+        *p = sender->pending[--sender->pending_count];
+    }
+}
@@ -0,0 +1,44 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_release.c
+ *
+ * \brief Release a zero-copy sender.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "zerocopy_sender_internal.h"
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a sender, first waiting for every pending frame.
+ *
+ * If the socket has failed, frames still pending are passed to the release
+ * callback without waiting for the kernel to report them.
+ *
+ * \param sender        The sender to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status zerocopy_sender_release(zerocopy_sender* sender)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+
+    /* the kernel may read pending frames until it says otherwise. */
+    retval = zerocopy_sender_reap_until(sender, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        /* the socket failed; hand back what it will never report. */
+        zerocopy_sender_abandon(sender);
+    }
+
+    rcpr_allocator_reclaim(sender->alloc, sender->pending);
+    rcpr_allocator_reclaim(sender->alloc, sender);
+
+    return retval;
+}
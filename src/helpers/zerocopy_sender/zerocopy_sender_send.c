@@ -0,0 +1,156 @@
+/**
+ * \file helpers/zerocopy_sender/zerocopy_sender_send.c
+ *
+ * \brief Send a frame with MSG_ZEROCOPY.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <errno.h>
+#include <helpers/status_codes.h>
+#include <sys/socket.h>
+
+#include "zerocopy_sender_internal.h"
+
+/* forward decls. */
+static void zerocopy_sender_release_frame(
+    zerocopy_sender* sender, void* frame);
+
+/**
+ * \brief Send a frame, taking ownership of it.
+ *
+ * This returns once every byte of the frame is queued on the socket. The
+ * frame is passed to the release callback, possibly before this returns,
+ * once the kernel no longer reads from it. On failure, it is released
+ * before this returns.
+ *
+ * \param sender        The sender.
+ * \param frame         The frame.
+ * \param size          The size of the frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SENDER_IO if the socket failed.
+ */
+status zerocopy_sender_send(
+    zerocopy_sender* sender, void* frame, size_t size)
+{
+    status retval;
+    zerocopy_sender_pending* pending;
+    const uint8_t* data = (const uint8_t*)frame;
+    size_t offset = 0;
+    uint32_t first_id, calls = 0;
+    int flags = MSG_NOSIGNAL;
+    ssize_t sent;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sender);
+    MODEL_ASSERT(NULL != frame);
+
+    ++sender->stats.frames;
+    sender->stats.bytes += size;
+
+    if (sender->stats.enabled && size >= sender->opts.min_size)
+    {
+        /* make room for this frame before its pages are pinned. */
+        retval =
+            zerocopy_sender_reap_until(
+                sender, sender->opts.max_pending - 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            zerocopy_sender_release_frame(sender, frame);
+            return retval;
+        }
+
+        flags |= MSG_ZEROCOPY;
+        ++sender->stats.zerocopy_frames;
+    }
+
+    first_id = sender->next_id;
+    while (offset < size)
+    {
+        sent = send(sender->descriptor, data + offset, size - offset, flags);
+        if (sent < 0 && EINTR == errno)
+        {
+            continue;
+        }
+        else if (sent < 0 && ENOBUFS == errno && (flags & MSG_ZEROCOPY))
+        {
+            /* pinning ran into the optmem limit; copy the rest. */
+            ++sender->stats.fallback_sends;
+            flags &= ~MSG_ZEROCOPY;
+            continue;
+        }
+        else if (sent < 0)
+        {
+            retval = ERROR_ZEROCOPY_SENDER_IO;
+            goto fail;
+        }
+
+        offset += (size_t)sent;
+        if (flags & MSG_ZEROCOPY)
+        {
+            ++sender->next_id;
+            ++calls;
+        }
+    }
+
+    if (0 == calls)
+    {
+        zerocopy_sender_release_frame(sender, frame);
+        return STATUS_SUCCESS;
+    }
+
+    pending = &sender->pending[sender->pending_count++];
+    pending->frame = frame;
+    pending->first_id = first_id;
+    pending->last_id = first_id + calls - 1;
+    pending->outstanding = calls;
+    pending->copied = false;
+    if (sender->pending_count > sender->stats.peak_pending)
+    {
+        sender->stats.peak_pending = sender->pending_count;
+    }
+
+    /* release whatever has completed meanwhile, without waiting. */
+    return zerocopy_sender_reap_until(sender, SIZE_MAX);
+
+fail:
+    /* the kernel may still hold pages from the calls that succeeded. */
+    if (calls > 0)
+    {
+        pending = &sender->pending[sender->pending_count++];
+        pending->frame = frame;
+        pending->first_id = first_id;
+        pending->last_id = first_id + calls - 1;
+        pending->outstanding = calls;
+        pending->copied = false;
+
+        /* a dead socket may never report them; don't keep the frames. */
+        if (STATUS_SUCCESS != zerocopy_sender_reap_until(sender, 0))
+        {
+            zerocopy_sender_abandon(sender);
+        }
+    }
+    else
+    {
+        zerocopy_sender_release_frame(sender, frame);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Hand a frame back to its owner.
+ *
+ * \param sender        The sender.
+ * \param frame         The frame.
+ */
+static void zerocopy_sender_release_frame(
+    zerocopy_sender* sender, void* frame)
+{
+    if (NULL != sender->opts.release)
+    {
+        sender->opts.release(sender->opts.context, frame);
+    }
+}
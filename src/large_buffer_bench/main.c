@@ -0,0 +1,329 @@
+/**
+ * \file large_buffer_bench/main.c
+ *
+ * \brief Main entry point for the large buffer benchmark.
+ *
+ * This benchmark replays the buffer traffic of a large extended API ping
+ * without the network: for each request, it creates the payload, serializes
+ * it into a request frame, receives a response frame of the same size, and
+ * decodes the response body out of it. Each of these is a vccrypt buffer of
+ * LARGE_BUFFER_SIZE bytes, allocated through the allocator options of the
+ * crypto suite, written in full, and released, as it is on the real path.
+ *
+ * The same LARGE_BUFFER_ROUNDS requests are run against each allocator:
+ *
+ *  - plain malloc, which maps and unmaps every buffer of this size;
+ *  - each large buffer pool backing available on this host;
+ *  - malloc with its mmap threshold raised, so that freed buffers stay in the
+ *    heap, which is the cheapest fix that needs no pool.
+ *
+ * For each, it reports minor and major page faults per request and buffer
+ * throughput. malloc tuning is global and can't be undone, so it runs last.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/env_helpers.h>
+#include <helpers/large_buffer_pool.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The size of the protocol header in front of a payload.
+ */
+#define BENCH_FRAME_OVERHEAD 64
+
+/**
+ * \brief The results of one allocator.
+ */
+typedef struct bench_result bench_result;
+
+struct bench_result
+{
+    uint64_t elapsed_ns;
+    uint64_t minor_faults;
+    uint64_t major_faults;
+};
+
+/* forward decls. */
+static status run_requests(
+    allocator_options_t* alloc_opts, size_t size, size_t rounds,
+    bench_result* result);
+static status fill_buffer(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, size_t size,
+    const uint8_t* src, size_t offset);
+static void print_result(
+    const char* name, const bench_result* result, const bench_result* base,
+    size_t size, size_t rounds);
+
+/**
+ * \brief Main entry point for the large buffer benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    large_buffer_pool_options pool_opts;
+    large_buffer_pool* pool;
+    large_buffer_pool_allocator pool_alloc;
+    large_buffer_pool_stats stats;
+    bench_result base, result;
+    size_t size = env_get_size("LARGE_BUFFER_SIZE", 5000000);
+    size_t rounds = env_get_size("LARGE_BUFFER_ROUNDS", 200);
+
+    if (0 == size || 0 == rounds)
+    {
+        fprintf(stderr, "Bad large buffer benchmark configuration.\n");
+        return ERROR_LARGE_BUFFER_BENCH_CONFIGURATION;
+    }
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    printf(
+        "%zu requests of %zu bytes, 4 buffers per request\n", rounds, size);
+    printf(
+        "%-22s %12s %12s %10s %10s\n", "allocator", "minflt/req",
+        "majflt/req", "MB/s", "speedup");
+
+    retval = run_requests(&alloc_opts, size, rounds, &base);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_rcpr_allocator;
+    }
+
+    print_result("malloc", &base, &base, size, rounds);
+
+    /* the pool needs room for every buffer in flight. */
+    for (int backing = LARGE_BUFFER_POOL_BACKING_HUGETLB;
+         backing <= LARGE_BUFFER_POOL_BACKING_BASE_PAGES; ++backing)
+    {
+        large_buffer_pool_options_init(&pool_opts);
+        pool_opts.slot_size = size + BENCH_FRAME_OVERHEAD;
+        pool_opts.slot_count = 4;
+        pool_opts.backing = (large_buffer_pool_backing)backing;
+
+        if (STATUS_SUCCESS !=
+                large_buffer_pool_create(&pool, alloc, &pool_opts))
+        {
+            printf(
+                "%-22s %12s\n",
+                large_buffer_pool_backing_name(pool_opts.backing),
+                "unavailable");
+            continue;
+        }
+
+        large_buffer_pool_allocator_init(&pool_alloc, pool, &alloc_opts);
+        retval = run_requests(&pool_alloc.options, size, rounds, &result);
+        if (STATUS_SUCCESS == retval)
+        {
+            large_buffer_pool_get_stats(pool, &stats);
+            print_result(
+                large_buffer_pool_backing_name(pool_opts.backing), &result,
+                &base, size, rounds);
+            printf(
+                "%-22s prefault %.1f ms, %" PRIu64 " fallbacks\n", "",
+                stats.prefault_ns / 1e6, stats.fallbacks);
+        }
+
+        dispose((disposable_t*)&pool_alloc.options);
+        release_retval = large_buffer_pool_release(pool);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_rcpr_allocator;
+        }
+    }
+
+    /* keep freed buffers in the heap instead of unmapping them. */
+    mallopt(M_MMAP_THRESHOLD, (int)(size + BENCH_FRAME_OVERHEAD) * 2);
+    mallopt(M_TRIM_THRESHOLD, (int)(size + BENCH_FRAME_OVERHEAD) * 8);
+
+    retval = run_requests(&alloc_opts, size, rounds, &result);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_rcpr_allocator;
+    }
+
+    print_result("malloc, no mmap", &result, &base, size, rounds);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Run the buffer traffic of the given number of requests.
+ *
+ * One request is run first, untimed, so that one-time costs such as growing
+ * the heap don't count against any allocator.
+ *
+ * \param alloc_opts    The allocator options to use.
+ * \param size          The payload size.
+ * \param rounds        The number of requests.
+ * \param result        The result to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_requests(
+    allocator_options_t* alloc_opts, size_t size, size_t rounds,
+    bench_result* result)
+{
+    status retval;
+    vccrypt_buffer_t payload, request, response, body;
+    struct rusage before, after;
+    uint64_t start = 0;
+
+    for (size_t i = 0; i <= rounds; ++i)
+    {
+        if (1 == i)
+        {
+            getrusage(RUSAGE_SELF, &before);
+            start = latency_clock_now_ns();
+        }
+
+        retval = fill_buffer(&payload, alloc_opts, size, NULL, 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            fill_buffer(
+                &request, alloc_opts, size + BENCH_FRAME_OVERHEAD,
+                payload.data, BENCH_FRAME_OVERHEAD);
+        dispose((disposable_t*)&payload);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the response frame is written by the socket read. */
+        retval =
+            fill_buffer(
+                &response, alloc_opts, size + BENCH_FRAME_OVERHEAD, NULL, 0);
+        dispose((disposable_t*)&request);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            fill_buffer(
+                &body, alloc_opts, size,
+                (const uint8_t*)response.data + BENCH_FRAME_OVERHEAD, 0);
+        dispose((disposable_t*)&response);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        dispose((disposable_t*)&body);
+    }
+
+    result->elapsed_ns = latency_clock_now_ns() - start;
+    getrusage(RUSAGE_SELF, &after);
+    result->minor_faults = after.ru_minflt - before.ru_minflt;
+    result->major_faults = after.ru_majflt - before.ru_majflt;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create a buffer and write every byte of it.
+ *
+ * \param buffer        The buffer to create.
+ * \param alloc_opts    The allocator options to use.
+ * \param size          The size of the buffer.
+ * \param src           The bytes to copy into it after offset, or NULL to
+ *                      fill it with a pattern.
+ * \param offset        The number of header bytes before the copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LARGE_BUFFER_BENCH_OUT_OF_MEMORY if allocation failed.
+ */
+static status fill_buffer(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, size_t size,
+    const uint8_t* src, size_t offset)
+{
+    if (STATUS_SUCCESS != vccrypt_buffer_init(buffer, alloc_opts, size))
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return ERROR_LARGE_BUFFER_BENCH_OUT_OF_MEMORY;
+    }
+
+    memset(buffer->data, 0x5a, offset);
+    if (NULL == src)
+    {
+        memset((uint8_t*)buffer->data + offset, 0xa5, size - offset);
+    }
+    else
+    {
+        memcpy((uint8_t*)buffer->data + offset, src, size - offset);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Print the results of one allocator.
+ *
+ * \param name          The allocator name.
+ * \param result        The results of this allocator.
+ * \param base          The results of plain malloc.
+ * \param size          The payload size.
+ * \param rounds        The number of requests.
+ */
+static void print_result(
+    const char* name, const bench_result* result, const bench_result* base,
+    size_t size, size_t rounds)
+{
+    double bytes = 4.0 * size * rounds;
+
+    printf(
+        "%-22s %12.1f %12.1f %10.0f %9.2fx\n", name,
+        (double)result->minor_faults / rounds,
+        (double)result->major_faults / rounds,
+        bytes / (result->elapsed_ns / 1e9) / 1e6,
+        (double)base->elapsed_ns / result->elapsed_ns);
+}
@@ -0,0 +1,471 @@
+/**
+ * \file long_session_stress/main.c
+ *
+ * \brief Main entry point for the long session stress tool.
+ *
+ * This tool pushes a very large number of requests through a single agentd
+ * session as fast as the session allows, to find out whether a session
+ * degrades over its lifetime. Gateway sessions stay open for months, so a
+ * session that slowly gets slower or leaks memory would be a problem that
+ * short benchmarks never show.
+ *
+ * The run is divided into epochs. For each epoch the tool reports throughput,
+ * request latency, the session counters, and the memory used by agentd. At
+ * the end it compares the last epoch against the first.
+ *
+ * The request offset is a 32-bit counter. By default it starts just below
+ * its limit, so every run crosses the wrap from 0xFFFFFFFF to 0 and checks
+ * that every response still carries the offset of its request. The client
+ * and server IVs are 64-bit counters that agentd tracks as well, so they
+ * cannot be started near their limit. Instead, the tool reports how long the
+ * session could keep running at the measured rate before they wrap.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/agentd_status.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/proc_stats.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define STRESS_MAX_WINDOW 1024
+
+/**
+ * \brief Summary of a single epoch of the run.
+ */
+typedef struct epoch_summary epoch_summary;
+
+struct epoch_summary
+{
+    double rate;
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    uint64_t agentd_rss_bytes;
+};
+
+/**
+ * \brief State of the stress run.
+ *
+ * Requests are matched to their send times by offset. The window is a power
+ * of two, so the slot for an offset stays the same when the offset wraps.
+ */
+typedef struct stress_context stress_context;
+
+struct stress_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    agentd_session* session;
+    size_t window;
+    uint32_t next_offset;
+    uint64_t sent_at[STRESS_MAX_WINDOW];
+    bool in_flight[STRESS_MAX_WINDOW];
+    uint64_t offset_wraps;
+};
+
+/* forward decls. */
+static status send_request(stress_context* ctx);
+static status receive_response(
+    stress_context* ctx, latency_histogram* hist);
+static void epoch_report(
+    size_t epoch, uint64_t messages, const stress_context* ctx,
+    const latency_histogram* hist, uint64_t elapsed_ns,
+    epoch_summary* summary);
+static void print_drift(
+    const epoch_summary* first, const epoch_summary* last);
+static void print_iv_headroom(const agentd_session* session, double rate);
+
+/**
+ * \brief Main entry point for the long session stress tool.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    agentd_session session;
+    stress_context ctx;
+    latency_histogram hist;
+    epoch_summary first, last;
+    uint64_t epoch_start, sent = 0, received = 0;
+    size_t epoch = 0;
+    uint64_t messages =
+        env_get_size("LONG_SESSION_MESSAGES", 300000000);
+    uint64_t epoch_size = env_get_size("LONG_SESSION_EPOCH", 1000000);
+    size_t window = env_get_size("LONG_SESSION_WINDOW", 16);
+    uint32_t offset_start =
+        (uint32_t)env_get_size("LONG_SESSION_OFFSET_START", 0xFFFF0000);
+
+    /* the window must be a power of two so slots survive offset wrap. */
+    if (0 == window || window > STRESS_MAX_WINDOW
+     || 0 != (window & (window - 1)) || 0 == epoch_size || 0 == messages)
+    {
+        fprintf(stderr, "Bad long session stress configuration.\n");
+        return ERROR_LONG_SESSION_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* connect the long lived session. */
+    retval =
+        agentd_session_init(
+            &session, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.alloc = alloc;
+    ctx.suite = &suite;
+    ctx.session = &session;
+    ctx.window = window;
+    ctx.next_offset = offset_start;
+
+    printf(
+        "long session: %" PRIu64 " messages, window %zu, "
+        "offset start 0x%08x\n", messages, window, offset_start);
+
+    latency_histogram_init(&hist);
+    epoch_start = latency_clock_now_ns();
+
+    while (received < messages)
+    {
+        /* keep the window full. */
+        while (sent < messages && sent - received < window)
+        {
+            retval = send_request(&ctx);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto report_failure;
+            }
+
+            ++sent;
+        }
+
+        retval = receive_response(&ctx, &hist);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto report_failure;
+        }
+
+        ++received;
+
+        if (0 == received % epoch_size || received == messages)
+        {
+            epoch_report(
+                epoch, received, &ctx, &hist,
+                latency_clock_now_ns() - epoch_start,
+                0 == epoch ? &first : &last);
+
+            ++epoch;
+            latency_histogram_init(&hist);
+            epoch_start = latency_clock_now_ns();
+        }
+    }
+
+    if (epoch > 1)
+    {
+        print_drift(&first, &last);
+    }
+
+    printf("offset wraps: %" PRIu64 "\n", ctx.offset_wraps);
+    print_iv_headroom(&session, 1 == epoch ? first.rate : last.rate);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto close_session;
+
+report_failure:
+    fprintf(
+        stderr,
+        "long session failed after %" PRIu64 " messages: client_iv=%" PRIu64
+        " server_iv=%" PRIu64 " next offset=0x%08x (%x, agentd %x)\n",
+        received, session.client_iv, session.server_iv, ctx.next_offset,
+        retval, agentd_status_last());
+    goto cleanup_session;
+
+close_session:
+    retval =
+        send_and_verify_close_connection(
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+
+cleanup_session:
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Send a latest block id request with the next offset.
+ *
+ * \param ctx           The stress context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status send_request(stress_context* ctx)
+{
+    status retval;
+    uint32_t offset = ctx->next_offset;
+    size_t slot = offset & (ctx->window - 1);
+
+    retval =
+        vcblockchain_protocol_sendreq_latest_block_id_get(
+            ctx->session->sock, ctx->suite, &ctx->session->client_iv,
+            &ctx->session->shared_secret, offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error sending get latest block id request.\n");
+        return ERROR_SEND_LATEST_BLOCK_ID_REQ;
+    }
+
+    ctx->sent_at[slot] = latency_clock_now_ns();
+    ctx->in_flight[slot] = true;
+
+    /* the offset is unsigned, so this wraps from 0xFFFFFFFF to 0. */
+    ++ctx->next_offset;
+    if (0 == ctx->next_offset)
+    {
+        ++ctx->offset_wraps;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Receive a response and match it to its request by offset.
+ *
+ * \param ctx           The stress context.
+ * \param hist          The histogram receiving the request latency.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LONG_SESSION_OFFSET if the offset matches no request in
+ *        flight.
+ *      - a non-zero error code on failure.
+ */
+static status receive_response(
+    stress_context* ctx, latency_histogram* hist)
+{
+    status retval;
+    vccrypt_buffer_t resp;
+    uint32_t request_id, status, offset;
+    size_t slot;
+
+    /* get a response. */
+    retval =
+        vcblockchain_protocol_recvresp(
+            ctx->session->sock, ctx->alloc, ctx->suite,
+            &ctx->session->server_iv, &ctx->session->shared_secret, &resp);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Error receiving response from agentd. (%x)\n", retval);
+        return ERROR_RECV_LATEST_BLOCK_ID_RESP;
+    }
+
+    /* decode the response header. */
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &offset, &status, &resp);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(
+            stderr, "Error decoding response from agentd. (%x)\n", retval);
+        retval = ERROR_DECODE_LATEST_BLOCK_ID;
+        goto cleanup_resp;
+    }
+
+    /* verify the request ID. */
+    if (PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET != request_id)
+    {
+        fprintf(stderr, "Wrong response code. (%x)\n", request_id);
+        retval = ERROR_LATEST_BLOCK_ID_REQUEST_ID;
+        goto cleanup_resp;
+    }
+
+    /* verify status. */
+    if (STATUS_SUCCESS != status)
+    {
+        agentd_status_record(status);
+        fprintf(stderr, "fail status from agentd. (%x)\n", status);
+        retval = ERROR_LATEST_BLOCK_ID_STATUS;
+        goto cleanup_resp;
+    }
+
+    /* the offset must belong to a request that is still in flight. */
+    slot = offset & (ctx->window - 1);
+    if (!ctx->in_flight[slot]
+     || (uint32_t)(ctx->next_offset - offset) > ctx->window)
+    {
+        fprintf(stderr, "unexpected response offset. (%x)\n", offset);
+        retval = ERROR_LONG_SESSION_OFFSET;
+        goto cleanup_resp;
+    }
+
+    latency_histogram_record(
+        hist, latency_clock_now_ns() - ctx->sent_at[slot]);
+    ctx->in_flight[slot] = false;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_resp;
+
+cleanup_resp:
+    dispose((disposable_t*)&resp);
+
+    return retval;
+}
+
+/**
+ * \brief Print one epoch of the run and summarize it.
+ *
+ * \param epoch         The epoch number.
+ * \param messages      The number of messages received so far.
+ * \param ctx           The stress context.
+ * \param hist          The request latencies of this epoch.
+ * \param elapsed_ns    The duration of this epoch.
+ * \param summary       The summary to fill in.
+ */
+static void epoch_report(
+    size_t epoch, uint64_t messages, const stress_context* ctx,
+    const latency_histogram* hist, uint64_t elapsed_ns,
+    epoch_summary* summary)
+{
+    proc_snapshot snapshot;
+
+    summary->rate = hist->total / (elapsed_ns / 1e9);
+    summary->p50_ns = latency_histogram_percentile(hist, 50.0);
+    summary->p99_ns = latency_histogram_percentile(hist, 99.0);
+    summary->agentd_rss_bytes = 0;
+    if (STATUS_SUCCESS == proc_snapshot_take(&snapshot, "agentd"))
+    {
+        summary->agentd_rss_bytes = snapshot.total_rss_bytes;
+    }
+
+    printf(
+        "epoch %zu: messages=%" PRIu64 " rate=%.0f/s p50=%.1fus "
+        "p99=%.1fus max=%.1fus client_iv=%" PRIu64 " server_iv=%" PRIu64
+        " offset=0x%08x agentd_rss=%" PRIu64 "KiB\n",
+        epoch, messages, summary->rate, summary->p50_ns / 1e3,
+        summary->p99_ns / 1e3, hist->max / 1e3, ctx->session->client_iv,
+        ctx->session->server_iv, ctx->next_offset,
+        summary->agentd_rss_bytes / 1024);
+    fflush(stdout);
+}
+
+/**
+ * \brief Compare the last epoch against the first.
+ *
+ * \param first         The first epoch.
+ * \param last          The last epoch.
+ */
+static void print_drift(
+    const epoch_summary* first, const epoch_summary* last)
+{
+    printf(
+        "drift (last vs first epoch): rate x%.3f, p50 x%.3f, p99 x%.3f, "
+        "agentd rss %+" PRId64 "KiB\n",
+        last->rate / first->rate,
+        (double)last->p50_ns / (first->p50_ns ? first->p50_ns : 1),
+        (double)last->p99_ns / (first->p99_ns ? first->p99_ns : 1),
+        ((int64_t)last->agentd_rss_bytes - (int64_t)first->agentd_rss_bytes)
+            / 1024);
+}
+
+/**
+ * \brief Report how long the session IVs last at the measured rate.
+ *
+ * \param session       The session.
+ * \param rate          The measured request rate, in requests per second.
+ */
+static void print_iv_headroom(const agentd_session* session, double rate)
+{
+    uint64_t iv =
+        session->client_iv > session->server_iv
+            ? session->client_iv : session->server_iv;
+    double years = (UINT64_MAX - iv) / rate / (365.25 * 24 * 3600);
+
+    printf(
+        "iv headroom: client_iv=%" PRIu64 " server_iv=%" PRIu64
+        ", %.3g years at %.0f requests/s\n",
+        session->client_iv, session->server_iv, years, rate);
+}
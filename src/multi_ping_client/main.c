@@ -9,10 +9,15 @@
 #include <errno.h>
 #include <helpers/cert_helpers.h>
 #include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/large_buffer_pool.h>
 #include <helpers/ping_protocol.h>
 #include <helpers/status_codes.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <sys/resource.h>
+#include <unistd.h>
 #include <vpr/allocator/malloc_allocator.h>
 #include <vpr/parameters.h>
 
@@ -23,6 +28,12 @@ RCPR_IMPORT_uuid;
 
 /* forward decls. */
 static size_t get_payload_size();
+static status connect_with_descriptor(
+    psock** sock, int* descriptor, rcpr_allocator* alloc,
+    vcblockchain_entity_private_cert** cert, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv, file* file,
+    vccrypt_suite_options_t* suite);
+static void release_frame(void* context, void* frame);
 
 /**
  * \brief Main entry point for the ping client test utility.
@@ -38,12 +49,20 @@ int main(int argc, char* argv[])
     (void)argv;
     status retval, release_retval;
     allocator_options_t alloc_opts;
+    allocator_options_t* suite_alloc_opts = &alloc_opts;
+    large_buffer_pool_options pool_opts;
+    large_buffer_pool* pool = NULL;
+    large_buffer_pool_allocator pool_alloc;
     rcpr_allocator* alloc;
     vccrypt_suite_options_t suite;
     vccert_builder_options_t builder_opts;
     vccert_parser_options_t parser_options;
     file file;
     psock* sock;
+    int descriptor;
+    zerocopy_sender_options sender_opts;
+    zerocopy_sender* sender = NULL;
+    zerocopy_sender_stats sender_stats;
     vcblockchain_entity_private_cert* client_priv;
     vccrypt_buffer_t shared_secret;
     uint64_t client_iv, server_iv;
@@ -53,6 +72,10 @@ int main(int argc, char* argv[])
     vcblockchain_entity_public_cert* ping_sentinel_cert;
     uint32_t offset_ctr = 5U;
     size_t payload_size = get_payload_size();
+    bool zerocopy = 0 != env_get_size("PING_CLIENT_ZEROCOPY", 0);
+    large_buffer_pool_stats pool_stats;
+    struct rusage usage_before, usage_after;
+    uint64_t start, elapsed_ns;
 
     /* register the velo v1 suite. */
     vccrypt_suite_register_velo_v1();
@@ -67,14 +90,34 @@ int main(int argc, char* argv[])
         goto cleanup_allocator;
     }
 
+    /* serve payload and response buffers from a pre-faulted pool. */
+    if (0 != env_get_size("PING_CLIENT_BUFFER_POOL", 0))
+    {
+        large_buffer_pool_options_init(&pool_opts);
+        pool_opts.slot_size = payload_size + 65536;
+        retval = large_buffer_pool_create(&pool, alloc, &pool_opts);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_rcpr_allocator;
+        }
+
+        large_buffer_pool_allocator_init(&pool_alloc, pool, &alloc_opts);
+        suite_alloc_opts = &pool_alloc.options;
+        printf(
+            "Using a %s buffer pool.\n",
+            large_buffer_pool_backing_name(
+                large_buffer_pool_backing_get(pool)));
+    }
+
     /* initialize the vccrypt suite. */
     retval =
-        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+        vccrypt_suite_options_init(
+            &suite, suite_alloc_opts, VCCRYPT_SUITE_VELO_V1);
     if (VCCRYPT_STATUS_SUCCESS != retval)
     {
         fprintf(stderr, "Error initializing crypto suite.\n");
         retval = ERROR_CRYPTO_SUITE_INIT;
-        goto cleanup_rcpr_allocator;
+        goto cleanup_buffer_pool;
     }
 
     /* initialize certificate builder options. */
@@ -125,15 +168,41 @@ int main(int argc, char* argv[])
     }
 
     /* connect to agentd. */
-    retval =
-        agentd_connection_init(
-            &sock, alloc, &client_priv, &shared_secret, &client_iv, &server_iv,
-            &file, &suite, "127.0.0.1", 4931, "ping_client.priv", "agentd.pub");
+    if (zerocopy)
+    {
+        /* zero-copy sends go straight to the descriptor. */
+        retval =
+            connect_with_descriptor(
+                &sock, &descriptor, alloc, &client_priv, &shared_secret,
+                &client_iv, &server_iv, &file, &suite);
+    }
+    else
+    {
+        retval =
+            agentd_connection_init(
+                &sock, alloc, &client_priv, &shared_secret, &client_iv,
+                &server_iv, &file, &suite, "127.0.0.1", 4931,
+                "ping_client.priv", "agentd.pub");
+    }
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_ping_sentinel_cert;
     }
 
+    /* frames are reclaimed once the kernel is done with them. */
+    if (zerocopy)
+    {
+        zerocopy_sender_options_init(&sender_opts);
+        sender_opts.release = &release_frame;
+        sender_opts.context = alloc;
+        retval =
+            zerocopy_sender_create(&sender, alloc, descriptor, &sender_opts);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_connection;
+        }
+    }
+
     /* get the client artifact id. */
     retval =
         vcblockchain_entity_get_artifact_id(
@@ -152,6 +221,9 @@ int main(int argc, char* argv[])
         goto cleanup_connection;
     }
 
+    getrusage(RUSAGE_SELF, &usage_before);
+    start = latency_clock_now_ns();
+
     /* iterate 10000 times. */
     for (int i = 0; i < 10000; ++i)
     {
@@ -162,10 +234,22 @@ int main(int argc, char* argv[])
         }
 
         /* Send a ping request and verify the response. */
-        retval =
-            send_and_verify_ping_request(
-                sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
-                offset_ctr++, (const vpr_uuid*)ping_sentinel_id, payload_size);
+        if (NULL != sender)
+        {
+            retval =
+                send_and_verify_ping_request_zerocopy(
+                    sender, sock, alloc, &suite, &client_iv, &server_iv,
+                    &shared_secret, offset_ctr++,
+                    (const vpr_uuid*)ping_sentinel_id, payload_size);
+        }
+        else
+        {
+            retval =
+                send_and_verify_ping_request(
+                    sock, alloc, &suite, &client_iv, &server_iv,
+                    &shared_secret, offset_ctr++,
+                    (const vpr_uuid*)ping_sentinel_id, payload_size);
+        }
         if (STATUS_SUCCESS != retval)
         {
             goto cleanup_connection;
@@ -177,6 +261,33 @@ int main(int argc, char* argv[])
 
     printf("\n");
 
+    /* report throughput and the page faults taken per ping. */
+    elapsed_ns = latency_clock_now_ns() - start;
+    getrusage(RUSAGE_SELF, &usage_after);
+    printf(
+        "%.0f pings/s, %.1f MB/s each way, %.1f minor faults per ping\n",
+        10000 / (elapsed_ns / 1e9),
+        10000.0 * payload_size / (elapsed_ns / 1e3),
+        (usage_after.ru_minflt - usage_before.ru_minflt) / 10000.0);
+    if (NULL != pool)
+    {
+        large_buffer_pool_get_stats(pool, &pool_stats);
+        printf(
+            "buffer pool: %" PRIu64 " acquired, %" PRIu64 " fallbacks, "
+            "peak %zu in use\n", pool_stats.acquired, pool_stats.fallbacks,
+            pool_stats.peak_in_use);
+    }
+    if (NULL != sender)
+    {
+        zerocopy_sender_get_stats(sender, &sender_stats);
+        printf(
+            "zero-copy sender: %s, %" PRIu64 " of %" PRIu64 " frames "
+            "zero-copy, %" PRIu64 " copied by the kernel, %" PRIu64
+            " fallbacks\n", sender_stats.enabled ? "enabled" : "unsupported",
+            sender_stats.zerocopy_frames, sender_stats.frames,
+            sender_stats.copied_frames, sender_stats.fallback_sends);
+    }
+
     /* send the close request. */
     retval =
         send_and_verify_close_connection(
@@ -191,6 +302,15 @@ int main(int argc, char* argv[])
     goto cleanup_connection;
 
 cleanup_connection:
+    if (NULL != sender)
+    {
+        release_retval = zerocopy_sender_release(sender);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
     release_retval =
         resource_release(
             vcblockchain_entity_private_cert_resource_handle(client_priv));
@@ -229,6 +349,17 @@ cleanup_builder_opts:
 cleanup_crypto_suite:
     dispose((disposable_t*)&suite);
 
+cleanup_buffer_pool:
+    if (NULL != pool)
+    {
+        dispose((disposable_t*)&pool_alloc.options);
+        release_retval = large_buffer_pool_release(pool);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
 cleanup_rcpr_allocator:
     release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
     if (STATUS_SUCCESS != release_retval)
@@ -275,3 +406,70 @@ static size_t get_payload_size()
 return_default:
     return 1;
 }
+
+/**
+ * \brief Connect and authenticate to agentd, keeping the raw descriptor.
+ *
+ * \param sock              Pointer to receive the socket on success.
+ * \param descriptor        Pointer to receive its descriptor, which the socket
+ *                          owns.
+ * \param alloc             The allocator to use for this operation.
+ * \param cert              Pointer to receive the client private certificate.
+ * \param shared_secret     The shared secret to initialize.
+ * \param client_iv         Pointer to receive the client IV.
+ * \param server_iv         Pointer to receive the server IV.
+ * \param file              The file abstraction layer.
+ * \param suite             The crypto suite to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status connect_with_descriptor(
+    psock** sock, int* descriptor, rcpr_allocator* alloc,
+    vcblockchain_entity_private_cert** cert, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv, file* file,
+    vccrypt_suite_options_t* suite)
+{
+    status retval, release_retval;
+
+    retval = agentd_socket_connect(descriptor, "127.0.0.1", 4931);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the psock owns the descriptor from here on. */
+    retval = psock_create_from_descriptor(sock, alloc, *descriptor);
+    if (STATUS_SUCCESS != retval)
+    {
+        close(*descriptor);
+        return retval;
+    }
+
+    retval =
+        agentd_connection_handshake(
+            *sock, alloc, cert, shared_secret, client_iv, server_iv, file,
+            suite, "ping_client.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        release_retval = resource_release(psock_resource_handle(*sock));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Reclaim a ping frame the kernel is done with.
+ *
+ * \param context           The allocator the frame came from.
+ * \param frame             The frame.
+ */
+static void release_frame(void* context, void* frame)
+{
+    rcpr_allocator_reclaim((rcpr_allocator*)context, frame);
+}
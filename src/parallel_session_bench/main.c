@@ -0,0 +1,547 @@
+/**
+ * \file parallel_session_bench/main.c
+ *
+ * \brief Main entry point for the parallel session benchmark.
+ *
+ * This benchmark sends PARALLEL_REQUESTS extended API pings of
+ * PARALLEL_PAYLOAD_SIZE bytes each over a single session, and reads back the
+ * equally large responses. Each worker count in PARALLEL_WORKERS is run in
+ * turn:
+ *
+ *  - 0 runs the blocking path, encrypting, sending, receiving and decrypting
+ *    one ping after another on the calling thread;
+ *  - any other count runs a parallel session with that many workers and
+ *    PARALLEL_WINDOW pings in flight.
+ *
+ * For each, it reports the payload throughput in each direction, the CPU
+ * time per megabyte, the share of wall time the workers spent on crypto,
+ * and the speedup over the first run. The blocking path is bound to one
+ * core's crypto throughput; the parallel runs show how far spreading the
+ * frames over cores lifts that bound.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/parallel_session.h>
+#include <helpers/ping_protocol.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The largest number of runs in PARALLEL_WORKERS.
+ */
+#define BENCH_MAX_RUNS 16
+
+/**
+ * \brief The arguments of one ping request.
+ */
+typedef struct bench_ping bench_ping;
+
+struct bench_ping
+{
+    const vpr_uuid* sentinel_id;
+    uint32_t offset;
+    vccrypt_buffer_t* payload;
+};
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    agentd_session session;
+    int descriptor;
+    const vpr_uuid* sentinel_id;
+    vccrypt_buffer_t payload;
+    size_t requests;
+    size_t window;
+    uint32_t offset;
+};
+
+/**
+ * \brief The results of one run.
+ */
+typedef struct bench_result bench_result;
+
+struct bench_result
+{
+    uint64_t elapsed_ns;
+    uint64_t cpu_ns;
+    uint64_t crypto_ns;
+    size_t workers;
+};
+
+/* forward decls. */
+static size_t parse_workers(const char* list, size_t* workers);
+static status run_blocking(bench_context* ctx, bench_result* result);
+static status run_parallel(
+    bench_context* ctx, size_t workers, bench_result* result);
+static status encode_ping(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, vccrypt_buffer_t* shared_secret, void* context);
+static uint64_t cpu_time_ns(void);
+static void print_result(
+    const bench_result* result, const bench_result* base, double mb);
+
+/**
+ * \brief Main entry point for the parallel session benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    vcblockchain_entity_public_cert* sentinel_cert;
+    const rcpr_uuid* sentinel_id;
+    bench_context ctx;
+    bench_result result, base;
+    size_t workers[BENCH_MAX_RUNS], run_count;
+    size_t payload_size = env_get_size("PARALLEL_PAYLOAD_SIZE", 4000000);
+    const char* hostaddr = env_get_string("PARALLEL_HOST", "127.0.0.1");
+    unsigned int hostport =
+        (unsigned int)env_get_size("PARALLEL_PORT", 4931);
+    double mb;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.requests = env_get_size("PARALLEL_REQUESTS", 100);
+    ctx.window = env_get_size("PARALLEL_WINDOW", 8);
+    run_count =
+        parse_workers(
+            env_get_string("PARALLEL_WORKERS", "0,1,2,4,8"), workers);
+    if (0 == payload_size || 0 == ctx.requests || 0 == ctx.window
+     || 0 == run_count || hostport > 65535)
+    {
+        fprintf(stderr, "Bad parallel session benchmark configuration.\n");
+        return ERROR_PARALLEL_SESSION_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* open the public key for the ping sentinel. */
+    retval =
+        entity_public_certificate_create_from_file(
+            &sentinel_cert, &file, &suite, "ping_sentinel.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    /* get the ping sentinel artifact id. */
+    retval = vcblockchain_entity_get_artifact_id(&sentinel_id, sentinel_cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sentinel_cert;
+    }
+
+    /* every ping carries the same payload. */
+    retval = vccrypt_buffer_init(&ctx.payload, suite.alloc_opts, payload_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        retval = ERROR_PARALLEL_SESSION_BENCH_OUT_OF_MEMORY;
+        goto cleanup_sentinel_cert;
+    }
+
+    memset(ctx.payload.data, 0x5a, payload_size);
+
+    /* the parallel session writes and reads the descriptor directly. */
+    retval = agentd_socket_connect(&ctx.descriptor, hostaddr, hostport);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    retval =
+        agentd_session_init_from_descriptor(
+            &ctx.session, alloc, &file, &suite, ctx.descriptor,
+            "ping_client.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    ctx.alloc = alloc;
+    ctx.suite = &suite;
+    ctx.sentinel_id = (const vpr_uuid*)sentinel_id;
+    ctx.offset = 1;
+    mb = (double)payload_size * ctx.requests / (1024 * 1024);
+
+    printf(
+        "%zu pings of %zu bytes on one session, %zu in flight\n",
+        ctx.requests, payload_size, ctx.window);
+    printf(
+        "%-9s %10s %10s %10s %9s\n", "workers", "MB/s", "cpu us/MB",
+        "crypto", "speedup");
+
+    for (size_t i = 0; i < run_count; ++i)
+    {
+        retval =
+            (0 == workers[i])
+                ? run_blocking(&ctx, &result)
+                : run_parallel(&ctx, workers[i], &result);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_session;
+        }
+
+        if (0 == i)
+        {
+            base = result;
+        }
+
+        print_result(&result, &base, mb);
+    }
+
+    /* send the close request. */
+    retval =
+        send_and_verify_close_connection(
+            ctx.session.sock, alloc, &suite, &ctx.session.client_iv,
+            &ctx.session.server_iv, &ctx.session.shared_secret);
+
+cleanup_session:
+    release_retval = agentd_session_dispose(&ctx.session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_payload:
+    dispose((disposable_t*)&ctx.payload);
+
+cleanup_sentinel_cert:
+    release_retval =
+        resource_release(
+            vcblockchain_entity_public_cert_resource_handle(sentinel_cert));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Parse a comma separated list of worker counts.
+ *
+ * \param list          The list.
+ * \param workers       Array of BENCH_MAX_RUNS entries to receive the
+ *                      counts.
+ *
+ * \returns the number of counts, or zero if the list is invalid.
+ */
+static size_t parse_workers(const char* list, size_t* workers)
+{
+    size_t count = 0;
+    const char* p = list;
+    char* end;
+    unsigned long value;
+
+    while (0 != *p)
+    {
+        value = strtoul(p, &end, 10);
+        if (end == p || value > 256 || count == BENCH_MAX_RUNS
+         || (',' != *end && 0 != *end))
+        {
+            return 0;
+        }
+
+        workers[count++] = (size_t)value;
+        p = (',' == *end) ? end + 1 : end;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Send and verify every ping one after another on the psock.
+ *
+ * \param ctx           The benchmark context.
+ * \param result        The result to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_blocking(bench_context* ctx, bench_result* result)
+{
+    status retval;
+    uint64_t start = latency_clock_now_ns(), cpu_start = cpu_time_ns();
+
+    memset(result, 0, sizeof(*result));
+
+    for (size_t i = 0; i < ctx->requests; ++i)
+    {
+        retval =
+            send_and_verify_ping_request(
+                ctx->session.sock, ctx->alloc, ctx->suite,
+                &ctx->session.client_iv, &ctx->session.server_iv,
+                &ctx->session.shared_secret, ctx->offset++,
+                ctx->sentinel_id, ctx->payload.size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    result->elapsed_ns = latency_clock_now_ns() - start;
+    result->cpu_ns = cpu_time_ns() - cpu_start;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Send and verify every ping through a parallel session.
+ *
+ * \param ctx           The benchmark context.
+ * \param workers       The number of workers.
+ * \param result        The result to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_parallel(
+    bench_context* ctx, size_t workers, bench_result* result)
+{
+    status retval, release_retval;
+    parallel_session_options opts;
+    parallel_session_stats stats;
+    parallel_session* ps;
+    bench_ping* pings;
+    vccrypt_buffer_t response;
+    size_t sent = 0, received = 0;
+    uint64_t start, cpu_start;
+
+    memset(result, 0, sizeof(*result));
+    result->workers = workers;
+
+    /* a ping's arguments are reused once its response is back. */
+    pings = calloc(ctx->window, sizeof(bench_ping));
+    if (NULL == pings)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return ERROR_PARALLEL_SESSION_BENCH_OUT_OF_MEMORY;
+    }
+
+    parallel_session_options_init(&opts);
+    opts.workers = workers;
+    opts.window = ctx->window;
+
+    retval =
+        parallel_session_create(
+            &ps, ctx->alloc, ctx->suite, &ctx->session, ctx->descriptor,
+            &opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pings;
+    }
+
+    start = latency_clock_now_ns();
+    cpu_start = cpu_time_ns();
+
+    while (received < ctx->requests)
+    {
+        while (sent < ctx->requests && sent - received < ctx->window)
+        {
+            bench_ping* ping = &pings[sent % ctx->window];
+
+            ping->sentinel_id = ctx->sentinel_id;
+            ping->offset = ctx->offset + (uint32_t)sent;
+            ping->payload = &ctx->payload;
+            retval = parallel_session_send(ps, &encode_ping, ping);
+            if (STATUS_SUCCESS != retval)
+            {
+                fprintf(stderr, "Error sending ping %zu.\n", sent);
+                goto cleanup_session;
+            }
+
+            ++sent;
+        }
+
+        retval = parallel_session_recv(ps, &response);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error receiving ping %zu.\n", received);
+            goto cleanup_session;
+        }
+
+        retval =
+            verify_ping_response(
+                ctx->suite, &response, ctx->offset + (uint32_t)received);
+        dispose((disposable_t*)&response);
+        if (STATUS_SUCCESS != retval)
+        {
+            retval = ERROR_PARALLEL_SESSION_BENCH_RESPONSE;
+            goto cleanup_session;
+        }
+
+        ++received;
+    }
+
+    result->elapsed_ns = latency_clock_now_ns() - start;
+    result->cpu_ns = cpu_time_ns() - cpu_start;
+    parallel_session_get_stats(ps, &stats);
+    result->crypto_ns = stats.crypto_ns;
+
+cleanup_session:
+    ctx->offset += (uint32_t)sent;
+    release_retval = parallel_session_release(ps);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_pings:
+    free(pings);
+
+    return retval;
+}
+
+/**
+ * \brief Write a ping request.
+ *
+ * \param sock          The socket to write to.
+ * \param suite         The crypto suite to use.
+ * \param client_iv     The client IV.
+ * \param shared_secret The shared secret.
+ * \param context       The \ref bench_ping arguments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status encode_ping(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, vccrypt_buffer_t* shared_secret, void* context)
+{
+    bench_ping* ping = (bench_ping*)context;
+
+    return
+        ping_protocol_sendreq_ping(
+            sock, suite, client_iv, shared_secret, ping->sentinel_id,
+            ping->offset, ping->payload);
+}
+
+/**
+ * \brief Get the user and system CPU time used by this process.
+ *
+ * \returns the CPU time in nanoseconds.
+ */
+static uint64_t cpu_time_ns(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return
+        (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+            * 1000000000
+      + (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000;
+}
+
+/**
+ * \brief Print the results of one run.
+ *
+ * The crypto column is the workers' crypto time over wall time, so a value
+ * near the worker count means the workers were never idle.
+ *
+ * \param result        The results of this run.
+ * \param base          The results of the first run.
+ * \param mb            The payload megabytes sent in each direction.
+ */
+static void print_result(
+    const bench_result* result, const bench_result* base, double mb)
+{
+    char workers[16], crypto[16];
+
+    if (0 == result->workers)
+    {
+        snprintf(workers, sizeof(workers), "blocking");
+        snprintf(crypto, sizeof(crypto), "-");
+    }
+    else
+    {
+        snprintf(workers, sizeof(workers), "%zu", result->workers);
+        snprintf(
+            crypto, sizeof(crypto), "%.2f",
+            (double)result->crypto_ns / result->elapsed_ns);
+    }
+
+    printf(
+        "%-9s %10.1f %10.1f %10s %8.2fx\n", workers,
+        mb / (result->elapsed_ns / 1e9), result->cpu_ns / 1e3 / mb, crypto,
+        (double)base->elapsed_ns / result->elapsed_ns);
+}
@@ -9,15 +9,14 @@
 #include <errno.h>
 #include <helpers/cert_helpers.h>
 #include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/large_buffer_pool.h>
 #include <helpers/ping_protocol.h>
-#include <helpers/ping_protocol/verbs.h>
 #include <helpers/status_codes.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 #include <vcblockchain/protocol.h>
-#include <vcblockchain/protocol/data.h>
-#include <vcblockchain/protocol/serialization.h>
 #include <vccert/certificate_types.h>
 #include <vccrypt/compare.h>
 #include <vpr/allocator/malloc_allocator.h>
@@ -29,10 +28,6 @@ RCPR_IMPORT_resource;
 RCPR_IMPORT_uuid;
 
 /* forward decls */
-static status read_decode_and_dispatch_request(
-    psock* sock, rcpr_allocator* alloc, vccrypt_suite_options_t* suite,
-    uint64_t* client_iv, uint64_t* server_iv, vccrypt_buffer_t* shared_secret,
-    size_t payload_size);
 static size_t get_payload_size();
 
 /**
@@ -49,6 +44,10 @@ int main(int argc, char* argv[])
     (void)argv;
     status retval, release_retval;
     allocator_options_t alloc_opts;
+    allocator_options_t* suite_alloc_opts = &alloc_opts;
+    large_buffer_pool_options pool_opts;
+    large_buffer_pool* pool = NULL;
+    large_buffer_pool_allocator pool_alloc;
     rcpr_allocator* alloc;
     vccrypt_suite_options_t suite;
     vccert_builder_options_t builder_opts;
@@ -76,14 +75,34 @@ int main(int argc, char* argv[])
         goto cleanup_allocator;
     }
 
+    /* serve payload and response buffers from a pre-faulted pool. */
+    if (0 != env_get_size("PING_SENTINEL_BUFFER_POOL", 0))
+    {
+        large_buffer_pool_options_init(&pool_opts);
+        pool_opts.slot_size = payload_size + 65536;
+        retval = large_buffer_pool_create(&pool, alloc, &pool_opts);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_rcpr_allocator;
+        }
+
+        large_buffer_pool_allocator_init(&pool_alloc, pool, &alloc_opts);
+        suite_alloc_opts = &pool_alloc.options;
+        printf(
+            "Using a %s buffer pool.\n",
+            large_buffer_pool_backing_name(
+                large_buffer_pool_backing_get(pool)));
+    }
+
     /* initialize the vccrypt suite. */
     retval =
-        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+        vccrypt_suite_options_init(
+            &suite, suite_alloc_opts, VCCRYPT_SUITE_VELO_V1);
     if (VCCRYPT_STATUS_SUCCESS != retval)
     {
         fprintf(stderr, "Error initializing crypto suite.\n");
         retval = ERROR_CRYPTO_SUITE_INIT;
-        goto cleanup_rcpr_allocator;
+        goto cleanup_buffer_pool;
     }
 
     /* initialize certificate builder options. */
@@ -158,7 +177,7 @@ int main(int argc, char* argv[])
     for (;;)
     {
         retval =
-            read_decode_and_dispatch_request(
+            ping_protocol_sentinel_serve_request(
                 sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
                 payload_size);
         if (STATUS_SUCCESS != retval)
@@ -209,6 +228,17 @@ cleanup_builder_opts:
 cleanup_crypto_suite:
     dispose((disposable_t*)&suite);
 
+cleanup_buffer_pool:
+    if (NULL != pool)
+    {
+        dispose((disposable_t*)&pool_alloc.options);
+        release_retval = large_buffer_pool_release(pool);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
 cleanup_rcpr_allocator:
     release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
     if (STATUS_SUCCESS != release_retval)
@@ -222,143 +252,6 @@ cleanup_allocator:
     return retval;
 }
 
-/**
- * \brief Read, decode, and dispatch a request.
- */
-static status read_decode_and_dispatch_request(
-    psock* sock, rcpr_allocator* alloc, vccrypt_suite_options_t* suite,
-    uint64_t* client_iv, uint64_t* server_iv, vccrypt_buffer_t* shared_secret,
-    size_t payload_size)
-{
-    status retval;
-    vccrypt_buffer_t response, send_response;
-    vccrypt_buffer_t response_body;
-    uint32_t request_id, offset, status_code;
-    bool fail_response = false;
-    uint32_t fail_code;
-    protocol_resp_extended_api_client_request client_resp;
-
-    /* read a response from the API. */
-    retval =
-        vcblockchain_protocol_recvresp(
-            sock, alloc, suite, server_iv, shared_secret, &response);
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_READ_EXTENDED_API_RESPONSE;
-        goto done;
-    }
-
-    /* decode the header. */
-    retval =
-        vcblockchain_protocol_response_decode_header(
-            &request_id, &offset, &status_code, &response);
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_READ_EXTENDED_API_RESPONSE_DECODE_HEADER;
-        goto cleanup_response;
-    }
-
-    /* verify that this is a client request. */
-    if (PROTOCOL_REQ_ID_EXTENDED_API_CLIENTREQ != request_id)
-    {
-        retval = ERROR_READ_EXTENDED_API_BAD_REQUEST_ID;
-        goto cleanup_response;
-    }
-
-    /* decode the client request. */
-    retval =
-        vcblockchain_protocol_decode_resp_extended_api_client_request(
-            &client_resp, suite->alloc_opts, response.data, response.size);
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_READ_EXTENDED_API_DECODE_RESPONSE;
-        goto cleanup_response;
-    }
-
-    /* verify the verb id. */
-    if (memcmp(&HELPERS_PING_PROTOCOL_VERB_PING, &client_resp.verb_id, 16))
-    {
-        fail_response = true;
-        fail_code = ERROR_READ_EXTENDED_API_INVALID_VERB;
-    }
-
-    /* create a dummy response body. */
-    retval =
-        vccrypt_buffer_init(&response_body, suite->alloc_opts, payload_size);
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_READ_EXTENDED_API_OUT_OF_MEMORY;
-        goto cleanup_client_resp;
-    }
-
-    /* send the response. */
-    if (fail_response)
-    {
-        retval =
-            vcblockchain_protocol_sendreq_extended_api_response(
-                sock, suite, client_iv, shared_secret, client_resp.offset,
-                fail_code, &response_body);
-    }
-    else
-    {
-        retval =
-            vcblockchain_protocol_sendreq_extended_api_response(
-                sock, suite, client_iv, shared_secret, client_resp.offset,
-                STATUS_SUCCESS, &response_body);
-    }
-
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_WRITE_EXTENDED_API_RESPONSE;
-        goto cleanup_response_body;
-    }
-
-    /* read a response from the API. */
-    retval =
-        vcblockchain_protocol_recvresp(
-            sock, alloc, suite, server_iv, shared_secret, &send_response);
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_READ_EXTENDED_API_RESPONSE;
-        goto cleanup_response_body;
-    }
-
-    /* decode the header. */
-    retval =
-        vcblockchain_protocol_response_decode_header(
-            &request_id, &offset, &status_code, &send_response);
-    if (STATUS_SUCCESS != retval)
-    {
-        retval = ERROR_READ_EXTENDED_API_RESPONSE_DECODE_HEADER;
-        goto cleanup_send_response;
-    }
-
-    /* verify that this is a send response. */
-    if (PROTOCOL_REQ_ID_EXTENDED_API_SENDRESP != request_id)
-    {
-        retval = ERROR_READ_EXTENDED_API_BAD_REQUEST_ID;
-        goto cleanup_send_response;
-    }
-
-    /* either way, we are done. */
-    goto cleanup_send_response;
-
-cleanup_send_response:
-    dispose((disposable_t*)&send_response);
-
-cleanup_response_body:
-    dispose((disposable_t*)&response_body);
-
-cleanup_client_resp:
-    dispose((disposable_t*)&client_resp);
-
-cleanup_response:
-    dispose((disposable_t*)&response);
-
-done:
-    return retval;
-}
-
 /**
  * \brief Get the payload size from the environment, defaulting it to 1.
  *
@@ -0,0 +1,643 @@
+/**
+ * \file pipelined_submit_bench/main.c
+ *
+ * \brief Main entry point for the pipelined submit benchmark.
+ *
+ * This benchmark measures transaction submission throughput on a single
+ * session. The baseline is submit_and_verify_txn, which waits for each
+ * acknowledgement before sending the next submission, so its throughput is
+ * one transaction per round trip. The same number of transactions is then
+ * submitted through a submission window at each configured window size,
+ * with acknowledgements matched to submissions by offset.
+ *
+ * For each run, the throughput, the speedup over the baseline, and the
+ * acknowledgement latency of each transaction are reported. A larger window
+ * raises throughput until agentd becomes the limit, after which it only
+ * adds queueing latency.
+ *
+ * Finally, unless SUBMIT_ADAPTIVE is 0, the batch is submitted once more with
+ * the window sized by an AIMD controller fed by acknowledgement latency and
+ * rejections. The trace of that run shows the window converging on the
+ * largest size agentd absorbs without latency growing.
+ *
+ * Certificates are built before each run starts, so only submission is
+ * timed.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_session.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <helpers/submit_controller.h>
+#include <helpers/submit_window.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define BENCH_MAX_WINDOWS 16
+#define BENCH_MAX_WINDOW 4096
+
+/**
+ * \brief A batch of prepared transactions.
+ */
+typedef struct txn_batch txn_batch;
+
+struct txn_batch
+{
+    size_t count;
+    vpr_uuid* txn_ids;
+    vpr_uuid* artifact_ids;
+    vccrypt_buffer_t* certs;
+};
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    vccert_builder_options_t* builder_opts;
+    agentd_session* session;
+    txn_batch batch;
+    double baseline_rate;
+    vpr_uuid last_accepted;
+    bool any_accepted;
+    submit_window* win;
+    submit_controller* ctrl;
+    uint64_t acks;
+    uint64_t trace_every;
+    uint64_t trace_start_ns;
+};
+
+/* forward decls. */
+static size_t parse_windows(size_t* windows);
+static status batch_prepare(bench_context* ctx);
+static void batch_dispose(txn_batch* batch);
+static status run_baseline(bench_context* ctx);
+static status run_window(bench_context* ctx, size_t window);
+static status run_adaptive(bench_context* ctx);
+static void on_ack(void* context, const submit_window_ack* ack);
+
+/**
+ * \brief Main entry point for the pipelined submit benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    agentd_session session;
+    bench_context ctx;
+    size_t windows[BENCH_MAX_WINDOWS];
+    size_t window_count = parse_windows(windows);
+    size_t txns = env_get_size("SUBMIT_TXNS", 2000);
+
+    if (0 == window_count || 0 == txns)
+    {
+        fprintf(stderr, "Bad pipelined submit benchmark configuration.\n");
+        return ERROR_PIPELINED_SUBMIT_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* connect to agentd. */
+    retval =
+        agentd_session_init(
+            &session, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.alloc = alloc;
+    ctx.suite = &suite;
+    ctx.builder_opts = &builder_opts;
+    ctx.session = &session;
+    ctx.batch.count = txns;
+    ctx.batch.txn_ids = calloc(txns, sizeof(vpr_uuid));
+    ctx.batch.artifact_ids = calloc(txns, sizeof(vpr_uuid));
+    ctx.batch.certs = calloc(txns, sizeof(vccrypt_buffer_t));
+    if (NULL == ctx.batch.txn_ids || NULL == ctx.batch.artifact_ids
+     || NULL == ctx.batch.certs)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        retval = ERROR_PIPELINED_SUBMIT_BENCH_OUT_OF_MEMORY;
+        goto cleanup_batch;
+    }
+
+    printf("submitting %zu transactions per run on one session\n", txns);
+
+    retval = run_baseline(&ctx);
+    for (size_t i = 0; STATUS_SUCCESS == retval && i < window_count; ++i)
+    {
+        retval = run_window(&ctx, windows[i]);
+    }
+
+    if (STATUS_SUCCESS == retval && 0 != env_get_size("SUBMIT_ADAPTIVE", 1))
+    {
+        retval = run_adaptive(&ctx);
+    }
+
+    /* everything submitted should reach the chain. */
+    if (STATUS_SUCCESS == retval && ctx.any_accepted)
+    {
+        retval =
+            chain_wait_for_transaction(
+                &session, alloc, &suite, &ctx.last_accepted, 10, 30000, NULL);
+    }
+
+cleanup_batch:
+    free(ctx.batch.txn_ids);
+    free(ctx.batch.artifact_ids);
+    free(ctx.batch.certs);
+
+    release_retval =
+        send_and_verify_close_connection(
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Parse the comma separated list of window sizes in SUBMIT_WINDOWS.
+ *
+ * \param windows       Array of BENCH_MAX_WINDOWS entries to receive the
+ *                      list.
+ *
+ * \returns the number of windows parsed, or 0 if the list is invalid.
+ */
+static size_t parse_windows(size_t* windows)
+{
+    const char* str = env_get_string("SUBMIT_WINDOWS", "1,4,16,64");
+    char* endptr;
+    size_t count = 0;
+
+    while ('\0' != *str)
+    {
+        errno = 0;
+        windows[count] = (size_t)strtoumax(str, &endptr, 10);
+        if (0 != errno || endptr == str || 0 == windows[count]
+         || windows[count] > BENCH_MAX_WINDOW
+         || (',' != *endptr && '\0' != *endptr)
+         || ++count == BENCH_MAX_WINDOWS)
+        {
+            fprintf(stderr, "Bad SUBMIT_WINDOWS value.\n");
+            return 0;
+        }
+
+        str = (',' == *endptr) ? endptr + 1 : endptr;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Build a fresh certificate for every transaction of the batch.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status batch_prepare(bench_context* ctx)
+{
+    status retval;
+    const rcpr_uuid* client_id;
+    const vccrypt_buffer_t* client_sign_priv;
+    txn_batch* batch = &ctx->batch;
+
+    retval =
+        vcblockchain_entity_get_artifact_id(&client_id, ctx->session->cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vcblockchain_entity_private_cert_get_private_signing_key(
+            &client_sign_priv, ctx->session->cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < batch->count; ++i)
+    {
+        retval =
+            create_transaction_cert(
+                &batch->certs[i], (rcpr_uuid*)&batch->txn_ids[i],
+                (rcpr_uuid*)&batch->artifact_ids[i], ctx->builder_opts,
+                client_id, client_sign_priv);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error creating transaction certificate.\n");
+            batch_dispose(batch);
+            return ERROR_TRANSACTION_CERT_CREATE;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the certificates of a batch.
+ *
+ * \param batch         The batch.
+ */
+static void batch_dispose(txn_batch* batch)
+{
+    for (size_t i = 0; i < batch->count; ++i)
+    {
+        if (NULL != batch->certs[i].data)
+        {
+            dispose((disposable_t*)&batch->certs[i]);
+            memset(&batch->certs[i], 0, sizeof(batch->certs[i]));
+        }
+    }
+}
+
+/**
+ * \brief Submit the batch one transaction at a time.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_baseline(bench_context* ctx)
+{
+    status retval = STATUS_SUCCESS;
+    agentd_session* session = ctx->session;
+    latency_histogram latency;
+    uint64_t start, txn_start, elapsed_ns;
+
+    retval = batch_prepare(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    latency_histogram_init(&latency);
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < ctx->batch.count; ++i)
+    {
+        txn_start = latency_clock_now_ns();
+        retval =
+            submit_and_verify_txn(
+                session->sock, ctx->alloc, ctx->suite, &session->client_iv,
+                &session->server_iv, &session->shared_secret,
+                &ctx->batch.txn_ids[i], &ctx->batch.artifact_ids[i],
+                &ctx->batch.certs[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_batch;
+        }
+
+        latency_histogram_record(
+            &latency, latency_clock_now_ns() - txn_start);
+    }
+
+    elapsed_ns = latency_clock_now_ns() - start;
+    ctx->baseline_rate = ctx->batch.count * 1e9 / elapsed_ns;
+
+    printf(
+        "serial submit_and_verify_txn: %.0f txns/s\n", ctx->baseline_rate);
+    latency_histogram_print(&latency, stdout, "  ack latency");
+
+cleanup_batch:
+    batch_dispose(&ctx->batch);
+
+    return retval;
+}
+
+/**
+ * \brief Submit the batch through a window of the given size.
+ *
+ * \param ctx           The benchmark context.
+ * \param window        The window size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_window(bench_context* ctx, size_t window)
+{
+    status retval, release_retval;
+    submit_window* win;
+    submit_window_stats stats;
+    uint64_t start, elapsed_ns;
+    double rate;
+
+    retval = batch_prepare(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        submit_window_create(
+            &win, ctx->alloc, ctx->suite, ctx->session, window, &on_ack,
+            ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_batch;
+    }
+
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < ctx->batch.count; ++i)
+    {
+        retval =
+            submit_window_submit(
+                win, &ctx->batch.txn_ids[i], &ctx->batch.artifact_ids[i],
+                &ctx->batch.certs[i], NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_window;
+        }
+    }
+
+    retval = submit_window_drain(win);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_window;
+    }
+
+    elapsed_ns = latency_clock_now_ns() - start;
+    submit_window_take_stats(win, &stats);
+    rate = stats.accepted * 1e9 / elapsed_ns;
+
+    printf(
+        "window %zu: %.0f txns/s (%.2fx serial), %" PRIu64 " accepted, %"
+        PRIu64 " rejected, full %" PRIu64 " times\n",
+        window, rate, ctx->baseline_rate > 0 ? rate / ctx->baseline_rate : 0,
+        stats.accepted, stats.rejected, stats.full_waits);
+    latency_histogram_print(&stats.latency, stdout, "  ack latency");
+
+    if (0 != stats.rejected)
+    {
+        retval = ERROR_PIPELINED_SUBMIT_BENCH_REJECTED;
+    }
+
+cleanup_window:
+    release_retval = submit_window_release(win);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_batch:
+    batch_dispose(&ctx->batch);
+
+    return retval;
+}
+
+/**
+ * \brief Submit the batch through a window sized by an AIMD controller.
+ *
+ * The window may grow up to SUBMIT_MAX_WINDOW. The latency target is
+ * SUBMIT_LATENCY_TARGET_US if set, and otherwise SUBMIT_LATENCY_TOLERANCE
+ * times the lowest latency seen.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_adaptive(bench_context* ctx)
+{
+    status retval, release_retval;
+    submit_controller_options opts;
+    submit_controller ctrl;
+    submit_window_stats stats;
+    uint64_t start, elapsed_ns;
+    double rate;
+
+    submit_controller_options_init(&opts);
+    opts.max_window = env_get_size("SUBMIT_MAX_WINDOW", opts.max_window);
+    opts.latency_tolerance =
+        env_get_double("SUBMIT_LATENCY_TOLERANCE", opts.latency_tolerance);
+    opts.latency_target_ns =
+        env_get_size("SUBMIT_LATENCY_TARGET_US", 0) * 1000;
+    if (0 == opts.max_window || opts.max_window > BENCH_MAX_WINDOW
+     || opts.latency_tolerance <= 1.0)
+    {
+        fprintf(stderr, "Bad pipelined submit benchmark configuration.\n");
+        return ERROR_PIPELINED_SUBMIT_BENCH_CONFIGURATION;
+    }
+
+    submit_controller_init(&ctrl, &opts);
+
+    retval = batch_prepare(ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        submit_window_create(
+            &ctx->win, ctx->alloc, ctx->suite, ctx->session, opts.max_window,
+            &on_ack, ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_batch;
+    }
+
+    submit_window_set_limit(ctx->win, submit_controller_window(&ctrl));
+    ctx->ctrl = &ctrl;
+    ctx->acks = 0;
+    ctx->trace_every = ctx->batch.count / 20 > 0 ? ctx->batch.count / 20 : 1;
+
+    printf("adaptive window, at most %zu:\n", opts.max_window);
+
+    start = latency_clock_now_ns();
+    ctx->trace_start_ns = start;
+    for (size_t i = 0; i < ctx->batch.count; ++i)
+    {
+        retval =
+            submit_window_submit(
+                ctx->win, &ctx->batch.txn_ids[i], &ctx->batch.artifact_ids[i],
+                &ctx->batch.certs[i], NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_window;
+        }
+    }
+
+    retval = submit_window_drain(ctx->win);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_window;
+    }
+
+    elapsed_ns = latency_clock_now_ns() - start;
+    submit_window_take_stats(ctx->win, &stats);
+    rate = stats.accepted * 1e9 / elapsed_ns;
+
+    /* rejections are a signal to the controller here, not a failure. */
+    printf(
+        "adaptive: %.0f txns/s (%.2fx serial), %" PRIu64 " accepted, %"
+        PRIu64 " rejected, final window %zu, %" PRIu64 " latency cuts, %"
+        PRIu64 " rejection cuts\n",
+        rate, ctx->baseline_rate > 0 ? rate / ctx->baseline_rate : 0,
+        stats.accepted, stats.rejected, submit_controller_window(&ctrl),
+        ctrl.latency_decreases, ctrl.reject_decreases);
+    latency_histogram_print(&stats.latency, stdout, "  ack latency");
+
+cleanup_window:
+    release_retval = submit_window_release(ctx->win);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    ctx->win = NULL;
+    ctx->ctrl = NULL;
+
+cleanup_batch:
+    batch_dispose(&ctx->batch);
+
+    return retval;
+}
+
+/**
+ * \brief Track accepted transactions, and feed the controller if one is
+ * running.
+ *
+ * \param context       The benchmark context.
+ * \param ack           The acknowledgement.
+ */
+static void on_ack(void* context, const submit_window_ack* ack)
+{
+    bench_context* ctx = (bench_context*)context;
+    uint64_t now;
+
+    if (STATUS_SUCCESS == ack->status)
+    {
+        memcpy(&ctx->last_accepted, ack->txn_id, sizeof(ctx->last_accepted));
+        ctx->any_accepted = true;
+    }
+
+    if (NULL == ctx->ctrl)
+    {
+        return;
+    }
+
+    submit_controller_on_ack(ctx->ctrl, ack);
+    submit_window_set_limit(ctx->win, submit_controller_window(ctx->ctrl));
+
+    /* trace the window as it converges. */
+    ctx->acks += 1;
+    if (0 == ctx->acks % ctx->trace_every)
+    {
+        now = latency_clock_now_ns();
+        printf(
+            "  %8" PRIu64 " acks: window %4zu, smoothed latency %8.1f us, "
+            "target %8.1f us, %.0f txns/s\n",
+            ctx->acks, submit_controller_window(ctx->ctrl),
+            ctx->ctrl->smoothed_latency_ns / 1e3,
+            submit_controller_target_ns(ctx->ctrl) / 1e3,
+            ctx->trace_every * 1e9 / (now - ctx->trace_start_ns));
+        ctx->trace_start_ns = now;
+    }
+}
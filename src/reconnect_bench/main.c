@@ -0,0 +1,260 @@
+/**
+ * \file reconnect_bench/main.c
+ *
+ * \brief Main entry point for the reconnect benchmark.
+ *
+ * This benchmark opens RECONNECT_COUNT sessions one after another, closing
+ * each gracefully before opening the next, with RECONNECT_INTERVAL_US
+ * microseconds between them. It does this twice: first with
+ * \ref agentd_session_init, which reads the credentials and draws the
+ * handshake nonces while connecting, then with
+ * \ref agentd_session_init_pooled, backed by a handshake pool of
+ * RECONNECT_POOL_CAPACITY entries. It reports the connect latency of each,
+ * from opening the socket to the handshake acknowledgement, and how many
+ * pooled connects found an entry ready.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/handshake_pool.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    const char* hostaddr;
+    unsigned int hostport;
+    size_t count;
+    size_t interval_us;
+};
+
+/* forward decls. */
+static status run_reconnects(
+    bench_context* ctx, handshake_pool* pool, latency_histogram* hist);
+
+/**
+ * \brief Main entry point for the reconnect benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    handshake_pool_options pool_opts;
+    handshake_pool* pool;
+    handshake_pool_stats pool_stats;
+    bench_context ctx;
+    latency_histogram direct, pooled;
+    uint64_t direct_mean, pooled_mean;
+
+    ctx.hostaddr = env_get_string("RECONNECT_HOST", "127.0.0.1");
+    ctx.hostport = (unsigned int)env_get_size("RECONNECT_PORT", 4931);
+    ctx.count = env_get_size("RECONNECT_COUNT", 200);
+    ctx.interval_us = env_get_size("RECONNECT_INTERVAL_US", 1000);
+    handshake_pool_options_init(&pool_opts);
+    pool_opts.capacity =
+        env_get_size("RECONNECT_POOL_CAPACITY", pool_opts.capacity);
+    if (0 == ctx.count || 0 == pool_opts.capacity || ctx.hostport > 65535)
+    {
+        fprintf(stderr, "Bad reconnect benchmark configuration.\n");
+        return ERROR_RECONNECT_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    ctx.alloc = alloc;
+    ctx.file = &file;
+    ctx.suite = &suite;
+
+    printf(
+        "%zu reconnects, %zu us apart, pool of %zu\n", ctx.count,
+        ctx.interval_us, pool_opts.capacity);
+
+    /* connect the usual way. */
+    retval = run_reconnects(&ctx, NULL, &direct);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    latency_histogram_print(&direct, stdout, "direct connect");
+
+    /* connect with precomputed handshake material. */
+    retval =
+        handshake_pool_create(
+            &pool, alloc, &file, &suite, "test.priv", "agentd.pub",
+            &pool_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    retval = run_reconnects(&ctx, pool, &pooled);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    latency_histogram_print(&pooled, stdout, "pooled connect");
+
+    handshake_pool_get_stats(pool, &pool_stats);
+    direct_mean = latency_histogram_mean(&direct);
+    pooled_mean = latency_histogram_mean(&pooled);
+    printf(
+        "pool hits %lu misses %lu, %.1f us per entry off the critical path\n",
+        (unsigned long)pool_stats.hits, (unsigned long)pool_stats.misses,
+        pool_stats.produced > 0
+            ? pool_stats.produce_ns / 1e3 / pool_stats.produced : 0.0);
+    printf(
+        "mean connect latency %.1f us -> %.1f us (%.1f%% lower)\n",
+        direct_mean / 1e3, pooled_mean / 1e3,
+        direct_mean > 0
+            ? 100.0 * ((double)direct_mean - pooled_mean) / direct_mean
+            : 0.0);
+
+cleanup_pool:
+    release_retval = handshake_pool_release(pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Open and close sessions one after another, timing each connect.
+ *
+ * \param ctx           The benchmark context.
+ * \param pool          The handshake pool to connect with, or NULL to
+ *                      connect with \ref agentd_session_init.
+ * \param hist          The histogram to receive the connect latencies.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_reconnects(
+    bench_context* ctx, handshake_pool* pool, latency_histogram* hist)
+{
+    status retval, release_retval;
+    agentd_session session;
+    uint64_t start;
+
+    latency_histogram_init(hist);
+
+    for (size_t i = 0; i < ctx->count; ++i)
+    {
+        /* give the refill thread the time a real client would. */
+        usleep(ctx->interval_us);
+
+        start = latency_clock_now_ns();
+        retval =
+            (NULL == pool)
+                ? agentd_session_init(
+                    &session, ctx->alloc, ctx->file, ctx->suite,
+                    ctx->hostaddr, ctx->hostport, "test.priv", "agentd.pub")
+                : agentd_session_init_pooled(
+                    &session, ctx->alloc, pool, ctx->hostaddr,
+                    ctx->hostport);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error connecting session %zu.\n", i);
+            return retval;
+        }
+
+        latency_histogram_record(hist, latency_clock_now_ns() - start);
+
+        /* send the close request. */
+        retval =
+            send_and_verify_close_connection(
+                session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+                &session.server_iv, &session.shared_secret);
+
+        release_retval = agentd_session_dispose(&session);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,799 @@
+/**
+ * \file rw_interference_bench/main.c
+ *
+ * \brief Main entry point for the read/write interference benchmark.
+ *
+ * This benchmark measures how reads and writes in agentd interfere with each
+ * other, in two sweeps.
+ *
+ * The first sweep ramps read load from idle to saturation. At each level, a
+ * fixed number of closed-loop reader threads hammer agentd while a committer
+ * submits transactions one at a time and measures the time from submission
+ * until each transaction is canonized into a block.
+ *
+ * The second sweep ramps submit load. At each level, a fixed number of reader
+ * threads measure read latency while submitter threads keep the canonizer
+ * busy.
+ *
+ * Both sweeps are reported as interference curves: one row per load level.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_session.h>
+#include <helpers/agentd_status.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/read_request.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+#define BENCH_MAX_LEVELS 32
+#define BENCH_MAX_WORKERS 256
+#define BENCH_SEED_TXNS 16
+
+/**
+ * \brief The kinds of load worker.
+ */
+typedef enum worker_role
+{
+    WORKER_ROLE_READER,
+    WORKER_ROLE_SUBMITTER,
+} worker_role;
+
+typedef struct bench_context bench_context;
+
+/**
+ * \brief A load worker thread and the session it owns.
+ */
+typedef struct load_worker load_worker;
+
+struct load_worker
+{
+    pthread_t thread;
+    bench_context* ctx;
+    worker_role role;
+    size_t index;
+    agentd_session session;
+    load_stats stats;
+};
+
+/**
+ * \brief One row of an interference curve.
+ *
+ * For the read sweep, load is the number of reader threads, throughput is in
+ * reads per second, and latency is the commit latency. For the submit sweep,
+ * load is the number of submitter threads, throughput is in submits per
+ * second, and latency is the read latency.
+ */
+typedef struct curve_point curve_point;
+
+struct curve_point
+{
+    size_t load;
+    double throughput;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t max_ns;
+    uint64_t failures;
+};
+
+/**
+ * \brief Shared benchmark state.
+ */
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    vccert_builder_options_t* builder_opts;
+    vpr_uuid txn_ids[BENCH_SEED_TXNS];
+    vpr_uuid block_id;
+    atomic_bool stop;
+    load_worker workers[BENCH_MAX_WORKERS];
+};
+
+/* forward decls. */
+static size_t parse_levels(
+    const char* name, const char* default_value, size_t* levels);
+static status run_read_sweep(
+    bench_context* ctx, const size_t* levels, size_t level_count,
+    size_t commits, curve_point* curve);
+static status run_submit_sweep(
+    bench_context* ctx, const size_t* levels, size_t level_count,
+    size_t readers, uint64_t duration_ns, curve_point* curve);
+static status start_workers(
+    bench_context* ctx, size_t first, size_t count, worker_role role);
+static void stop_workers(bench_context* ctx, size_t count);
+static void* worker_main(void* context);
+static status worker_read(load_worker* worker, size_t i);
+static void curve_point_set(
+    curve_point* point, size_t load, double throughput,
+    const latency_histogram* hist, uint64_t failures);
+static void print_curve(
+    const char* title, const char* load_label, const char* throughput_label,
+    const char* latency_label, double latency_scale, const curve_point* curve,
+    size_t count);
+
+/**
+ * \brief Main entry point for the read/write interference benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    agentd_session setup;
+    bench_context* ctx;
+    size_t read_levels[BENCH_MAX_LEVELS], submit_levels[BENCH_MAX_LEVELS];
+    curve_point read_curve[BENCH_MAX_LEVELS];
+    curve_point submit_curve[BENCH_MAX_LEVELS];
+    size_t read_level_count, submit_level_count;
+    size_t commits = env_get_size("INTERFERENCE_COMMITS", 10);
+    size_t readers = env_get_size("INTERFERENCE_READERS", 4);
+    uint64_t duration_ns =
+        env_get_size("INTERFERENCE_LEVEL_S", 10) * UINT64_C(1000000000);
+
+    read_level_count =
+        parse_levels(
+            "INTERFERENCE_READ_LEVELS", "0,1,2,4,8,16,32", read_levels);
+    submit_level_count =
+        parse_levels(
+            "INTERFERENCE_SUBMIT_LEVELS", "0,1,2,4,8", submit_levels);
+    if (0 == read_level_count || 0 == submit_level_count)
+    {
+        return ERROR_INTERFERENCE_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* the worker table is too large for the stack. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&ctx, sizeof(*ctx));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    atomic_init(&ctx->stop, false);
+    ctx->alloc = alloc;
+    ctx->file = &file;
+    ctx->suite = &suite;
+    ctx->builder_opts = &builder_opts;
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_ctx;
+    }
+
+    /* seed the chain with transactions for the readers. */
+    retval =
+        chain_seed_transactions(
+            &setup, alloc, &suite, &builder_opts, BENCH_SEED_TXNS,
+            ctx->txn_ids, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    retval =
+        chain_wait_for_transaction(
+            &setup, alloc, &suite, &ctx->txn_ids[BENCH_SEED_TXNS - 1], 100,
+            30000, &ctx->block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* commit latency as read load ramps up. */
+    retval =
+        run_read_sweep(
+            ctx, read_levels, read_level_count, commits, read_curve);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* read latency as submit load ramps up. */
+    retval =
+        run_submit_sweep(
+            ctx, submit_levels, submit_level_count, readers, duration_ns,
+            submit_curve);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    print_curve(
+        "commit latency vs read load", "readers", "reads/s", "commit_ms",
+        1e6, read_curve, read_level_count);
+    print_curve(
+        "read latency vs submit load", "submitters", "submits/s", "read_us",
+        1e3, submit_curve, submit_level_count);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_setup;
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_ctx:
+    release_retval = rcpr_allocator_reclaim(alloc, ctx);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Parse a comma separated list of load levels from the environment.
+ *
+ * \param name          The name of the environment variable.
+ * \param default_value The list to use if the variable is unset.
+ * \param levels        Array of BENCH_MAX_LEVELS entries to receive the list.
+ *
+ * \returns the number of levels parsed, or 0 if the list is invalid.
+ */
+static size_t parse_levels(
+    const char* name, const char* default_value, size_t* levels)
+{
+    const char* str = env_get_string(name, default_value);
+    char* endptr;
+    size_t count = 0;
+
+    while ('\0' != *str)
+    {
+        errno = 0;
+        levels[count] = (size_t)strtoumax(str, &endptr, 10);
+        if (0 != errno || endptr == str
+         || levels[count] > BENCH_MAX_WORKERS / 2
+         || (',' != *endptr && '\0' != *endptr)
+         || ++count == BENCH_MAX_LEVELS)
+        {
+            fprintf(stderr, "Bad %s value.\n", name);
+            return 0;
+        }
+
+        str = (',' == *endptr) ? endptr + 1 : endptr;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Measure commit latency at each read load level.
+ *
+ * \param ctx           The benchmark context.
+ * \param levels        The number of reader threads at each level.
+ * \param level_count   The number of levels.
+ * \param commits       The number of commits to time at each level.
+ * \param curve         Array to receive one point per level.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_read_sweep(
+    bench_context* ctx, const size_t* levels, size_t level_count,
+    size_t commits, curve_point* curve)
+{
+    status retval;
+    agentd_session committer;
+    latency_histogram commit_latency;
+    load_stats reads;
+    vpr_uuid txn_id;
+    uint64_t start, commit_start;
+    uint64_t failures;
+    char label[64];
+
+    /* the committer keeps its own session across levels. */
+    retval =
+        agentd_session_init(
+            &committer, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t l = 0; l < level_count; ++l)
+    {
+        latency_histogram_init(&commit_latency);
+        load_stats_init(&reads);
+        failures = 0;
+
+        retval = start_workers(ctx, 0, levels[l], WORKER_ROLE_READER);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_committer;
+        }
+
+        /* time each commit from submission until canonization. */
+        start = latency_clock_now_ns();
+        for (size_t i = 0; i < commits; ++i)
+        {
+            commit_start = latency_clock_now_ns();
+            retval =
+                chain_seed_transactions(
+                    &committer, ctx->alloc, ctx->suite, ctx->builder_opts, 1,
+                    &txn_id, NULL);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval =
+                    chain_wait_for_transaction(
+                        &committer, ctx->alloc, ctx->suite, &txn_id, 5,
+                        60000, NULL);
+            }
+
+            if (STATUS_SUCCESS != retval)
+            {
+                ++failures;
+                if (status_is_transport_error(retval))
+                {
+                    stop_workers(ctx, levels[l]);
+                    goto cleanup_committer;
+                }
+
+                continue;
+            }
+
+            latency_histogram_record(
+                &commit_latency, latency_clock_now_ns() - commit_start);
+        }
+
+        stop_workers(ctx, levels[l]);
+        for (size_t i = 0; i < levels[l]; ++i)
+        {
+            load_stats_merge(&reads, &ctx->workers[i].stats);
+        }
+
+        snprintf(label, sizeof(label), "commit @ %zu readers", levels[l]);
+        latency_histogram_print(&commit_latency, stdout, label);
+        snprintf(label, sizeof(label), "reads @ %zu readers", levels[l]);
+        load_stats_print(
+            &reads, stdout, label, (latency_clock_now_ns() - start) / 1e9);
+
+        curve_point_set(
+            &curve[l], levels[l],
+            reads.success_latency.total
+                / ((latency_clock_now_ns() - start) / 1e9),
+            &commit_latency, failures);
+    }
+
+    retval = STATUS_SUCCESS;
+
+cleanup_committer:
+    if (!status_is_transport_error(retval))
+    {
+        (void)send_and_verify_close_connection(
+            committer.sock, ctx->alloc, ctx->suite, &committer.client_iv,
+            &committer.server_iv, &committer.shared_secret);
+    }
+
+    (void)agentd_session_dispose(&committer);
+
+    return retval;
+}
+
+/**
+ * \brief Measure read latency at each submit load level.
+ *
+ * \param ctx           The benchmark context.
+ * \param levels        The number of submitter threads at each level.
+ * \param level_count   The number of levels.
+ * \param readers       The number of reader threads at every level.
+ * \param duration_ns   The duration of each level, in nanoseconds.
+ * \param curve         Array to receive one point per level.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_submit_sweep(
+    bench_context* ctx, const size_t* levels, size_t level_count,
+    size_t readers, uint64_t duration_ns, curve_point* curve)
+{
+    status retval;
+    load_stats reads, submits;
+    uint64_t start;
+    double elapsed_s;
+    char label[64];
+
+    if (readers > BENCH_MAX_WORKERS / 2)
+    {
+        readers = BENCH_MAX_WORKERS / 2;
+    }
+
+    for (size_t l = 0; l < level_count; ++l)
+    {
+        load_stats_init(&reads);
+        load_stats_init(&submits);
+
+        /* start the submitters first so the canonizer is already busy. */
+        retval = start_workers(ctx, 0, levels[l], WORKER_ROLE_SUBMITTER);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = start_workers(ctx, levels[l], readers, WORKER_ROLE_READER);
+        if (STATUS_SUCCESS != retval)
+        {
+            stop_workers(ctx, levels[l]);
+            return retval;
+        }
+
+        start = latency_clock_now_ns();
+        usleep(duration_ns / 1000);
+        stop_workers(ctx, levels[l] + readers);
+        elapsed_s = (latency_clock_now_ns() - start) / 1e9;
+
+        for (size_t i = 0; i < levels[l]; ++i)
+        {
+            load_stats_merge(&submits, &ctx->workers[i].stats);
+        }
+
+        for (size_t i = levels[l]; i < levels[l] + readers; ++i)
+        {
+            load_stats_merge(&reads, &ctx->workers[i].stats);
+        }
+
+        snprintf(label, sizeof(label), "reads @ %zu submitters", levels[l]);
+        load_stats_print(&reads, stdout, label, elapsed_s);
+        snprintf(label, sizeof(label), "submits @ %zu submitters", levels[l]);
+        load_stats_print(&submits, stdout, label, elapsed_s);
+
+        curve_point_set(
+            &curve[l], levels[l], submits.success_latency.total / elapsed_s,
+            &reads.success_latency, reads.failure_latency.total);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Connect and start a range of workers.
+ *
+ * Sessions are connected before any worker starts, so connection setup is
+ * not part of the measured load.
+ *
+ * \param ctx           The benchmark context.
+ * \param first         The index of the first worker to start.
+ * \param count         The number of workers to start.
+ * \param role          The role of the workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status start_workers(
+    bench_context* ctx, size_t first, size_t count, worker_role role)
+{
+    status retval;
+
+    atomic_store(&ctx->stop, false);
+
+    for (size_t i = first; i < first + count; ++i)
+    {
+        load_worker* worker = &ctx->workers[i];
+
+        worker->ctx = ctx;
+        worker->role = role;
+        worker->index = i;
+        load_stats_init(&worker->stats);
+
+        retval =
+            agentd_session_init(
+                &worker->session, ctx->alloc, ctx->file, ctx->suite,
+                "127.0.0.1", 4931, "test.priv", "agentd.pub");
+        if (STATUS_SUCCESS != retval)
+        {
+            /* release the sessions connected so far. */
+            for (size_t j = first; j < i; ++j)
+            {
+                (void)agentd_session_dispose(&ctx->workers[j].session);
+            }
+
+            return retval;
+        }
+    }
+
+    for (size_t i = first; i < first + count; ++i)
+    {
+        pthread_create(
+            &ctx->workers[i].thread, NULL, &worker_main, &ctx->workers[i]);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Stop, join, and disconnect the first count workers.
+ *
+ * \param ctx           The benchmark context.
+ * \param count         The number of workers to stop.
+ */
+static void stop_workers(bench_context* ctx, size_t count)
+{
+    atomic_store(&ctx->stop, true);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        load_worker* worker = &ctx->workers[i];
+
+        pthread_join(worker->thread, NULL);
+
+        if (NULL != worker->session.sock)
+        {
+            (void)send_and_verify_close_connection(
+                worker->session.sock, ctx->alloc, ctx->suite,
+                &worker->session.client_iv, &worker->session.server_iv,
+                &worker->session.shared_secret);
+            (void)agentd_session_dispose(&worker->session);
+        }
+    }
+}
+
+/**
+ * \brief Load worker entry point.
+ *
+ * Readers cycle through a read mix; submitters submit one transaction after
+ * another. Either stops on request or after a transport error, which also
+ * discards its session.
+ *
+ * \param context       The \ref load_worker for this thread.
+ *
+ * \returns NULL.
+ */
+static void* worker_main(void* context)
+{
+    load_worker* worker = (load_worker*)context;
+    bench_context* ctx = worker->ctx;
+    uint64_t start;
+    status retval;
+
+    for (size_t i = 0; !atomic_load(&ctx->stop); ++i)
+    {
+        agentd_status_clear();
+        start = latency_clock_now_ns();
+
+        if (WORKER_ROLE_SUBMITTER == worker->role)
+        {
+            retval =
+                chain_seed_transactions(
+                    &worker->session, ctx->alloc, ctx->suite,
+                    ctx->builder_opts, 1, NULL, NULL);
+        }
+        else
+        {
+            retval = worker_read(worker, i);
+        }
+
+        load_stats_record(
+            &worker->stats, retval, latency_clock_now_ns() - start);
+
+        if (status_is_transport_error(retval))
+        {
+            (void)agentd_session_dispose(&worker->session);
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Issue the next read in the read mix.
+ *
+ * The mix cycles through block gets, transaction gets, and latest block id
+ * lookups.
+ *
+ * \param worker        The reader.
+ * \param i             The iteration number.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status worker_read(load_worker* worker, size_t i)
+{
+    bench_context* ctx = worker->ctx;
+    read_request req;
+    read_result result;
+    status retval;
+
+    memset(&req, 0, sizeof(req));
+    switch ((worker->index + i) % 3)
+    {
+        case 0:
+            req.type = READ_REQUEST_BLOCK_GET;
+            memcpy(&req.id, &ctx->block_id, sizeof(req.id));
+            break;
+
+        case 1:
+            req.type = READ_REQUEST_TXN_GET;
+            memcpy(
+                &req.id, &ctx->txn_ids[(worker->index + i) % BENCH_SEED_TXNS],
+                sizeof(req.id));
+            break;
+
+        default:
+            req.type = READ_REQUEST_LATEST_BLOCK_ID_GET;
+            break;
+    }
+
+    retval =
+        read_request_execute(
+            &worker->session, ctx->alloc, ctx->suite, &req, &result);
+    if (STATUS_SUCCESS == retval)
+    {
+        read_result_dispose(&result);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Fill in a curve point from a latency histogram.
+ *
+ * \param point         The point to fill in.
+ * \param load          The load level.
+ * \param throughput    The throughput at this level.
+ * \param hist          The latencies measured at this level.
+ * \param failures      The number of failed measurements at this level.
+ */
+static void curve_point_set(
+    curve_point* point, size_t load, double throughput,
+    const latency_histogram* hist, uint64_t failures)
+{
+    point->load = load;
+    point->throughput = throughput;
+    point->p50_ns = latency_histogram_percentile(hist, 50.0);
+    point->p90_ns = latency_histogram_percentile(hist, 90.0);
+    point->p99_ns = latency_histogram_percentile(hist, 99.0);
+    point->max_ns = hist->max;
+    point->failures = failures;
+}
+
+/**
+ * \brief Print an interference curve as comma separated values.
+ *
+ * \param title             The title of the curve.
+ * \param load_label        The column label for the load level.
+ * \param throughput_label  The column label for the throughput.
+ * \param latency_label     The column label prefix for the latencies.
+ * \param latency_scale     The divisor converting nanoseconds to the
+ *                          latency unit.
+ * \param curve             The points of the curve.
+ * \param count             The number of points.
+ */
+static void print_curve(
+    const char* title, const char* load_label, const char* throughput_label,
+    const char* latency_label, double latency_scale, const curve_point* curve,
+    size_t count)
+{
+    printf("\n# %s\n", title);
+    printf(
+        "%s,%s,%s_p50,%s_p90,%s_p99,%s_max,failures\n", load_label,
+        throughput_label, latency_label, latency_label, latency_label,
+        latency_label);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        printf(
+            "%zu,%.1f,%.3f,%.3f,%.3f,%.3f,%" PRIu64 "\n", curve[i].load,
+            curve[i].throughput, curve[i].p50_ns / latency_scale,
+            curve[i].p90_ns / latency_scale, curve[i].p99_ns / latency_scale,
+            curve[i].max_ns / latency_scale, curve[i].failures);
+    }
+}
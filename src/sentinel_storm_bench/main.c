@@ -0,0 +1,697 @@
+/**
+ * \file sentinel_storm_bench/main.c
+ *
+ * \brief Main entry point for the sentinel registration storm benchmark.
+ *
+ * This benchmark models a cluster-wide restart. Hundreds of ping sentinels
+ * connect to agentd and enable the extended API at the same instant, while a
+ * few clients with warm sessions repeatedly ping every sentinel that has not
+ * yet answered. It reports how long each sentinel took to connect, to
+ * register, and to become routable, and how long it took until every sentinel
+ * was routable.
+ *
+ * Sentinel i uses the key pair storm_sentinel_i.priv / storm_sentinel_i.pub,
+ * and the clients use storm_client.priv, which must be endorsed to ping every
+ * sentinel.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/ping_protocol.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+typedef struct storm_context storm_context;
+
+/**
+ * \brief Per-sentinel benchmark state.
+ *
+ * All times are measured from the start of the storm. The routable fields are
+ * written by the client responsible for this sentinel.
+ */
+typedef struct storm_sentinel storm_sentinel;
+
+struct storm_sentinel
+{
+    pthread_t thread;
+    storm_context* ctx;
+    size_t index;
+    vpr_uuid id;
+    status retval;
+    atomic_bool registered;
+    atomic_bool failed;
+    atomic_bool done;
+    uint64_t connect_ns;
+    uint64_t enable_ns;
+    uint64_t registered_ns;
+    bool routable;
+    uint64_t routable_ns;
+};
+
+/**
+ * \brief Per-client benchmark state.
+ */
+typedef struct storm_client storm_client;
+
+struct storm_client
+{
+    pthread_t thread;
+    storm_context* ctx;
+    size_t index;
+    status retval;
+    uint64_t pings;
+    uint64_t failed_pings;
+};
+
+/**
+ * \brief Shared benchmark state.
+ */
+struct storm_context
+{
+    rcpr_allocator* alloc;
+    file* file;
+    vccrypt_suite_options_t* suite;
+    storm_sentinel* sentinels;
+    size_t sentinel_count;
+    storm_client* clients;
+    size_t client_count;
+    pthread_barrier_t start_barrier;
+    uint64_t start_ns;
+    uint64_t timeout_ns;
+    atomic_bool stop;
+};
+
+/* forward decls. */
+static status load_sentinel_ids(storm_context* ctx);
+static void* sentinel_thread_main(void* context);
+static void* client_thread_main(void* context);
+static bool sentinel_pending(const storm_sentinel* sentinel);
+static status wake_sentinels(storm_context* ctx);
+static void report(const storm_context* ctx);
+
+/**
+ * \brief Main entry point for the sentinel registration storm benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    storm_context ctx;
+
+    memset(&ctx, 0, sizeof(ctx));
+    atomic_init(&ctx.stop, false);
+    ctx.sentinel_count = env_get_size("STORM_SENTINELS", 200);
+    ctx.client_count = env_get_size("STORM_CLIENTS", 4);
+    ctx.timeout_ns =
+        env_get_size("STORM_TIMEOUT_MS", 60000) * UINT64_C(1000000);
+    if (0 == ctx.sentinel_count || 0 == ctx.client_count)
+    {
+        fprintf(stderr, "At least one sentinel and one client are needed.\n");
+        return ERROR_STORM_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    ctx.alloc = alloc;
+    ctx.file = &file;
+    ctx.suite = &suite;
+
+    /* allocate the sentinels. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&ctx.sentinels,
+            ctx.sentinel_count * sizeof(storm_sentinel));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    memset(ctx.sentinels, 0, ctx.sentinel_count * sizeof(storm_sentinel));
+
+    /* allocate the clients. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&ctx.clients,
+            ctx.client_count * sizeof(storm_client));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sentinels;
+    }
+
+    memset(ctx.clients, 0, ctx.client_count * sizeof(storm_client));
+
+    /* read every sentinel's id from its public certificate. */
+    retval = load_sentinel_ids(&ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_clients;
+    }
+
+    pthread_barrier_init(
+        &ctx.start_barrier, NULL,
+        (unsigned int)(ctx.sentinel_count + ctx.client_count + 1));
+
+    /* start the clients; each warms up its session before the storm. */
+    for (size_t i = 0; i < ctx.client_count; ++i)
+    {
+        ctx.clients[i].ctx = &ctx;
+        ctx.clients[i].index = i;
+        pthread_create(
+            &ctx.clients[i].thread, NULL, &client_thread_main,
+            &ctx.clients[i]);
+    }
+
+    /* start the sentinels. */
+    for (size_t i = 0; i < ctx.sentinel_count; ++i)
+    {
+        ctx.sentinels[i].ctx = &ctx;
+        ctx.sentinels[i].index = i;
+        atomic_init(&ctx.sentinels[i].registered, false);
+        atomic_init(&ctx.sentinels[i].failed, false);
+        atomic_init(&ctx.sentinels[i].done, false);
+        pthread_create(
+            &ctx.sentinels[i].thread, NULL, &sentinel_thread_main,
+            &ctx.sentinels[i]);
+    }
+
+    /* release everyone at once. */
+    printf(
+        "Starting storm of %zu sentinels with %zu clients.\n",
+        ctx.sentinel_count, ctx.client_count);
+    ctx.start_ns = latency_clock_now_ns();
+    pthread_barrier_wait(&ctx.start_barrier);
+
+    /* wait for the clients to reach every sentinel or give up. */
+    for (size_t i = 0; i < ctx.client_count; ++i)
+    {
+        pthread_join(ctx.clients[i].thread, NULL);
+        if (STATUS_SUCCESS != ctx.clients[i].retval)
+        {
+            retval = ctx.clients[i].retval;
+        }
+    }
+
+    report(&ctx);
+
+    /* ask the sentinels to stop, then wake each one with a final ping. */
+    atomic_store(&ctx.stop, true);
+    release_retval = wake_sentinels(&ctx);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    for (size_t i = 0; i < ctx.sentinel_count; ++i)
+    {
+        pthread_join(ctx.sentinels[i].thread, NULL);
+    }
+
+    pthread_barrier_destroy(&ctx.start_barrier);
+
+    /* every sentinel must have become routable. */
+    for (size_t i = 0; i < ctx.sentinel_count; ++i)
+    {
+        if (!ctx.sentinels[i].routable && STATUS_SUCCESS == retval)
+        {
+            retval = ERROR_STORM_BENCH_NOT_ROUTABLE;
+        }
+    }
+
+    goto cleanup_clients;
+
+cleanup_clients:
+    release_retval = rcpr_allocator_reclaim(alloc, ctx.clients);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_sentinels:
+    release_retval = rcpr_allocator_reclaim(alloc, ctx.sentinels);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Read the artifact id of every sentinel from its public certificate.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status load_sentinel_ids(storm_context* ctx)
+{
+    status retval, release_retval;
+    vcblockchain_entity_public_cert* cert;
+    const rcpr_uuid* id;
+    char filename[64];
+
+    for (size_t i = 0; i < ctx->sentinel_count; ++i)
+    {
+        snprintf(filename, sizeof(filename), "storm_sentinel_%zu.pub", i);
+
+        retval =
+            entity_public_certificate_create_from_file(
+                &cert, ctx->file, ctx->suite, filename);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = vcblockchain_entity_get_artifact_id(&id, cert);
+        if (STATUS_SUCCESS == retval)
+        {
+            memcpy(&ctx->sentinels[i].id, id, sizeof(ctx->sentinels[i].id));
+        }
+
+        release_retval =
+            resource_release(
+                vcblockchain_entity_public_cert_resource_handle(cert));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (STATUS_SUCCESS != release_retval)
+        {
+            return release_retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Sentinel thread entry point.
+ *
+ * The sentinel connects, enables the extended API, and then answers pings
+ * until the benchmark asks it to stop.
+ *
+ * \param context       The \ref storm_sentinel for this thread.
+ *
+ * \returns NULL.
+ */
+static void* sentinel_thread_main(void* context)
+{
+    storm_sentinel* sentinel = (storm_sentinel*)context;
+    storm_context* ctx = sentinel->ctx;
+    agentd_session session;
+    char filename[64];
+    uint64_t start;
+    status retval;
+
+    snprintf(
+        filename, sizeof(filename), "storm_sentinel_%zu.priv",
+        sentinel->index);
+
+    pthread_barrier_wait(&ctx->start_barrier);
+
+    /* connect to agentd. */
+    retval =
+        agentd_session_init(
+            &session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1", 4931,
+            filename, "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto fail;
+    }
+
+    sentinel->connect_ns = latency_clock_now_ns() - ctx->start_ns;
+
+    /* enable the extended API. */
+    start = latency_clock_now_ns();
+    retval =
+        send_and_verify_enable_extended_api(
+            session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret, 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_session;
+    }
+
+    sentinel->enable_ns = latency_clock_now_ns() - start;
+    sentinel->registered_ns = latency_clock_now_ns() - ctx->start_ns;
+    atomic_store(&sentinel->registered, true);
+
+    /* answer pings until asked to stop. */
+    do
+    {
+        retval =
+            ping_protocol_sentinel_serve_request(
+                session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+                &session.server_iv, &session.shared_secret, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_session;
+        }
+    } while (!atomic_load(&ctx->stop));
+
+    retval =
+        send_and_verify_close_connection(
+            session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+
+cleanup_session:
+    (void)agentd_session_dispose(&session);
+
+fail:
+    sentinel->retval = retval;
+    if (!atomic_load(&sentinel->registered))
+    {
+        atomic_store(&sentinel->failed, true);
+    }
+
+    atomic_store(&sentinel->done, true);
+
+    return NULL;
+}
+
+/**
+ * \brief Client thread entry point.
+ *
+ * Client k is responsible for every sentinel whose index is k modulo the
+ * number of clients. It pings each of its sentinels that has not yet
+ * answered, pass after pass, until all of them have answered, have failed to
+ * register, or the storm times out.
+ *
+ * \param context       The \ref storm_client for this thread.
+ *
+ * \returns NULL.
+ */
+static void* client_thread_main(void* context)
+{
+    storm_client* client = (storm_client*)context;
+    storm_context* ctx = client->ctx;
+    agentd_session session;
+    uint32_t offset_ctr = 1;
+    bool connected, pending, progress;
+    status retval;
+
+    /* warm up the client session before the storm. */
+    retval =
+        agentd_session_init(
+            &session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1", 4931,
+            "storm_client.priv", "agentd.pub");
+    connected = (STATUS_SUCCESS == retval);
+
+    pthread_barrier_wait(&ctx->start_barrier);
+
+    if (!connected)
+    {
+        client->retval = retval;
+        return NULL;
+    }
+
+    do
+    {
+        pending = false;
+        progress = false;
+
+        for (size_t i = client->index; i < ctx->sentinel_count;
+             i += ctx->client_count)
+        {
+            storm_sentinel* sentinel = &ctx->sentinels[i];
+
+            if (!sentinel_pending(sentinel))
+            {
+                continue;
+            }
+
+            ++client->pings;
+            retval =
+                send_and_verify_ping_request(
+                    session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+                    &session.server_iv, &session.shared_secret, offset_ctr++,
+                    &sentinel->id, 1);
+            if (STATUS_SUCCESS == retval)
+            {
+                sentinel->routable_ns = latency_clock_now_ns() - ctx->start_ns;
+                sentinel->routable = true;
+                progress = true;
+                continue;
+            }
+
+            ++client->failed_pings;
+            pending = true;
+
+            /* a transport error means the client session is gone. */
+            if (status_is_transport_error(retval))
+            {
+                client->retval = retval;
+                goto cleanup_session;
+            }
+        }
+
+        /* don't spin while the remaining sentinels are still starting. */
+        if (pending && !progress)
+        {
+            usleep(1000);
+        }
+    } while (pending
+          && latency_clock_now_ns() - ctx->start_ns < ctx->timeout_ns);
+
+    (void)send_and_verify_close_connection(
+        session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+        &session.server_iv, &session.shared_secret);
+
+cleanup_session:
+    (void)agentd_session_dispose(&session);
+
+    return NULL;
+}
+
+/**
+ * \brief Determine whether a sentinel still needs to be pinged.
+ *
+ * \param sentinel      The sentinel to check.
+ *
+ * \returns true if the sentinel has neither answered nor failed to register.
+ */
+static bool sentinel_pending(const storm_sentinel* sentinel)
+{
+    return !sentinel->routable && !atomic_load(&sentinel->failed);
+}
+
+/**
+ * \brief Send one final ping to every registered sentinel so that each one
+ * notices that the benchmark is stopping.
+ *
+ * A failed ping does not stop the wake-up of the remaining sentinels; if it
+ * broke the session, the session is reopened.
+ *
+ * \param ctx           The benchmark context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status wake_sentinels(storm_context* ctx)
+{
+    status retval, release_retval, ping_retval;
+    agentd_session session;
+    uint32_t offset_ctr = 1;
+
+    retval =
+        agentd_session_init(
+            &session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1", 4931,
+            "storm_client.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < ctx->sentinel_count; ++i)
+    {
+        if (!atomic_load(&ctx->sentinels[i].registered)
+         || atomic_load(&ctx->sentinels[i].done))
+        {
+            continue;
+        }
+
+        ping_retval =
+            send_and_verify_ping_request(
+                session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+                &session.server_iv, &session.shared_secret, offset_ctr++,
+                &ctx->sentinels[i].id, 1);
+        if (STATUS_SUCCESS == ping_retval)
+        {
+            continue;
+        }
+
+        retval = ping_retval;
+        if (status_is_transport_error(ping_retval))
+        {
+            (void)agentd_session_dispose(&session);
+            ping_retval =
+                agentd_session_init(
+                    &session, ctx->alloc, ctx->file, ctx->suite, "127.0.0.1",
+                    4931, "storm_client.priv", "agentd.pub");
+            if (STATUS_SUCCESS != ping_retval)
+            {
+                return ping_retval;
+            }
+        }
+    }
+
+    (void)send_and_verify_close_connection(
+        session.sock, ctx->alloc, ctx->suite, &session.client_iv,
+        &session.server_iv, &session.shared_secret);
+
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Report the results of the storm.
+ *
+ * \param ctx           The benchmark context.
+ */
+static void report(const storm_context* ctx)
+{
+    latency_histogram connect, enable, registered, routable;
+    size_t registered_count = 0, routable_count = 0;
+    uint64_t all_routable_ns = 0, pings = 0, failed_pings = 0;
+
+    latency_histogram_init(&connect);
+    latency_histogram_init(&enable);
+    latency_histogram_init(&registered);
+    latency_histogram_init(&routable);
+
+    for (size_t i = 0; i < ctx->sentinel_count; ++i)
+    {
+        const storm_sentinel* sentinel = &ctx->sentinels[i];
+
+        if (atomic_load(&sentinel->registered))
+        {
+            ++registered_count;
+            latency_histogram_record(&connect, sentinel->connect_ns);
+            latency_histogram_record(&enable, sentinel->enable_ns);
+            latency_histogram_record(&registered, sentinel->registered_ns);
+        }
+
+        if (sentinel->routable)
+        {
+            ++routable_count;
+            latency_histogram_record(&routable, sentinel->routable_ns);
+            if (sentinel->routable_ns > all_routable_ns)
+            {
+                all_routable_ns = sentinel->routable_ns;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < ctx->client_count; ++i)
+    {
+        pings += ctx->clients[i].pings;
+        failed_pings += ctx->clients[i].failed_pings;
+    }
+
+    latency_histogram_print(&connect, stdout, "connected after");
+    latency_histogram_print(&enable, stdout, "enable latency");
+    latency_histogram_print(&registered, stdout, "registered after");
+    latency_histogram_print(&routable, stdout, "routable after");
+    printf(
+        "registered %zu of %zu sentinels, %zu routable.\n", registered_count,
+        ctx->sentinel_count, routable_count);
+    printf(
+        "clients sent %" PRIu64 " pings, %" PRIu64 " before the target was"
+        " routable.\n", pings, failed_pings);
+
+    if (routable_count == ctx->sentinel_count)
+    {
+        printf(
+            "all sentinels routable after %.1fms.\n", all_routable_ns / 1e6);
+    }
+    else
+    {
+        printf(
+            "%zu sentinels never became routable.\n",
+            ctx->sentinel_count - routable_count);
+    }
+}
@@ -0,0 +1,516 @@
+/**
+ * \file session_select_bench/main.c
+ *
+ * \brief Main entry point for the session selection benchmark.
+ *
+ * This benchmark compares round robin and least loaded (power of two choices)
+ * session selection in a session pool. A few heavy threads repeatedly read a
+ * large block, which slows down whichever sessions carry those reads, while
+ * light threads issue small id lookups. The latency of the light reads under
+ * each policy shows how well the policy routes around slowed sessions.
+ *
+ * By default, the first failed read aborts the run. If LOAD_KEEP_GOING is set
+ * to 1, failed reads are counted by helper error code and agentd status, and
+ * the run continues.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/session_pool.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+#define BENCH_MAX_TXNS 1024
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    session_pool* pool;
+    size_t iterations;
+    bool keep_going;
+    size_t txn_count;
+    vpr_uuid txn_ids[BENCH_MAX_TXNS];
+    vpr_uuid large_block_id;
+    atomic_bool stop;
+};
+
+/**
+ * \brief Per-thread benchmark state.
+ */
+typedef struct bench_thread bench_thread;
+
+struct bench_thread
+{
+    pthread_t thread;
+    bench_context* ctx;
+    size_t index;
+    status retval;
+    load_stats stats;
+};
+
+/* forward decls. */
+static status run_phase(
+    bench_context* ctx, bench_thread* light, size_t light_count,
+    bench_thread* heavy, size_t heavy_count, const char* label,
+    load_stats* light_merged, load_stats* heavy_merged);
+static status bench_record(
+    bench_thread* th, status retval, uint64_t start, read_result* result);
+static void* light_thread_main(void* context);
+static void* heavy_thread_main(void* context);
+
+/**
+ * \brief Main entry point for the session selection benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    agentd_session setup;
+    bench_context ctx;
+    bench_thread* light = NULL;
+    bench_thread* heavy = NULL;
+    load_stats rr_light, rr_heavy, p2c_light, p2c_heavy;
+    size_t session_count = env_get_size("SELECT_BENCH_SESSIONS", 8);
+    size_t light_count = env_get_size("SELECT_BENCH_LIGHT_THREADS", 8);
+    size_t heavy_count = env_get_size("SELECT_BENCH_HEAVY_THREADS", 2);
+
+    memset(&ctx, 0, sizeof(ctx));
+    atomic_init(&ctx.stop, false);
+    ctx.iterations = env_get_size("SELECT_BENCH_ITERATIONS", 2000);
+    ctx.keep_going = 0 != env_get_size("LOAD_KEEP_GOING", 0);
+    ctx.txn_count = env_get_size("SELECT_BENCH_TXNS", 500);
+    if (0 == ctx.txn_count || ctx.txn_count > BENCH_MAX_TXNS)
+    {
+        ctx.txn_count = 500;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    /* submit a burst of transactions so that they land in a large block. */
+    printf("Submitting %zu transactions.\n", ctx.txn_count);
+    retval =
+        chain_seed_transactions(
+            &setup, alloc, &suite, &builder_opts, ctx.txn_count, ctx.txn_ids,
+            NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* the block holding the last transaction is the large block. */
+    retval =
+        chain_wait_for_transaction(
+            &setup, alloc, &suite, &ctx.txn_ids[ctx.txn_count - 1], 100,
+            30000, &ctx.large_block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* create the session pool. */
+    retval =
+        session_pool_create(
+            &ctx.pool, alloc, &file, &suite, session_count, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* allocate the light threads. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&light, light_count * sizeof(bench_thread));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* allocate the heavy threads, allowing for a run with none. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&heavy, (heavy_count + 1) * sizeof(bench_thread));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_light;
+    }
+
+    /* run the round robin phase. */
+    session_pool_set_selection_policy(
+        ctx.pool, SESSION_POOL_SELECT_ROUND_ROBIN);
+    retval =
+        run_phase(
+            &ctx, light, light_count, heavy, heavy_count, "round robin",
+            &rr_light, &rr_heavy);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_heavy;
+    }
+
+    /* run the least loaded phase. */
+    session_pool_set_selection_policy(
+        ctx.pool, SESSION_POOL_SELECT_LEAST_LOADED);
+    retval =
+        run_phase(
+            &ctx, light, light_count, heavy, heavy_count, "least loaded",
+            &p2c_light, &p2c_heavy);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_heavy;
+    }
+
+    /* summarize. */
+    printf(
+        "light p99 round robin=%.1fus least loaded=%.1fus\n",
+        latency_histogram_percentile(&rr_light.success_latency, 99.0)
+            / 1000.0,
+        latency_histogram_percentile(&p2c_light.success_latency, 99.0)
+            / 1000.0);
+    printf(
+        "light p99.9 round robin=%.1fus least loaded=%.1fus\n",
+        latency_histogram_percentile(&rr_light.success_latency, 99.9)
+            / 1000.0,
+        latency_histogram_percentile(&p2c_light.success_latency, 99.9)
+            / 1000.0);
+    printf(
+        "large block reads round robin=%" PRIu64 " least loaded=%" PRIu64
+        "\n", rr_heavy.success_latency.total,
+        p2c_heavy.success_latency.total);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_heavy;
+
+cleanup_heavy:
+    release_retval = rcpr_allocator_reclaim(alloc, heavy);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_light:
+    release_retval = rcpr_allocator_reclaim(alloc, light);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_pool:
+    release_retval = session_pool_release(ctx.pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Run one phase of the benchmark.
+ *
+ * The heavy threads run until every light thread has finished its iterations.
+ *
+ * \param ctx           The benchmark context.
+ * \param light         The light thread array to use for this phase.
+ * \param light_count   The number of light threads to run.
+ * \param heavy         The heavy thread array to use for this phase.
+ * \param heavy_count   The number of heavy threads to run.
+ * \param label         The label for this phase.
+ * \param light_merged  Load stats to receive the merged light results.
+ * \param heavy_merged  Load stats to receive the merged heavy results.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_phase(
+    bench_context* ctx, bench_thread* light, size_t light_count,
+    bench_thread* heavy, size_t heavy_count, const char* label,
+    load_stats* light_merged, load_stats* heavy_merged)
+{
+    status retval = STATUS_SUCCESS;
+    char heavy_label[64];
+    uint64_t start;
+    double elapsed_s;
+
+    session_pool_reset_stats(ctx->pool);
+    load_stats_init(light_merged);
+    load_stats_init(heavy_merged);
+    start = latency_clock_now_ns();
+    atomic_store(&ctx->stop, false);
+
+    /* start the heavy threads. */
+    for (size_t i = 0; i < heavy_count; ++i)
+    {
+        heavy[i].ctx = ctx;
+        heavy[i].index = i;
+        heavy[i].retval = STATUS_SUCCESS;
+        load_stats_init(&heavy[i].stats);
+        pthread_create(&heavy[i].thread, NULL, &heavy_thread_main, &heavy[i]);
+    }
+
+    /* start the light threads. */
+    for (size_t i = 0; i < light_count; ++i)
+    {
+        light[i].ctx = ctx;
+        light[i].index = i;
+        light[i].retval = STATUS_SUCCESS;
+        load_stats_init(&light[i].stats);
+        pthread_create(&light[i].thread, NULL, &light_thread_main, &light[i]);
+    }
+
+    /* join the light threads and merge their results. */
+    for (size_t i = 0; i < light_count; ++i)
+    {
+        pthread_join(light[i].thread, NULL);
+        load_stats_merge(light_merged, &light[i].stats);
+        if (STATUS_SUCCESS != light[i].retval)
+        {
+            retval = light[i].retval;
+        }
+    }
+
+    /* stop and join the heavy threads. */
+    atomic_store(&ctx->stop, true);
+    for (size_t i = 0; i < heavy_count; ++i)
+    {
+        pthread_join(heavy[i].thread, NULL);
+        load_stats_merge(heavy_merged, &heavy[i].stats);
+        if (STATUS_SUCCESS != heavy[i].retval)
+        {
+            retval = heavy[i].retval;
+        }
+    }
+
+    elapsed_s = (latency_clock_now_ns() - start) / 1e9;
+    snprintf(heavy_label, sizeof(heavy_label), "%s (large)", label);
+    load_stats_print(light_merged, stdout, label, elapsed_s);
+    load_stats_print(heavy_merged, stdout, heavy_label, elapsed_s);
+
+    return retval;
+}
+
+/**
+ * \brief Record the outcome of a read.
+ *
+ * \param th            The calling thread.
+ * \param retval        The status returned by the read.
+ * \param start         The time at which the read was issued.
+ * \param result        The result of the read, disposed on success.
+ *
+ * \returns STATUS_SUCCESS if the thread should continue, or the failure that
+ * stops it.
+ */
+static status bench_record(
+    bench_thread* th, status retval, uint64_t start, read_result* result)
+{
+    load_stats_record(&th->stats, retval, latency_clock_now_ns() - start);
+    if (STATUS_SUCCESS == retval)
+    {
+        read_result_dispose(result);
+        return STATUS_SUCCESS;
+    }
+
+    if (th->ctx->keep_going)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    th->retval = retval;
+    return retval;
+}
+
+/**
+ * \brief Light thread entry point.
+ *
+ * Light threads alternate between latest block id lookups and transaction
+ * block id lookups, both of which return a single id.
+ *
+ * \param context       The \ref bench_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* light_thread_main(void* context)
+{
+    bench_thread* th = (bench_thread*)context;
+    read_request req;
+    read_result result;
+    uint64_t start;
+    status retval;
+
+    for (size_t i = 0; i < th->ctx->iterations; ++i)
+    {
+        memset(&req, 0, sizeof(req));
+        if ((th->index + i) % 2)
+        {
+            req.type = READ_REQUEST_LATEST_BLOCK_ID_GET;
+        }
+        else
+        {
+            req.type = READ_REQUEST_TXN_BLOCK_ID_GET;
+            memcpy(
+                &req.id,
+                &th->ctx->txn_ids[(th->index + i) % th->ctx->txn_count],
+                sizeof(req.id));
+        }
+
+        start = latency_clock_now_ns();
+        retval = session_pool_read(th->ctx->pool, &req, &result);
+        if (STATUS_SUCCESS != bench_record(th, retval, start, &result))
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Heavy thread entry point.
+ *
+ * Heavy threads repeatedly read the large block until told to stop.
+ *
+ * \param context       The \ref bench_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* heavy_thread_main(void* context)
+{
+    bench_thread* th = (bench_thread*)context;
+    read_request req;
+    read_result result;
+    uint64_t start;
+    status retval;
+
+    memset(&req, 0, sizeof(req));
+    req.type = READ_REQUEST_BLOCK_GET;
+    memcpy(&req.id, &th->ctx->large_block_id, sizeof(req.id));
+
+    while (!atomic_load(&th->ctx->stop))
+    {
+        start = latency_clock_now_ns();
+        retval = session_pool_read(th->ctx->pool, &req, &result);
+        if (STATUS_SUCCESS != bench_record(th, retval, start, &result))
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,993 @@
+/**
+ * \file session_transport_bench/main.c
+ *
+ * \brief Main entry point for the session transport benchmark.
+ *
+ * This benchmark opens TRANSPORT_SESSIONS sessions with agentd and drives all
+ * of them from a single thread, as a load generator does. Each round sends a
+ * latest block id request on every session, then collects every response.
+ * The same TRANSPORT_ROUNDS rounds are run with each transport:
+ *
+ *  - blocking, which sends and receives through each session's psock, one
+ *    session after another;
+ *  - epoll, which writes every request, then reads responses from whichever
+ *    sockets epoll reports as readable;
+ *  - uring, which queues every send and receive on one io_uring submission
+ *    queue and submits them together.
+ *
+ * TRANSPORT_MODES selects a comma separated subset. For each, it reports
+ * requests per second, round time percentiles, system calls per request, and
+ * CPU time per request. System calls are the reads and writes counted by
+ * /proc/self/io, plus the epoll_wait or io_uring_enter calls made by the
+ * benchmark. The CPU time per request is what bounds how much traffic one
+ * load box can generate.
+ *
+ * If io_uring is unavailable on this host, the uring mode is reported as
+ * such and skipped.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <helpers/agentd_session.h>
+#include <helpers/agentd_status.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/session_frame.h>
+#include <helpers/status_codes.h>
+#include <helpers/uring_transport.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <vcblockchain/protocol.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The size of the receive buffer of each session in epoll mode.
+ */
+#define BENCH_RX_CAPACITY 16384
+
+/**
+ * \brief The number of events fetched by one epoll_wait call.
+ */
+#define BENCH_MAX_EVENTS 256
+
+/**
+ * \brief The transports under test.
+ */
+typedef enum bench_mode
+{
+    BENCH_MODE_BLOCKING,
+    BENCH_MODE_EPOLL,
+    BENCH_MODE_URING,
+    BENCH_MODE_COUNT,
+} bench_mode;
+
+static const char* mode_names[BENCH_MODE_COUNT] = {
+    "blocking", "epoll", "uring" };
+
+/**
+ * \brief One open session and its raw descriptor.
+ */
+typedef struct bench_session bench_session;
+
+struct bench_session
+{
+    agentd_session session;
+    int descriptor;
+    uint8_t* rx;
+    size_t rx_size;
+};
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    bench_session* sessions;
+    size_t session_count;
+    size_t rounds;
+};
+
+/**
+ * \brief The results of one transport.
+ *
+ * waits counts the epoll_wait or io_uring_enter calls, which /proc/self/io
+ * doesn't see.
+ */
+typedef struct bench_result bench_result;
+
+struct bench_result
+{
+    uint64_t elapsed_ns;
+    uint64_t cpu_ns;
+    uint64_t io_syscalls;
+    uint64_t waits;
+    bool io_syscalls_valid;
+    latency_histogram rounds;
+};
+
+/* forward decls. */
+static bool mode_selected(const char* modes, const char* name);
+static status open_sessions(
+    bench_context* ctx, file* file, const char* hostaddr,
+    unsigned int hostport);
+static void close_sessions(bench_context* ctx);
+static status run_mode(
+    bench_context* ctx, bench_mode mode, bench_result* result);
+static status run_blocking_round(bench_context* ctx, uint64_t* waits);
+static status run_epoll_round(
+    bench_context* ctx, int epfd, uint64_t* waits);
+static status run_uring_round(
+    bench_context* ctx, uring_transport* transport);
+static status encode_latest_block_id(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, vccrypt_buffer_t* shared_secret, void* context);
+static status verify_response(
+    vccrypt_buffer_t* response, uint32_t expected_offset);
+static status set_nonblocking(bench_context* ctx, bool nonblocking);
+static bool read_io_syscalls(uint64_t* count);
+static uint64_t cpu_time_ns(void);
+static void print_result(
+    const char* name, const bench_result* result, const bench_result* base,
+    size_t requests);
+
+/**
+ * \brief Main entry point for the session transport benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    bench_context ctx;
+    bench_result result, base;
+    bool have_base = false;
+    const char* modes =
+        env_get_string("TRANSPORT_MODES", "blocking,epoll,uring");
+    const char* hostaddr = env_get_string("TRANSPORT_HOST", "127.0.0.1");
+    unsigned int hostport =
+        (unsigned int)env_get_size("TRANSPORT_PORT", 4931);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.session_count = env_get_size("TRANSPORT_SESSIONS", 256);
+    ctx.rounds = env_get_size("TRANSPORT_ROUNDS", 50);
+    if (0 == ctx.session_count || 0 == ctx.rounds || hostport > 65535)
+    {
+        fprintf(stderr, "Bad session transport benchmark configuration.\n");
+        return ERROR_SESSION_TRANSPORT_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    ctx.alloc = alloc;
+    ctx.suite = &suite;
+
+    /* sessions opened before a failure are closed on the way out. */
+    retval = open_sessions(&ctx, &file, hostaddr, hostport);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sessions;
+    }
+
+    printf(
+        "%zu sessions, %zu rounds of one request per session\n",
+        ctx.session_count, ctx.rounds);
+    printf(
+        "%-10s %10s %10s %10s %12s %12s %9s\n", "mode", "req/s",
+        "round p50", "round p99", "syscalls/req", "cpu us/req", "speedup");
+
+    for (int mode = 0; mode < BENCH_MODE_COUNT; ++mode)
+    {
+        if (!mode_selected(modes, mode_names[mode]))
+        {
+            continue;
+        }
+
+        retval = run_mode(&ctx, (bench_mode)mode, &result);
+        if (ERROR_URING_TRANSPORT_SETUP == retval)
+        {
+            printf("%-10s %10s\n", mode_names[mode], "unavailable");
+            continue;
+        }
+        else if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_sessions;
+        }
+
+        if (!have_base)
+        {
+            base = result;
+            have_base = true;
+        }
+
+        print_result(
+            mode_names[mode], &result, &base,
+            ctx.session_count * ctx.rounds);
+    }
+
+    retval = STATUS_SUCCESS;
+
+cleanup_sessions:
+    close_sessions(&ctx);
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Check whether a mode appears in a comma separated list.
+ *
+ * \param modes         The list.
+ * \param name          The mode name.
+ *
+ * \returns true if the mode is listed.
+ */
+static bool mode_selected(const char* modes, const char* name)
+{
+    size_t len = strlen(name);
+
+    for (const char* p = modes; NULL != p; p = strchr(p, ','))
+    {
+        if (',' == *p)
+        {
+            ++p;
+        }
+
+        if (0 == strncmp(p, name, len) && (',' == p[len] || 0 == p[len]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Open and authenticate every session.
+ *
+ * \param ctx           The benchmark context.
+ * \param file          The OS file abstraction to use.
+ * \param hostaddr      The agentd address.
+ * \param hostport      The agentd port.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status open_sessions(
+    bench_context* ctx, file* file, const char* hostaddr,
+    unsigned int hostport)
+{
+    status retval;
+    size_t count = ctx->session_count;
+    bench_session* s;
+    int descriptor;
+
+    ctx->sessions = calloc(count, sizeof(bench_session));
+    if (NULL == ctx->sessions)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return ERROR_SESSION_TRANSPORT_BENCH_OUT_OF_MEMORY;
+    }
+
+    for (ctx->session_count = 0; ctx->session_count < count;
+         ++ctx->session_count)
+    {
+        s = &ctx->sessions[ctx->session_count];
+
+        s->rx = malloc(BENCH_RX_CAPACITY);
+        if (NULL == s->rx)
+        {
+            fprintf(stderr, "Out of memory.\n");
+            return ERROR_SESSION_TRANSPORT_BENCH_OUT_OF_MEMORY;
+        }
+
+        retval = agentd_socket_connect(&descriptor, hostaddr, hostport);
+        if (STATUS_SUCCESS != retval)
+        {
+            free(s->rx);
+            return retval;
+        }
+
+        retval =
+            agentd_session_init_from_descriptor(
+                &s->session, ctx->alloc, file, ctx->suite, descriptor,
+                "test.priv", "agentd.pub");
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(
+                stderr, "Error opening session %zu.\n", ctx->session_count);
+            free(s->rx);
+            return retval;
+        }
+
+        s->descriptor = descriptor;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Close every open session.
+ *
+ * \param ctx           The benchmark context.
+ */
+static void close_sessions(bench_context* ctx)
+{
+    bench_session* s;
+
+    for (size_t i = 0; i < ctx->session_count; ++i)
+    {
+        s = &ctx->sessions[i];
+        send_and_verify_close_connection(
+            s->session.sock, ctx->alloc, ctx->suite, &s->session.client_iv,
+            &s->session.server_iv, &s->session.shared_secret);
+        agentd_session_dispose(&s->session);
+        free(s->rx);
+    }
+
+    free(ctx->sessions);
+    ctx->sessions = NULL;
+    ctx->session_count = 0;
+}
+
+/**
+ * \brief Run every round with one transport.
+ *
+ * One round is run first, untimed, to warm up both sides.
+ *
+ * \param ctx           The benchmark context.
+ * \param mode          The transport.
+ * \param result        The result to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_URING_TRANSPORT_SETUP if io_uring is unavailable.
+ *      - a non-zero error code on failure.
+ */
+static status run_mode(
+    bench_context* ctx, bench_mode mode, bench_result* result)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    int epfd = -1;
+    uring_transport* transport = NULL;
+    uring_transport_stats stats;
+    struct epoll_event ev;
+    uint64_t waits = 0, io_before = 0, io_after = 0, cpu_before = 0;
+    uint64_t start = 0, round_start;
+    size_t index;
+
+    memset(result, 0, sizeof(*result));
+    latency_histogram_init(&result->rounds);
+
+    if (BENCH_MODE_EPOLL == mode)
+    {
+        epfd = epoll_create1(EPOLL_CLOEXEC);
+        if (epfd < 0)
+        {
+            fprintf(stderr, "Error creating epoll instance.\n");
+            return ERROR_SESSION_TRANSPORT_BENCH_IO;
+        }
+
+        for (size_t i = 0; i < ctx->session_count; ++i)
+        {
+            ev.events = EPOLLIN;
+            ev.data.u64 = i;
+            if (0 !=
+                    epoll_ctl(
+                        epfd, EPOLL_CTL_ADD, ctx->sessions[i].descriptor,
+                        &ev))
+            {
+                fprintf(stderr, "Error adding session to epoll.\n");
+                retval = ERROR_SESSION_TRANSPORT_BENCH_IO;
+                goto cleanup_epoll;
+            }
+        }
+
+        retval = set_nonblocking(ctx, true);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_epoll;
+        }
+    }
+    else if (BENCH_MODE_URING == mode)
+    {
+        retval =
+            uring_transport_create(
+                &transport, ctx->alloc, ctx->suite, ctx->session_count);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        for (size_t i = 0; i < ctx->session_count; ++i)
+        {
+            retval =
+                uring_transport_add_session(
+                    transport, &ctx->sessions[i].session,
+                    ctx->sessions[i].descriptor, &index);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_transport;
+            }
+        }
+    }
+
+    for (size_t round = 0; round <= ctx->rounds; ++round)
+    {
+        if (1 == round)
+        {
+            result->io_syscalls_valid = read_io_syscalls(&io_before);
+            cpu_before = cpu_time_ns();
+            waits = 0;
+            if (NULL != transport)
+            {
+                uring_transport_get_stats(transport, &stats);
+                waits = stats.enters;
+            }
+            start = latency_clock_now_ns();
+        }
+
+        round_start = latency_clock_now_ns();
+        switch (mode)
+        {
+            case BENCH_MODE_BLOCKING:
+                retval = run_blocking_round(ctx, &waits);
+                break;
+
+            case BENCH_MODE_EPOLL:
+                retval = run_epoll_round(ctx, epfd, &waits);
+                break;
+
+            default:
+                retval = run_uring_round(ctx, transport);
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_mode;
+        }
+
+        if (round > 0)
+        {
+            latency_histogram_record(
+                &result->rounds, latency_clock_now_ns() - round_start);
+        }
+    }
+
+    result->elapsed_ns = latency_clock_now_ns() - start;
+    result->cpu_ns = cpu_time_ns() - cpu_before;
+    if (NULL != transport)
+    {
+        uring_transport_get_stats(transport, &stats);
+        waits = stats.enters - waits;
+    }
+    result->waits = waits;
+    if (result->io_syscalls_valid && read_io_syscalls(&io_after))
+    {
+        result->io_syscalls = io_after - io_before;
+    }
+    else
+    {
+        result->io_syscalls_valid = false;
+    }
+
+cleanup_mode:
+    if (BENCH_MODE_EPOLL == mode)
+    {
+        release_retval = set_nonblocking(ctx, false);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+cleanup_transport:
+    if (NULL != transport)
+    {
+        release_retval = uring_transport_release(transport);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+cleanup_epoll:
+    if (epfd >= 0)
+    {
+        close(epfd);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Run one round through each session's psock.
+ *
+ * \param ctx           The benchmark context.
+ * \param waits         Unused; blocking reads wait inside read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_blocking_round(bench_context* ctx, uint64_t* waits)
+{
+    status retval;
+    vccrypt_buffer_t response;
+    bench_session* s;
+
+    (void)waits;
+
+    for (size_t i = 0; i < ctx->session_count; ++i)
+    {
+        s = &ctx->sessions[i];
+        retval =
+            vcblockchain_protocol_sendreq_latest_block_id_get(
+                s->session.sock, ctx->suite, &s->session.client_iv,
+                &s->session.shared_secret, (uint32_t)i);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error sending request on session %zu.\n", i);
+            return ERROR_SEND_LATEST_BLOCK_ID_REQ;
+        }
+    }
+
+    for (size_t i = 0; i < ctx->session_count; ++i)
+    {
+        s = &ctx->sessions[i];
+        retval =
+            vcblockchain_protocol_recvresp(
+                s->session.sock, ctx->alloc, ctx->suite,
+                &s->session.server_iv, &s->session.shared_secret, &response);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error receiving response on session %zu.\n", i);
+            return ERROR_RECV_LATEST_BLOCK_ID_RESP;
+        }
+
+        retval = verify_response(&response, (uint32_t)i);
+        dispose((disposable_t*)&response);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Run one round with non-blocking sockets and epoll.
+ *
+ * \param ctx           The benchmark context.
+ * \param epfd          The epoll instance watching every session.
+ * \param waits         Incremented for each epoll_wait call.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_epoll_round(
+    bench_context* ctx, int epfd, uint64_t* waits)
+{
+    status retval;
+    struct epoll_event events[BENCH_MAX_EVENTS];
+    vccrypt_buffer_t response;
+    bench_session* s;
+    void* frame;
+    size_t frame_size, outstanding = ctx->session_count;
+    uint32_t offset;
+    ssize_t bytes;
+    int ready;
+
+    for (size_t i = 0; i < ctx->session_count; ++i)
+    {
+        s = &ctx->sessions[i];
+        offset = (uint32_t)i;
+        retval =
+            session_frame_encode(
+                &s->session, ctx->alloc, ctx->suite, &encode_latest_block_id,
+                &offset, &frame, &frame_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* a request is far smaller than an idle socket's send buffer. */
+        bytes = write(s->descriptor, frame, frame_size);
+        rcpr_allocator_reclaim(ctx->alloc, frame);
+        if (bytes != (ssize_t)frame_size)
+        {
+            fprintf(stderr, "Error writing request on session %zu.\n", i);
+            return ERROR_SESSION_TRANSPORT_BENCH_IO;
+        }
+    }
+
+    while (outstanding > 0)
+    {
+        ++*waits;
+        ready = epoll_wait(epfd, events, BENCH_MAX_EVENTS, -1);
+        if (ready < 0 && EINTR != errno)
+        {
+            fprintf(stderr, "Error waiting for responses.\n");
+            return ERROR_SESSION_TRANSPORT_BENCH_IO;
+        }
+
+        for (int e = 0; e < ready; ++e)
+        {
+            s = &ctx->sessions[events[e].data.u64];
+            bytes =
+                read(
+                    s->descriptor, s->rx + s->rx_size,
+                    BENCH_RX_CAPACITY - s->rx_size);
+            if (bytes < 0 && (EAGAIN == errno || EINTR == errno))
+            {
+                continue;
+            }
+            else if (bytes <= 0)
+            {
+                fprintf(
+                    stderr, "Error reading response on session %" PRIu64
+                    ".\n", events[e].data.u64);
+                return ERROR_SESSION_TRANSPORT_BENCH_IO;
+            }
+
+            s->rx_size += (size_t)bytes;
+            retval =
+                session_frame_decode(
+                    &s->session, ctx->alloc, ctx->suite, s->rx, s->rx_size,
+                    &response);
+            if (ERROR_SESSION_FRAME_INCOMPLETE == retval
+             && s->rx_size < BENCH_RX_CAPACITY)
+            {
+                continue;
+            }
+            else if (STATUS_SUCCESS != retval)
+            {
+                fprintf(
+                    stderr, "Error decoding response on session %" PRIu64
+                    ".\n", events[e].data.u64);
+                return ERROR_SESSION_TRANSPORT_BENCH_RESPONSE;
+            }
+
+            s->rx_size = 0;
+            retval =
+                verify_response(&response, (uint32_t)events[e].data.u64);
+            dispose((disposable_t*)&response);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            --outstanding;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Run one round through the io_uring transport.
+ *
+ * \param ctx           The benchmark context.
+ * \param transport     The transport, with every session added in order.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_uring_round(
+    bench_context* ctx, uring_transport* transport)
+{
+    status retval;
+    uring_transport_completion completions[BENCH_MAX_EVENTS];
+    size_t count, outstanding = ctx->session_count;
+    uint32_t offset;
+
+    for (size_t i = 0; i < ctx->session_count; ++i)
+    {
+        offset = (uint32_t)i;
+        retval =
+            uring_transport_send(
+                transport, i, &encode_latest_block_id, &offset);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error queuing request on session %zu.\n", i);
+            return retval;
+        }
+    }
+
+    while (outstanding > 0)
+    {
+        retval =
+            uring_transport_wait(
+                transport, completions, BENCH_MAX_EVENTS, &count);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error waiting for responses.\n");
+            return retval;
+        }
+
+        /* check every completion, so that none leaks its response. */
+        for (size_t c = 0; c < count; ++c)
+        {
+            if (STATUS_SUCCESS != completions[c].retval)
+            {
+                fprintf(
+                    stderr, "Session %zu failed (%x).\n",
+                    completions[c].session, completions[c].retval);
+                retval = completions[c].retval;
+                continue;
+            }
+
+            if (STATUS_SUCCESS == retval)
+            {
+                retval =
+                    verify_response(
+                        &completions[c].response,
+                        (uint32_t)completions[c].session);
+            }
+            dispose((disposable_t*)&completions[c].response);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        outstanding -= count;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write a latest block id request.
+ *
+ * \param sock          The socket to write to.
+ * \param suite         The crypto suite to use.
+ * \param client_iv     The client IV.
+ * \param shared_secret The shared secret.
+ * \param context       Pointer to the uint32_t request offset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status encode_latest_block_id(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    uint64_t* client_iv, vccrypt_buffer_t* shared_secret, void* context)
+{
+    return
+        vcblockchain_protocol_sendreq_latest_block_id_get(
+            sock, suite, client_iv, shared_secret, *(uint32_t*)context);
+}
+
+/**
+ * \brief Verify the header of a latest block id response.
+ *
+ * \param response          The decrypted response.
+ * \param expected_offset   The offset the request was sent with.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_SESSION_TRANSPORT_BENCH_RESPONSE if the response doesn't
+ *        match.
+ */
+static status verify_response(
+    vccrypt_buffer_t* response, uint32_t expected_offset)
+{
+    uint32_t request_id, offset, status;
+
+    if (STATUS_SUCCESS !=
+            vcblockchain_protocol_response_decode_header(
+                &request_id, &offset, &status, response)
+     || PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET != request_id
+     || expected_offset != offset)
+    {
+        fprintf(
+            stderr, "Unexpected response for offset %u.\n", expected_offset);
+        return ERROR_SESSION_TRANSPORT_BENCH_RESPONSE;
+    }
+
+    if (STATUS_SUCCESS != status)
+    {
+        agentd_status_record(status);
+        fprintf(stderr, "fail status from agentd. (%x)\n", status);
+        return ERROR_SESSION_TRANSPORT_BENCH_RESPONSE;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Switch every session descriptor between blocking and non-blocking.
+ *
+ * \param ctx           The benchmark context.
+ * \param nonblocking   Whether to make the descriptors non-blocking.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_SESSION_TRANSPORT_BENCH_IO on failure.
+ */
+static status set_nonblocking(bench_context* ctx, bool nonblocking)
+{
+    int flags;
+
+    for (size_t i = 0; i < ctx->session_count; ++i)
+    {
+        flags = fcntl(ctx->sessions[i].descriptor, F_GETFL);
+        if (flags < 0)
+        {
+            return ERROR_SESSION_TRANSPORT_BENCH_IO;
+        }
+
+        flags = nonblocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+        if (0 != fcntl(ctx->sessions[i].descriptor, F_SETFL, flags))
+        {
+            return ERROR_SESSION_TRANSPORT_BENCH_IO;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the number of read and write system calls made so far.
+ *
+ * \param count         Pointer to receive the count.
+ *
+ * \returns true if /proc/self/io could be read.
+ */
+static bool read_io_syscalls(uint64_t* count)
+{
+    FILE* f;
+    char line[128];
+    uint64_t value;
+    int found = 0;
+
+    f = fopen("/proc/self/io", "r");
+    if (NULL == f)
+    {
+        return false;
+    }
+
+    *count = 0;
+    while (NULL != fgets(line, sizeof(line), f))
+    {
+        if (1 == sscanf(line, "syscr: %" SCNu64, &value)
+         || 1 == sscanf(line, "syscw: %" SCNu64, &value))
+        {
+            *count += value;
+            ++found;
+        }
+    }
+
+    fclose(f);
+
+    return 2 == found;
+}
+
+/**
+ * \brief Get the user and system CPU time used by this process.
+ *
+ * \returns the CPU time in nanoseconds.
+ */
+static uint64_t cpu_time_ns(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return
+        (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+            * 1000000000
+      + (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000;
+}
+
+/**
+ * \brief Print the results of one transport.
+ *
+ * \param name          The transport name.
+ * \param result        The results of this transport.
+ * \param base          The results of the first transport run.
+ * \param requests      The number of timed requests.
+ */
+static void print_result(
+    const char* name, const bench_result* result, const bench_result* base,
+    size_t requests)
+{
+    char syscalls[32];
+
+    if (result->io_syscalls_valid)
+    {
+        snprintf(
+            syscalls, sizeof(syscalls), "%.2f",
+            (double)(result->io_syscalls + result->waits) / requests);
+    }
+    else
+    {
+        snprintf(
+            syscalls, sizeof(syscalls), "%.2f+",
+            (double)result->waits / requests);
+    }
+
+    printf(
+        "%-10s %10.0f %8.2fms %8.2fms %12s %12.2f %8.2fx\n", name,
+        requests / (result->elapsed_ns / 1e9),
+        latency_histogram_percentile(&result->rounds, 50.0) / 1e6,
+        latency_histogram_percentile(&result->rounds, 99.0) / 1e6,
+        syscalls, result->cpu_ns / 1e3 / requests,
+        (double)base->elapsed_ns / result->elapsed_ns);
+}
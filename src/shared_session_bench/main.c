@@ -0,0 +1,442 @@
+/**
+ * \file shared_session_bench/main.c
+ *
+ * \brief Main entry point for the shared session benchmark.
+ *
+ * Many application threads share a few authenticated sessions. This
+ * benchmark compares two ways of sharing them.
+ *
+ * In the mutex phase, each session is guarded by a mutex, and a thread holds
+ * the mutex for the whole blocking request. Threads waiting on a busy session
+ * form a convoy, so the time spent waiting for the lock is reported
+ * separately.
+ *
+ * In the queue phase, each session is a \ref shared_session: threads push
+ * requests onto its lock-free queue, and its I/O thread executes them and
+ * completes each one.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/agentd_status.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/error_class.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/read_request.h>
+#include <helpers/shared_session.h>
+#include <helpers/status_codes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define BENCH_MAX_SESSIONS 64
+#define BENCH_MAX_THREADS 256
+
+/**
+ * \brief A session guarded by a mutex.
+ */
+typedef struct locked_session locked_session;
+
+struct locked_session
+{
+    pthread_mutex_t lock;
+    agentd_session session;
+    bool failed;
+};
+
+typedef struct bench_context bench_context;
+
+/**
+ * \brief An application thread.
+ */
+typedef struct app_thread app_thread;
+
+struct app_thread
+{
+    pthread_t thread;
+    bench_context* ctx;
+    size_t index;
+    load_stats stats;
+    latency_histogram lock_wait;
+};
+
+/**
+ * \brief Shared benchmark state.
+ */
+struct bench_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    size_t session_count;
+    size_t requests;
+    bool keep_going;
+    locked_session locked[BENCH_MAX_SESSIONS];
+    shared_session* shared[BENCH_MAX_SESSIONS];
+    app_thread threads[BENCH_MAX_THREADS];
+};
+
+/* forward decls. */
+static status run_phase(
+    bench_context* ctx, size_t thread_count, void* (*entry)(void*),
+    const char* label);
+static void* mutex_thread(void* context);
+static void* queue_thread(void* context);
+
+/**
+ * \brief Main entry point for the shared session benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    file file;
+    bench_context* ctx;
+    size_t connected = 0;
+    size_t session_count = env_get_size("SHARED_SESSIONS", 4);
+    size_t thread_count = env_get_size("SHARED_THREADS", 64);
+
+    if (0 == session_count || session_count > BENCH_MAX_SESSIONS
+     || 0 == thread_count || thread_count > BENCH_MAX_THREADS)
+    {
+        fprintf(stderr, "Bad shared session benchmark configuration.\n");
+        return ERROR_SHARED_SESSION_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* the thread table is too large for the stack. */
+    retval = rcpr_allocator_allocate(alloc, (void**)&ctx, sizeof(*ctx));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->alloc = alloc;
+    ctx->suite = &suite;
+    ctx->session_count = session_count;
+    ctx->requests = env_get_size("SHARED_REQUESTS", 2000);
+    ctx->keep_going = 0 != env_get_size("LOAD_KEEP_GOING", 0);
+
+    printf(
+        "%zu threads sharing %zu sessions, %zu requests per thread\n",
+        thread_count, session_count, ctx->requests);
+
+    /* phase 1: a mutex around the blocking helpers. */
+    for (connected = 0; connected < session_count; ++connected)
+    {
+        pthread_mutex_init(&ctx->locked[connected].lock, NULL);
+        retval =
+            agentd_session_init(
+                &ctx->locked[connected].session, alloc, &file, &suite,
+                "127.0.0.1", 4931, "test.priv", "agentd.pub");
+        if (STATUS_SUCCESS != retval)
+        {
+            pthread_mutex_destroy(&ctx->locked[connected].lock);
+            goto cleanup_locked;
+        }
+    }
+
+    retval = run_phase(ctx, thread_count, &mutex_thread, "mutex");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_locked;
+    }
+
+    /* phase 2: a lock-free queue feeding an I/O thread per session. */
+    for (size_t i = 0; i < session_count; ++i)
+    {
+        retval =
+            shared_session_create(
+                &ctx->shared[i], alloc, &file, &suite, "127.0.0.1", 4931,
+                "test.priv", "agentd.pub");
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_shared;
+        }
+    }
+
+    retval = run_phase(ctx, thread_count, &queue_thread, "queue");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_shared;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_shared;
+
+cleanup_shared:
+    for (size_t i = 0; i < session_count; ++i)
+    {
+        if (NULL != ctx->shared[i])
+        {
+            release_retval = shared_session_release(ctx->shared[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+cleanup_locked:
+    for (size_t i = 0; i < connected; ++i)
+    {
+        locked_session* locked = &ctx->locked[i];
+
+        if (!locked->failed)
+        {
+            (void)send_and_verify_close_connection(
+                locked->session.sock, alloc, &suite,
+                &locked->session.client_iv, &locked->session.server_iv,
+                &locked->session.shared_secret);
+        }
+
+        release_retval = agentd_session_dispose(&locked->session);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        pthread_mutex_destroy(&locked->lock);
+    }
+
+    release_retval = rcpr_allocator_reclaim(alloc, ctx);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Run one phase of the benchmark and print its results.
+ *
+ * \param ctx           The benchmark context.
+ * \param thread_count  The number of application threads.
+ * \param entry         The application thread entry point.
+ * \param label         The label for this phase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS if every request succeeded, or if failures are
+ *        tolerated with LOAD_KEEP_GOING.
+ *      - the status of a failed request otherwise.
+ */
+static status run_phase(
+    bench_context* ctx, size_t thread_count, void* (*entry)(void*),
+    const char* label)
+{
+    load_stats stats;
+    latency_histogram lock_wait;
+    uint64_t start;
+    double elapsed_s;
+    char wait_label[64];
+
+    load_stats_init(&stats);
+    latency_histogram_init(&lock_wait);
+
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        ctx->threads[i].ctx = ctx;
+        ctx->threads[i].index = i;
+        load_stats_init(&ctx->threads[i].stats);
+        latency_histogram_init(&ctx->threads[i].lock_wait);
+        pthread_create(&ctx->threads[i].thread, NULL, entry, &ctx->threads[i]);
+    }
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        pthread_join(ctx->threads[i].thread, NULL);
+        load_stats_merge(&stats, &ctx->threads[i].stats);
+        latency_histogram_merge(&lock_wait, &ctx->threads[i].lock_wait);
+    }
+
+    elapsed_s = (latency_clock_now_ns() - start) / 1e9;
+
+    load_stats_print(&stats, stdout, label, elapsed_s);
+    if (lock_wait.total > 0)
+    {
+        snprintf(wait_label, sizeof(wait_label), "%s lock wait", label);
+        latency_histogram_print(&lock_wait, stdout, wait_label);
+    }
+
+    printf(
+        "%s: %.0f requests/s over %.2f s\n", label,
+        stats.success_latency.total / elapsed_s, elapsed_s);
+
+    if (stats.failure_latency.total > 0 && !ctx->keep_going)
+    {
+        return ERROR_SHARED_SESSION_FAILED;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Application thread sharing sessions through a mutex.
+ *
+ * \param context       The \ref app_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* mutex_thread(void* context)
+{
+    app_thread* app = (app_thread*)context;
+    bench_context* ctx = app->ctx;
+    locked_session* locked = &ctx->locked[app->index % ctx->session_count];
+    read_request req;
+    read_result result;
+    uint64_t start;
+    status retval;
+
+    memset(&req, 0, sizeof(req));
+    req.type = READ_REQUEST_LATEST_BLOCK_ID_GET;
+
+    for (size_t i = 0; i < ctx->requests; ++i)
+    {
+        start = latency_clock_now_ns();
+
+        pthread_mutex_lock(&locked->lock);
+        latency_histogram_record(
+            &app->lock_wait, latency_clock_now_ns() - start);
+
+        agentd_status_clear();
+        if (locked->failed)
+        {
+            retval = ERROR_SHARED_SESSION_FAILED;
+        }
+        else
+        {
+            retval =
+                read_request_execute(
+                    &locked->session, ctx->alloc, ctx->suite, &req, &result);
+            if (status_is_transport_error(retval))
+            {
+                locked->failed = true;
+            }
+        }
+        pthread_mutex_unlock(&locked->lock);
+
+        load_stats_record(
+            &app->stats, retval, latency_clock_now_ns() - start);
+
+        if (STATUS_SUCCESS == retval)
+        {
+            read_result_dispose(&result);
+        }
+        else if (!ctx->keep_going)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Application thread sharing sessions through lock-free queues.
+ *
+ * \param context       The \ref app_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* queue_thread(void* context)
+{
+    app_thread* app = (app_thread*)context;
+    bench_context* ctx = app->ctx;
+    shared_session* session = ctx->shared[app->index % ctx->session_count];
+    read_request req;
+    read_result result;
+    uint64_t start;
+    status retval;
+
+    memset(&req, 0, sizeof(req));
+    req.type = READ_REQUEST_LATEST_BLOCK_ID_GET;
+
+    for (size_t i = 0; i < ctx->requests; ++i)
+    {
+        agentd_status_clear();
+        start = latency_clock_now_ns();
+        retval = shared_session_read(session, &req, &result);
+        load_stats_record(
+            &app->stats, retval, latency_clock_now_ns() - start);
+
+        if (STATUS_SUCCESS == retval)
+        {
+            read_result_dispose(&result);
+        }
+        else if (!ctx->keep_going)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
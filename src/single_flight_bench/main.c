@@ -0,0 +1,485 @@
+/**
+ * \file single_flight_bench/main.c
+ *
+ * \brief Main entry point for the single-flight benchmark.
+ *
+ * This benchmark runs a tip-hot read workload against a session pool twice:
+ * once with every thread reading from the pool directly, and once through a
+ * single-flight layer that joins concurrent identical reads. Most reads go
+ * to the latest block and the few transactions nearest the tip, as clients
+ * following the chain do; the rest are spread over older transactions. It
+ * reports the latency distribution of each run, along with the wire requests
+ * sent to agentd and the share of them the single-flight layer saved.
+ *
+ * By default, the first failed read aborts the run. If LOAD_KEEP_GOING is set
+ * to 1, failed reads are counted by helper error code and agentd status, and
+ * the run continues.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/load_stats.h>
+#include <helpers/session_pool.h>
+#include <helpers/single_flight.h>
+#include <helpers/status_codes.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+RCPR_IMPORT_uuid;
+
+#define BENCH_MAX_TXNS 256
+
+/**
+ * \brief The number of transactions nearest the tip that count as hot.
+ */
+#define BENCH_HOT_TXNS 4
+
+/**
+ * \brief Shared benchmark state.
+ *
+ * When sf is set, reads go through it; otherwise they go to the pool.
+ */
+typedef struct bench_context bench_context;
+
+struct bench_context
+{
+    session_pool* pool;
+    single_flight* sf;
+    size_t iterations;
+    size_t hot_percent;
+    bool keep_going;
+    size_t txn_count;
+    vpr_uuid txn_ids[BENCH_MAX_TXNS];
+    vpr_uuid latest_block_id;
+};
+
+/**
+ * \brief Per-thread benchmark state.
+ */
+typedef struct bench_thread bench_thread;
+
+struct bench_thread
+{
+    pthread_t thread;
+    bench_context* ctx;
+    size_t index;
+    status retval;
+    load_stats stats;
+};
+
+/* forward decls. */
+static status run_phase(
+    bench_context* ctx, bench_thread* threads, size_t thread_count,
+    const char* label, load_stats* merged, session_pool_stats* stats);
+static void* bench_thread_main(void* context);
+static void make_request(
+    const bench_context* ctx, size_t index, size_t i, read_request* req);
+
+/**
+ * \brief Main entry point for the single-flight benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    file file;
+    agentd_session setup;
+    bench_context ctx;
+    bench_thread* threads = NULL;
+    load_stats direct, joined;
+    session_pool_stats direct_stats, joined_stats;
+    single_flight_stats sf_stats;
+    size_t session_count = env_get_size("SF_BENCH_SESSIONS", 4);
+    size_t thread_count = env_get_size("SF_BENCH_THREADS", 16);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.iterations = env_get_size("SF_BENCH_ITERATIONS", 2000);
+    ctx.hot_percent = env_get_size("SF_BENCH_HOT_PERCENT", 90);
+    ctx.keep_going = 0 != env_get_size("LOAD_KEEP_GOING", 0);
+    ctx.txn_count = env_get_size("SF_BENCH_TXNS", 16);
+    if (0 == ctx.txn_count || ctx.txn_count > BENCH_MAX_TXNS)
+    {
+        ctx.txn_count = 16;
+    }
+
+    if (0 == thread_count || 0 == session_count || ctx.hot_percent > 100)
+    {
+        fprintf(stderr, "Bad single-flight benchmark configuration.\n");
+        return ERROR_SINGLE_FLIGHT_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* connect a setup session to agentd. */
+    retval =
+        agentd_session_init(
+            &setup, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    /* seed the chain with transactions to read. */
+    printf("Submitting %zu transactions.\n", ctx.txn_count);
+    retval =
+        chain_seed_transactions(
+            &setup, alloc, &suite, &builder_opts, ctx.txn_count, ctx.txn_ids,
+            NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* wait for the last transaction to be canonized. */
+    retval =
+        chain_wait_for_transaction(
+            &setup, alloc, &suite, &ctx.txn_ids[ctx.txn_count - 1], 100,
+            30000, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* get the latest block id. */
+    retval =
+        get_and_verify_last_block_id(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret, &ctx.latest_block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* create the session pool. */
+    retval =
+        session_pool_create(
+            &ctx.pool, alloc, &file, &suite, session_count, "127.0.0.1", 4931,
+            "test.priv", "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_setup;
+    }
+
+    /* allocate the benchmark threads. */
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&threads, thread_count * sizeof(bench_thread));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* run the direct phase. */
+    retval =
+        run_phase(
+            &ctx, threads, thread_count, "direct", &direct, &direct_stats);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_threads;
+    }
+
+    /* run the single-flight phase. */
+    retval =
+        single_flight_create(
+            &ctx.sf, alloc, &single_flight_session_pool_read, ctx.pool);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_threads;
+    }
+
+    retval =
+        run_phase(
+            &ctx, threads, thread_count, "single-flight", &joined,
+            &joined_stats);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sf;
+    }
+
+    /* summarize. */
+    single_flight_get_stats(ctx.sf, &sf_stats);
+    printf(
+        "single-flight joined %" PRIu64 " of %" PRIu64
+        " reads, up to %zu per wire request.\n",
+        sf_stats.joined, sf_stats.requests, sf_stats.peak_waiters);
+    printf(
+        "agentd load: %" PRIu64 " wire requests direct, %" PRIu64
+        " with single-flight (%.1f%% saved).\n",
+        direct_stats.wire_requests, joined_stats.wire_requests,
+        100.0
+            * ((double)direct_stats.wire_requests
+                - (double)joined_stats.wire_requests)
+            / (double)direct_stats.wire_requests);
+    printf(
+        "p50 direct=%.1fus single-flight=%.1fus\n",
+        latency_histogram_percentile(&direct.success_latency, 50.0) / 1000.0,
+        latency_histogram_percentile(&joined.success_latency, 50.0) / 1000.0);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_sf;
+
+cleanup_sf:
+    release_retval = single_flight_release(ctx.sf);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_threads:
+    release_retval = rcpr_allocator_reclaim(alloc, threads);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_pool:
+    release_retval = session_pool_release(ctx.pool);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_setup:
+    release_retval =
+        send_and_verify_close_connection(
+            setup.sock, alloc, &suite, &setup.client_iv, &setup.server_iv,
+            &setup.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&setup);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Run one phase of the benchmark.
+ *
+ * \param ctx           The benchmark context.
+ * \param threads       The thread array to use for this phase.
+ * \param thread_count  The number of threads to run.
+ * \param label         The label for this phase.
+ * \param merged        Load stats to receive the merged results.
+ * \param stats         Structure to receive the pool counters for this phase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_phase(
+    bench_context* ctx, bench_thread* threads, size_t thread_count,
+    const char* label, load_stats* merged, session_pool_stats* stats)
+{
+    status retval = STATUS_SUCCESS;
+    uint64_t start;
+
+    session_pool_reset_stats(ctx->pool);
+    load_stats_init(merged);
+    start = latency_clock_now_ns();
+
+    /* start the threads. */
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads[i].ctx = ctx;
+        threads[i].index = i;
+        threads[i].retval = STATUS_SUCCESS;
+        load_stats_init(&threads[i].stats);
+        pthread_create(&threads[i].thread, NULL, &bench_thread_main,
+            &threads[i]);
+    }
+
+    /* join the threads and merge their results. */
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        pthread_join(threads[i].thread, NULL);
+        load_stats_merge(merged, &threads[i].stats);
+        if (STATUS_SUCCESS != threads[i].retval)
+        {
+            retval = threads[i].retval;
+        }
+    }
+
+    session_pool_get_stats(ctx->pool, stats);
+    load_stats_print(
+        merged, stdout, label, (latency_clock_now_ns() - start) / 1e9);
+    printf(
+        "%-24s requests=%" PRIu64 " wire=%" PRIu64 "\n",
+        label, stats->requests, stats->wire_requests);
+
+    return retval;
+}
+
+/**
+ * \brief Benchmark thread entry point.
+ *
+ * \param context       The \ref bench_thread for this thread.
+ *
+ * \returns NULL.
+ */
+static void* bench_thread_main(void* context)
+{
+    bench_thread* th = (bench_thread*)context;
+    read_request req;
+    read_result result;
+    uint64_t start;
+    status retval;
+
+    for (size_t i = 0; i < th->ctx->iterations; ++i)
+    {
+        make_request(th->ctx, th->index, i, &req);
+
+        start = latency_clock_now_ns();
+        retval =
+            (NULL != th->ctx->sf)
+                ? single_flight_read(th->ctx->sf, &req, &result)
+                : session_pool_read(th->ctx->pool, &req, &result);
+        load_stats_record(&th->stats, retval, latency_clock_now_ns() - start);
+        if (STATUS_SUCCESS != retval)
+        {
+            if (th->ctx->keep_going)
+            {
+                continue;
+            }
+
+            th->retval = retval;
+            break;
+        }
+
+        read_result_dispose(&result);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Build the next request in the tip-hot read mix.
+ *
+ * SF_BENCH_HOT_PERCENT of the requests alternate between the latest block
+ * and the BENCH_HOT_TXNS transactions nearest the tip. Every thread walks
+ * the hot set in the same order, so threads that are in step ask for the
+ * same thing at the same time. The rest are transaction gets spread over the
+ * whole seeded set.
+ *
+ * \param ctx           The benchmark context.
+ * \param index         The index of the calling thread.
+ * \param i             The iteration number.
+ * \param req           The request to populate.
+ */
+static void make_request(
+    const bench_context* ctx, size_t index, size_t i, read_request* req)
+{
+    size_t hot_txns =
+        ctx->txn_count < BENCH_HOT_TXNS ? ctx->txn_count : BENCH_HOT_TXNS;
+    uint64_t draw = (index + 1) * UINT64_C(2654435761) + i * UINT64_C(40503);
+
+    memset(req, 0, sizeof(*req));
+
+    if ((draw >> 7) % 100 >= ctx->hot_percent)
+    {
+        req->type = READ_REQUEST_TXN_GET;
+        memcpy(
+            &req->id, &ctx->txn_ids[(draw >> 17) % ctx->txn_count],
+            sizeof(req->id));
+    }
+    else if (0 == i % 2)
+    {
+        req->type = READ_REQUEST_BLOCK_GET;
+        memcpy(&req->id, &ctx->latest_block_id, sizeof(req->id));
+    }
+    else
+    {
+        req->type = READ_REQUEST_TXN_GET;
+        memcpy(
+            &req->id,
+            &ctx->txn_ids[ctx->txn_count - 1 - (i / 2) % hot_txns],
+            sizeof(req->id));
+    }
+}
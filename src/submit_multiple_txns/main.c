@@ -7,9 +7,13 @@
  */
 
 #include <stdio.h>
+#include <helpers/agentd_session.h>
 #include <helpers/cert_helpers.h>
 #include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
 #include <helpers/status_codes.h>
+#include <helpers/submit_controller.h>
+#include <helpers/submit_window.h>
 #include <vcblockchain/protocol.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
@@ -23,7 +27,25 @@ RCPR_IMPORT_psock;
 RCPR_IMPORT_resource;
 RCPR_IMPORT_uuid;
 
+/**
+ * \brief State for an adaptive submission.
+ */
+typedef struct adaptive_context adaptive_context;
+
+struct adaptive_context
+{
+    submit_window* win;
+    submit_controller ctrl;
+    status status;
+};
+
 /* forward decls */
+static status submit_txns(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, size_t count, const vpr_uuid** txn_ids,
+    const vpr_uuid* artifact_id, const vccrypt_buffer_t** certs);
+static void on_ack(void* context, const submit_window_ack* ack);
+
 static vpr_uuid ff_uuid = { .data = {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } };
@@ -52,10 +74,7 @@ int main(int argc, char* argv[])
     vccert_builder_options_t builder_opts;
     vccert_parser_options_t parser_options;
     file file;
-    psock* sock;
-    vcblockchain_entity_private_cert* client_priv;
-    vccrypt_buffer_t shared_secret;
-    uint64_t client_iv, server_iv;
+    agentd_session session;
     const vccrypt_buffer_t* client_sign_priv;
     const rcpr_uuid* client_id;
     vccrypt_buffer_t cert1_buffer, cert2_buffer, cert3_buffer;
@@ -65,6 +84,9 @@ int main(int argc, char* argv[])
     vpr_uuid prev_txn2_id, next_txn2_id, txn2_artifact_id, txn2_block_id;
     vpr_uuid prev_txn3_id, next_txn3_id, txn3_artifact_id, txn3_block_id;
     vpr_uuid txn1_block_id2, txn2_block_id2, txn3_block_id2;
+    const vpr_uuid* txn_ids[3] = { &txn1_id, &txn2_id, &txn3_id };
+    const vccrypt_buffer_t* certs[3] = {
+        &cert1_buffer, &cert2_buffer, &cert3_buffer };
 
     /* register the velo v1 suite. */
     vccrypt_suite_register_velo_v1();
@@ -120,9 +142,9 @@ int main(int argc, char* argv[])
 
     /* connect to agentd. */
     retval =
-        agentd_connection_init(
-            &sock, alloc, &client_priv, &shared_secret, &client_iv, &server_iv,
-            &file, &suite, "127.0.0.1", 4931, "test.priv", "agentd.pub");
+        agentd_session_init(
+            &session, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_file;
@@ -131,7 +153,7 @@ int main(int argc, char* argv[])
     /* get the client artifact id. */
     retval =
         vcblockchain_entity_get_artifact_id(
-            &client_id, client_priv);
+            &client_id, session.cert);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_connection;
@@ -140,7 +162,7 @@ int main(int argc, char* argv[])
     /* get the client private signing key. */
     retval =
         vcblockchain_entity_private_cert_get_private_signing_key(
-            &client_sign_priv, client_priv);
+            &client_sign_priv, session.cert);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_connection;
@@ -184,31 +206,10 @@ int main(int argc, char* argv[])
         goto cleanup_txn2_cert;
     }
 
-    /* submit and verify cert 1. */
-    retval =
-        submit_and_verify_txn(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
-            &txn1_id, &artifact_id, &cert1_buffer);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_txn3_cert;
-    }
-
-    /* submit and verify cert 2. */
-    retval =
-        submit_and_verify_txn(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
-            &txn2_id, &artifact_id, &cert2_buffer);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_txn3_cert;
-    }
-
-    /* submit and verify cert 3. */
+    /* submit and verify all three certs. */
     retval =
-        submit_and_verify_txn(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
-            &txn3_id, &artifact_id, &cert3_buffer);
+        submit_txns(
+            &session, alloc, &suite, 3, txn_ids, &artifact_id, certs);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_txn3_cert;
@@ -221,7 +222,8 @@ int main(int argc, char* argv[])
     /* get and verify the first transaction by id. */
     retval =
         get_and_verify_txn(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn1_id, &txn1_cert, &prev_txn1_id, &next_txn1_id,
             &txn1_artifact_id, &txn1_block_id);
     if (STATUS_SUCCESS != retval)
@@ -232,7 +234,8 @@ int main(int argc, char* argv[])
     /* get and verify the second transaction by id. */
     retval =
         get_and_verify_txn(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn2_id, &txn2_cert, &prev_txn2_id, &next_txn2_id,
             &txn2_artifact_id, &txn2_block_id);
     if (STATUS_SUCCESS != retval)
@@ -243,7 +246,8 @@ int main(int argc, char* argv[])
     /* get and verify the third transaction by id. */
     retval =
         get_and_verify_txn(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn3_id, &txn3_cert, &prev_txn3_id, &next_txn3_id,
             &txn3_artifact_id, &txn3_block_id);
     if (STATUS_SUCCESS != retval)
@@ -326,7 +330,8 @@ int main(int argc, char* argv[])
     /* get and verify txn1 next id. */
     retval =
         get_and_verify_next_txn_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn1_id, &next_txn1_id);
     if (STATUS_SUCCESS != retval)
     {
@@ -344,7 +349,8 @@ int main(int argc, char* argv[])
     /* get and verify txn2 next id. */
     retval =
         get_and_verify_next_txn_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn2_id, &next_txn2_id);
     if (STATUS_SUCCESS != retval)
     {
@@ -362,7 +368,8 @@ int main(int argc, char* argv[])
     /* get and verify txn3 prev id. */
     retval =
         get_and_verify_prev_txn_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn3_id, &prev_txn3_id);
     if (STATUS_SUCCESS != retval)
     {
@@ -380,7 +387,8 @@ int main(int argc, char* argv[])
     /* get and verify txn2 prev id. */
     retval =
         get_and_verify_prev_txn_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn2_id, &prev_txn2_id);
     if (STATUS_SUCCESS != retval)
     {
@@ -398,7 +406,8 @@ int main(int argc, char* argv[])
     /* get the block id for txn1. */
     retval =
         get_and_verify_txn_block_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn1_id, &txn1_block_id2);
     if (STATUS_SUCCESS != retval)
     {
@@ -408,7 +417,8 @@ int main(int argc, char* argv[])
     /* get the block id for txn2. */
     retval =
         get_and_verify_txn_block_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn2_id, &txn2_block_id2);
     if (STATUS_SUCCESS != retval)
     {
@@ -418,7 +428,8 @@ int main(int argc, char* argv[])
     /* get the block id for txn3. */
     retval =
         get_and_verify_txn_block_id(
-            sock, alloc, &suite, &client_iv, &server_iv, &shared_secret,
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret,
             &txn3_id, &txn3_block_id2);
     if (STATUS_SUCCESS != retval)
     {
@@ -472,17 +483,7 @@ cleanup_txn1_cert:
     dispose((disposable_t*)&cert1_buffer);
 
 cleanup_connection:
-    release_retval =
-        resource_release(
-            vcblockchain_entity_private_cert_resource_handle(client_priv));
-    if (STATUS_SUCCESS != release_retval)
-    {
-        retval = release_retval;
-    }
-
-    dispose((disposable_t*)&shared_secret);
-
-    release_retval = resource_release(psock_resource_handle(sock));
+    release_retval = agentd_session_dispose(&session);
     if (STATUS_SUCCESS != release_retval)
     {
         retval = release_retval;
@@ -512,3 +513,127 @@ cleanup_allocator:
 
     return retval;
 }
+
+/**
+ * \brief Submit transactions in order, and wait for every acknowledgement.
+ *
+ * By default, each transaction is submitted and acknowledged before the
+ * next is sent. If SUBMIT_ADAPTIVE is set to a non-zero value, they are
+ * instead pipelined through a submission window sized by an AIMD controller,
+ * which may grow up to SUBMIT_MAX_WINDOW.
+ *
+ * \param session       The session to submit on.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param count         The number of transactions.
+ * \param txn_ids       The transaction ids.
+ * \param artifact_id   The artifact id shared by the transactions.
+ * \param certs         The transaction certificates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_TXN_SUBMIT_STATUS if agentd rejected a transaction.
+ *      - ERROR_SUBMIT_MULTIPLE_TXNS_CONFIGURATION if SUBMIT_MAX_WINDOW is
+ *        invalid.
+ *      - a non-zero error code on failure.
+ */
+static status submit_txns(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, size_t count, const vpr_uuid** txn_ids,
+    const vpr_uuid* artifact_id, const vccrypt_buffer_t** certs)
+{
+    status retval, release_retval;
+    submit_controller_options opts;
+    adaptive_context ctx;
+
+    if (0 == env_get_size("SUBMIT_ADAPTIVE", 0))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            retval =
+                submit_and_verify_txn(
+                    session->sock, alloc, suite, &session->client_iv,
+                    &session->server_iv, &session->shared_secret, txn_ids[i],
+                    artifact_id, certs[i]);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        return STATUS_SUCCESS;
+    }
+
+    submit_controller_options_init(&opts);
+    opts.max_window = env_get_size("SUBMIT_MAX_WINDOW", opts.max_window);
+    if (0 == opts.max_window)
+    {
+        fprintf(stderr, "Bad SUBMIT_MAX_WINDOW value.\n");
+        return ERROR_SUBMIT_MULTIPLE_TXNS_CONFIGURATION;
+    }
+
+    submit_controller_init(&ctx.ctrl, &opts);
+    ctx.status = STATUS_SUCCESS;
+
+    retval =
+        submit_window_create(
+            &ctx.win, alloc, suite, session, opts.max_window, &on_ack, &ctx);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    submit_window_set_limit(ctx.win, submit_controller_window(&ctx.ctrl));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        retval =
+            submit_window_submit(
+                ctx.win, txn_ids[i], artifact_id, certs[i], NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_window;
+        }
+    }
+
+    retval = submit_window_drain(ctx.win);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_window;
+    }
+
+    /* a rejected transaction fails the test, as it does when serial. */
+    retval = ctx.status;
+
+cleanup_window:
+    release_retval = submit_window_release(ctx.win);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Feed an acknowledgement to the controller, and remember the first
+ * rejection.
+ *
+ * \param context       The adaptive context.
+ * \param ack           The acknowledgement.
+ */
+static void on_ack(void* context, const submit_window_ack* ack)
+{
+    adaptive_context* ctx = (adaptive_context*)context;
+
+    if (STATUS_SUCCESS != ack->status && STATUS_SUCCESS == ctx->status)
+    {
+        fprintf(
+            stderr, "Transaction rejected with status %u.\n",
+            (unsigned int)ack->agentd_status);
+        ctx->status = ack->status;
+    }
+
+    submit_controller_on_ack(&ctx->ctrl, ack);
+    submit_window_set_limit(ctx->win, submit_controller_window(&ctx->ctrl));
+}
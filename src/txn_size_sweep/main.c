@@ -0,0 +1,635 @@
+/**
+ * \file txn_size_sweep/main.c
+ *
+ * \brief Main entry point for the transaction size sweep.
+ *
+ * This benchmark measures how the cost of a transaction grows with its size.
+ * For each payload size in TXN_SIZES, it:
+ *
+ *  - builds TXN_PER_SIZE transaction certificates carrying that payload;
+ *  - submits them through a submission window of TXN_SIZE_WINDOW, and times
+ *    submission until every acknowledgement has arrived;
+ *  - times how long the chain takes to canonize the last of them;
+ *  - submits TXN_SIZE_PROBES single transactions, each waited for until it
+ *    is canonized, to time commit latency on an otherwise idle chain;
+ *  - reads back the block holding the last probe to report its size.
+ *
+ * Each size is reported as cost per transaction and cost per byte. A least
+ * squares fit of submit time per transaction against certificate size then
+ * splits the cost into a fixed part per transaction and a part per byte.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <errno.h>
+#include <helpers/agentd_session.h>
+#include <helpers/cert_helpers.h>
+#include <helpers/chain_block.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <helpers/submit_window.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+#define SWEEP_MAX_SIZES 32
+#define SWEEP_MAX_PAYLOAD (16 * 1024 * 1024)
+
+/**
+ * \brief Shared benchmark state.
+ */
+typedef struct sweep_context sweep_context;
+
+struct sweep_context
+{
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t* suite;
+    vccert_builder_options_t* builder_opts;
+    vccert_parser_options_t* parser_opts;
+    agentd_session* session;
+    const rcpr_uuid* client_id;
+    const vccrypt_buffer_t* client_sign_priv;
+    uint8_t* payload;
+    size_t txns;
+    size_t window;
+    size_t probes;
+    vpr_uuid* txn_ids;
+    vpr_uuid* artifact_ids;
+    vccrypt_buffer_t* certs;
+};
+
+/**
+ * \brief The measurements for one payload size.
+ */
+typedef struct sweep_point sweep_point;
+
+struct sweep_point
+{
+    size_t payload_size;
+    size_t cert_size;
+    uint64_t build_ns;
+    uint64_t submit_ns;
+    uint64_t canonize_ns;
+    latency_histogram commit;
+    size_t block_size;
+    size_t block_txns;
+};
+
+/* forward decls. */
+static size_t parse_sizes(size_t* sizes);
+static status run_size(sweep_context* ctx, sweep_point* point);
+static status build_certs(sweep_context* ctx, sweep_point* point);
+static void dispose_certs(sweep_context* ctx);
+static status probe_commit(sweep_context* ctx, sweep_point* point);
+static void print_point(const sweep_point* point, size_t txns);
+static void print_fit(const sweep_point* points, size_t count, size_t txns);
+
+/**
+ * \brief Main entry point for the transaction size sweep.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t parser_opts;
+    file file;
+    agentd_session session;
+    sweep_context ctx;
+    size_t sizes[SWEEP_MAX_SIZES];
+    sweep_point points[SWEEP_MAX_SIZES];
+    size_t size_count = parse_sizes(sizes);
+    size_t max_size = 0;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.txns = env_get_size("TXN_PER_SIZE", 50);
+    ctx.window = env_get_size("TXN_SIZE_WINDOW", 8);
+    ctx.probes = env_get_size("TXN_SIZE_PROBES", 3);
+    if (0 == size_count || 0 == ctx.txns || 0 == ctx.window
+     || 0 == ctx.probes)
+    {
+        fprintf(stderr, "Bad transaction size sweep configuration.\n");
+        return ERROR_TXN_SIZE_SWEEP_CONFIGURATION;
+    }
+
+    for (size_t i = 0; i < size_count; ++i)
+    {
+        if (sizes[i] > max_size)
+        {
+            max_size = sizes[i];
+        }
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* initialize parser options. */
+    retval =
+        vccert_parser_options_simple_init(&parser_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate parser.\n");
+        retval = ERROR_CERTIFICATE_PARSER_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_parser_opts;
+    }
+
+    /* connect to agentd. */
+    retval =
+        agentd_session_init(
+            &session, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    ctx.alloc = alloc;
+    ctx.suite = &suite;
+    ctx.builder_opts = &builder_opts;
+    ctx.parser_opts = &parser_opts;
+    ctx.session = &session;
+
+    retval = vcblockchain_entity_get_artifact_id(&ctx.client_id, session.cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_session;
+    }
+
+    retval =
+        vcblockchain_entity_private_cert_get_private_signing_key(
+            &ctx.client_sign_priv, session.cert);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_session;
+    }
+
+    /* the payload bytes don't matter; a pattern is easy to spot in dumps. */
+    ctx.payload = malloc(max_size + 1);
+    ctx.txn_ids = calloc(ctx.txns, sizeof(vpr_uuid));
+    ctx.artifact_ids = calloc(ctx.txns, sizeof(vpr_uuid));
+    ctx.certs = calloc(ctx.txns, sizeof(vccrypt_buffer_t));
+    if (NULL == ctx.payload || NULL == ctx.txn_ids || NULL == ctx.artifact_ids
+     || NULL == ctx.certs)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        retval = ERROR_TXN_SIZE_SWEEP_OUT_OF_MEMORY;
+        goto cleanup_buffers;
+    }
+
+    for (size_t i = 0; i < max_size; ++i)
+    {
+        ctx.payload[i] = (uint8_t)('a' + i % 26);
+    }
+
+    printf(
+        "%zu transactions per size, window %zu, %zu commit probes\n",
+        ctx.txns, ctx.window, ctx.probes);
+    printf(
+        "%10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n", "payload",
+        "cert", "build us", "submit us", "txns/s", "MB/s", "ns/byte",
+        "canon ms", "commit ms", "block");
+
+    retval = STATUS_SUCCESS;
+    for (size_t i = 0; STATUS_SUCCESS == retval && i < size_count; ++i)
+    {
+        memset(&points[i], 0, sizeof(points[i]));
+        points[i].payload_size = sizes[i];
+
+        retval = run_size(&ctx, &points[i]);
+        if (STATUS_SUCCESS == retval)
+        {
+            print_point(&points[i], ctx.txns);
+        }
+        else
+        {
+            fprintf(
+                stderr, "Payload size %zu failed (%x).\n", sizes[i], retval);
+            size_count = i;
+        }
+    }
+
+    print_fit(points, size_count, ctx.txns);
+
+cleanup_buffers:
+    free(ctx.payload);
+    free(ctx.txn_ids);
+    free(ctx.artifact_ids);
+    free(ctx.certs);
+
+cleanup_session:
+    release_retval =
+        send_and_verify_close_connection(
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_parser_opts:
+    dispose((disposable_t*)&parser_opts);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Parse the comma separated list of payload sizes in TXN_SIZES.
+ *
+ * \param sizes         Array of SWEEP_MAX_SIZES entries to receive the list.
+ *
+ * \returns the number of sizes parsed, or 0 if the list is invalid.
+ */
+static size_t parse_sizes(size_t* sizes)
+{
+    const char* str =
+        env_get_string("TXN_SIZES", "16,256,4096,65536,262144,1048576");
+    char* endptr;
+    size_t count = 0;
+
+    while ('\0' != *str)
+    {
+        errno = 0;
+        sizes[count] = (size_t)strtoumax(str, &endptr, 10);
+        if (0 != errno || endptr == str || sizes[count] > SWEEP_MAX_PAYLOAD
+         || (',' != *endptr && '\0' != *endptr)
+         || ++count == SWEEP_MAX_SIZES)
+        {
+            fprintf(stderr, "Bad TXN_SIZES value.\n");
+            return 0;
+        }
+
+        str = (',' == *endptr) ? endptr + 1 : endptr;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Measure one payload size.
+ *
+ * \param ctx           The benchmark context.
+ * \param point         The point to fill; its payload_size is set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_size(sweep_context* ctx, sweep_point* point)
+{
+    status retval, release_retval;
+    submit_window* win;
+    submit_window_stats stats;
+    uint64_t start;
+
+    retval = build_certs(ctx, point);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        submit_window_create(
+            &win, ctx->alloc, ctx->suite, ctx->session, ctx->window, NULL,
+            NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_certs;
+    }
+
+    start = latency_clock_now_ns();
+    for (size_t i = 0; i < ctx->txns; ++i)
+    {
+        retval =
+            submit_window_submit(
+                win, &ctx->txn_ids[i], &ctx->artifact_ids[i], &ctx->certs[i],
+                NULL);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_window;
+        }
+    }
+
+    retval = submit_window_drain(win);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_window;
+    }
+
+    point->submit_ns = latency_clock_now_ns() - start;
+    submit_window_take_stats(win, &stats);
+    if (0 != stats.rejected)
+    {
+        fprintf(
+            stderr, "%" PRIu64 " transactions of payload size %zu were "
+            "rejected.\n", stats.rejected, point->payload_size);
+        retval = ERROR_TXN_SIZE_SWEEP_REJECTED;
+        goto cleanup_window;
+    }
+
+    /* time from the last acknowledgement until the batch is on the chain. */
+    start = latency_clock_now_ns();
+    retval =
+        chain_wait_for_transaction(
+            ctx->session, ctx->alloc, ctx->suite,
+            &ctx->txn_ids[ctx->txns - 1], 1, 60000, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_window;
+    }
+
+    point->canonize_ns = latency_clock_now_ns() - start;
+
+    retval = probe_commit(ctx, point);
+
+cleanup_window:
+    release_retval = submit_window_release(win);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_certs:
+    dispose_certs(ctx);
+
+    return retval;
+}
+
+/**
+ * \brief Build the certificates for one payload size.
+ *
+ * \param ctx           The benchmark context.
+ * \param point         The point; its build time and certificate size are
+ *                      set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status build_certs(sweep_context* ctx, sweep_point* point)
+{
+    status retval;
+    uint64_t start = latency_clock_now_ns();
+
+    for (size_t i = 0; i < ctx->txns; ++i)
+    {
+        retval =
+            create_transaction_cert_with_payload(
+                &ctx->certs[i], (rcpr_uuid*)&ctx->txn_ids[i],
+                (rcpr_uuid*)&ctx->artifact_ids[i], ctx->builder_opts,
+                ctx->client_id, ctx->client_sign_priv, ctx->payload,
+                point->payload_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error creating transaction certificate.\n");
+            dispose_certs(ctx);
+            return ERROR_TRANSACTION_CERT_CREATE;
+        }
+    }
+
+    point->build_ns = latency_clock_now_ns() - start;
+    point->cert_size = ctx->certs[0].size;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the certificates built for one payload size.
+ *
+ * \param ctx           The benchmark context.
+ */
+static void dispose_certs(sweep_context* ctx)
+{
+    for (size_t i = 0; i < ctx->txns; ++i)
+    {
+        if (NULL != ctx->certs[i].data)
+        {
+            dispose((disposable_t*)&ctx->certs[i]);
+            memset(&ctx->certs[i], 0, sizeof(ctx->certs[i]));
+        }
+    }
+}
+
+/**
+ * \brief Time single transactions from submission until canonization, then
+ * read back the block holding the last one.
+ *
+ * \param ctx           The benchmark context.
+ * \param point         The point; its commit latency and block size are set.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status probe_commit(sweep_context* ctx, sweep_point* point)
+{
+    status retval;
+    agentd_session* session = ctx->session;
+    vccrypt_buffer_t cert;
+    vpr_uuid txn_id, artifact_id;
+    chain_block block;
+    uint64_t start;
+
+    memset(&block, 0, sizeof(block));
+    latency_histogram_init(&point->commit);
+
+    for (size_t i = 0; i < ctx->probes; ++i)
+    {
+        retval =
+            create_transaction_cert_with_payload(
+                &cert, (rcpr_uuid*)&txn_id, (rcpr_uuid*)&artifact_id,
+                ctx->builder_opts, ctx->client_id, ctx->client_sign_priv,
+                ctx->payload, point->payload_size);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error creating transaction certificate.\n");
+            return ERROR_TRANSACTION_CERT_CREATE;
+        }
+
+        start = latency_clock_now_ns();
+        retval =
+            submit_and_verify_txn(
+                session->sock, ctx->alloc, ctx->suite, &session->client_iv,
+                &session->server_iv, &session->shared_secret, &txn_id,
+                &artifact_id, &cert);
+        dispose((disposable_t*)&cert);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            chain_wait_for_transaction(
+                session, ctx->alloc, ctx->suite, &txn_id, 1, 60000,
+                &block.block_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        latency_histogram_record(
+            &point->commit, latency_clock_now_ns() - start);
+    }
+
+    retval =
+        get_and_verify_block(
+            session->sock, ctx->alloc, ctx->suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &block.block_id,
+            &block.cert, &block.prev_id, &block.next_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = chain_block_parse(&block, ctx->alloc, ctx->parser_opts);
+    if (STATUS_SUCCESS == retval)
+    {
+        point->block_size = block.cert.size;
+        point->block_txns = block.txn_count;
+    }
+
+    chain_block_dispose(&block, ctx->alloc);
+
+    return retval;
+}
+
+/**
+ * \brief Print the measurements for one payload size.
+ *
+ * \param point         The point to print.
+ * \param txns          The number of transactions submitted per size.
+ */
+static void print_point(const sweep_point* point, size_t txns)
+{
+    double submit_s = point->submit_ns / 1e9;
+    double bytes = (double)point->cert_size * txns;
+
+    printf(
+        "%10zu %10zu %10.1f %10.1f %10.0f %10.2f %10.2f %10.1f %10.1f "
+        "%6zu/%-3zu\n",
+        point->payload_size, point->cert_size,
+        point->build_ns / 1e3 / txns, point->submit_ns / 1e3 / txns,
+        txns / submit_s, bytes / submit_s / 1e6, point->submit_ns / bytes,
+        point->canonize_ns / 1e6,
+        latency_histogram_percentile(&point->commit, 50.0) / 1e6,
+        point->block_size, point->block_txns);
+}
+
+/**
+ * \brief Fit submit time per transaction against certificate size, and print
+ * the fixed and per byte costs.
+ *
+ * \param points        The measured points.
+ * \param count         The number of points.
+ * \param txns          The number of transactions submitted per size.
+ */
+static void print_fit(const sweep_point* points, size_t count, size_t txns)
+{
+    double sx = 0, sy = 0, sxx = 0, sxy = 0, x, y, denom, slope, intercept;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        x = points[i].cert_size;
+        y = (double)points[i].submit_ns / txns;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+
+    denom = count * sxx - sx * sx;
+    if (count < 2 || 0 == denom)
+    {
+        printf("need at least two distinct sizes to split the cost.\n");
+        return;
+    }
+
+    slope = (count * sxy - sx * sy) / denom;
+    intercept = (sy - slope * sx) / count;
+
+    printf(
+        "submit cost: %.1f us per transaction + %.3f ns per byte\n",
+        intercept / 1e3, slope);
+}
@@ -0,0 +1,605 @@
+/**
+ * \file uuid_match_bench/main.c
+ *
+ * \brief Main entry point for the UUID match benchmark.
+ *
+ * This benchmark decodes one block into flat columns of transaction IDs and
+ * artifact IDs, then matches many candidate UUIDs against them. Half of the
+ * candidates are in the block and half are not, so that both early exits
+ * and full scans are measured.
+ *
+ * The baseline is the loop used by find_transaction_in_block, which compares
+ * one entry at a time with crypto_memcmp. It is compared against the scalar,
+ * SSE2 and AVX2 column kernels, whichever this CPU supports. Transaction and
+ * artifact IDs are public, so the kernels don't need to be constant time.
+ *
+ * Two workloads are measured: finding the first match of each candidate
+ * transaction ID, and counting the transactions of each candidate artifact.
+ * Every implementation must agree with the baseline.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <helpers/agentd_session.h>
+#include <helpers/chain_block.h>
+#include <helpers/chain_seed.h>
+#include <helpers/conn_helpers.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <helpers/uuid_column.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The columns of a decoded block and the candidates to match.
+ */
+typedef struct bench_columns bench_columns;
+
+struct bench_columns
+{
+    size_t rows;
+    uint8_t* txn_ids;
+    uint8_t* artifact_ids;
+    size_t candidate_count;
+    uint8_t* txn_candidates;
+    uint8_t* artifact_candidates;
+    size_t* expected;
+    size_t* actual;
+    size_t rounds;
+};
+
+/* forward decls. */
+static status decode_block(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts,
+    vccert_parser_options_t* parser_opts, bench_columns* cols);
+static void make_candidates(
+    uint8_t* candidates, const uint8_t* column, size_t rows, size_t count);
+static size_t baseline_find(
+    const uint8_t* column, size_t rows, const uint8_t* id);
+static size_t baseline_count(
+    const uint8_t* column, size_t rows, const uint8_t* id);
+static status run_find(bench_columns* cols);
+static status run_count(bench_columns* cols);
+static void print_result(
+    const char* name, uint64_t elapsed_ns, uint64_t baseline_ns,
+    const bench_columns* cols);
+
+/**
+ * \brief Main entry point for the UUID match benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    vccrypt_suite_options_t suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t parser_opts;
+    file file;
+    agentd_session session;
+    bench_columns cols;
+
+    memset(&cols, 0, sizeof(cols));
+    cols.candidate_count = env_get_size("UUID_CANDIDATES", 1024);
+    cols.rounds = env_get_size("UUID_ROUNDS", 20);
+    if (0 == cols.candidate_count || 0 == cols.rounds)
+    {
+        fprintf(stderr, "Bad UUID match benchmark configuration.\n");
+        return ERROR_UUID_MATCH_BENCH_CONFIGURATION;
+    }
+
+    /* register the velo v1 suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    /* initialize the vccrypt suite. */
+    retval =
+        vccrypt_suite_options_init(&suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing crypto suite.\n");
+        retval = ERROR_CRYPTO_SUITE_INIT;
+        goto cleanup_rcpr_allocator;
+    }
+
+    /* initialize certificate builder options. */
+    retval = vccert_builder_options_init(&builder_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate builder.\n");
+        retval = ERROR_CERTIFICATE_BUILDER_INIT;
+        goto cleanup_crypto_suite;
+    }
+
+    /* initialize parser options. */
+    retval =
+        vccert_parser_options_simple_init(&parser_opts, &alloc_opts, &suite);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error initializing certificate parser.\n");
+        retval = ERROR_CERTIFICATE_PARSER_INIT;
+        goto cleanup_builder_opts;
+    }
+
+    /* create OS level file abstraction. */
+    retval = file_init(&file);
+    if (VCTOOL_STATUS_SUCCESS != retval)
+    {
+        fprintf(stderr, "Error creating file abstraction layer.\n");
+        retval = ERROR_FILE_ABSTRACTION_INIT;
+        goto cleanup_parser_opts;
+    }
+
+    /* connect to agentd. */
+    retval =
+        agentd_session_init(
+            &session, alloc, &file, &suite, "127.0.0.1", 4931, "test.priv",
+            "agentd.pub");
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_file;
+    }
+
+    retval =
+        decode_block(
+            &session, alloc, &suite, &builder_opts, &parser_opts, &cols);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_columns;
+    }
+
+    printf(
+        "matching %zu candidates x %zu rounds against a block of %zu "
+        "transactions\n", cols.candidate_count, cols.rounds, cols.rows);
+
+    retval = run_find(&cols);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = run_count(&cols);
+    }
+
+cleanup_columns:
+    free(cols.txn_ids);
+    free(cols.artifact_ids);
+    free(cols.txn_candidates);
+    free(cols.artifact_candidates);
+    free(cols.expected);
+    free(cols.actual);
+
+    release_retval =
+        send_and_verify_close_connection(
+            session.sock, alloc, &suite, &session.client_iv,
+            &session.server_iv, &session.shared_secret);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    release_retval = agentd_session_dispose(&session);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_file:
+    dispose((disposable_t*)&file);
+
+cleanup_parser_opts:
+    dispose((disposable_t*)&parser_opts);
+
+cleanup_builder_opts:
+    dispose((disposable_t*)&builder_opts);
+
+cleanup_crypto_suite:
+    dispose((disposable_t*)&suite);
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Seed a block, then decode it into ID columns and build the
+ * candidates.
+ *
+ * UUID_BLOCK_TXNS transactions are submitted and waited for, so that they
+ * land in one block.
+ *
+ * \param session       The session.
+ * \param alloc         The allocator to use for this operation.
+ * \param suite         The crypto suite to use for this operation.
+ * \param builder_opts  The certificate builder options to use.
+ * \param parser_opts   The parser options to use.
+ * \param cols          The columns to fill.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status decode_block(
+    agentd_session* session, rcpr_allocator* alloc,
+    vccrypt_suite_options_t* suite, vccert_builder_options_t* builder_opts,
+    vccert_parser_options_t* parser_opts, bench_columns* cols)
+{
+    status retval;
+    size_t seed = env_get_size("UUID_BLOCK_TXNS", 500);
+    vpr_uuid* txn_ids;
+    chain_block block;
+    chain_block_txn_info info;
+
+    if (0 == seed)
+    {
+        fprintf(stderr, "Bad UUID match benchmark configuration.\n");
+        return ERROR_UUID_MATCH_BENCH_CONFIGURATION;
+    }
+
+    retval =
+        rcpr_allocator_allocate(
+            alloc, (void**)&txn_ids, seed * sizeof(vpr_uuid));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(&block, 0, sizeof(block));
+
+    retval =
+        chain_seed_transactions(
+            session, alloc, suite, builder_opts, seed, txn_ids, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_txn_ids;
+    }
+
+    retval =
+        chain_wait_for_transaction(
+            session, alloc, suite, &txn_ids[seed - 1], 10, 30000,
+            &block.block_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_txn_ids;
+    }
+
+    /* decode the block holding the last transaction. */
+    retval =
+        get_and_verify_block(
+            session->sock, alloc, suite, &session->client_iv,
+            &session->server_iv, &session->shared_secret, &block.block_id,
+            &block.cert, &block.prev_id, &block.next_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_txn_ids;
+    }
+
+    retval = chain_block_parse(&block, alloc, parser_opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_block;
+    }
+
+    cols->rows = block.txn_count;
+    cols->txn_ids = malloc(cols->rows * UUID_COLUMN_ENTRY_SIZE + 1);
+    cols->artifact_ids = malloc(cols->rows * UUID_COLUMN_ENTRY_SIZE + 1);
+    cols->txn_candidates =
+        malloc(cols->candidate_count * UUID_COLUMN_ENTRY_SIZE);
+    cols->artifact_candidates =
+        malloc(cols->candidate_count * UUID_COLUMN_ENTRY_SIZE);
+    cols->expected = malloc(cols->candidate_count * sizeof(size_t));
+    cols->actual = malloc(cols->candidate_count * sizeof(size_t));
+    if (NULL == cols->txn_ids || NULL == cols->artifact_ids
+     || NULL == cols->txn_candidates || NULL == cols->artifact_candidates
+     || NULL == cols->expected || NULL == cols->actual)
+    {
+        retval = ERROR_UUID_MATCH_BENCH_OUT_OF_MEMORY;
+        goto cleanup_block;
+    }
+
+    for (size_t i = 0; i < block.txn_count; ++i)
+    {
+        retval =
+            chain_block_verify_txn(
+                &info, &block.txns[i], parser_opts, suite);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_block;
+        }
+
+        memcpy(
+            cols->txn_ids + i * UUID_COLUMN_ENTRY_SIZE, info.txn_id.data,
+            UUID_COLUMN_ENTRY_SIZE);
+        memcpy(
+            cols->artifact_ids + i * UUID_COLUMN_ENTRY_SIZE,
+            info.artifact_id.data, UUID_COLUMN_ENTRY_SIZE);
+    }
+
+    make_candidates(
+        cols->txn_candidates, cols->txn_ids, cols->rows,
+        cols->candidate_count);
+    make_candidates(
+        cols->artifact_candidates, cols->artifact_ids, cols->rows,
+        cols->candidate_count);
+
+    retval = STATUS_SUCCESS;
+
+cleanup_block:
+    chain_block_dispose(&block, alloc);
+
+cleanup_txn_ids:
+    (void)rcpr_allocator_reclaim(alloc, txn_ids);
+
+    return retval;
+}
+
+/**
+ * \brief Build candidates: even ones are taken from the column, odd ones are
+ * random and almost certainly absent.
+ *
+ * \param candidates    The candidate column to fill.
+ * \param column        The column to draw from.
+ * \param rows          The number of entries in the column.
+ * \param count         The number of candidates.
+ */
+static void make_candidates(
+    uint8_t* candidates, const uint8_t* column, size_t rows, size_t count)
+{
+    uint8_t* candidate;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        candidate = candidates + i * UUID_COLUMN_ENTRY_SIZE;
+
+        if (0 == i % 2 && rows > 0)
+        {
+            memcpy(
+                candidate,
+                column + ((size_t)rand() % rows) * UUID_COLUMN_ENTRY_SIZE,
+                UUID_COLUMN_ENTRY_SIZE);
+        }
+        else
+        {
+            for (size_t b = 0; b < UUID_COLUMN_ENTRY_SIZE; ++b)
+            {
+                candidate[b] = (uint8_t)rand();
+            }
+        }
+    }
+}
+
+/**
+ * \brief The crypto_memcmp loop of find_transaction_in_block, over a column.
+ *
+ * \param column        The column.
+ * \param rows          The number of entries in the column.
+ * \param id            The UUID to find.
+ *
+ * \returns the index of the entry, or rows if there is none.
+ */
+static size_t baseline_find(
+    const uint8_t* column, size_t rows, const uint8_t* id)
+{
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if (!crypto_memcmp(
+                column + i * UUID_COLUMN_ENTRY_SIZE, id,
+                UUID_COLUMN_ENTRY_SIZE))
+        {
+            return i;
+        }
+    }
+
+    return rows;
+}
+
+/**
+ * \brief Count the entries of a column equal to a UUID with crypto_memcmp.
+ *
+ * \param column        The column.
+ * \param rows          The number of entries in the column.
+ * \param id            The UUID to count.
+ *
+ * \returns the number of equal entries.
+ */
+static size_t baseline_count(
+    const uint8_t* column, size_t rows, const uint8_t* id)
+{
+    size_t matches = 0;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        matches +=
+            !crypto_memcmp(
+                column + i * UUID_COLUMN_ENTRY_SIZE, id,
+                UUID_COLUMN_ENTRY_SIZE);
+    }
+
+    return matches;
+}
+
+/**
+ * \brief Time finding every candidate transaction ID with each
+ * implementation.
+ *
+ * \param cols          The columns and candidates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_find(bench_columns* cols)
+{
+    uint64_t start, baseline_ns;
+    const uint8_t* candidate;
+
+    printf("find first match of each transaction id:\n");
+
+    start = latency_clock_now_ns();
+    for (size_t r = 0; r < cols->rounds; ++r)
+    {
+        for (size_t i = 0; i < cols->candidate_count; ++i)
+        {
+            candidate = cols->txn_candidates + i * UUID_COLUMN_ENTRY_SIZE;
+            cols->expected[i] =
+                baseline_find(cols->txn_ids, cols->rows, candidate);
+        }
+    }
+
+    baseline_ns = latency_clock_now_ns() - start;
+    print_result("crypto_memcmp", baseline_ns, baseline_ns, cols);
+
+    for (int impl = 0; impl < UUID_COLUMN_IMPL_COUNT; ++impl)
+    {
+        if (!uuid_column_impl_supported((uuid_column_impl)impl))
+        {
+            printf(
+                "  %-14s not supported on this CPU\n",
+                uuid_column_impl_name((uuid_column_impl)impl));
+            continue;
+        }
+
+        start = latency_clock_now_ns();
+        for (size_t r = 0; r < cols->rounds; ++r)
+        {
+            (void)uuid_column_find_many(
+                (uuid_column_impl)impl, cols->txn_ids, cols->rows,
+                cols->txn_candidates, cols->candidate_count, cols->actual);
+        }
+
+        print_result(
+            uuid_column_impl_name((uuid_column_impl)impl),
+            latency_clock_now_ns() - start, baseline_ns, cols);
+
+        if (memcmp(
+                cols->expected, cols->actual,
+                cols->candidate_count * sizeof(size_t)))
+        {
+            fprintf(
+                stderr, "%s disagrees with crypto_memcmp.\n",
+                uuid_column_impl_name((uuid_column_impl)impl));
+            return ERROR_UUID_MATCH_BENCH_MISMATCH;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Time counting the transactions of every candidate artifact with
+ * each implementation.
+ *
+ * \param cols          The columns and candidates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_count(bench_columns* cols)
+{
+    uint64_t start, baseline_ns;
+    const uint8_t* candidate;
+
+    printf("count transactions of each artifact:\n");
+
+    start = latency_clock_now_ns();
+    for (size_t r = 0; r < cols->rounds; ++r)
+    {
+        for (size_t i = 0; i < cols->candidate_count; ++i)
+        {
+            candidate =
+                cols->artifact_candidates + i * UUID_COLUMN_ENTRY_SIZE;
+            cols->expected[i] =
+                baseline_count(cols->artifact_ids, cols->rows, candidate);
+        }
+    }
+
+    baseline_ns = latency_clock_now_ns() - start;
+    print_result("crypto_memcmp", baseline_ns, baseline_ns, cols);
+
+    for (int impl = 0; impl < UUID_COLUMN_IMPL_COUNT; ++impl)
+    {
+        if (!uuid_column_impl_supported((uuid_column_impl)impl))
+        {
+            continue;
+        }
+
+        start = latency_clock_now_ns();
+        for (size_t r = 0; r < cols->rounds; ++r)
+        {
+            (void)uuid_column_count_many(
+                (uuid_column_impl)impl, cols->artifact_ids, cols->rows,
+                cols->artifact_candidates, cols->candidate_count,
+                cols->actual);
+        }
+
+        print_result(
+            uuid_column_impl_name((uuid_column_impl)impl),
+            latency_clock_now_ns() - start, baseline_ns, cols);
+
+        if (memcmp(
+                cols->expected, cols->actual,
+                cols->candidate_count * sizeof(size_t)))
+        {
+            fprintf(
+                stderr, "%s disagrees with crypto_memcmp.\n",
+                uuid_column_impl_name((uuid_column_impl)impl));
+            return ERROR_UUID_MATCH_BENCH_MISMATCH;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Print the cost of one implementation.
+ *
+ * \param name          The name of the implementation.
+ * \param elapsed_ns    The time taken for every round.
+ * \param baseline_ns   The time taken by the baseline.
+ * \param cols          The columns and candidates.
+ */
+static void print_result(
+    const char* name, uint64_t elapsed_ns, uint64_t baseline_ns,
+    const bench_columns* cols)
+{
+    double lookups = (double)cols->candidate_count * cols->rounds;
+
+    printf(
+        "  %-14s %10.1f ns/candidate %12.0f candidates/s %6.2fx\n", name,
+        elapsed_ns / lookups, elapsed_ns > 0 ? lookups * 1e9 / elapsed_ns : 0,
+        elapsed_ns > 0 ? (double)baseline_ns / elapsed_ns : 0.0);
+}
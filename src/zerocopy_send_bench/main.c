@@ -0,0 +1,569 @@
+/**
+ * \file zerocopy_send_bench/main.c
+ *
+ * \brief Main entry point for the zero-copy send benchmark.
+ *
+ * This benchmark streams frames of each size in ZEROCOPY_SIZES, given in
+ * megabytes, to a sink over TCP, once with the normal send path and once
+ * through a zero-copy sender. Each frame is written in full before it is
+ * sent, as the encryption of a real frame writes it, so both paths pay the
+ * same cost apart from the send itself. In the zero-copy path, frames come
+ * from a small ring that the sender's release callback refills, so a frame
+ * is only rewritten once the kernel is done with it.
+ *
+ * For each size and path it reports throughput and the CPU time the sending
+ * thread spent per megabyte, and for the zero-copy path, the share of frames
+ * the kernel copied anyway. Roughly ZEROCOPY_BYTES megabytes are sent per
+ * run, with at least ZEROCOPY_MIN_FRAMES frames.
+ *
+ * By default the sink is a thread of this process reading from a loopback
+ * connection. Loopback traffic is always copied by the kernel, so for
+ * meaningful zero-copy numbers, point ZEROCOPY_SINK_HOST and
+ * ZEROCOPY_SINK_PORT at a discard service on another host.
+ *
+ * \copyright 2026 Velo Payments.  See License.txt for license terms.
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <helpers/env_helpers.h>
+#include <helpers/latency_histogram.h>
+#include <helpers/status_codes.h>
+#include <helpers/zerocopy_sender.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/parameters.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The read size of the local sink.
+ */
+#define BENCH_SINK_BUFFER_SIZE (1024 * 1024)
+
+/**
+ * \brief The largest number of sizes in ZEROCOPY_SIZES.
+ */
+#define BENCH_MAX_SIZES 16
+
+/**
+ * \brief A ring of frames, refilled by the sender's release callback.
+ */
+typedef struct bench_ring bench_ring;
+
+struct bench_ring
+{
+    void** frames;
+    size_t capacity;
+    size_t count;
+};
+
+/**
+ * \brief The results of one run.
+ */
+typedef struct bench_result bench_result;
+
+struct bench_result
+{
+    uint64_t elapsed_ns;
+    uint64_t cpu_ns;
+    zerocopy_sender_stats stats;
+};
+
+/* forward decls. */
+static size_t parse_sizes(const char* list, size_t* sizes);
+static status start_local_sink(
+    int* listener, unsigned int* port, pthread_t* thread);
+static void* sink_main(void* context);
+static status connect_sink(
+    int* descriptor, const char* host, unsigned int port);
+static status run_frames(
+    rcpr_allocator* alloc, const char* host, unsigned int port, size_t size,
+    size_t frames, size_t pending, bool zerocopy, bench_result* result);
+static void release_frame(void* context, void* frame);
+static uint64_t thread_cpu_ns(void);
+static void print_result(
+    size_t size, const char* path, const bench_result* result,
+    const bench_result* base, size_t frames);
+
+/**
+ * \brief Main entry point for the zero-copy send benchmark.
+ *
+ * \param argc      The number of arguments.
+ * \param argv      Arguments to main.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+    status retval, release_retval;
+    allocator_options_t alloc_opts;
+    rcpr_allocator* alloc;
+    pthread_t sink_thread;
+    int listener = -1;
+    bench_result copy, zerocopy;
+    size_t sizes[BENCH_MAX_SIZES], size_count, size, frames;
+    const char* sink_host = env_get_string("ZEROCOPY_SINK_HOST", "");
+    unsigned int sink_port =
+        (unsigned int)env_get_size("ZEROCOPY_SINK_PORT", 9);
+    size_t total_mb = env_get_size("ZEROCOPY_BYTES", 1024);
+    size_t min_frames = env_get_size("ZEROCOPY_MIN_FRAMES", 8);
+    size_t pending = env_get_size("ZEROCOPY_PENDING", 4);
+
+    size_count =
+        parse_sizes(env_get_string("ZEROCOPY_SIZES", "1,4,16,64"), sizes);
+    if (0 == size_count || 0 == total_mb || 0 == min_frames || 0 == pending
+     || sink_port > 65535)
+    {
+        fprintf(stderr, "Bad zero-copy send benchmark configuration.\n");
+        return ERROR_ZEROCOPY_SEND_BENCH_CONFIGURATION;
+    }
+
+    /* initialize the allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the RCPR allocator. */
+    retval = rcpr_malloc_allocator_create(&alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_allocator;
+    }
+
+    if (0 == strlen(sink_host))
+    {
+        retval = start_local_sink(&listener, &sink_port, &sink_thread);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_rcpr_allocator;
+        }
+
+        sink_host = "127.0.0.1";
+    }
+
+    printf(
+        "sink %s:%u, about %zu MB per run, %zu frames in flight\n",
+        sink_host, sink_port, total_mb, pending);
+    printf(
+        "%8s %-9s %8s %10s %10s %9s %9s\n", "size", "path", "frames", "MB/s",
+        "cpu us/MB", "copied", "cpu gain");
+
+    for (size_t i = 0; i < size_count; ++i)
+    {
+        size = sizes[i];
+        frames = (total_mb * 1024 * 1024) / size;
+        if (frames < min_frames)
+        {
+            frames = min_frames;
+        }
+
+        retval =
+            run_frames(
+                alloc, sink_host, sink_port, size, frames, pending, false,
+                &copy);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_sink;
+        }
+
+        retval =
+            run_frames(
+                alloc, sink_host, sink_port, size, frames, pending, true,
+                &zerocopy);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_sink;
+        }
+
+        print_result(size, "copy", &copy, &copy, frames);
+        print_result(size, "zerocopy", &zerocopy, &copy, frames);
+        if (!zerocopy.stats.enabled)
+        {
+            printf("%8s SO_ZEROCOPY is not supported on this socket.\n", "");
+        }
+    }
+
+cleanup_sink:
+    if (listener >= 0)
+    {
+        /* shutting the listener down makes the sink's accept fail. */
+        shutdown(listener, SHUT_RDWR);
+        pthread_join(sink_thread, NULL);
+        close(listener);
+    }
+
+cleanup_rcpr_allocator:
+    release_retval = resource_release(rcpr_allocator_resource_handle(alloc));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
+
+/**
+ * \brief Parse a comma separated list of sizes in megabytes.
+ *
+ * \param list          The list.
+ * \param sizes         Array of BENCH_MAX_SIZES entries to receive the sizes
+ *                      in bytes.
+ *
+ * \returns the number of sizes, or zero if the list is invalid.
+ */
+static size_t parse_sizes(const char* list, size_t* sizes)
+{
+    size_t count = 0;
+    const char* p = list;
+    char* end;
+    unsigned long long mb;
+
+    while (0 != *p)
+    {
+        errno = 0;
+        mb = strtoull(p, &end, 10);
+        if (0 != errno || end == p || 0 == mb || mb > 4096
+         || count == BENCH_MAX_SIZES)
+        {
+            return 0;
+        }
+
+        sizes[count++] = (size_t)mb * 1024 * 1024;
+        p = (',' == *end) ? end + 1 : end;
+        if (p == end && 0 != *p)
+        {
+            return 0;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * \brief Start a sink thread reading from a loopback listener.
+ *
+ * \param listener      Pointer to receive the listening socket.
+ * \param port          Pointer to receive the port it listens on.
+ * \param thread        Pointer to receive the sink thread.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SEND_BENCH_SOCKET on failure.
+ */
+static status start_local_sink(
+    int* listener, unsigned int* port, pthread_t* thread)
+{
+    struct sockaddr_in addr;
+    socklen_t addr_len = sizeof(addr);
+
+    *listener = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (*listener < 0)
+    {
+        fprintf(stderr, "Error creating sink socket.\n");
+        return ERROR_ZEROCOPY_SEND_BENCH_SOCKET;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (0 != bind(*listener, (struct sockaddr*)&addr, sizeof(addr))
+     || 0 != listen(*listener, 1)
+     || 0 != getsockname(*listener, (struct sockaddr*)&addr, &addr_len))
+    {
+        fprintf(stderr, "Error starting sink listener.\n");
+        goto fail;
+    }
+
+    *port = ntohs(addr.sin_port);
+
+    if (0 != pthread_create(thread, NULL, &sink_main, listener))
+    {
+        fprintf(stderr, "Error starting sink thread.\n");
+        goto fail;
+    }
+
+    return STATUS_SUCCESS;
+
+fail:
+    close(*listener);
+    *listener = -1;
+
+    return ERROR_ZEROCOPY_SEND_BENCH_SOCKET;
+}
+
+/**
+ * \brief Accept connections one at a time and discard everything read from
+ * them, until accept fails.
+ *
+ * \param context       Pointer to the listening socket.
+ *
+ * \returns NULL.
+ */
+static void* sink_main(void* context)
+{
+    int listener = *(int*)context;
+    int descriptor;
+    uint8_t* buffer;
+    ssize_t received;
+
+    buffer = malloc(BENCH_SINK_BUFFER_SIZE);
+    if (NULL == buffer)
+    {
+        return NULL;
+    }
+
+    while ((descriptor = accept(listener, NULL, NULL)) >= 0)
+    {
+        do
+        {
+            received = read(descriptor, buffer, BENCH_SINK_BUFFER_SIZE);
+        } while (received > 0 || (received < 0 && EINTR == errno));
+
+        close(descriptor);
+    }
+
+    free(buffer);
+
+    return NULL;
+}
+
+/**
+ * \brief Connect to the sink.
+ *
+ * \param descriptor    Pointer to receive the connected socket.
+ * \param host          The sink IPv4 address.
+ * \param port          The sink port.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_ZEROCOPY_SEND_BENCH_SOCKET on failure.
+ */
+static status connect_sink(
+    int* descriptor, const char* host, unsigned int port)
+{
+    struct sockaddr_in addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    if (1 != inet_pton(AF_INET, host, &addr.sin_addr))
+    {
+        fprintf(stderr, "Bad sink address %s.\n", host);
+        return ERROR_ZEROCOPY_SEND_BENCH_SOCKET;
+    }
+
+    *descriptor = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (*descriptor < 0
+     || 0 != connect(*descriptor, (struct sockaddr*)&addr, sizeof(addr)))
+    {
+        fprintf(stderr, "Error connecting to sink %s:%u.\n", host, port);
+        if (*descriptor >= 0)
+        {
+            close(*descriptor);
+        }
+        return ERROR_ZEROCOPY_SEND_BENCH_SOCKET;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write and send frames of one size along one path.
+ *
+ * Each run gets its own connection, since the kernel numbers zero-copy sends
+ * per socket and a sender must see every one of them. One frame is sent
+ * first, untimed, so that both paths start with their buffers faulted in.
+ *
+ * \param alloc         The allocator for frames and the sender.
+ * \param host          The sink address.
+ * \param port          The sink port.
+ * \param size          The frame size.
+ * \param frames        The number of frames.
+ * \param pending       The number of frames that may be in flight.
+ * \param zerocopy      Whether to send with MSG_ZEROCOPY.
+ * \param result        The result to populate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status run_frames(
+    rcpr_allocator* alloc, const char* host, unsigned int port, size_t size,
+    size_t frames, size_t pending, bool zerocopy, bench_result* result)
+{
+    status retval, release_retval;
+    int descriptor;
+    zerocopy_sender_options opts;
+    zerocopy_sender* sender;
+    bench_ring ring;
+    void* frame;
+    uint64_t start = 0, cpu_start = 0;
+
+    memset(result, 0, sizeof(*result));
+
+    /* one spare frame is written while the others are in flight. */
+    ring.capacity = pending + 1;
+    ring.count = 0;
+    ring.frames = calloc(ring.capacity, sizeof(void*));
+    if (NULL == ring.frames)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return ERROR_ZEROCOPY_SEND_BENCH_OUT_OF_MEMORY;
+    }
+
+    retval = connect_sink(&descriptor, host, port);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_ring;
+    }
+
+    for (; ring.count < ring.capacity; ++ring.count)
+    {
+        retval =
+            rcpr_allocator_allocate(
+                alloc, &ring.frames[ring.count], size);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Out of memory.\n");
+            retval = ERROR_ZEROCOPY_SEND_BENCH_OUT_OF_MEMORY;
+            goto cleanup_descriptor;
+        }
+    }
+
+    /* the normal path sends everything at or above an unreachable size. */
+    zerocopy_sender_options_init(&opts);
+    opts.min_size = zerocopy ? size : SIZE_MAX;
+    opts.max_pending = pending;
+    opts.release = &release_frame;
+    opts.context = &ring;
+
+    retval = zerocopy_sender_create(&sender, alloc, descriptor, &opts);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_descriptor;
+    }
+
+    for (size_t i = 0; i <= frames; ++i)
+    {
+        if (1 == i)
+        {
+            start = latency_clock_now_ns();
+            cpu_start = thread_cpu_ns();
+        }
+
+        /* with at most pending frames in flight, a spare is always free. */
+        frame = ring.frames[--ring.count];
+        memset(frame, (int)(i & 0xff), size);
+
+        retval = zerocopy_sender_send(sender, frame, size);
+        if (STATUS_SUCCESS != retval)
+        {
+            fprintf(stderr, "Error sending frame %zu.\n", i);
+            goto cleanup_sender;
+        }
+    }
+
+    retval = zerocopy_sender_reap(sender, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_sender;
+    }
+
+    result->elapsed_ns = latency_clock_now_ns() - start;
+    result->cpu_ns = thread_cpu_ns() - cpu_start;
+    zerocopy_sender_get_stats(sender, &result->stats);
+
+cleanup_sender:
+    release_retval = zerocopy_sender_release(sender);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_descriptor:
+    close(descriptor);
+
+cleanup_ring:
+    for (size_t i = 0; i < ring.count; ++i)
+    {
+        rcpr_allocator_reclaim(alloc, ring.frames[i]);
+    }
+    free(ring.frames);
+
+    return retval;
+}
+
+/**
+ * \brief Return a frame the kernel is done with to the ring.
+ *
+ * \param context       The ring.
+ * \param frame         The frame.
+ */
+static void release_frame(void* context, void* frame)
+{
+    bench_ring* ring = (bench_ring*)context;
+
+    ring->frames[ring->count++] = frame;
+}
+
+/**
+ * \brief Get the CPU time used by the calling thread.
+ *
+ * \returns the CPU time in nanoseconds.
+ */
+static uint64_t thread_cpu_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * \brief Print the results of one run.
+ *
+ * \param size          The frame size.
+ * \param path          The send path name.
+ * \param result        The results of this run.
+ * \param base          The results of the normal path for this size.
+ * \param frames        The number of timed frames.
+ */
+static void print_result(
+    size_t size, const char* path, const bench_result* result,
+    const bench_result* base, size_t frames)
+{
+    double mb = (double)size * frames / (1024 * 1024);
+    char copied[16];
+
+    if (result->stats.zerocopy_frames > 0)
+    {
+        snprintf(
+            copied, sizeof(copied), "%.0f%%",
+            100.0 * result->stats.copied_frames
+                / result->stats.zerocopy_frames);
+    }
+    else
+    {
+        snprintf(copied, sizeof(copied), "-");
+    }
+
+    printf(
+        "%6zuMB %-9s %8zu %10.0f %10.1f %9s %8.2fx\n",
+        size / (1024 * 1024), path, frames,
+        mb / (result->elapsed_ns / 1e9), result->cpu_ns / 1e3 / mb, copied,
+        (double)base->cpu_ns / result->cpu_ns);
+}
@@ -131,6 +131,9 @@ cp $build_dir/src/submit_multiple_txns/submit_multiple_txns .
 #run the test
 ./submit_multiple_txns
 
+#run the test again, pipelining submissions through the adaptive window
+SUBMIT_ADAPTIVE=1 ./submit_multiple_txns
+
 #get the agentd supervisor pid
 agentd_supervisor_pid=$(ps -ef | grep agentd | grep -v grep | grep supervisor | awk '{ print $2 }')
 if [ "$agentd_supervisor_pid" == "" ]; then
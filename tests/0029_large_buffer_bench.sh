@@ -0,0 +1,17 @@
+#!/bin/sh
+
+testdir=$INTEGRATION_TEST_DIR/$(basename $0 .sh)
+
+set -e
+
+build_dir=$(pwd)
+
+#the large buffer benchmark needs no agentd instance
+mkdir -p $testdir
+cd $testdir
+
+#copy the large buffer benchmark binary here
+cp $build_dir/src/large_buffer_bench/large_buffer_bench .
+
+#run the benchmark
+LARGE_BUFFER_SIZE=5000000 LARGE_BUFFER_ROUNDS=100 ./large_buffer_bench
@@ -0,0 +1,17 @@
+#!/bin/sh
+
+testdir=$INTEGRATION_TEST_DIR/$(basename $0 .sh)
+
+set -e
+
+build_dir=$(pwd)
+
+#the zero-copy send benchmark runs its own sink and needs no agentd instance
+mkdir -p $testdir
+cd $testdir
+
+#copy the zero-copy send benchmark binary here
+cp $build_dir/src/zerocopy_send_bench/zerocopy_send_bench .
+
+#run the benchmark
+ZEROCOPY_SIZES=1,4 ZEROCOPY_BYTES=64 ./zerocopy_send_bench